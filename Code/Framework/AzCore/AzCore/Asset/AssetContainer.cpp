@@ -10,11 +10,49 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ::Data
 {
+    AZ_CVAR(uint32_t, cl_assetLoadDependencyDeadlineMs, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When non-zero, asset containers order the streaming of dependencies by giving assets that preloads are waiting on earlier "
+        "deadlines.  This is the deadline in milliseconds used for assets whose handler doesn't set a default deadline.");
+    AZ_CVAR(bool, cl_assetLoadReportReadyTimes, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Print the time until each asset in an asset container was ready once the container finishes loading.");
+
+    namespace AssetContainerInternal
+    {
+        // Returns the number of levels of preloads waiting on the asset, or 0 if no asset needs to wait for it to preload.
+        int GetPreloadHeight(const AssetId& assetId, const PreloadAssetListType& preloadWaitList, AZStd::unordered_map<AssetId, int>& heights)
+        {
+            // Assets that are already being evaluated are part of a preload cycle, which is reported in SetupPreloadLists
+            if (auto heightIter = heights.find(assetId); heightIter != heights.end())
+            {
+                return heightIter->second;
+            }
+            heights.emplace(assetId, 0);
+
+            int height = 0;
+            if (auto waitingIter = preloadWaitList.find(assetId); waitingIter != preloadWaitList.end())
+            {
+                for (const AssetId& waitingAssetId : waitingIter->second)
+                {
+                    // Assets are in their own wait list as a marker for their own data load
+                    if (waitingAssetId != assetId)
+                    {
+                        height = AZStd::max(height, GetPreloadHeight(waitingAssetId, preloadWaitList, heights) + 1);
+                    }
+                }
+            }
+            heights[assetId] = height;
+            return height;
+        }
+    }
+
     AssetContainer::AssetContainer(Asset<AssetData> rootAsset, const AssetLoadParameters& loadParams, bool isReload)
     {
+        m_loadStartTime = AZStd::chrono::steady_clock::now();
         m_rootAsset = AssetInternal::WeakAsset<AssetData>(rootAsset);
         m_containerAssetId = m_rootAsset.GetId();
         m_isReload = isReload;
@@ -55,13 +93,37 @@ namespace AZ::Data
             dependencyAssets.emplace_back(thisInfo, AZStd::move(dependentAsset));
         }
 
+        if (!m_dependencyDeadlines.empty())
+        {
+            // Queue the assets with the earliest deadlines first so their reads are at the front of the streaming queue.
+            auto getDeadline = [this](const AssetId& assetId)
+            {
+                auto deadlineIter = m_dependencyDeadlines.find(assetId);
+                return deadlineIter != m_dependencyDeadlines.end() ? deadlineIter->second : AZ::IO::IStreamerTypes::s_noDeadline;
+            };
+            AZStd::stable_sort(dependencyAssets.begin(), dependencyAssets.end(),
+                [&getDeadline](const auto& lhs, const auto& rhs)
+                {
+                    return getDeadline(lhs.first.m_assetId) < getDeadline(rhs.first.m_assetId);
+                });
+        }
+
         // Queue the loading of all of the dependent assets before loading the root asset.
         for (auto& [dependentAssetInfo, dependentAsset] : dependencyAssets)
         {
+            const AssetLoadParameters* dependentLoadParams = &loadParamsCopyWithNoLoadingFilter;
+            AssetLoadParameters loadParamsWithDeadline;
+            if (auto deadlineIter = m_dependencyDeadlines.find(dependentAsset.GetId()); deadlineIter != m_dependencyDeadlines.end())
+            {
+                loadParamsWithDeadline = loadParamsCopyWithNoLoadingFilter;
+                loadParamsWithDeadline.m_deadline = deadlineIter->second;
+                dependentLoadParams = &loadParamsWithDeadline;
+            }
+
             // Queue each asset to load.
             auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
                 dependentAsset.GetId(), dependentAsset.GetType(),
-                AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
+                AZ::Data::AssetLoadBehavior::Default, *dependentLoadParams,
                 dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
 
             // Verify that the returned asset reference matches the one that we found or created and queued to load.
@@ -167,6 +229,7 @@ namespace AZ::Data
         // Add waiting assets ahead of time to hear signals for any which may already be loading
         AddWaitingAssets(waitingList);
         SetupPreloadLists(move(preloadDependencies), rootAssetId);
+        AssignDependencyDeadlines(dependencyInfoList, loadParams);
 
         auto loadParamsCopyWithNoLoadingFilter = loadParams;
 
@@ -393,7 +456,7 @@ namespace AZ::Data
         if (m_initComplete)
         {
             RemoveFromAllWaitingPreloads(asset->GetId());
-            RemoveWaitingAsset(asset->GetId());
+            RemoveWaitingAsset(asset->GetId(), asset->IsReady());
         }
     }
 
@@ -521,7 +584,7 @@ namespace AZ::Data
         }
     }
 
-    void AssetContainer::RemoveWaitingAsset(const AssetId& thisAsset)
+    void AssetContainer::RemoveWaitingAsset(const AssetId& thisAsset, bool loadSucceeded)
     {
         bool allReady{ false };
         {
@@ -534,7 +597,11 @@ namespace AZ::Data
                 {
                     m_waitingCount -= 1;
                     disconnectEbus = true;
-
+                    if (loadSucceeded)
+                    {
+                        m_assetReadyTimes.emplace_back(thisAsset,
+                            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - m_loadStartTime));
+                    }
                 }
                 if (m_waitingAssets.empty())
                 {
@@ -557,6 +624,10 @@ namespace AZ::Data
         if (allReady && m_initComplete && !m_finalNotificationSent)
         {
             m_finalNotificationSent = true;
+            if (cl_assetLoadReportReadyTimes)
+            {
+                ReportReadyTimes();
+            }
             if (m_rootAsset)
             {
                 AssetManagerBus::Broadcast(&AssetManagerBus::Events::OnAssetContainerReady, this);
@@ -674,6 +745,81 @@ namespace AZ::Data
         }
     }
 
+    void AssetContainer::AssignDependencyDeadlines(const AZStd::vector<AssetInfo>& dependencyInfoList, const AssetLoadParameters& loadParams)
+    {
+        const uint32_t defaultDeadlineMs = cl_assetLoadDependencyDeadlineMs;
+        if (defaultDeadlineMs == 0 || dependencyInfoList.empty())
+        {
+            return;
+        }
+
+        AZStd::unordered_map<AssetId, int> preloadHeights;
+        int maxPreloadHeight = 0;
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
+            for (const AssetInfo& dependencyInfo : dependencyInfoList)
+            {
+                maxPreloadHeight = AZStd::max(maxPreloadHeight,
+                    AssetContainerInternal::GetPreloadHeight(dependencyInfo.m_assetId, m_preloadWaitList, preloadHeights));
+            }
+        }
+
+        for (const AssetInfo& dependencyInfo : dependencyInfoList)
+        {
+            AZ::IO::IStreamerTypes::Deadline deadline = AZ::IO::IStreamerTypes::s_noDeadline;
+            if (loadParams.m_deadline)
+            {
+                deadline = loadParams.m_deadline.value();
+            }
+            else if (AssetHandler* handler = AssetManager::Instance().GetHandler(dependencyInfo.m_assetType))
+            {
+                AZ::IO::IStreamerTypes::Priority priority;
+                handler->GetDefaultAssetLoadPriority(dependencyInfo.m_assetType, deadline, priority);
+            }
+            if (deadline == AZ::IO::IStreamerTypes::s_noDeadline)
+            {
+                deadline = AZStd::chrono::milliseconds(defaultDeadlineMs);
+            }
+
+            // Assets that deeper chains of preloads are waiting on need to finish first, so they get a proportionally earlier deadline.
+            const int preloadHeight = preloadHeights[dependencyInfo.m_assetId];
+            m_dependencyDeadlines[dependencyInfo.m_assetId] = deadline * (maxPreloadHeight + 1 - preloadHeight) / (maxPreloadHeight + 1);
+        }
+    }
+
+    void AssetContainer::ReportReadyTimes() const
+    {
+        ReadyTimeList readyTimes = GetAssetReadyTimes();
+        if (readyTimes.empty())
+        {
+            return;
+        }
+
+        AZ_TracePrintf("AssetContainer", "Container for asset %s: %zu assets ready, first after %.2f ms, last after %.2f ms\n",
+            m_containerAssetId.ToString<AZStd::string>().c_str(), readyTimes.size(),
+            readyTimes.front().second.count() / 1000.0, readyTimes.back().second.count() / 1000.0);
+
+        AZStd::lock_guard<AZStd::recursive_mutex> dependenciesGuard(m_dependencyMutex);
+        for (const auto& [assetId, readyTime] : readyTimes)
+        {
+            auto dependencyIter = m_dependencies.find(assetId);
+            AZ_TracePrintf("AssetContainer", "    %.2f ms %s %s\n", readyTime.count() / 1000.0, assetId.ToString<AZStd::string>().c_str(),
+                dependencyIter != m_dependencies.end() ? dependencyIter->second.GetHint().c_str() : "");
+        }
+    }
+
+    AssetContainer::ReadyTimeList AssetContainer::GetAssetReadyTimes() const
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_readyMutex);
+        return m_assetReadyTimes;
+    }
+
+    AZ::IO::IStreamerTypes::Deadline AssetContainer::GetDependencyDeadline(const AssetId& assetId) const
+    {
+        auto deadlineIter = m_dependencyDeadlines.find(assetId);
+        return deadlineIter != m_dependencyDeadlines.end() ? deadlineIter->second : AZ::IO::IStreamerTypes::s_noDeadline;
+    }
+
     bool AssetContainer::HasPreloads(const AssetId& assetId) const
     {
         AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
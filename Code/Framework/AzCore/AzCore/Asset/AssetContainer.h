@@ -13,6 +13,7 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/set.h>
 
@@ -66,6 +67,15 @@ namespace AZ
             void ListWaitingAssets() const;
             void ListWaitingPreloads(const AZ::Data::AssetId& assetId) const;
 
+            // Time from the creation of the container until each asset stopped being waited on, in the order the assets became
+            // ready.  This is the time to first use for the asset when it's loaded through this container.
+            using ReadyTimeList = AZStd::vector<AZStd::pair<AZ::Data::AssetId, AZStd::chrono::microseconds>>;
+            ReadyTimeList GetAssetReadyTimes() const;
+
+            // Streaming deadline the dependency was queued with, see cl_assetLoadDependencyDeadlineMs.  Returns s_noDeadline for
+            // assets that were queued without one.
+            AZ::IO::IStreamerTypes::Deadline GetDependencyDeadline(const AZ::Data::AssetId& assetId) const;
+
             // Default behavior is to store dependencies flagged as "NoLoad" AutoLoadBehavior
             // These can be kicked off with a LoadDependency request
 
@@ -88,7 +98,8 @@ namespace AZ
             // All of its preload dependencies have been loaded, when it signals OnAssetReady
             void AddWaitingAsset(const AZ::Data::AssetId& waitingAsset);
             void AddWaitingAssets(const AZStd::vector<AZ::Data::AssetId>& waitingAssets);
-            void RemoveWaitingAsset(const AZ::Data::AssetId& waitingAsset);
+            // loadSucceeded is set when the asset is being removed because it became ready, only those assets get a ready time
+            void RemoveWaitingAsset(const AZ::Data::AssetId& waitingAsset, bool loadSucceeded = false);
             void ClearWaitingAssets();
 
             // Internal check to validate ready status at the end of initialization
@@ -109,6 +120,14 @@ namespace AZ
             void SetupPreloadLists(PreloadAssetListType&& preloadList, const AZ::Data::AssetId& rootAssetId);
             bool HasPreloads(const AZ::Data::AssetId& assetId) const;
 
+            // When cl_assetLoadDependencyDeadlineMs is set, gives every dependency a streaming deadline based on how many levels of
+            // preloads are waiting on it, so the reads for the whole dependency graph can be queued at once and still complete
+            // bottom up.  Must be called after SetupPreloadLists.
+            void AssignDependencyDeadlines(const AZStd::vector<AssetInfo>& dependencyInfoList, const AssetLoadParameters& loadParams);
+
+            // Prints the ready times of all assets in the container, see cl_assetLoadReportReadyTimes
+            void ReportReadyTimes() const;
+
             // Remove a specific id from the list an asset is waiting for and complete the load if everything is ready
             void RemoveFromWaitingPreloads(const AZ::Data::AssetId& waitingId, const AZ::Data::AssetId& preloadAssetId);
             // Iterate over the list that was waiting for this asset and remove it from each
@@ -145,6 +164,12 @@ namespace AZ
 
             // AssetId -> List of assets waiting on it
             PreloadAssetListType m_preloadWaitList;
+
+            // Streaming deadlines for dependencies, only filled in when ordering by deadline is enabled
+            AZStd::unordered_map<AssetId, AZ::IO::IStreamerTypes::Deadline> m_dependencyDeadlines;
+
+            AZStd::chrono::steady_clock::time_point m_loadStartTime;
+            ReadyTimeList m_assetReadyTimes; // Guarded by m_readyMutex
         private:
             AssetContainer operator=(const AssetContainer& copyContainer) = delete;
             AssetContainer operator=(const AssetContainer&& copyContainer) = delete;
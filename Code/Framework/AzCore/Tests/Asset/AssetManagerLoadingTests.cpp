@@ -1720,6 +1720,74 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_AssetWithQueueAndPreLoadReferencesThreeLevels_ReadyTimesFollowPreloads)
+#else
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_AssetWithQueueAndPreLoadReferencesThreeLevels_ReadyTimesFollowPreloads)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+
+        // Give the dependency reads a deadline so they're ordered by how many levels of preloads are waiting on them
+        AZ::Console console;
+        AZ::Interface<AZ::IConsole>::Register(&console);
+        console.LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        console.PerformCommand("cl_assetLoadDependencyDeadlineMs 1000");
+        {
+            ContainerReadyListener readyListener(PreloadAssetRootId);
+
+            auto asset = m_testAssetManager->FindOrCreateAsset(PreloadAssetRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(), AZ::Data::AssetLoadBehavior::Default);
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset);
+
+            auto maxTimeout = AZStd::chrono::steady_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::steady_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+
+            // Every asset in the container, including the root, gets a ready time
+            AssetContainer::ReadyTimeList readyTimes = containerReady->GetAssetReadyTimes();
+            EXPECT_EQ(readyTimes.size(), 7);
+
+            auto getReadyTime = [&readyTimes](const AssetId& assetId)
+            {
+                auto readyTimeIter = AZStd::find_if(readyTimes.begin(), readyTimes.end(),
+                    [&assetId](const auto& readyTime) { return readyTime.first == assetId; });
+                EXPECT_NE(readyTimeIter, readyTimes.end());
+                return readyTimeIter != readyTimes.end() ? readyTimeIter->second : AZStd::chrono::microseconds::max();
+            };
+
+            // Assets can't be ready before the assets they preload
+            EXPECT_GE(getReadyTime(PreloadAssetRootId), getReadyTime(PreloadAssetAId));
+            EXPECT_GE(getReadyTime(PreloadAssetAId), getReadyTime(PreloadAssetBId));
+            EXPECT_GE(getReadyTime(QueueLoadAssetAId), getReadyTime(PreloadAssetCId));
+
+            // PreloadB is waited on by PreloadA, which is waited on by the root, so it has the earliest deadline.  Queue loads have
+            // nothing waiting on them and keep the full deadline.
+            EXPECT_LT(containerReady->GetDependencyDeadline(PreloadAssetBId), containerReady->GetDependencyDeadline(PreloadAssetAId));
+            EXPECT_LT(containerReady->GetDependencyDeadline(PreloadAssetAId), containerReady->GetDependencyDeadline(QueueLoadAssetBId));
+            EXPECT_LT(containerReady->GetDependencyDeadline(PreloadAssetCId), containerReady->GetDependencyDeadline(QueueLoadAssetAId));
+            EXPECT_EQ(containerReady->GetDependencyDeadline(PreloadAssetAId), containerReady->GetDependencyDeadline(PreloadAssetCId));
+            EXPECT_EQ(containerReady->GetDependencyDeadline(QueueLoadAssetAId), AZStd::chrono::milliseconds(1000));
+            EXPECT_EQ(containerReady->GetDependencyDeadline(QueueLoadAssetCId), AZStd::chrono::milliseconds(1000));
+        }
+        console.PerformCommand("cl_assetLoadDependencyDeadlineMs 0");
+        AZ::Interface<AZ::IConsole>::Unregister(&console);
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
     // If our preload list contains assets we can't load we should catch the errors and load what we can
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_RootHasBrokenPreloads_LoadsRoot)
@@ -1764,6 +1832,11 @@ namespace UnitTest
             EXPECT_EQ(preLoadNoDataListener.m_dataLoaded, 0);
             EXPECT_EQ(preLoadNoHandlerListener.m_ready, 0);
             EXPECT_EQ(preLoadNoHandlerListener.m_dataLoaded, 0);
+
+            // Only the root loaded, the broken preloads don't get a ready time
+            AssetContainer::ReadyTimeList readyTimes = containerReady->GetAssetReadyTimes();
+            ASSERT_EQ(readyTimes.size(), 1);
+            EXPECT_EQ(readyTimes[0].first, AssetId(PreloadBrokenDepBId));
         }
 
         CheckFinishedCreationsAndDestructions();
@@ -151,6 +151,22 @@ namespace AZ::IO::ZipDir
             }
         }
         m_treeDir.Clear();
+        m_flatIndex.reset();
+        m_treeFromFlatIndexBuilt = false;
+    }
+
+    FileEntryTree* Cache::GetRoot()
+    {
+        if (m_flatIndex && !m_treeFromFlatIndexBuilt.load(AZStd::memory_order_acquire))
+        {
+            AZStd::scoped_lock lock(m_treeFromFlatIndexMutex);
+            if (!m_treeFromFlatIndexBuilt.load(AZStd::memory_order_relaxed))
+            {
+                m_flatIndex->AddToTree(m_treeDir);
+                m_treeFromFlatIndexBuilt.store(true, AZStd::memory_order_release);
+            }
+        }
+        return &m_treeDir;
     }
 
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
@@ -735,6 +751,15 @@ namespace AZ::IO::ZipDir
     {
         AZ::IO::PathView szPath{ szPathSrc };
 
+        if (FileEntry* fileEntry = nullptr; m_flatIndex && m_flatIndex->FindFile(szPath, fileEntry))
+        {
+            if (!fileEntry && az_archive_zip_directory_cache_verbosity)
+            {
+                AZ_TracePrintf("Archive", "Flat index lookup failed to find file %.*s at root %s", AZ_STRING_ARG(szPath.Native()), GetFilePath());
+            }
+            return fileEntry;
+        }
+
         ZipDir::FindFile fd(GetRoot());
         FileEntry* fileEntry = fd.FindExact(szPath);
         if (!fileEntry)
@@ -19,8 +19,11 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipDirFlatIndex.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 
@@ -93,7 +96,7 @@ namespace AZ::IO::ZipDir
         // QUICK check to determine whether the file entry belongs to this object
         bool IsOwnerOf(const FileEntry* pFileEntry) const
         {
-            return m_treeDir.IsOwnerOf(pFileEntry);
+            return (m_flatIndex && m_flatIndex->IsOwnerOf(pFileEntry)) || m_treeDir.IsOwnerOf(pFileEntry);
         }
 
         // returns the string - path to the zip file from which this object was constructed.
@@ -103,10 +106,8 @@ namespace AZ::IO::ZipDir
             return m_strFilePath;
         }
 
-        FileEntryTree* GetRoot()
-        {
-            return &m_treeDir;
-        }
+        // when files are looked up through a flat index, the tree is only built the first time it's requested
+        FileEntryTree* GetRoot();
 
         // writes the CDR to the disk
         bool WriteCDR() { return WriteCDR(m_fileHandle); }
@@ -131,6 +132,11 @@ namespace AZ::IO::ZipDir
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
         FileEntryTree m_treeDir;
+
+        // read only caches may use a flat index for file lookups instead of the tree, see az_archive_zip_flat_index
+        AZStd::unique_ptr<FlatIndex> m_flatIndex;
+        AZStd::mutex m_treeFromFlatIndexMutex;
+        AZStd::atomic_bool m_treeFromFlatIndexBuilt{ false };
         AZ::IO::HandleType m_fileHandle = AZ::IO::InvalidHandle;
         AZ::IO::Path m_strFilePath;
 
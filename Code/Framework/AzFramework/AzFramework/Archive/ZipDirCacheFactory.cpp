@@ -16,6 +16,7 @@
 #include <AzFramework/Archive/ZipDirTree.h>
 #include <AzFramework/Archive/ZipDirCache.h>
 #include <AzFramework/Archive/ZipDirCacheFactory.h>
+#include <AzFramework/Archive/ZipDirFlatIndex.h>
 #include <AzFramework/Archive/ZipDirList.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
@@ -24,6 +25,12 @@
 #include <locale>
 #include <cinttypes>
 
+AZ_CVAR(bool, az_archive_zip_flat_index, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "When set, archives opened for reading look up files through a flat sorted index instead of the directory tree.");
+AZ_CVAR(bool, az_archive_zip_flat_index_persist, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "When set, the flat index of an archive is saved next to it and loaded the next time the archive is opened,"
+    " which avoids reading the local header of every file in the archive.");
+
 namespace AZ::IO::ZipDir
 {
     // this sets the window size of the blocks of data read from the end of the file to find the Central Directory Record
@@ -34,6 +41,7 @@ namespace AZ::IO::ZipDir
         m_nCDREndPos = 0;
         m_bBuildFileEntryMap = false; // we only need it for validation/debugging
         m_bBuildFileEntryTree = true; // we need it to actually build the optimized structure of directories
+        m_bBuildFlatIndex = false;
         m_bBuildOptimizedFileEntry = false;
         m_nInitMethod = nInitMethod;
         m_nFlags = nFlags;
@@ -152,19 +160,28 @@ namespace AZ::IO::ZipDir
 
     bool CacheFactory::ReadCache(Cache& rwCache)
     {
+        // archives that are never written to can use the flat index, the tree is then only built if it's needed
+        m_bBuildFlatIndex = az_archive_zip_flat_index && (m_nFlags & FLAGS_READ_ONLY) && m_nInitMethod == InitMethod::Default;
         m_bBuildFileEntryTree = true;
         if (!Prepare())
         {
             return false;
         }
 
-        // since it's open for R/W, we need to know exactly how much space
-        // we have for each file to use the gaps efficiently
-        FileEntryList Adjuster(&m_treeFileEntries, m_CDREnd.lCDROffset);
-        Adjuster.RefreshEOFOffsets();
+        if (m_flatIndex)
+        {
+            rwCache.m_flatIndex = AZStd::move(m_flatIndex);
+        }
+        else
+        {
+            // since it's open for R/W, we need to know exactly how much space
+            // we have for each file to use the gaps efficiently
+            FileEntryList Adjuster(&m_treeFileEntries, m_CDREnd.lCDROffset);
+            Adjuster.RefreshEOFOffsets();
 
-        m_treeFileEntries.Swap(rwCache.m_treeDir);
-        m_CDR_buffer.swap(rwCache.m_CDR_buffer);   // CDR Buffer contain actually the string pool for the tree directory.
+            m_treeFileEntries.Swap(rwCache.m_treeDir);
+            m_CDR_buffer.swap(rwCache.m_CDR_buffer);   // CDR Buffer contain actually the string pool for the tree directory.
+        }
 
         // very important: we need this offset to be able to add to the zip file
         rwCache.m_lCDROffset = m_CDREnd.lCDROffset;
@@ -313,6 +330,8 @@ namespace AZ::IO::ZipDir
         memset(&m_CDREnd, 0, sizeof(m_CDREnd));
         m_mapFileEntries.clear();
         m_treeFileEntries.Clear();
+        m_flatIndexEntries.clear();
+        m_flatIndex.reset();
         m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
     }
 
@@ -471,6 +490,25 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
+        // the CRC has to be calculated before parsing, as parsing modifies the buffer
+        uint32_t cdrCrc = 0;
+        AZ::IO::Path flatIndexPath;
+        const bool persistFlatIndex = m_bBuildFlatIndex && az_archive_zip_flat_index_persist && !(m_nFlags & FLAGS_READ_INSIDE_PAK);
+        if (m_bBuildFlatIndex)
+        {
+            cdrCrc = static_cast<uint32_t>(crc32(0, pBuffer.data(), m_CDREnd.lCDRSize));
+            if (persistFlatIndex)
+            {
+                flatIndexPath = FlatIndex::GetIndexPath(m_szFilename);
+                m_flatIndex = FlatIndex::Load(m_fileExt.m_fileIOBase, flatIndexPath.c_str(), cdrCrc);
+                if (m_flatIndex)
+                {
+                    // the index holds everything that would have been read out of the central directory
+                    return true;
+                }
+            }
+        }
+
         // now we've read the complete CDR - parse it.
         ZipFile::CDRFileHeader* pFile = (ZipFile::CDRFileHeader*)(&pBuffer[0]);
         const uint8_t* pEndOfData = &pBuffer[0] + m_CDREnd.lCDRSize;
@@ -537,6 +575,24 @@ namespace AZ::IO::ZipDir
             pFile = (ZipFile::CDRFileHeader*)pEndOfRecord;
         }
 
+        if (m_bBuildFlatIndex)
+        {
+            m_flatIndex = FlatIndex::Create(m_flatIndexEntries, cdrCrc);
+            if (!m_flatIndex)
+            {
+                // some paths in the archive can't be looked up through the index, fall back to the tree
+                for (const FlatIndex::SourceEntry& entry : m_flatIndexEntries)
+                {
+                    m_treeFileEntries.Add(AZ::IO::PathView(entry.first), entry.second);
+                }
+            }
+            else if (persistFlatIndex && !m_flatIndex->Save(m_fileExt.m_fileIOBase, flatIndexPath.c_str()))
+            {
+                AZ_Warning("Archive", false, R"(Failed to save the flat index of archive "%s" to "%s")", m_szFilename.c_str(), flatIndexPath.c_str());
+            }
+            m_flatIndexEntries.clear();
+        }
+
         // finished reading CDR
         return true;
     }
@@ -572,7 +628,12 @@ namespace AZ::IO::ZipDir
             m_mapFileEntries.emplace(strFilePath, fileEntry);
         }
 
-        if (m_bBuildFileEntryTree)
+        if (m_bBuildFlatIndex)
+        {
+            // the path points into the CDR buffer, which stays alive until the index is built
+            m_flatIndexEntries.emplace_back(strFilePath, fileEntry);
+        }
+        else if (m_bBuildFileEntryTree)
         {
             m_treeFileEntries.Add(strFilePath, fileEntry);
         }
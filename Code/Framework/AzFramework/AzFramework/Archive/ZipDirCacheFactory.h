@@ -13,6 +13,7 @@
 #pragma once
 
 #include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/ZipDirFlatIndex.h>
 
 namespace AZ::IO::ZipDir
 {
@@ -96,10 +97,15 @@ namespace AZ::IO::ZipDir
 
         FileEntryTree m_treeFileEntries;
 
+        // files collected for the flat index, and the index built from them or loaded from the index file
+        AZStd::vector<FlatIndex::SourceEntry> m_flatIndexEntries;
+        AZStd::unique_ptr<FlatIndex> m_flatIndex;
+
         AZStd::vector<uint8_t> m_CDR_buffer;
 
         bool m_bBuildFileEntryMap;
         bool m_bBuildFileEntryTree;
+        bool m_bBuildFlatIndex;
         bool m_bBuildOptimizedFileEntry;
         ZipFile::EHeaderEncryptionType m_encryptedHeaders;
         ZipFile::EHeaderSignatureType m_signedHeaders;
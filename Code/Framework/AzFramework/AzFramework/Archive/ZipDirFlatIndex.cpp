@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Archive/ZipDirFlatIndex.h>
+#include <AzFramework/Archive/ZipDirTree.h>
+
+namespace AZ::IO::ZipDir
+{
+    // the FileEntryTree compares paths the same way as AZ::IO::PathView, which ignores case on platforms using the windows separator
+    static constexpr bool CaseInsensitivePaths = AZ_TRAIT_OS_PATH_SEPARATOR == AZ::IO::WindowsPathSeparator;
+
+    static constexpr uint32_t IndexSignature = 0x3158445A; // "ZDX1"
+    static constexpr uint32_t IndexVersion = 1;
+
+    // All values are stored little endian, like the zip file format itself
+    struct FlatIndex::Header
+    {
+        uint32_t m_signature;
+        uint32_t m_version;
+        uint32_t m_cdrCrc;        // CRC of the central directory the index was built from
+        uint32_t m_fileCount;
+        uint32_t m_pathPoolSize;
+        uint32_t m_caseInsensitive; // the sort order depends on whether paths are compared case insensitively
+    };
+
+    struct FlatIndex::Record
+    {
+        uint32_t m_pathHash;
+        uint32_t m_pathOffset;    // offset of the path in the path pool
+        uint32_t m_pathLength;
+        uint32_t m_crc32;
+        uint32_t m_sizeCompressed;
+        uint32_t m_sizeUncompressed;
+        uint32_t m_fileDataOffset;
+        uint32_t m_fileHeaderOffset;
+        uint32_t m_eofOffset;
+        uint16_t m_method;
+        uint16_t m_lastModTime;
+        uint16_t m_lastModDate;
+        uint16_t m_reserved0;
+        uint32_t m_reserved1;
+        uint64_t m_ntfsLastModifyTime;
+    };
+
+    static char FoldCase(char c)
+    {
+        return (CaseInsensitivePaths && c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    static int ComparePaths(AZStd::string_view lhs, AZStd::string_view rhs)
+    {
+        const size_t count = AZStd::min(lhs.size(), rhs.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const unsigned char lhsChar = static_cast<unsigned char>(FoldCase(lhs[i]));
+            const unsigned char rhsChar = static_cast<unsigned char>(FoldCase(rhs[i]));
+            if (lhsChar != rhsChar)
+            {
+                return lhsChar < rhsChar ? -1 : 1;
+            }
+        }
+        return lhs.size() == rhs.size() ? 0 : (lhs.size() < rhs.size() ? -1 : 1);
+    }
+
+    static uint32_t HashPath(AZStd::string_view path)
+    {
+        return static_cast<uint32_t>(AZ::Crc32(path.data(), path.size(), CaseInsensitivePaths));
+    }
+
+    // joins the segments of the path with a posix separator, which matches how the FileEntryTree splits paths into directories
+    // returns false for paths the tree would look up differently, such as paths with a root
+    static bool NormalizePath(AZ::IO::PathView path, AZ::IO::FixedMaxPathString& normalizedPath)
+    {
+        normalizedPath.clear();
+        if (path.empty() || path.HasRootPath())
+        {
+            return false;
+        }
+
+        for (const AZ::IO::PathView segment : path)
+        {
+            const AZStd::string_view segmentString = segment.Native();
+            if (normalizedPath.size() + segmentString.size() + 1 > normalizedPath.max_size())
+            {
+                return false;
+            }
+            if (!normalizedPath.empty())
+            {
+                normalizedPath.push_back(AZ::IO::PosixPathSeparator);
+            }
+            normalizedPath.append(segmentString);
+        }
+        return true;
+    }
+
+    AZStd::unique_ptr<FlatIndex> FlatIndex::Create(AZStd::span<const SourceEntry> entries, uint32_t cdrCrc)
+    {
+        struct SortEntry
+        {
+            uint32_t m_pathHash;
+            uint32_t m_pathOffset;
+            uint32_t m_pathLength;
+            uint32_t m_sourceIndex;
+        };
+
+        AZStd::vector<char> pathPool;
+        AZStd::vector<SortEntry> sortEntries;
+        sortEntries.reserve(entries.size());
+        AZ::IO::FixedMaxPathString normalizedPath;
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (!NormalizePath(AZ::IO::PathView(entries[i].first), normalizedPath))
+            {
+                // the entry couldn't be found by a lookup, so the tree has to be used for this zip file
+                return {};
+            }
+            sortEntries.push_back({ HashPath(normalizedPath), aznumeric_cast<uint32_t>(pathPool.size()),
+                aznumeric_cast<uint32_t>(normalizedPath.size()), aznumeric_cast<uint32_t>(i) });
+            pathPool.insert(pathPool.end(), normalizedPath.begin(), normalizedPath.end());
+        }
+
+        auto getPath = [&pathPool](const SortEntry& entry)
+        {
+            return AZStd::string_view(pathPool.data() + entry.m_pathOffset, entry.m_pathLength);
+        };
+        AZStd::sort(sortEntries.begin(), sortEntries.end(), [&getPath](const SortEntry& lhs, const SortEntry& rhs)
+        {
+            if (lhs.m_pathHash != rhs.m_pathHash)
+            {
+                return lhs.m_pathHash < rhs.m_pathHash;
+            }
+            const int result = ComparePaths(getPath(lhs), getPath(rhs));
+            return result != 0 ? result < 0 : lhs.m_sourceIndex < rhs.m_sourceIndex;
+        });
+
+        // remove duplicated paths, keeping the entry that was added first like FileEntryTree::Add does
+        size_t uniqueCount = 0;
+        for (size_t i = 0; i < sortEntries.size(); ++i)
+        {
+            if (uniqueCount > 0 && sortEntries[uniqueCount - 1].m_pathHash == sortEntries[i].m_pathHash &&
+                ComparePaths(getPath(sortEntries[uniqueCount - 1]), getPath(sortEntries[i])) == 0)
+            {
+                continue;
+            }
+            sortEntries[uniqueCount++] = sortEntries[i];
+        }
+        sortEntries.resize(uniqueCount);
+
+        AZStd::unique_ptr<FlatIndex> index(aznew FlatIndex);
+        const size_t recordsSize = sizeof(Record) * sortEntries.size();
+        index->m_buffer.resize(sizeof(Header) + recordsSize + pathPool.size(), 0);
+
+        Header& header = *reinterpret_cast<Header*>(index->m_buffer.data());
+        header.m_signature = IndexSignature;
+        header.m_version = IndexVersion;
+        header.m_cdrCrc = cdrCrc;
+        header.m_fileCount = aznumeric_cast<uint32_t>(sortEntries.size());
+        header.m_pathPoolSize = aznumeric_cast<uint32_t>(pathPool.size());
+        header.m_caseInsensitive = CaseInsensitivePaths ? 1 : 0;
+
+        Record* records = reinterpret_cast<Record*>(index->m_buffer.data() + sizeof(Header));
+        for (size_t i = 0; i < sortEntries.size(); ++i)
+        {
+            const SortEntry& sortEntry = sortEntries[i];
+            const FileEntryBase& fileEntry = entries[sortEntry.m_sourceIndex].second;
+            Record& record = records[i];
+            record.m_pathHash = sortEntry.m_pathHash;
+            record.m_pathOffset = sortEntry.m_pathOffset;
+            record.m_pathLength = sortEntry.m_pathLength;
+            record.m_crc32 = fileEntry.desc.lCRC32;
+            record.m_sizeCompressed = fileEntry.desc.lSizeCompressed;
+            record.m_sizeUncompressed = fileEntry.desc.lSizeUncompressed;
+            record.m_fileDataOffset = fileEntry.nFileDataOffset;
+            record.m_fileHeaderOffset = fileEntry.nFileHeaderOffset;
+            record.m_eofOffset = fileEntry.nEOFOffset;
+            record.m_method = fileEntry.nMethod;
+            record.m_lastModTime = fileEntry.nLastModTime;
+            record.m_lastModDate = fileEntry.nLastModDate;
+            record.m_ntfsLastModifyTime = fileEntry.nNTFS_LastModifyTime;
+        }
+        if (!pathPool.empty())
+        {
+            memcpy(index->m_buffer.data() + sizeof(Header) + recordsSize, pathPool.data(), pathPool.size());
+        }
+
+        if (!index->InitFromBuffer(cdrCrc))
+        {
+            return {};
+        }
+        return index;
+    }
+
+    AZStd::unique_ptr<FlatIndex> FlatIndex::Load(AZ::IO::FileIOBase* fileIO, const char* indexPath, uint32_t cdrCrc)
+    {
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if (!fileIO || !fileIO->Open(indexPath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            return {};
+        }
+
+        AZStd::unique_ptr<FlatIndex> index(aznew FlatIndex);
+        AZ::u64 fileSize = 0;
+        bool readSucceeded = fileIO->Size(fileHandle, fileSize) && fileSize >= sizeof(Header) &&
+            fileSize <= AZStd::numeric_limits<uint32_t>::max();
+        if (readSucceeded)
+        {
+            index->m_buffer.resize_no_construct(fileSize);
+            readSucceeded = fileIO->Read(fileHandle, index->m_buffer.data(), fileSize, true);
+        }
+        fileIO->Close(fileHandle);
+
+        if (!readSucceeded || !index->InitFromBuffer(cdrCrc))
+        {
+            return {};
+        }
+        return index;
+    }
+
+    AZ::IO::Path FlatIndex::GetIndexPath(AZStd::string_view zipPath)
+    {
+        AZ::IO::Path indexPath(zipPath);
+        indexPath.Native() += IndexFileExtension;
+        return indexPath;
+    }
+
+    bool FlatIndex::Save(AZ::IO::FileIOBase* fileIO, const char* indexPath) const
+    {
+        // write to a temporary file first so a partially written index is never loaded
+        AZ::IO::Path tempPath(indexPath);
+        tempPath.Native() += ".tmp";
+
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(tempPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            return false;
+        }
+        const bool writeSucceeded = fileIO->Write(fileHandle, m_buffer.data(), m_buffer.size());
+        fileIO->Close(fileHandle);
+
+        if (writeSucceeded)
+        {
+            if (fileIO->Exists(indexPath))
+            {
+                fileIO->Remove(indexPath);
+            }
+            if (fileIO->Rename(tempPath.c_str(), indexPath))
+            {
+                return true;
+            }
+        }
+        fileIO->Remove(tempPath.c_str());
+        return false;
+    }
+
+    bool FlatIndex::FindFile(AZ::IO::PathView path, FileEntry*& fileEntry)
+    {
+        AZ::IO::FixedMaxPathString normalizedPath;
+        if (!NormalizePath(path, normalizedPath))
+        {
+            return false;
+        }
+
+        fileEntry = nullptr;
+        const uint32_t pathHash = HashPath(normalizedPath);
+        const Record* records = GetRecords();
+        const Record* recordsEnd = records + m_fileCount;
+        const Record* record = AZStd::lower_bound(records, recordsEnd, pathHash, [](const Record& lhs, uint32_t hash)
+        {
+            return lhs.m_pathHash < hash;
+        });
+        for (; record != recordsEnd && record->m_pathHash == pathHash; ++record)
+        {
+            if (ComparePaths(GetPath(*record), normalizedPath) == 0)
+            {
+                fileEntry = &m_fileEntries[record - records];
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool FlatIndex::IsOwnerOf(const FileEntry* pFileEntry) const
+    {
+        return m_fileCount > 0 && pFileEntry >= &m_fileEntries[0] && pFileEntry < &m_fileEntries[0] + m_fileCount;
+    }
+
+    uint32_t FlatIndex::NumFilesTotal() const
+    {
+        return m_fileCount;
+    }
+
+    void FlatIndex::AddToTree(FileEntryTree& tree) const
+    {
+        const Record* records = GetRecords();
+        for (uint32_t i = 0; i < m_fileCount; ++i)
+        {
+            tree.Add(AZ::IO::PathView(GetPath(records[i])), m_fileEntries[i]);
+        }
+    }
+
+    bool FlatIndex::InitFromBuffer(uint32_t cdrCrc)
+    {
+        static_assert(sizeof(Header) % alignof(Record) == 0, "Records following the header must be aligned");
+        static_assert(sizeof(Record) == 56, "The record layout is part of the index file format");
+
+        const Header& header = GetHeader();
+        if (header.m_signature != IndexSignature || header.m_version != IndexVersion || header.m_cdrCrc != cdrCrc ||
+            header.m_caseInsensitive != (CaseInsensitivePaths ? 1u : 0u))
+        {
+            return false;
+        }
+
+        if (m_buffer.size() != sizeof(Header) + sizeof(Record) * AZ::u64(header.m_fileCount) + header.m_pathPoolSize)
+        {
+            return false;
+        }
+
+        const Record* records = GetRecords();
+        for (uint32_t i = 0; i < header.m_fileCount; ++i)
+        {
+            if (AZ::u64(records[i].m_pathOffset) + records[i].m_pathLength > header.m_pathPoolSize)
+            {
+                return false;
+            }
+        }
+
+        m_fileCount = header.m_fileCount;
+        m_fileEntries = AZStd::make_unique<FileEntry[]>(m_fileCount);
+        for (uint32_t i = 0; i < m_fileCount; ++i)
+        {
+            const Record& record = records[i];
+            FileEntry& fileEntry = m_fileEntries[i];
+            fileEntry.desc.lCRC32 = record.m_crc32;
+            fileEntry.desc.lSizeCompressed = record.m_sizeCompressed;
+            fileEntry.desc.lSizeUncompressed = record.m_sizeUncompressed;
+            fileEntry.nFileDataOffset = record.m_fileDataOffset;
+            fileEntry.nFileHeaderOffset = record.m_fileHeaderOffset;
+            fileEntry.nNameOffset = record.m_pathOffset;
+            fileEntry.nMethod = record.m_method;
+            fileEntry.nLastModTime = record.m_lastModTime;
+            fileEntry.nLastModDate = record.m_lastModDate;
+            fileEntry.nNTFS_LastModifyTime = record.m_ntfsLastModifyTime;
+            fileEntry.nEOFOffset = record.m_eofOffset;
+        }
+        return true;
+    }
+
+    auto FlatIndex::GetHeader() const -> const Header&
+    {
+        return *reinterpret_cast<const Header*>(m_buffer.data());
+    }
+
+    auto FlatIndex::GetRecords() const -> const Record*
+    {
+        return reinterpret_cast<const Record*>(m_buffer.data() + sizeof(Header));
+    }
+
+    AZStd::string_view FlatIndex::GetPath(const Record& record) const
+    {
+        const char* pathPool = reinterpret_cast<const char*>(m_buffer.data() + sizeof(Header) + sizeof(Record) * m_fileCount);
+        return AZStd::string_view(pathPool + record.m_pathOffset, record.m_pathLength);
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+// Declaration of the flat lookup table that can be used instead of the
+// FileEntryTree to find files inside of a read only zip file
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/utils.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
+
+namespace AZ::IO
+{
+    class FileIOBase;
+}
+
+namespace AZ::IO::ZipDir
+{
+    class FileEntryTree;
+
+    // A flat table of all files in a zip file, sorted by the hash of their path and then by the path itself.
+    // Looking up a file is a binary search over a single contiguous array instead of a walk through the per directory maps of
+    // the FileEntryTree, and building the table needs a fixed number of allocations regardless of the number of files.
+    // The table is stored in one buffer using the same layout as the index file, so it can be saved next to the zip file and
+    // loaded back with a single read. A loaded index also skips reading the local header of every file when the zip is opened.
+    class FlatIndex
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FlatIndex, AZ::SystemAllocator);
+
+        // extension appended to the zip file path to get the path of its index file
+        inline static constexpr AZStd::string_view IndexFileExtension = ".zdx";
+
+        using SourceEntry = AZStd::pair<AZStd::string_view, FileEntryBase>;
+
+        FlatIndex(const FlatIndex&) = delete;
+        FlatIndex& operator=(const FlatIndex&) = delete;
+
+        // builds the index from the files read out of the central directory of a zip file
+        // cdrCrc is the CRC of the central directory, which is used to check whether a saved index still matches its zip file
+        // if multiple entries have the same path, the first one is kept
+        static AZStd::unique_ptr<FlatIndex> Create(AZStd::span<const SourceEntry> entries, uint32_t cdrCrc);
+
+        // loads an index file that was previously saved for a zip file
+        // returns nullptr if there's no index file or if it wasn't built from a central directory with the given CRC
+        static AZStd::unique_ptr<FlatIndex> Load(AZ::IO::FileIOBase* fileIO, const char* indexPath, uint32_t cdrCrc);
+
+        // returns the path of the index file that belongs to the zip file
+        static AZ::IO::Path GetIndexPath(AZStd::string_view zipPath);
+
+        // writes the index to a file so it can be loaded with Load instead of being built again
+        bool Save(AZ::IO::FileIOBase* fileIO, const char* indexPath) const;
+
+        // finds the file by exact path
+        // returns false if the path can't be looked up in the index, in which case the FileEntryTree needs to be used instead
+        bool FindFile(AZ::IO::PathView path, FileEntry*& fileEntry);
+
+        // QUICK check to determine whether the file entry belongs to this index
+        bool IsOwnerOf(const FileEntry* pFileEntry) const;
+
+        uint32_t NumFilesTotal() const;
+
+        // adds all files in the index to the tree, for operations that need the directory structure of the zip file
+        // the tree references the paths stored in this index, so it must not outlive it
+        void AddToTree(FileEntryTree& tree) const;
+
+    private:
+        struct Header;
+        struct Record;
+
+        FlatIndex() = default;
+
+        bool InitFromBuffer(uint32_t cdrCrc);
+
+        const Header& GetHeader() const;
+        const Record* GetRecords() const;
+        AZStd::string_view GetPath(const Record& record) const;
+
+        // header, sorted records and the path pool, laid out exactly as in the index file
+        AZStd::vector<uint8_t> m_buffer;
+        // file entries for each record, in the same order
+        AZStd::unique_ptr<FileEntry[]> m_fileEntries;
+        uint32_t m_fileCount = 0;
+    };
+}
@@ -13,6 +13,7 @@
 #include <AzCore/Asset/AssetTypeInfoBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
@@ -32,6 +33,8 @@
 // uncomment to have the catalog be dumped to stdout:
 //#define DEBUG_DUMP_CATALOG
 
+AZ_CVAR(bool, az_asset_catalog_snapshot, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "When set, an immutable snapshot of the asset catalog is built when catalogs are loaded, so asset lookups don't need to lock the catalog.");
 
 namespace AzFramework
 {
@@ -177,6 +180,12 @@ namespace AzFramework
             return AZStd::string();
         }
 
+        if (auto snapshot = GetRegistrySnapshot(); snapshot)
+        {
+            const AZ::Data::AssetInfo* assetInfo = snapshot->FindAssetInfo(id);
+            return assetInfo ? assetInfo->m_relativePath : AZStd::string();
+        }
+
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         auto foundIter = m_registry->m_assetIdToInfo.find(id);
@@ -206,6 +215,12 @@ namespace AzFramework
             return AZ::Data::AssetInfo();
         }
 
+        if (auto snapshot = GetRegistrySnapshot(); snapshot)
+        {
+            const AZ::Data::AssetInfo* assetInfo = snapshot->FindAssetInfo(id);
+            return assetInfo ? *assetInfo : AZ::Data::AssetInfo();
+        }
+
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         auto foundIter = m_registry->m_assetIdToInfo.find(id);
@@ -226,13 +241,27 @@ namespace AzFramework
         {
             return AZ::Data::AssetId();
         }
-        m_pathBuffer = path;
+        AZStd::string pathBuffer = path;
         AzFramework::ApplicationRequests::Bus::Broadcast(
-            &AzFramework::ApplicationRequests::Bus::Events::MakePathAssetRootRelative, m_pathBuffer);
+            &AzFramework::ApplicationRequests::Bus::Events::MakePathAssetRootRelative, pathBuffer);
+
+        if (auto snapshot = GetRegistrySnapshot(); snapshot)
+        {
+            AZ::Data::AssetId foundId = snapshot->GetAssetIdByPath(pathBuffer.c_str());
+            if (foundId.IsValid())
+            {
+                const AZ::Data::AssetInfo* assetInfo = snapshot->FindAssetInfo(foundId);
+                if (!autoRegisterIfNotFound || (assetInfo && !assetInfo->m_assetType.IsNull()))
+                {
+                    return foundId;
+                }
+            }
+        }
+        else
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-            AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(m_pathBuffer.c_str());
+            AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(pathBuffer.c_str());
             if (foundId.IsValid())
             {
                 const AZ::Data::AssetInfo& assetInfo = m_registry->m_assetIdToInfo.find(foundId)->second;
@@ -249,18 +278,18 @@ namespace AzFramework
         if (autoRegisterIfNotFound)
         {
             AZ_Error("AssetCatalog", typeToRegister != AZ::Data::s_invalidAssetType,
-                "Invalid asset type provided for registration of asset \"%s\".", m_pathBuffer.c_str());
+                "Invalid asset type provided for registration of asset \"%s\".", pathBuffer.c_str());
 
             // note, we are intentionally allowing missing files, since this is an explicit ask to add.
             AZ::u64 fileSize = 0;
             auto* fileIo = AZ::IO::FileIOBase::GetInstance();
-            if (fileIo->Exists(m_pathBuffer.c_str()))
+            if (fileIo->Exists(pathBuffer.c_str()))
             {
-                fileIo->Size(m_pathBuffer.c_str(), fileSize);
+                fileIo->Size(pathBuffer.c_str(), fileSize);
             }
 
             AZ::Data::AssetInfo newInfo;
-            newInfo.m_relativePath = m_pathBuffer;
+            newInfo.m_relativePath = pathBuffer;
             newInfo.m_assetType = typeToRegister;
             newInfo.m_sizeBytes = fileSize;
             AZ::Data::AssetId generatedID = GenerateAssetIdTEMP(newInfo.m_relativePath.c_str());
@@ -269,6 +298,7 @@ namespace AzFramework
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
                 m_registry->RegisterAsset(generatedID, newInfo);
+                UpdateRegistrySnapshot(generatedID, newInfo.m_relativePath.c_str());
             }
 
             AzFramework::AssetCatalogEventBus::Broadcast(&AzFramework::AssetCatalogEventBus::Events::OnCatalogAssetAdded, generatedID);
@@ -579,6 +609,7 @@ namespace AzFramework
 
             if (!bytes.empty())
             {
+                ClearRegistrySnapshot();
                 AZStd::shared_ptr<AzFramework::AssetRegistry> prevRegistry;
                 if (!m_initialized)
                 {
@@ -605,9 +636,14 @@ namespace AzFramework
                 // It's currently possible in tools for us to have received updates from AP which were applied before the catalog was ready to load
                 if (!m_initialized)
                 {
+                    // this also publishes the snapshot of the loaded registry
                     ApplyDeltaCatalog(prevRegistry);
                     m_initialized = true;
                 }
+                else
+                {
+                    RebuildRegistrySnapshot();
+                }
                 shouldBroadcast = true;
             }
             else
@@ -666,6 +702,7 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
             m_registry->RegisterAsset(id, info);
+            UpdateRegistrySnapshot(id, info.m_relativePath.c_str());
         }
         AzFramework::AssetCatalogEventBus::Broadcast(&AzFramework::AssetCatalogEventBus::Events::OnCatalogAssetAdded, id);
     }
@@ -685,7 +722,15 @@ namespace AzFramework
             });
 
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            // the registry drops the path of the asset as well, so the snapshot needs to know what it was
+            AZStd::string assetPath;
+            auto existingAsset = m_registry->m_assetIdToInfo.find(assetId);
+            if (existingAsset != m_registry->m_assetIdToInfo.end())
+            {
+                assetPath = existingAsset->second.m_relativePath;
+            }
             m_registry->UnregisterAsset(assetId);
+            UpdateRegistrySnapshot(assetId, assetPath.c_str());
         }
     }
 
@@ -696,12 +741,7 @@ namespace AzFramework
     {
         (void)assetType;
 
-        AZ::Data::AssetInfo info;
-        {
-            // narrow-scoped lock.
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-            info = GetAssetInfoById(assetId);
-        }
+        AZ::Data::AssetInfo info = GetAssetInfoById(assetId);
 
         if (!info.m_relativePath.empty())
         {
@@ -846,6 +886,7 @@ namespace AzFramework
 
                     m_registry->RegisterAsset(assetId, newData);
                     m_registry->SetAssetDependencies(assetId, message.m_dependencies);
+                    UpdateRegistrySnapshot(assetId, newData.m_relativePath.c_str());
                 }
                 if (!isNewAsset)
                 {
@@ -995,6 +1036,7 @@ namespace AzFramework
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        ClearRegistrySnapshot();
         m_registry->Clear();
         m_initialized = false;
     }
@@ -1103,9 +1145,74 @@ namespace AzFramework
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         m_registry->AddRegistry(deltaCatalog);
+        RebuildRegistrySnapshot();
         return true;
     }
 
+    //=========================================================================
+    // RebuildRegistrySnapshot
+    //=========================================================================
+    void AssetCatalog::RebuildRegistrySnapshot()
+    {
+        AZStd::shared_ptr<const AssetRegistrySnapshot> snapshot;
+        if (az_asset_catalog_snapshot)
+        {
+            snapshot = AZStd::make_shared<AssetRegistrySnapshot>(*m_registry);
+        }
+
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(m_registrySnapshotMutex);
+            m_registrySnapshot.swap(snapshot);
+        }
+        // the previous snapshot is released here outside of the spin lock, or later by the last lookup still using it
+    }
+
+    //=========================================================================
+    // UpdateRegistrySnapshot
+    //=========================================================================
+    void AssetCatalog::UpdateRegistrySnapshot(const AZ::Data::AssetId& id, const char* assetPath)
+    {
+        AZStd::shared_ptr<const AssetRegistrySnapshot> snapshot = GetRegistrySnapshot();
+        if (!snapshot)
+        {
+            // lookups go through the registry until the next catalog load builds a snapshot
+            return;
+        }
+
+        if (snapshot->ShouldRebuild())
+        {
+            RebuildRegistrySnapshot();
+            return;
+        }
+
+        snapshot = AZStd::make_shared<AssetRegistrySnapshot>(*snapshot, *m_registry, id, assetPath);
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(m_registrySnapshotMutex);
+            m_registrySnapshot.swap(snapshot);
+        }
+    }
+
+    //=========================================================================
+    // ClearRegistrySnapshot
+    //=========================================================================
+    void AssetCatalog::ClearRegistrySnapshot()
+    {
+        AZStd::shared_ptr<const AssetRegistrySnapshot> snapshot;
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(m_registrySnapshotMutex);
+            m_registrySnapshot.swap(snapshot);
+        }
+    }
+
+    //=========================================================================
+    // GetRegistrySnapshot
+    //=========================================================================
+    AZStd::shared_ptr<const AssetRegistrySnapshot> AssetCatalog::GetRegistrySnapshot() const
+    {
+        AZStd::lock_guard<AZStd::spin_mutex> lock(m_registrySnapshotMutex);
+        return m_registrySnapshot;
+    }
+
     //=========================================================================
     // InsertDeltaCatalog
     //=========================================================================
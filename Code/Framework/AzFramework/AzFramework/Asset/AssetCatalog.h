@@ -11,7 +11,9 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManager.h>
 
+#include <AzCore/std/parallel/spin_mutex.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
@@ -21,6 +23,7 @@
 namespace AzFramework
 {
     class AssetRegistry;
+    class AssetRegistrySnapshot;
     class AssetBundleManifest;
 
     /*
@@ -125,6 +128,15 @@ namespace AzFramework
         void InsertCatalogEntry(AZStd::shared_ptr<AzFramework::AssetRegistry> deltaCatalog, size_t catalogIndex);
         // Clear just the registry
         void ResetRegistry();
+        // Publish a new snapshot of the registry for lock free lookups, must be called while holding m_registryMutex
+        void RebuildRegistrySnapshot();
+        // Publish a snapshot that reflects the registration or removal of the asset, must be called while holding m_registryMutex
+        // after the registry was modified. The path is the one the asset was registered with, or had before it was unregistered.
+        void UpdateRegistrySnapshot(const AZ::Data::AssetId& id, const char* assetPath);
+        // Drop the snapshot so lookups go through the registry, must be called while holding m_registryMutex
+        void ClearRegistrySnapshot();
+        // Returns the current snapshot of the registry, or nullptr if lookups need to go through the registry
+        AZStd::shared_ptr<const AssetRegistrySnapshot> GetRegistrySnapshot() const;
 
         AZStd::string GetAssetPathByIdInternal(const AZ::Data::AssetId& id) const;
         AZ::Data::AssetInfo GetAssetInfoByIdInternal(const AZ::Data::AssetId& id) const;
@@ -136,7 +148,10 @@ namespace AzFramework
         AZStd::unordered_set<AZStd::string> m_extensions;           ///< Valid asset extensions.
         mutable AZStd::recursive_mutex m_registryMutex;
         AZStd::unique_ptr<AssetRegistry> m_registry;
-        AZStd::string m_pathBuffer;
+        //! Read only copy of m_registry used by lookups, replaced whenever the registry is modified.
+        AZStd::shared_ptr<const AssetRegistrySnapshot> m_registrySnapshot;
+        //! Only held while m_registrySnapshot is copied or replaced.
+        mutable AZStd::spin_mutex m_registrySnapshotMutex;
         mutable AZStd::recursive_mutex m_baseCatalogNameMutex;
         AZStd::string m_baseCatalogName;
         mutable AZStd::recursive_mutex m_deltaCatalogMutex;
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/ranges/transform_view.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/IO/SystemFile.h> // for max path
 
@@ -42,6 +43,17 @@ namespace AssetRegistryInternal
 
         return AZ::Uuid::CreateData(name | AZStd::views::transform(TransformPath));
     }
+
+    // open addressing tables are sized to a power of two with at most half of the slots in use, which keeps probe sequences short
+    size_t GetSlotCount(size_t count)
+    {
+        size_t slotCount = 16;
+        while (slotCount < count * 2)
+        {
+            slotCount <<= 1;
+        }
+        return slotCount;
+    }
 }
 
 namespace AzFramework
@@ -201,4 +213,159 @@ namespace AzFramework
         }
     }
 
+    //=========================================================================
+    // AssetRegistrySnapshot
+    //=========================================================================
+    AssetRegistrySnapshot::AssetRegistrySnapshot(const AssetRegistry& registry)
+    {
+        auto tables = AZStd::make_shared<Tables>();
+        tables->m_assetInfos.reserve(registry.m_assetIdToInfo.size());
+        tables->m_assetIdSlots.resize(GetSlotCount(registry.m_assetIdToInfo.size()));
+        const size_t assetIdMask = tables->m_assetIdSlots.size() - 1;
+        for (const auto& [assetId, assetInfo] : registry.m_assetIdToInfo)
+        {
+            size_t slot = AZStd::hash<AZ::Data::AssetId>{}(assetId) & assetIdMask;
+            while (tables->m_assetIdSlots[slot].m_assetInfoIndex != EmptySlot)
+            {
+                slot = (slot + 1) & assetIdMask;
+            }
+            tables->m_assetIdSlots[slot].m_assetId = assetId;
+            tables->m_assetIdSlots[slot].m_assetInfoIndex = aznumeric_cast<uint32_t>(tables->m_assetInfos.size());
+            tables->m_assetInfos.push_back(assetInfo);
+        }
+
+        tables->m_assetPathSlots.resize(GetSlotCount(registry.m_assetPathToId.size()));
+        const size_t assetPathMask = tables->m_assetPathSlots.size() - 1;
+        for (const auto& [pathKey, assetId] : registry.m_assetPathToId)
+        {
+            size_t slot = pathKey.GetHash() & assetPathMask;
+            while (tables->m_assetPathSlots[slot].m_assetId.IsValid())
+            {
+                slot = (slot + 1) & assetPathMask;
+            }
+            tables->m_assetPathSlots[slot].m_pathKey = pathKey;
+            tables->m_assetPathSlots[slot].m_assetId = assetId;
+        }
+
+        m_assetCount = tables->m_assetInfos.size();
+        m_tables = AZStd::move(tables);
+    }
+
+    AssetRegistrySnapshot::AssetRegistrySnapshot(
+        const AssetRegistrySnapshot& previous, const AssetRegistry& registry, const AZ::Data::AssetId& id, const char* assetPath)
+        : m_tables(previous.m_tables)
+        , m_changedAssets(previous.m_changedAssets)
+        , m_removedAssets(previous.m_removedAssets)
+        , m_changedPaths(previous.m_changedPaths)
+        , m_assetCount(previous.m_assetCount)
+    {
+        const bool wasRegistered = previous.FindAssetInfo(id) != nullptr;
+        auto assetEntry = registry.m_assetIdToInfo.find(id);
+        if (assetEntry != registry.m_assetIdToInfo.end())
+        {
+            m_changedAssets[id] = assetEntry->second;
+            m_removedAssets.erase(id);
+            m_assetCount += wasRegistered ? 0 : 1;
+        }
+        else
+        {
+            m_changedAssets.erase(id);
+            if (m_tables->FindAssetInfo(id))
+            {
+                m_removedAssets.insert(id);
+            }
+            m_assetCount -= wasRegistered ? 1 : 0;
+        }
+
+        if (assetPath && (assetPath[0] != 0))
+        {
+            const AZ::Uuid pathKey = CreateUUIDForName(assetPath);
+            auto pathEntry = registry.m_assetPathToId.find(pathKey);
+            m_changedPaths[pathKey] = (pathEntry != registry.m_assetPathToId.end()) ? pathEntry->second : AZ::Data::AssetId();
+        }
+    }
+
+    const AZ::Data::AssetInfo* AssetRegistrySnapshot::FindAssetInfo(const AZ::Data::AssetId& id) const
+    {
+        if (!m_changedAssets.empty())
+        {
+            auto changedAsset = m_changedAssets.find(id);
+            if (changedAsset != m_changedAssets.end())
+            {
+                return &changedAsset->second;
+            }
+        }
+        if (!m_removedAssets.empty() && (m_removedAssets.find(id) != m_removedAssets.end()))
+        {
+            return nullptr;
+        }
+        return m_tables->FindAssetInfo(id);
+    }
+
+    AZ::Data::AssetId AssetRegistrySnapshot::GetAssetIdByPath(const char* assetPath) const
+    {
+        if ((!assetPath) || (assetPath[0] == 0))
+        {
+            // the empty path has no asset ID.
+            return AZ::Data::AssetId();
+        }
+
+        const AZ::Uuid pathKey = CreateUUIDForName(assetPath);
+        if (!m_changedPaths.empty())
+        {
+            auto changedPath = m_changedPaths.find(pathKey);
+            if (changedPath != m_changedPaths.end())
+            {
+                return changedPath->second;
+            }
+        }
+        return m_tables->GetAssetIdByPathKey(pathKey);
+    }
+
+    size_t AssetRegistrySnapshot::GetAssetCount() const
+    {
+        return m_assetCount;
+    }
+
+    size_t AssetRegistrySnapshot::GetChangeCount() const
+    {
+        return m_changedAssets.size() + m_removedAssets.size() + m_changedPaths.size();
+    }
+
+    bool AssetRegistrySnapshot::ShouldRebuild() const
+    {
+        // small catalogs are cheap to rebuild, but still avoid rebuilding them on every single update
+        constexpr size_t MinChangesBeforeRebuild = 64;
+        const size_t changeCount = GetChangeCount();
+        return changeCount >= MinChangesBeforeRebuild && changeCount * changeCount >= 2 * m_assetCount;
+    }
+
+    const AZ::Data::AssetInfo* AssetRegistrySnapshot::Tables::FindAssetInfo(const AZ::Data::AssetId& id) const
+    {
+        const size_t assetIdMask = m_assetIdSlots.size() - 1;
+        for (size_t slot = AZStd::hash<AZ::Data::AssetId>{}(id) & assetIdMask; m_assetIdSlots[slot].m_assetInfoIndex != EmptySlot;
+             slot = (slot + 1) & assetIdMask)
+        {
+            if (m_assetIdSlots[slot].m_assetId == id)
+            {
+                return &m_assetInfos[m_assetIdSlots[slot].m_assetInfoIndex];
+            }
+        }
+        return nullptr;
+    }
+
+    AZ::Data::AssetId AssetRegistrySnapshot::Tables::GetAssetIdByPathKey(const AZ::Uuid& pathKey) const
+    {
+        const size_t assetPathMask = m_assetPathSlots.size() - 1;
+        for (size_t slot = pathKey.GetHash() & assetPathMask; m_assetPathSlots[slot].m_assetId.IsValid();
+             slot = (slot + 1) & assetPathMask)
+        {
+            if (m_assetPathSlots[slot].m_pathKey == pathKey)
+            {
+                return m_assetPathSlots[slot].m_assetId;
+            }
+        }
+        return AZ::Data::AssetId();
+    }
+
 } // namespace AzFramework
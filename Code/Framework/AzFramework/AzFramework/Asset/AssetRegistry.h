@@ -12,6 +12,8 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace AZ
@@ -28,6 +30,7 @@ namespace AzFramework
     class AssetRegistry
     {
         friend class AssetCatalog;
+        friend class AssetRegistrySnapshot;
     public:
         AZ_TYPE_INFO(AssetRegistry, "{5DBC20D9-7143-48B3-ADEE-CCBD2FA6D443}");
         AZ_CLASS_ALLOCATOR(AssetRegistry, AZ::SystemAllocator);
@@ -70,4 +73,76 @@ namespace AzFramework
 
     };
 
+    /**
+    * Immutable copy of the lookup tables of an asset registry.
+    * The tables use open addressing over flat arrays instead of the node based maps of the registry, and since the
+    * snapshot never changes after it's built, any number of threads can look up assets in it without locking.
+    * Registering or unregistering a single asset doesn't rebuild the tables: the updated snapshot shares the tables of the
+    * previous one and only records the assets and paths that changed since they were built.
+    */
+    class AssetRegistrySnapshot
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AssetRegistrySnapshot, AZ::SystemAllocator);
+
+        //! Builds the tables from all assets in the registry.
+        explicit AssetRegistrySnapshot(const AssetRegistry& registry);
+
+        //! Shares the tables of the previous snapshot and takes the state the registry now has for the asset and for the path,
+        //! which is the path the asset was registered with or, when it was unregistered, the path it had before.
+        AssetRegistrySnapshot(
+            const AssetRegistrySnapshot& previous, const AssetRegistry& registry, const AZ::Data::AssetId& id, const char* assetPath);
+
+        //! Returns the info registered for the asset, or nullptr if the asset isn't registered.
+        const AZ::Data::AssetInfo* FindAssetInfo(const AZ::Data::AssetId& id) const;
+
+        //! LEGACY - same as AssetRegistry::GetAssetIdByPath.
+        AZ::Data::AssetId GetAssetIdByPath(const char* assetPath) const;
+
+        size_t GetAssetCount() const;
+
+        //! Returns the number of assets and paths that changed since the tables were built. Every update copies these, so
+        //! a new snapshot should be built from the registry once there are too many.
+        size_t GetChangeCount() const;
+
+        //! Returns true once building new tables from the registry is cheaper over time than copying the changes on every update.
+        //! With N assets and C changes, the updates since the last build copied about C^2 / 2 changes and a build copies N assets,
+        //! so rebuilding once C reaches sqrt(2N) keeps the cost of an update at O(sqrt(N)) on average.
+        bool ShouldRebuild() const;
+
+    private:
+        static constexpr uint32_t EmptySlot = 0xFFFFFFFF;
+
+        struct AssetIdSlot
+        {
+            AZ::Data::AssetId m_assetId;
+            uint32_t m_assetInfoIndex = EmptySlot;
+        };
+
+        struct AssetPathSlot
+        {
+            AZ::Uuid m_pathKey;
+            AZ::Data::AssetId m_assetId; //< Invalid for empty slots.
+        };
+
+        struct Tables
+        {
+            AZStd::vector<AZ::Data::AssetInfo> m_assetInfos;
+            AZStd::vector<AssetIdSlot> m_assetIdSlots;
+            AZStd::vector<AssetPathSlot> m_assetPathSlots;
+
+            const AZ::Data::AssetInfo* FindAssetInfo(const AZ::Data::AssetId& id) const;
+            AZ::Data::AssetId GetAssetIdByPathKey(const AZ::Uuid& pathKey) const;
+        };
+
+        AZStd::shared_ptr<const Tables> m_tables;
+        //! Assets registered or changed since the tables were built.
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::AssetInfo> m_changedAssets;
+        //! Assets in the tables that have been unregistered since.
+        AZStd::unordered_set<AZ::Data::AssetId> m_removedAssets;
+        //! Paths changed since the tables were built, an invalid id means the path was removed.
+        AZStd::unordered_map<AZ::Uuid, AZ::Data::AssetId> m_changedPaths;
+        size_t m_assetCount = 0;
+    };
+
 } // namespace AzFramework
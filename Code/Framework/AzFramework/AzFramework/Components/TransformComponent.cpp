@@ -8,6 +8,7 @@
 
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Component/Entity.h>
@@ -80,6 +81,11 @@ namespace AZ
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, az_transform_hierarchy, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, transform components that activate add themselves to the central transform hierarchy. Changes to world "
+        "transforms are then propagated to children once per frame in a single batched pass, and OnTransformChanged notifications "
+        "for children are sent at that time instead of immediately.");
+
     bool TransformComponentVersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
     {
         if (classElement.GetVersion() < 3)
@@ -138,7 +144,7 @@ namespace AzFramework
         if (auto config = azrtti_cast<AZ::TransformConfig*>(baseConfig))
         {
             config->m_localTransform = m_localTM;
-            config->m_worldTransform = m_worldTM;
+            config->m_worldTransform = GetCurrentWorldTM();
             config->m_parentId = m_parentId;
             config->m_parentActivationTransformMode = m_parentActivationTransformMode;
             config->m_isStatic = m_isStatic;
@@ -152,12 +158,30 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        if (az_transform_hierarchy)
+        {
+            if (ITransformHierarchy* transformHierarchy = AZ::Interface<ITransformHierarchy>::Get())
+            {
+                m_transformHierarchy = transformHierarchy;
+                m_hierarchyNode = transformHierarchy->AddTransform(this, m_worldTM);
+            }
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
 
     void TransformComponent::Deactivate()
     {
+        if (m_transformHierarchy)
+        {
+            m_worldTM = GetCurrentWorldTM();
+            m_transformHierarchy->RemoveTransform(m_hierarchyNode);
+            m_transformHierarchy = nullptr;
+            m_hierarchyNode = TransformHierarchy::InvalidNodeId;
+            m_hierarchyParented = false;
+        }
+
         AZ::TransformNotificationBus::Event(m_parentId, &AZ::TransformNotificationBus::Events::OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -223,7 +247,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetCurrentWorldTM();
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
     }
@@ -237,7 +261,7 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldTranslation()
     {
-        return m_worldTM.GetTranslation();
+        return GetCurrentWorldTM().GetTranslation();
     }
 
     AZ::Vector3 TransformComponent::GetLocalTranslation()
@@ -247,25 +271,25 @@ namespace AzFramework
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3 worldPosition = GetCurrentWorldTM().GetTranslation();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3 worldPosition = GetCurrentWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3 worldPosition = GetCurrentWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3 worldPosition = GetCurrentWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
 
@@ -325,26 +349,26 @@ namespace AzFramework
 
     void TransformComponent::SetWorldRotation(const AZ::Vector3& eulerAnglesRadian)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetCurrentWorldTM();
         newWorldTransform.SetRotation(AZ::Quaternion::CreateFromEulerAnglesRadians(eulerAnglesRadian));
         SetWorldTM(newWorldTransform);
     }
 
     void TransformComponent::SetWorldRotationQuaternion(const AZ::Quaternion& quaternion)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetCurrentWorldTM();
         newWorldTransform.SetRotation(quaternion);
         SetWorldTM(newWorldTransform);
     }
 
     AZ::Vector3 TransformComponent::GetWorldRotation()
     {
-        return m_worldTM.GetRotation().GetEulerRadians();
+        return GetCurrentWorldTM().GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetWorldRotationQuaternion()
     {
-        return m_worldTM.GetRotation();
+        return GetCurrentWorldTM().GetRotation();
     }
 
     void TransformComponent::SetLocalRotation(const AZ::Vector3& eulerRadianAngles)
@@ -429,7 +453,7 @@ namespace AzFramework
 
     float TransformComponent::GetWorldUniformScale()
     {
-        return m_worldTM.GetUniformScale();
+        return GetCurrentWorldTM().GetUniformScale();
     }
 
     AZStd::vector<AZ::EntityId> TransformComponent::GetChildren()
@@ -473,7 +497,9 @@ namespace AzFramework
 
     void TransformComponent::SetOnParentChangedBehavior(AZ::OnParentChangedBehavior onParentChangedBehavior)
     {
+        m_worldTM = GetCurrentWorldTM();
         m_onParentChangedBehavior = onParentChangedBehavior;
+        UpdateHierarchyParent();
     }
 
     void TransformComponent::OnTransformChanged(const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM)
@@ -533,15 +559,18 @@ namespace AzFramework
             {
                 ComputeWorldTM();
             }
+            UpdateHierarchyParent();
         }
     }
 
     void TransformComponent::OnEntityDeactivated([[maybe_unused]] const AZ::EntityId& parentEntityId)
     {
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+        m_worldTM = GetCurrentWorldTM();
         m_parentTM = nullptr;
         m_parentActive = false;
         ComputeLocalTM();
+        UpdateHierarchyParent();
     }
 
     void TransformComponent::SetParentImpl(AZ::EntityId parentId, bool isKeepWorldTM)
@@ -552,6 +581,14 @@ namespace AzFramework
             return;
         }
 
+        if (m_hierarchyParented)
+        {
+            // Detach from the old parent in the hierarchy, the new parent is linked once it's active.
+            m_worldTM = GetCurrentWorldTM();
+            m_hierarchyParented = false;
+            m_transformHierarchy->SetParent(m_hierarchyNode, TransformHierarchy::InvalidNodeId, m_worldTM);
+        }
+
         AZ::EntityId oldParent = m_parentId;
         if (m_parentId.IsValid())
         {
@@ -619,24 +656,52 @@ namespace AzFramework
     void TransformComponent::SetLocalTMImpl(const AZ::Transform& tm)
     {
         m_localTM = tm;
+        if (m_hierarchyParented)
+        {
+            // The world transform is propagated by the hierarchy, which sends the notifications.
+            m_transformHierarchy->SetLocalTM(m_hierarchyNode, tm);
+            return;
+        }
+
         ComputeWorldTM();  // We can user dirty flags and compute it later on demand
+        if (m_transformHierarchy)
+        {
+            m_transformHierarchy->SetLocalTM(m_hierarchyNode, m_worldTM);
+        }
     }
 
     void TransformComponent::SetWorldTMImpl(const AZ::Transform& tm)
     {
         m_worldTM = tm;
+        if (m_hierarchyParented)
+        {
+            m_transformHierarchy->SetWorldTM(m_hierarchyNode, tm);
+            m_localTM = m_transformHierarchy->GetLocalTM(m_hierarchyNode);
+            return;
+        }
+
         ComputeLocalTM(); // We can user dirty flags and compute it later on demand
+        if (m_transformHierarchy)
+        {
+            m_transformHierarchy->SetLocalTM(m_hierarchyNode, m_worldTM);
+        }
     }
 
     void TransformComponent::OnTransformChangedImpl(const AZ::Transform& /*parentLocalTM*/, const AZ::Transform& parentWorldTM)
     {
         // Called when our parent transform changes
         // Ignore the event until we've already derived our local transform.
-        if (m_parentTM)
+        // Transforms that are parented in the hierarchy already had the change propagated to them.
+        if (m_parentTM && !m_hierarchyParented)
         {
             if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
             {
                 m_worldTM = parentWorldTM * m_localTM;
+                if (m_transformHierarchy)
+                {
+                    // The parent isn't part of the hierarchy, pass the change on to the children that are.
+                    m_transformHierarchy->SetLocalTM(m_hierarchyNode, m_worldTM);
+                }
                 AZ::TransformNotificationBus::Event(
                     m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
                 m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -690,6 +755,68 @@ namespace AzFramework
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
 
+    const AZ::Transform& TransformComponent::GetWorldTM()
+    {
+        // The world transforms stored in the hierarchy move when nodes are added, removed or sorted, so the caller gets a
+        // reference to the copy held by the component instead.
+        if (m_hierarchyParented)
+        {
+            m_worldTM = m_transformHierarchy->GetWorldTM(m_hierarchyNode);
+        }
+        return m_worldTM;
+    }
+
+    AZ::Transform TransformComponent::GetCurrentWorldTM() const
+    {
+        // The world transform of a transform that follows its parent is resolved through the hierarchy, m_worldTM is only
+        // updated when the change is propagated or read through GetWorldTM.
+        return m_hierarchyParented ? m_transformHierarchy->GetWorldTM(m_hierarchyNode) : m_worldTM;
+    }
+
+    void TransformComponent::UpdateHierarchyParent()
+    {
+        if (!m_transformHierarchy)
+        {
+            return;
+        }
+
+        // Only children that follow their parent can have their world transform propagated, and only if the parent is part of
+        // the hierarchy as well. Anything else stays a root in the hierarchy and is updated through notifications as before.
+        ITransformHierarchy::NodeId parentNode = TransformHierarchy::InvalidNodeId;
+        if (m_parentTM && m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
+        {
+            if (auto parentTransform = azrtti_cast<TransformComponent*>(m_parentTM))
+            {
+                parentNode = parentTransform->m_hierarchyNode;
+            }
+        }
+
+        m_hierarchyParented = parentNode != TransformHierarchy::InvalidNodeId;
+        m_transformHierarchy->SetParent(m_hierarchyNode, parentNode, m_hierarchyParented ? m_localTM : m_worldTM);
+    }
+
+    void TransformComponent::OnTransformHierarchyUpdated()
+    {
+        // Roots send their notifications right away when they're moved.
+        if (!m_hierarchyParented)
+        {
+            return;
+        }
+
+        m_worldTM = m_transformHierarchy->GetWorldTM(m_hierarchyNode);
+        AZ::TransformNotificationBus::Event(
+            m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+    }
+
+    void TransformComponent::OnTransformHierarchyDisconnected()
+    {
+        m_worldTM = GetCurrentWorldTM();
+        m_transformHierarchy = nullptr;
+        m_hierarchyNode = TransformHierarchy::InvalidNodeId;
+        m_hierarchyParented = false;
+    }
+
     bool TransformComponent::AreMoveRequestsAllowed() const
     {
         // Don't allow static transform to be moved while entity is activated.
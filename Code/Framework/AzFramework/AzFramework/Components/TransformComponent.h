@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Components/TransformHierarchyBus.h>
 
 namespace AzToolsFramework
 {
@@ -25,6 +26,7 @@ namespace AzToolsFramework
 namespace AzFramework
 {
     class GameEntityContextComponent;
+    class TransformHierarchySystem;
 
     /// @deprecated Use AZ::TransformConfig
     using TransformComponentConfiguration = AZ::TransformConfig;
@@ -41,6 +43,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class TransformHierarchySystem;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -56,9 +59,9 @@ namespace AzFramework
         //! Returns true if the tm was set to the local transform.
         const AZ::Transform& GetLocalTM() override { return m_localTM; }
         //! Returns true if the tm was set to the world transform.
-        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        const AZ::Transform& GetWorldTM() override;
         //! Returns both local and world transforms.
-        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = m_worldTM; }
+        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = GetCurrentWorldTM(); }
         //! Returns parent EntityId.
         AZ::EntityId GetParentId() override { return m_parentId; }
         //! Returns parent interface if available.
@@ -165,6 +168,18 @@ namespace AzFramework
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
+        //! Methods for transforms that are part of the central transform hierarchy, see az_transform_hierarchy.
+        //! @{
+        //! Returns the world transform, which is resolved through the hierarchy if it's propagated from the parent.
+        AZ::Transform GetCurrentWorldTM() const;
+        //! Links the hierarchy node to the node of the parent when the parent is also part of the hierarchy.
+        void UpdateHierarchyParent();
+        //! Called by the hierarchy after it propagated a change to the world transform.
+        void OnTransformHierarchyUpdated();
+        //! Called when the hierarchy shuts down while the transform is still active.
+        void OnTransformHierarchyDisconnected();
+        //! @}
+
         // TransformHierarchyInformationBus
         void GatherChildren(AZStd::vector<AZ::EntityId>& children) override;
 
@@ -190,5 +205,9 @@ namespace AzFramework
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
         /// Behavior for this entity's transform when its parent's transform changes.
         AZ::OnParentChangedBehavior m_onParentChangedBehavior = AZ::OnParentChangedBehavior::Update;
+
+        ITransformHierarchy* m_transformHierarchy = nullptr; ///< Set while the transform is part of the central transform hierarchy.
+        ITransformHierarchy::NodeId m_hierarchyNode = TransformHierarchy::InvalidNodeId; ///< Node of this transform in the hierarchy.
+        bool m_hierarchyParented = false; ///< If true, the hierarchy propagates the world transform from the parent.
     };
 }   // namespace AZ
@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchy.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzFramework
+{
+    TransformHierarchy::NodeId TransformHierarchy::AddNode(const AZ::Transform& localTM)
+    {
+        NodeId node;
+        if (!m_freeNodes.empty())
+        {
+            node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            node = aznumeric_cast<NodeId>(m_nodeSlots.size());
+            m_nodeSlots.push_back(InvalidSlot);
+        }
+
+        m_nodeSlots[node] = aznumeric_cast<uint32_t>(m_slotNodes.size());
+        m_slotNodes.push_back(node);
+        m_parentNodes.push_back(InvalidNodeId);
+        m_parentSlots.push_back(InvalidSlot);
+        m_childCounts.push_back(0);
+        m_localTMs.push_back(localTM);
+        m_worldTMs.push_back(localTM);
+        m_flags.push_back(0);
+        m_resolvedGenerations.push_back(0);
+        m_orderDirty = true;
+        return node;
+    }
+
+    void TransformHierarchy::RemoveNode(NodeId node)
+    {
+        const uint32_t slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            return;
+        }
+
+        if (m_childCounts[slot] > 0)
+        {
+            for (uint32_t childSlot = 0; childSlot < m_slotNodes.size(); ++childSlot)
+            {
+                if (m_parentNodes[childSlot] == node)
+                {
+                    // Keep the world transform of the child, it becomes its local transform as a root.
+                    const AZ::Transform worldTM = GetWorldTM(m_slotNodes[childSlot]);
+                    m_parentNodes[childSlot] = InvalidNodeId;
+                    m_localTMs[childSlot] = worldTM;
+                    m_worldTMs[childSlot] = worldTM;
+                }
+            }
+        }
+
+        const NodeId parent = m_parentNodes[slot];
+        if (parent != InvalidNodeId)
+        {
+            m_childCounts[GetSlot(parent)] -= 1;
+        }
+        if (m_flags[slot] & (Dirty | WorldSet))
+        {
+            m_pendingCount -= 1;
+        }
+
+        // Move the last slot into the released one, the order is restored on the next update.
+        const uint32_t lastSlot = aznumeric_cast<uint32_t>(m_slotNodes.size() - 1);
+        if (slot != lastSlot)
+        {
+            m_slotNodes[slot] = m_slotNodes[lastSlot];
+            m_parentNodes[slot] = m_parentNodes[lastSlot];
+            m_childCounts[slot] = m_childCounts[lastSlot];
+            m_localTMs[slot] = m_localTMs[lastSlot];
+            m_worldTMs[slot] = m_worldTMs[lastSlot];
+            m_flags[slot] = m_flags[lastSlot];
+            m_resolvedGenerations[slot] = m_resolvedGenerations[lastSlot];
+            m_nodeSlots[m_slotNodes[slot]] = slot;
+        }
+        m_slotNodes.pop_back();
+        m_parentNodes.pop_back();
+        m_parentSlots.pop_back();
+        m_childCounts.pop_back();
+        m_localTMs.pop_back();
+        m_worldTMs.pop_back();
+        m_flags.pop_back();
+        m_resolvedGenerations.pop_back();
+
+        m_nodeSlots[node] = InvalidSlot;
+        m_freeNodes.push_back(node);
+        m_orderDirty = true;
+        m_changeGeneration += 1;
+    }
+
+    void TransformHierarchy::SetParent(NodeId node, NodeId parent)
+    {
+        const uint32_t slot = GetSlot(node);
+        if (slot == InvalidSlot || m_parentNodes[slot] == parent)
+        {
+            return;
+        }
+
+        if (parent != InvalidNodeId)
+        {
+            for (NodeId ancestor = parent; ancestor != InvalidNodeId; ancestor = m_parentNodes[GetSlot(ancestor)])
+            {
+                if (ancestor == node)
+                {
+                    AZ_Error("TransformHierarchy", false, "Setting the parent would create a cycle in the transform hierarchy.");
+                    return;
+                }
+            }
+            m_childCounts[GetSlot(parent)] += 1;
+        }
+
+        if (m_parentNodes[slot] != InvalidNodeId)
+        {
+            m_childCounts[GetSlot(m_parentNodes[slot])] -= 1;
+        }
+        m_parentNodes[slot] = parent;
+        MarkPending(slot, Dirty);
+        m_orderDirty = true;
+    }
+
+    TransformHierarchy::NodeId TransformHierarchy::GetParent(NodeId node) const
+    {
+        const uint32_t slot = GetSlot(node);
+        return slot != InvalidSlot ? m_parentNodes[slot] : InvalidNodeId;
+    }
+
+    void TransformHierarchy::SetLocalTM(NodeId node, const AZ::Transform& localTM)
+    {
+        const uint32_t slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            return;
+        }
+
+        m_localTMs[slot] = localTM;
+        if (m_parentNodes[slot] == InvalidNodeId)
+        {
+            // The world transform of a root is known right away, only its descendants need to be updated.
+            m_worldTMs[slot] = localTM;
+            MarkPending(slot, WorldSet);
+        }
+        else
+        {
+            MarkPending(slot, Dirty);
+        }
+    }
+
+    void TransformHierarchy::SetWorldTM(NodeId node, const AZ::Transform& worldTM)
+    {
+        const uint32_t slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            return;
+        }
+
+        const NodeId parent = m_parentNodes[slot];
+        m_localTMs[slot] = (parent != InvalidNodeId) ? GetWorldTM(parent).GetInverse() * worldTM : worldTM;
+        m_worldTMs[slot] = worldTM;
+        MarkPending(slot, WorldSet);
+    }
+
+    const AZ::Transform& TransformHierarchy::GetLocalTM(NodeId node) const
+    {
+        const uint32_t slot = GetSlot(node);
+        AZ_Assert(slot != InvalidSlot, "Invalid transform hierarchy node %u.", node);
+        return m_localTMs[slot];
+    }
+
+    const AZ::Transform& TransformHierarchy::GetWorldTM(NodeId node)
+    {
+        const uint32_t slot = GetSlot(node);
+        AZ_Assert(slot != InvalidSlot, "Invalid transform hierarchy node %u.", node);
+        if (m_pendingCount == 0 || m_resolvedGenerations[slot] == m_changeGeneration)
+        {
+            return m_worldTMs[slot];
+        }
+
+        // Walk up to the pending ancestor closest to the root, everything above it is up to date. An ancestor that was already
+        // resolved since the last change is up to date as well, so the walk stops there.
+        m_resolveChain.clear();
+        uint32_t startIndex = InvalidSlot;
+        for (uint32_t current = slot; current != InvalidSlot; current = GetParentSlot(current))
+        {
+            m_resolveChain.push_back(current);
+            if (m_resolvedGenerations[current] == m_changeGeneration)
+            {
+                startIndex = aznumeric_cast<uint32_t>(m_resolveChain.size() - 1);
+                break;
+            }
+            if (m_flags[current] & (Dirty | WorldSet))
+            {
+                startIndex = aznumeric_cast<uint32_t>(m_resolveChain.size() - 1);
+            }
+        }
+        if (startIndex == InvalidSlot)
+        {
+            return m_worldTMs[slot];
+        }
+
+        // Recompute the chain from that ancestor down to the node. The start keeps its world transform unless it's dirty, the
+        // same way the update treats it. The pending flags are kept so the next update still propagates the changes to the other
+        // descendants and reports them. Resolved nodes aren't written again until the next change, so resolving other nodes doesn't
+        // write to a world transform that's already being read.
+        for (uint32_t index = startIndex + 1; index-- > 0;)
+        {
+            const uint32_t current = m_resolveChain[index];
+            if (m_resolvedGenerations[current] == m_changeGeneration)
+            {
+                continue;
+            }
+            if (index < startIndex || (m_flags[current] & Dirty))
+            {
+                const uint32_t parentSlot = GetParentSlot(current);
+                m_worldTMs[current] = (parentSlot != InvalidSlot) ? m_worldTMs[parentSlot] * m_localTMs[current] : m_localTMs[current];
+            }
+            m_resolvedGenerations[current] = m_changeGeneration;
+        }
+        return m_worldTMs[slot];
+    }
+
+    bool TransformHierarchy::HasPendingChanges() const
+    {
+        return m_pendingCount > 0 || m_orderDirty;
+    }
+
+    uint32_t TransformHierarchy::GetNodeCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_slotNodes.size());
+    }
+
+    uint32_t TransformHierarchy::GetDepthCount() const
+    {
+        return m_depthStarts.empty() ? 0 : aznumeric_cast<uint32_t>(m_depthStarts.size() - 1);
+    }
+
+    void TransformHierarchy::UpdateWorldTransforms(AZStd::vector<NodeId>& changedNodes, uint32_t parallelBatchSize)
+    {
+        if (m_orderDirty)
+        {
+            SortByDepth();
+        }
+        if (m_pendingCount == 0)
+        {
+            return;
+        }
+
+        for (size_t depth = 0; depth + 1 < m_depthStarts.size(); ++depth)
+        {
+            const uint32_t begin = m_depthStarts[depth];
+            const uint32_t end = m_depthStarts[depth + 1];
+            if (parallelBatchSize == 0 || end - begin < parallelBatchSize * 2)
+            {
+                UpdateRange(begin, end);
+                continue;
+            }
+
+            // Nodes on the same depth only read from their parents, which were all updated with the previous depth.
+            static const AZ::TaskDescriptor descriptor{ "AzFramework::TransformHierarchy::UpdateWorldTransforms", "Transform" };
+            AZ::TaskGraph taskGraph{ "TransformHierarchy::UpdateWorldTransforms" };
+            for (uint32_t batchBegin = begin; batchBegin < end; batchBegin += parallelBatchSize)
+            {
+                const uint32_t batchEnd = AZStd::min(batchBegin + parallelBatchSize, end);
+                taskGraph.AddTask(descriptor, [this, batchBegin, batchEnd]()
+                {
+                    UpdateRange(batchBegin, batchEnd);
+                });
+            }
+            AZ::TaskGraphEvent waitForCompletion{ "TransformHierarchy::UpdateWorldTransforms Wait" };
+            taskGraph.Submit(&waitForCompletion);
+            waitForCompletion.Wait();
+        }
+
+        for (uint32_t slot = 0; slot < m_flags.size(); ++slot)
+        {
+            if (m_flags[slot] & Changed)
+            {
+                changedNodes.push_back(m_slotNodes[slot]);
+            }
+            m_flags[slot] = 0;
+        }
+        m_pendingCount = 0;
+        m_changeGeneration += 1;
+    }
+
+    void TransformHierarchy::UpdateRange(uint32_t begin, uint32_t end)
+    {
+        for (uint32_t slot = begin; slot < end; ++slot)
+        {
+            uint8_t flags = m_flags[slot];
+            const uint32_t parentSlot = m_parentSlots[slot];
+            const bool parentChanged = (parentSlot != InvalidSlot) && (m_flags[parentSlot] & Changed);
+            if ((flags & Dirty) || parentChanged)
+            {
+                m_worldTMs[slot] = (parentSlot != InvalidSlot) ? m_worldTMs[parentSlot] * m_localTMs[slot] : m_localTMs[slot];
+                flags |= Changed;
+            }
+            else if (flags & WorldSet)
+            {
+                flags |= Changed;
+            }
+            m_flags[slot] = flags;
+        }
+    }
+
+    void TransformHierarchy::SortByDepth()
+    {
+        const uint32_t slotCount = aznumeric_cast<uint32_t>(m_slotNodes.size());
+
+        // Resolve the depth of every slot, walking up only until an ancestor with a known depth is found.
+        AZStd::vector<uint32_t> depths(slotCount, InvalidSlot);
+        uint32_t maxDepth = 0;
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            m_resolveChain.clear();
+            uint32_t current = slot;
+            while (current != InvalidSlot && depths[current] == InvalidSlot)
+            {
+                m_resolveChain.push_back(current);
+                current = GetParentSlot(current);
+            }
+            uint32_t depth = (current == InvalidSlot) ? 0 : depths[current] + 1;
+            for (size_t index = m_resolveChain.size(); index-- > 0;)
+            {
+                depths[m_resolveChain[index]] = depth++;
+            }
+            maxDepth = AZStd::max(maxDepth, depths[slot]);
+        }
+
+        // Counting sort by depth, which keeps the relative order of the slots on each depth.
+        m_depthStarts.assign(slotCount > 0 ? maxDepth + 2 : 1, 0);
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            m_depthStarts[depths[slot] + 1] += 1;
+        }
+        for (size_t depth = 1; depth < m_depthStarts.size(); ++depth)
+        {
+            m_depthStarts[depth] += m_depthStarts[depth - 1];
+        }
+        AZStd::vector<uint32_t> sortedSlots(slotCount);
+        {
+            AZStd::vector<uint32_t> nextSlots(m_depthStarts.begin(), m_depthStarts.end() - 1);
+            for (uint32_t slot = 0; slot < slotCount; ++slot)
+            {
+                sortedSlots[slot] = nextSlots[depths[slot]]++;
+            }
+        }
+
+        auto reorder = [&sortedSlots](auto& values)
+        {
+            AZStd::remove_reference_t<decltype(values)> sortedValues(values.size());
+            for (size_t slot = 0; slot < values.size(); ++slot)
+            {
+                sortedValues[sortedSlots[slot]] = values[slot];
+            }
+            values.swap(sortedValues);
+        };
+        reorder(m_slotNodes);
+        reorder(m_parentNodes);
+        reorder(m_childCounts);
+        reorder(m_localTMs);
+        reorder(m_worldTMs);
+        reorder(m_flags);
+        reorder(m_resolvedGenerations);
+
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            m_nodeSlots[m_slotNodes[slot]] = slot;
+        }
+        m_parentSlots.resize(slotCount);
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            m_parentSlots[slot] = GetParentSlot(slot);
+        }
+        m_orderDirty = false;
+    }
+
+    void TransformHierarchy::MarkPending(uint32_t slot, uint8_t flag)
+    {
+        if ((m_flags[slot] & (Dirty | WorldSet)) == 0)
+        {
+            m_pendingCount += 1;
+        }
+        m_flags[slot] |= flag;
+        m_changeGeneration += 1;
+    }
+
+    uint32_t TransformHierarchy::GetSlot(NodeId node) const
+    {
+        return node < m_nodeSlots.size() ? m_nodeSlots[node] : InvalidSlot;
+    }
+
+    uint32_t TransformHierarchy::GetParentSlot(uint32_t slot) const
+    {
+        const NodeId parent = m_parentNodes[slot];
+        return parent != InvalidNodeId ? m_nodeSlots[parent] : InvalidSlot;
+    }
+} // namespace AzFramework
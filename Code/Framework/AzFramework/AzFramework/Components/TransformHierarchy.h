@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    //! Central store for a hierarchy of transforms.
+    //! Local and world transforms are kept in contiguous arrays sorted by depth in the hierarchy, so the world transforms of all
+    //! changed nodes and their descendants can be recomputed in one linear pass where every parent is updated before its children.
+    //! Nodes on the same depth are independent of each other, which allows large levels to be updated in parallel.
+    //! Changes to local transforms only mark nodes as dirty, world transforms are propagated in UpdateWorldTransforms or resolved
+    //! on demand for a single node through GetWorldTM.
+    class TransformHierarchy
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TransformHierarchy, AZ::SystemAllocator);
+
+        using NodeId = uint32_t;
+        static constexpr NodeId InvalidNodeId = AZStd::numeric_limits<NodeId>::max();
+
+        //! Adds a new root node with the given local transform, which is also its world transform.
+        NodeId AddNode(const AZ::Transform& localTM);
+        //! Removes the node. Children of the node become root nodes and keep their current world transform.
+        void RemoveNode(NodeId node);
+
+        //! Sets the parent of a node, or makes it a root node if parent is InvalidNodeId.
+        //! The local transform is kept, so the world transform of the node and all of its descendants will change.
+        void SetParent(NodeId node, NodeId parent);
+        NodeId GetParent(NodeId node) const;
+
+        //! Sets the local transform and marks the node as dirty.
+        void SetLocalTM(NodeId node, const AZ::Transform& localTM);
+        //! Sets the world transform, the local transform is derived from the current world transform of the parent.
+        void SetWorldTM(NodeId node, const AZ::Transform& worldTM);
+
+        const AZ::Transform& GetLocalTM(NodeId node) const;
+        //! Returns the up to date world transform of the node, resolving pending changes on the chain of its ancestors if needed.
+        //! Once resolved, the world transform isn't written again until the next change to the hierarchy.
+        const AZ::Transform& GetWorldTM(NodeId node);
+
+        //! Returns true if there are dirty nodes that haven't been propagated by UpdateWorldTransforms yet.
+        bool HasPendingChanges() const;
+        uint32_t GetNodeCount() const;
+        uint32_t GetDepthCount() const;
+
+        //! Recomputes the world transforms of all dirty nodes and their descendants.
+        //! The nodes whose world transform changed are appended to changedNodes, parents before their children.
+        //! Levels with at least parallelBatchSize nodes are split across tasks, 0 keeps the update on the calling thread.
+        void UpdateWorldTransforms(AZStd::vector<NodeId>& changedNodes, uint32_t parallelBatchSize = 0);
+
+    private:
+        static constexpr uint32_t InvalidSlot = AZStd::numeric_limits<uint32_t>::max();
+
+        enum NodeFlags : uint8_t
+        {
+            Dirty = 1 << 0, //!< The world transform needs to be computed from the parent and the local transform.
+            WorldSet = 1 << 1, //!< The world transform was set directly, only descendants need to be recomputed.
+            Changed = 1 << 2 //!< The world transform changed during the current update.
+        };
+
+        void SortByDepth();
+        void UpdateRange(uint32_t begin, uint32_t end);
+        void MarkPending(uint32_t slot, uint8_t flag);
+        uint32_t GetSlot(NodeId node) const;
+        uint32_t GetParentSlot(uint32_t slot) const;
+
+        //! Node id to slot, InvalidSlot for released ids.
+        AZStd::vector<uint32_t> m_nodeSlots;
+        AZStd::vector<NodeId> m_freeNodes;
+
+        //! Per slot data, sorted by depth unless m_orderDirty is set.
+        //! @{
+        AZStd::vector<NodeId> m_slotNodes;
+        AZStd::vector<NodeId> m_parentNodes;
+        AZStd::vector<uint32_t> m_parentSlots; //!< Only valid while the order is clean.
+        AZStd::vector<uint32_t> m_childCounts;
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<uint8_t> m_flags;
+        AZStd::vector<uint32_t> m_resolvedGenerations; //!< Change generation in which GetWorldTM last resolved the slot.
+        //! @}
+
+        //! First slot of each depth, followed by the slot count.
+        AZStd::vector<uint32_t> m_depthStarts;
+        AZStd::vector<uint32_t> m_resolveChain; //!< Scratch space for walking up the hierarchy.
+        uint32_t m_pendingCount = 0;
+        uint32_t m_changeGeneration = 1; //!< Incremented by every change, which invalidates the slots resolved before it.
+        bool m_orderDirty = false;
+    };
+} // namespace AzFramework
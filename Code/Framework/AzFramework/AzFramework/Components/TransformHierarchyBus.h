@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTIMacros.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Provides an interface to the central transform hierarchy used by transform components when az_transform_hierarchy is enabled.
+    //! Transform components that are part of the hierarchy defer the propagation of world transforms to their children, which
+    //! is done for all entities in one batched pass per frame instead of through recursive TransformNotificationBus calls.
+    class ITransformHierarchy
+    {
+    public:
+        AZ_RTTI(ITransformHierarchy, "{2B05F31C-ED77-4E3A-A931-0083E9461365}");
+
+        using NodeId = TransformHierarchy::NodeId;
+
+        //! Adds a transform as a root node with the given world transform.
+        virtual NodeId AddTransform(TransformComponent* transform, const AZ::Transform& worldTM) = 0;
+        virtual void RemoveTransform(NodeId node) = 0;
+
+        //! Sets the parent of the node, the node becomes a root if parent is InvalidNodeId.
+        virtual void SetParent(NodeId node, NodeId parent, const AZ::Transform& localTM) = 0;
+        virtual void SetLocalTM(NodeId node, const AZ::Transform& localTM) = 0;
+        virtual void SetWorldTM(NodeId node, const AZ::Transform& worldTM) = 0;
+        virtual AZ::Transform GetLocalTM(NodeId node) = 0;
+        //! Returns the current world transform, including changes to ancestors that haven't been propagated yet.
+        //! It's returned by value, since adding, removing and sorting nodes moves the world transforms stored in the hierarchy.
+        virtual AZ::Transform GetWorldTM(NodeId node) = 0;
+
+        //! Propagates all pending changes and notifies the transform components whose world transform changed.
+        //! @note During normal operation this is called every frame in OnTick but can
+        //! also be called explicitly (e.g. For testing purposes).
+        virtual void ProcessTransformHierarchy() = 0;
+
+    protected:
+        ~ITransformHierarchy() = default;
+    };
+} // namespace AzFramework
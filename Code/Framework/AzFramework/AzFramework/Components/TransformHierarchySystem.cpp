@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchySystem.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    AZ_CVAR(uint32_t, az_transform_hierarchy_parallel_batch_size, 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of transforms per task when propagating a depth of the transform hierarchy in parallel. 0 disables parallel updates.");
+
+    void TransformHierarchySystem::Connect()
+    {
+        AZ::Interface<ITransformHierarchy>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformHierarchySystem::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+
+        // Transforms that are still active fall back to propagating their own changes.
+        AZStd::vector<TransformComponent*> transforms;
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            for (const TransformEntry& entry : m_transforms)
+            {
+                if (entry.m_transform)
+                {
+                    transforms.push_back(entry.m_transform);
+                }
+            }
+        }
+        for (TransformComponent* transform : transforms)
+        {
+            transform->OnTransformHierarchyDisconnected();
+        }
+
+        AZ::Interface<ITransformHierarchy>::Unregister(this);
+
+        AZStd::scoped_lock lock(m_mutex);
+        m_hierarchy = TransformHierarchy();
+        m_transforms.clear();
+        m_changedNodes.clear();
+        m_notificationBuffer.clear();
+    }
+
+    ITransformHierarchy::NodeId TransformHierarchySystem::AddTransform(TransformComponent* transform, const AZ::Transform& worldTM)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        const NodeId node = m_hierarchy.AddNode(worldTM);
+        if (node >= m_transforms.size())
+        {
+            m_transforms.resize(node + 1);
+        }
+        m_transforms[node].m_transform = transform;
+        return node;
+    }
+
+    void TransformHierarchySystem::RemoveTransform(NodeId node)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_hierarchy.RemoveNode(node);
+        if (node < m_transforms.size())
+        {
+            m_transforms[node].m_transform = nullptr;
+            m_transforms[node].m_generation += 1;
+        }
+    }
+
+    void TransformHierarchySystem::SetParent(NodeId node, NodeId parent, const AZ::Transform& localTM)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_hierarchy.SetParent(node, parent);
+        m_hierarchy.SetLocalTM(node, localTM);
+    }
+
+    void TransformHierarchySystem::SetLocalTM(NodeId node, const AZ::Transform& localTM)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_hierarchy.SetLocalTM(node, localTM);
+    }
+
+    void TransformHierarchySystem::SetWorldTM(NodeId node, const AZ::Transform& worldTM)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_hierarchy.SetWorldTM(node, worldTM);
+    }
+
+    AZ::Transform TransformHierarchySystem::GetLocalTM(NodeId node)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_hierarchy.GetLocalTM(node);
+    }
+
+    AZ::Transform TransformHierarchySystem::GetWorldTM(NodeId node)
+    {
+        // Adding and removing transforms moves the world transforms around, so every read locks, even without pending changes.
+        AZStd::scoped_lock lock(m_mutex);
+        return m_hierarchy.GetWorldTM(node);
+    }
+
+    void TransformHierarchySystem::ProcessTransformHierarchy()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        AZStd::vector<PendingNotification> notifications;
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            if (!m_hierarchy.HasPendingChanges())
+            {
+                return;
+            }
+
+            auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+
+            m_changedNodes.clear();
+            m_hierarchy.UpdateWorldTransforms(m_changedNodes, useTaskGraph ? uint32_t(az_transform_hierarchy_parallel_batch_size) : 0);
+
+            // Reuse the notification buffer, it's handed back below unless a notification processed the hierarchy again.
+            notifications.swap(m_notificationBuffer);
+            notifications.clear();
+            for (NodeId node : m_changedNodes)
+            {
+                notifications.push_back({ node, m_transforms[node].m_generation });
+            }
+        }
+
+        // Notifications are sent without holding the lock, handlers are free to move other transforms or to deactivate entities.
+        // Changed nodes are sorted by depth, so parents notify before their children.
+        for (const PendingNotification& notification : notifications)
+        {
+            TransformComponent* transform = nullptr;
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                const TransformEntry& entry = m_transforms[notification.m_node];
+                if (entry.m_generation == notification.m_generation)
+                {
+                    transform = entry.m_transform;
+                }
+            }
+            if (transform)
+            {
+                transform->OnTransformHierarchyUpdated();
+            }
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+        if (m_notificationBuffer.empty())
+        {
+            m_notificationBuffer.swap(notifications);
+        }
+    }
+
+    void TransformHierarchySystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ProcessTransformHierarchy();
+    }
+
+    int TransformHierarchySystem::GetTickOrder()
+    {
+        // Propagate the transforms moved by gameplay, animation and physics before anything is rendered.
+        return AZ::TICK_PRE_RENDER;
+    }
+} // namespace AzFramework
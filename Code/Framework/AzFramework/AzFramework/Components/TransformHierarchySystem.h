@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Components/TransformHierarchyBus.h>
+
+namespace AzFramework
+{
+    //! Owns the transform hierarchy shared by all transform components and propagates their world transforms once per frame.
+    class TransformHierarchySystem
+        : public ITransformHierarchy
+        , private AZ::TickBus::Handler
+    {
+    public:
+        void Connect();
+        void Disconnect();
+
+        // ITransformHierarchy overrides ...
+        NodeId AddTransform(TransformComponent* transform, const AZ::Transform& worldTM) override;
+        void RemoveTransform(NodeId node) override;
+        void SetParent(NodeId node, NodeId parent, const AZ::Transform& localTM) override;
+        void SetLocalTM(NodeId node, const AZ::Transform& localTM) override;
+        void SetWorldTM(NodeId node, const AZ::Transform& worldTM) override;
+        AZ::Transform GetLocalTM(NodeId node) override;
+        AZ::Transform GetWorldTM(NodeId node) override;
+        void ProcessTransformHierarchy() override;
+
+    private:
+        struct TransformEntry
+        {
+            TransformComponent* m_transform = nullptr;
+            uint32_t m_generation = 0; //!< Incremented when the node is removed, so pending notifications for it can be dropped.
+        };
+
+        struct PendingNotification
+        {
+            NodeId m_node;
+            uint32_t m_generation;
+        };
+
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        AZStd::mutex m_mutex;
+        TransformHierarchy m_hierarchy;
+        AZStd::vector<TransformEntry> m_transforms; //!< Indexed by node id.
+        AZStd::vector<NodeId> m_changedNodes;
+        AZStd::vector<PendingNotification> m_notificationBuffer;
+    };
+} // namespace AzFramework
@@ -100,6 +100,7 @@ namespace AzFramework
         GameEntityContextRequestBus::Handler::BusConnect();
 
         m_entityVisibilityBoundsUnionSystem.Connect();
+        m_transformHierarchySystem.Connect();
     }
 
     //=========================================================================
@@ -107,6 +108,7 @@ namespace AzFramework
     //=========================================================================
     void GameEntityContextComponent::Deactivate()
     {
+        m_transformHierarchySystem.Disconnect();
         m_entityVisibilityBoundsUnionSystem.Disconnect();
 
         GameEntityContextRequestBus::Handler::BusDisconnect();
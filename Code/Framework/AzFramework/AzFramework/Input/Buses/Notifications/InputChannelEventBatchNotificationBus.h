@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/span.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace AzFramework
+{
+    struct BufferedInputChannelEvent;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! EBus interface used to receive all input channel events of a frame at once. This is an
+    //! alternative to InputChannelNotificationBus for listeners that only need to observe input,
+    //! as it costs one call per frame instead of one call per event. Events have already been
+    //! broadcast through InputChannelNotificationBus when the batch is sent, so batch listeners
+    //! can't consume them, but they can check whether another listener did.
+    class InputChannelEventBatchNotifications : public AZ::EBusTraits
+    {
+    public:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! EBus Trait: input notifications are addressed to a single address
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! EBus Trait: input notifications can be handled by multiple (ordered) listeners
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::MultipleAndOrdered;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Default destructor
+        virtual ~InputChannelEventBatchNotifications() = default;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Override to be notified of all input channel events broadcast since the last batch
+        //! \param[in] inputChannelEvents The events, in the order they were broadcast
+        virtual void OnInputChannelEventBatch(AZStd::span<const BufferedInputChannelEvent> inputChannelEvents) = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Access to the priority of the input notification handler (sorted from highest to lowest)
+        //! \return Priority of the input notification handler
+        virtual AZ::s32 GetPriority() const { return 0; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Compare function required by BusHandlerOrderCompare = BusHandlerCompareDefault
+        //! \param[in] other Another instance of the class to compare
+        //! \return True if the priority of this handler is greater than the other, false otherwise
+        inline bool Compare(const InputChannelEventBatchNotifications* other) const
+        {
+            return GetPriority() > other->GetPriority();
+        }
+    };
+    using InputChannelEventBatchNotificationBus = AZ::EBus<InputChannelEventBatchNotifications>;
+} // namespace AzFramework
@@ -11,6 +11,7 @@
 #include <AzFramework/Input/Devices/InputDevice.h>
 
 #include <AzFramework/Input/Buses/Notifications/InputChannelNotificationBus.h>
+#include <AzFramework/Input/Events/InputChannelEventBuffer.h>
 
 #include <AzCore/RTTI/BehaviorContext.h>
 
@@ -334,6 +335,7 @@ namespace AzFramework
             InputChannelNotificationBus::Broadcast(&InputChannelNotifications::OnInputChannelEvent,
                                                    *this,
                                                    hasBeenConsumed);
+            InputChannelEventBuffer::RecordEvent(*this, hasBeenConsumed);
         }
 
         return m_state != previousState;
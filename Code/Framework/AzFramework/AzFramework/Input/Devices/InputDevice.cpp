@@ -9,6 +9,7 @@
 #include <AzFramework/Input/Devices/InputDevice.h>
 
 #include <AzFramework/Input/Buses/Notifications/InputChannelNotificationBus.h>
+#include <AzFramework/Input/Events/InputChannelEventBuffer.h>
 #include <AzFramework/Input/Buses/Notifications/InputDeviceNotificationBus.h>
 #include <AzFramework/Input/Buses/Notifications/InputTextNotificationBus.h>
 #include <AzFramework/Input/Buses/Requests/InputChannelRequestBus.h>
@@ -115,6 +116,7 @@ namespace AzFramework
         bool hasBeenConsumed = false;
         InputChannelNotificationBus::Broadcast(
             &InputChannelNotifications::OnInputChannelEvent, inputChannel, hasBeenConsumed);
+        InputChannelEventBuffer::RecordEvent(inputChannel, hasBeenConsumed);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
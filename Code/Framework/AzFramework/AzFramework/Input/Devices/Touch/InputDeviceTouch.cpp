@@ -146,10 +146,12 @@ namespace AzFramework
                                                                    float normalizedY,
                                                                    float pressure,
                                                                    AZ::u32 index,
-                                                                   State state)
+                                                                   State state,
+                                                                   AZStd::chrono::steady_clock::time_point timestamp)
         : InputChannelAnalogWithPosition2D::RawInputEvent(normalizedX, normalizedY, pressure)
         , m_index(index)
         , m_state(state)
+        , m_timestamp(timestamp)
     {
     }
 
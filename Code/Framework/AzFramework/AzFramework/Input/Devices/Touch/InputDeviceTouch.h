@@ -11,6 +11,8 @@
 #include <AzFramework/Input/Devices/InputDevice.h>
 #include <AzFramework/Input/Channels/InputChannelAnalogWithPosition2D.h>
 
+#include <AzCore/std/chrono/chrono.h>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace AzFramework
 {
@@ -195,12 +197,14 @@ namespace AzFramework
 
                 ////////////////////////////////////////////////////////////////////////////////////
                 //! Constructor
+                //! \param[in] timestamp When the platform received the raw touch event (default now)
                 explicit RawTouchEvent(
                     float normalizedX,
                     float normalizedY,
                     float pressure,
                     AZ::u32 index,
-                    State state);
+                    State state,
+                    AZStd::chrono::steady_clock::time_point timestamp = AZStd::chrono::steady_clock::now());
 
                 ////////////////////////////////////////////////////////////////////////////////////
                 // Default copying
@@ -214,6 +218,7 @@ namespace AzFramework
                 // Variables
                 AZ::u32 m_index; //!< The index of the raw touch event
                 State m_state;   //!< The state of the raw touch event
+                AZStd::chrono::steady_clock::time_point m_timestamp; //!< When it was received
             };
 
             ////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Input/Events/InputChannelEventBatchListener.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace AzFramework
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    InputChannelEventBatchListener::InputChannelEventBatchListener()
+        : m_filter()
+        , m_priority(0)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    InputChannelEventBatchListener::InputChannelEventBatchListener(bool autoConnect)
+        : m_filter()
+        , m_priority(0)
+    {
+        if (autoConnect)
+        {
+            Connect();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    InputChannelEventBatchListener::InputChannelEventBatchListener(AZStd::shared_ptr<InputChannelEventFilter> filter,
+                                                                   AZ::s32 priority,
+                                                                   bool autoConnect)
+        : m_filter(filter)
+        , m_priority(priority)
+    {
+        if (autoConnect)
+        {
+            Connect();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    AZ::s32 InputChannelEventBatchListener::GetPriority() const
+    {
+        return m_priority;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputChannelEventBatchListener::SetFilter(AZStd::shared_ptr<InputChannelEventFilter> filter)
+    {
+        m_filter = filter;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputChannelEventBatchListener::Connect()
+    {
+        InputChannelEventBatchNotificationBus::Handler::BusConnect();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputChannelEventBatchListener::Disconnect()
+    {
+        InputChannelEventBatchNotificationBus::Handler::BusDisconnect();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputChannelEventBatchListener::OnInputChannelEventBatch(
+        AZStd::span<const BufferedInputChannelEvent> inputChannelEvents)
+    {
+        for (const BufferedInputChannelEvent& inputChannelEvent : inputChannelEvents)
+        {
+            if (inputChannelEvent.m_hasBeenConsumed)
+            {
+                continue;
+            }
+
+            if (m_filter && !m_filter->DoesPassFilter(inputChannelEvent.m_snapshot))
+            {
+                continue;
+            }
+
+            OnInputChannelEventFiltered(inputChannelEvent);
+        }
+    }
+} // namespace AzFramework
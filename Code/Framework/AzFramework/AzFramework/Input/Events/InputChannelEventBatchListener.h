@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzFramework/Input/Buses/Notifications/InputChannelEventBatchNotificationBus.h>
+#include <AzFramework/Input/Events/InputChannelEventBuffer.h>
+#include <AzFramework/Input/Events/InputChannelEventFilter.h>
+
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace AzFramework
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Class that handles batched input notifications by priority, and that allows events to be
+    //! filtered the same way as InputChannelEventListener. Listeners that only observe input can
+    //! derive from this instead of InputChannelEventListener to receive the same (unconsumed and
+    //! filtered) events once per frame, instead of through one InputChannelNotificationBus call
+    //! per event. Because the events are delivered after they were broadcast, they can't be
+    //! consumed, so listeners that need to consume input must keep using InputChannelEventListener.
+    class InputChannelEventBatchListener : public InputChannelEventBatchNotificationBus::Handler
+    {
+    public:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Constructor
+        InputChannelEventBatchListener();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Constructor
+        //! \param[in] autoConnect Whether to connect to the input notification bus on construction
+        explicit InputChannelEventBatchListener(bool autoConnect);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Constructor
+        //! \param[in] filter The filter used to determine whether an input event should be handled
+        //! \param[in] priority The priority used to sort relative to other batch listeners
+        //! \param[in] autoConnect Whether to connect to the input notification bus on construction
+        explicit InputChannelEventBatchListener(AZStd::shared_ptr<InputChannelEventFilter> filter,
+                                                AZ::s32 priority,
+                                                bool autoConnect);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Default copying
+        AZ_DEFAULT_COPY(InputChannelEventBatchListener);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Default destructor
+        ~InputChannelEventBatchListener() override = default;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \ref AzFramework::InputChannelEventBatchNotifications::GetPriority
+        AZ::s32 GetPriority() const override;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Allow the filter to be set as necessary even if already connected to the input event bus
+        //! \param[in] filter The filter used to determine whether an input event should be handled
+        void SetFilter(AZStd::shared_ptr<InputChannelEventFilter> filter);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Connect to the input notification bus to start receiving input notifications
+        void Connect();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Disconnect from the input notification bus to stop receiving input notifications
+        void Disconnect();
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \ref AzFramework::InputChannelEventBatchNotifications::OnInputChannelEventBatch
+        void OnInputChannelEventBatch(AZStd::span<const BufferedInputChannelEvent> inputChannelEvents) final;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Override to be notified of each input channel event of the batch, in the order they were
+        //! broadcast, unless the event was consumed by an input channel listener or did not pass
+        //! the filter.
+        //! \param[in] inputChannelEvent The buffered input channel event
+        virtual void OnInputChannelEventFiltered(const BufferedInputChannelEvent& inputChannelEvent) = 0;
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Variables
+        AZStd::shared_ptr<InputChannelEventFilter> m_filter;   //!< The shared input event filter
+        AZ::s32                                    m_priority; //!< The priority used for sorting
+    };
+} // namespace AzFramework
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Input/Events/InputChannelEventBuffer.h>
+#include <AzFramework/Input/Buses/Notifications/InputChannelEventBatchNotificationBus.h>
+
+#include <AzCore/Interface/Interface.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace AzFramework
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    BufferedInputChannelEvent::BufferedInputChannelEvent(const InputChannel& inputChannel,
+                                                         bool hasBeenConsumed,
+                                                         AZStd::chrono::steady_clock::time_point timestamp)
+        : m_snapshot(inputChannel)
+        , m_timestamp(timestamp)
+        , m_normalizedPosition(AZ::Vector2::CreateZero())
+        , m_hasPosition(false)
+        , m_hasBeenConsumed(hasBeenConsumed)
+    {
+        const auto* positionData2D = azrtti_cast<const InputChannel::PositionData2D*>(inputChannel.GetCustomData());
+        if (positionData2D)
+        {
+            m_normalizedPosition = positionData2D->m_normalizedPosition;
+            m_hasPosition = true;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    InputChannelEventBuffer::ScopedEventTimestamp::ScopedEventTimestamp(
+        AZStd::chrono::steady_clock::time_point timestamp)
+        : m_inputChannelEventBuffer(nullptr)
+        , m_previous()
+    {
+        if (!InputChannelEventBatchNotificationBus::HasHandlers())
+        {
+            return;
+        }
+
+        m_inputChannelEventBuffer = AZ::Interface<InputChannelEventBuffer>::Get();
+        if (m_inputChannelEventBuffer)
+        {
+            m_previous = m_inputChannelEventBuffer->m_eventTimestamp;
+            m_inputChannelEventBuffer->m_eventTimestamp = timestamp;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    InputChannelEventBuffer::ScopedEventTimestamp::~ScopedEventTimestamp()
+    {
+        if (m_inputChannelEventBuffer)
+        {
+            m_inputChannelEventBuffer->m_eventTimestamp = m_previous;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputChannelEventBuffer::RecordEvent(const InputChannel& inputChannel, bool hasBeenConsumed)
+    {
+        if (!InputChannelEventBatchNotificationBus::HasHandlers())
+        {
+            return;
+        }
+
+        if (InputChannelEventBuffer* inputChannelEventBuffer = AZ::Interface<InputChannelEventBuffer>::Get())
+        {
+            inputChannelEventBuffer->Record(inputChannel, hasBeenConsumed);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputChannelEventBuffer::Record(const InputChannel& inputChannel, bool hasBeenConsumed)
+    {
+        Record(inputChannel,
+               hasBeenConsumed,
+               m_eventTimestamp ? *m_eventTimestamp : AZStd::chrono::steady_clock::now());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputChannelEventBuffer::Record(const InputChannel& inputChannel,
+                                         bool hasBeenConsumed,
+                                         AZStd::chrono::steady_clock::time_point timestamp)
+    {
+        m_events.emplace_back(inputChannel, hasBeenConsumed, timestamp);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    AZStd::span<const BufferedInputChannelEvent> InputChannelEventBuffer::GetEvents() const
+    {
+        return m_events;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputChannelEventBuffer::Dispatch()
+    {
+        if (m_events.empty())
+        {
+            return;
+        }
+
+        // Swap the events out before dispatching them, so any events broadcast by the listeners
+        // are recorded for the next batch instead of invalidating the one being dispatched.
+        m_dispatch.swap(m_events);
+        InputChannelEventBatchNotificationBus::Broadcast(
+            &InputChannelEventBatchNotifications::OnInputChannelEventBatch,
+            AZStd::span<const BufferedInputChannelEvent>(m_dispatch));
+        m_dispatch.clear();
+    }
+} // namespace AzFramework
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzFramework/Input/Channels/InputChannel.h>
+
+#include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace AzFramework
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Snapshot of an input channel event, stored when the event was broadcast by its input channel
+    struct BufferedInputChannelEvent
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Constructor
+        //! \param[in] inputChannel The input channel that broadcast the event
+        //! \param[in] hasBeenConsumed Whether the event was consumed by an input channel listener
+        //! \param[in] timestamp When the input device received the raw input that caused the event
+        BufferedInputChannelEvent(const InputChannel& inputChannel,
+                                  bool hasBeenConsumed,
+                                  AZStd::chrono::steady_clock::time_point timestamp);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Variables
+        InputChannel::Snapshot m_snapshot;                   //!< The state of the input channel
+        AZStd::chrono::steady_clock::time_point m_timestamp; //!< When the raw input was received
+        AZ::Vector2 m_normalizedPosition;                    //!< The position, if m_hasPosition
+        bool m_hasPosition;                                  //!< Does the channel have a position?
+        bool m_hasBeenConsumed;                              //!< Was the event consumed already?
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Collects all input channel events broadcast during a frame into one contiguous array, so
+    //! that listeners connected to InputChannelEventBatchNotificationBus can process every event
+    //! of the frame in a single pass instead of receiving one InputChannelNotificationBus call for
+    //! each event. Events are only recorded while there are batch listeners, and they are recorded
+    //! after the InputChannelNotificationBus broadcast so consumption by per event listeners is
+    //! preserved. The buffer is owned by the input system component, which dispatches it after it
+    //! ticks all input devices.
+    //!
+    //! Each event is timestamped with the time its input device received the raw input, if the
+    //! device provides one through ScopedEventTimestamp, or with the time it was broadcast if not.
+    class InputChannelEventBuffer
+    {
+    public:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Type Info
+        AZ_RTTI(InputChannelEventBuffer, "{031FBDAC-27AF-4B18-AE3A-66F1D87A4C09}");
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Timestamps all events recorded while it is in scope, used by input devices to provide
+        //! the time that raw input was received while it is being processed by its input channel.
+        class ScopedEventTimestamp
+        {
+        public:
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Constructor
+            //! \param[in] timestamp When the input device received the raw input being processed
+            explicit ScopedEventTimestamp(AZStd::chrono::steady_clock::time_point timestamp);
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            // Disable copying
+            AZ_DISABLE_COPY_MOVE(ScopedEventTimestamp);
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Destructor
+            ~ScopedEventTimestamp();
+
+        private:
+            ////////////////////////////////////////////////////////////////////////////////////////
+            // Variables
+            InputChannelEventBuffer* m_inputChannelEventBuffer;                   //!< The buffer
+            AZStd::optional<AZStd::chrono::steady_clock::time_point> m_previous;  //!< To restore
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Default destructor
+        virtual ~InputChannelEventBuffer() = default;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Record an event broadcast by an input channel into the buffer registered with
+        //! AZ::Interface, if there is one and if there are any batch listeners
+        //! \param[in] inputChannel The input channel that broadcast the event
+        //! \param[in] hasBeenConsumed Whether the event was consumed by an input channel listener
+        static void RecordEvent(const InputChannel& inputChannel, bool hasBeenConsumed);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Add an event to the buffer
+        //! \param[in] inputChannel The input channel that broadcast the event
+        //! \param[in] hasBeenConsumed Whether the event was consumed by an input channel listener
+        void Record(const InputChannel& inputChannel, bool hasBeenConsumed);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Add an event to the buffer
+        //! \param[in] inputChannel The input channel that broadcast the event
+        //! \param[in] hasBeenConsumed Whether the event was consumed by an input channel listener
+        //! \param[in] timestamp When the input device received the raw input that caused the event
+        void Record(const InputChannel& inputChannel,
+                    bool hasBeenConsumed,
+                    AZStd::chrono::steady_clock::time_point timestamp);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Access to the events recorded since the buffer was last dispatched
+        //! \return The recorded events, in the order they were broadcast
+        AZStd::span<const BufferedInputChannelEvent> GetEvents() const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Send all recorded events to the batch listeners and clear the buffer
+        void Dispatch();
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Variables
+        AZStd::vector<BufferedInputChannelEvent> m_events;   //!< Events recorded this frame
+        AZStd::vector<BufferedInputChannelEvent> m_dispatch; //!< Events that are being dispatched
+        AZStd::optional<AZStd::chrono::steady_clock::time_point> m_eventTimestamp; //!< Device time
+    };
+} // namespace AzFramework
@@ -30,11 +30,28 @@ namespace AzFramework
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     bool InputChannelEventFilterInclusionList::DoesPassFilter(const InputChannel& inputChannel) const
+    {
+        return IsIncluded(inputChannel.GetInputChannelId().GetNameCrc32(),
+                          inputChannel.GetInputDevice().GetInputDeviceId().GetNameCrc32(),
+                          inputChannel.GetInputDevice().GetAssignedLocalUserId());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool InputChannelEventFilterInclusionList::DoesPassFilter(const InputChannel::Snapshot& inputChannelSnapshot) const
+    {
+        return IsIncluded(inputChannelSnapshot.m_channelId.GetNameCrc32(),
+                          inputChannelSnapshot.m_deviceId.GetNameCrc32(),
+                          inputChannelSnapshot.m_localUserId);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool InputChannelEventFilterInclusionList::IsIncluded(const AZ::Crc32& channelNameCrc32,
+                                                          const AZ::Crc32& deviceNameCrc32,
+                                                          LocalUserId localUserId) const
     {
         if (!m_channelNameCrc32InclusionList.empty())
         {
-            const AZ::Crc32& channelName = inputChannel.GetInputChannelId().GetNameCrc32();
-            if (m_channelNameCrc32InclusionList.find(channelName) == m_channelNameCrc32InclusionList.end())
+            if (m_channelNameCrc32InclusionList.find(channelNameCrc32) == m_channelNameCrc32InclusionList.end())
             {
                 return false;
             }
@@ -42,8 +59,7 @@ namespace AzFramework
 
         if (!m_deviceNameCrc32InclusionList.empty())
         {
-            const AZ::Crc32& deviceName = inputChannel.GetInputDevice().GetInputDeviceId().GetNameCrc32();
-            if (m_deviceNameCrc32InclusionList.find(deviceName) == m_deviceNameCrc32InclusionList.end())
+            if (m_deviceNameCrc32InclusionList.find(deviceNameCrc32) == m_deviceNameCrc32InclusionList.end())
             {
                 return false;
             }
@@ -51,7 +67,6 @@ namespace AzFramework
 
         if (!m_localUserIdInclusionList.empty())
         {
-            const LocalUserId localUserId = inputChannel.GetInputDevice().GetAssignedLocalUserId();
             if (m_localUserIdInclusionList.find(localUserId) == m_localUserIdInclusionList.end())
             {
                 return false;
@@ -111,25 +126,27 @@ namespace AzFramework
     ////////////////////////////////////////////////////////////////////////////////////////////////
     bool InputChannelEventFilterExclusionList::DoesPassFilter(const InputChannel& inputChannel) const
     {
-        const AZ::Crc32& channelName = inputChannel.GetInputChannelId().GetNameCrc32();
-        if (m_channelNameCrc32ExclusionList.find(channelName) != m_channelNameCrc32ExclusionList.end())
-        {
-            return false;
-        }
-
-        const AZ::Crc32& deviceName = inputChannel.GetInputDevice().GetInputDeviceId().GetNameCrc32();
-        if (m_deviceNameCrc32ExclusionList.find(deviceName) != m_deviceNameCrc32ExclusionList.end())
-        {
-            return false;
-        }
+        return !IsExcluded(inputChannel.GetInputChannelId().GetNameCrc32(),
+                           inputChannel.GetInputDevice().GetInputDeviceId().GetNameCrc32(),
+                           inputChannel.GetInputDevice().GetAssignedLocalUserId());
+    }
 
-        const LocalUserId localUserId = inputChannel.GetInputDevice().GetAssignedLocalUserId();
-        if (m_localUserIdExclusionList.find(localUserId) != m_localUserIdExclusionList.end())
-        {
-            return false;
-        }
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool InputChannelEventFilterExclusionList::DoesPassFilter(const InputChannel::Snapshot& inputChannelSnapshot) const
+    {
+        return !IsExcluded(inputChannelSnapshot.m_channelId.GetNameCrc32(),
+                           inputChannelSnapshot.m_deviceId.GetNameCrc32(),
+                           inputChannelSnapshot.m_localUserId);
+    }
 
-        return true;
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool InputChannelEventFilterExclusionList::IsExcluded(const AZ::Crc32& channelNameCrc32,
+                                                          const AZ::Crc32& deviceNameCrc32,
+                                                          LocalUserId localUserId) const
+    {
+        return m_channelNameCrc32ExclusionList.find(channelNameCrc32) != m_channelNameCrc32ExclusionList.end()
+            || m_deviceNameCrc32ExclusionList.find(deviceNameCrc32) != m_deviceNameCrc32ExclusionList.end()
+            || m_localUserIdExclusionList.find(localUserId) != m_localUserIdExclusionList.end();
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,14 @@ namespace AzFramework
         //! \param[in] inputChannel The input channel to be filtered
         //! \return True if the input channel passes the filter, false otherwise
         virtual bool DoesPassFilter(const InputChannel& inputChannel) const = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Check whether a snapshot of an input channel should pass through the filter, used for
+        //! buffered events that are processed after the input channel itself has been updated.
+        //! \param[in] inputChannelSnapshot The snapshot of the input channel to be filtered
+        //! 
+eturn True if the input channel snapshot passes the filter, false otherwise
+        virtual bool DoesPassFilter(const InputChannel::Snapshot& inputChannelSnapshot) const = 0;
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,6 +80,10 @@ namespace AzFramework
         //! \ref AzFramework::InputChannelEventFilter::DoesPassFilter
         bool DoesPassFilter(const InputChannel& inputChannel) const override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \ref AzFramework::InputChannelEventFilter::DoesPassFilter
+        bool DoesPassFilter(const InputChannel::Snapshot& inputChannelSnapshot) const override;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         //! Add an input channel name to the inclusion list
         //! \param[in] channelNameCrc32 The input channel name (Crc32) to add to the inclusion list
@@ -88,6 +100,16 @@ namespace AzFramework
         void IncludeLocalUserId(LocalUserId localUserId);
 
     private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Check whether an input channel is included by the filter
+        //! \param[in] channelNameCrc32 The input channel name (Crc32)
+        //! \param[in] deviceNameCrc32 The input device name (Crc32)
+        //! \param[in] localUserId The local user id assigned to the input device
+        //! \return True if the input channel is included by the filter, false otherwise
+        bool IsIncluded(const AZ::Crc32& channelNameCrc32,
+                          const AZ::Crc32& deviceNameCrc32,
+                          LocalUserId localUserId) const;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Variables
         AZStd::unordered_set<AZ::Crc32>   m_channelNameCrc32InclusionList; //!< Channel name inclusion list
@@ -116,6 +138,10 @@ namespace AzFramework
         //! \ref AzFramework::InputChannelEventFilter::DoesPassFilter
         bool DoesPassFilter(const InputChannel& inputChannel) const override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \ref AzFramework::InputChannelEventFilter::DoesPassFilter
+        bool DoesPassFilter(const InputChannel::Snapshot& inputChannelSnapshot) const override;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         //! Add an input channel name to the exclusion list
         //! \param[in] channelNameCrc32 The input channel name (Crc32) to add to the exclusion list
@@ -132,6 +158,16 @@ namespace AzFramework
         void ExcludeLocalUserId(LocalUserId localUserId);
 
     private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Check whether an input channel is excluded by the filter
+        //! \param[in] channelNameCrc32 The input channel name (Crc32)
+        //! \param[in] deviceNameCrc32 The input device name (Crc32)
+        //! \param[in] localUserId The local user id assigned to the input device
+        //! \return True if the input channel is excluded by the filter, false otherwise
+        bool IsExcluded(const AZ::Crc32& channelNameCrc32,
+                          const AZ::Crc32& deviceNameCrc32,
+                          LocalUserId localUserId) const;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Variables
         AZStd::unordered_set<AZ::Crc32>   m_channelNameCrc32ExclusionList; //!< Channel name exclusion list
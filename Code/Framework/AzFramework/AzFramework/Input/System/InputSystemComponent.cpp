@@ -18,6 +18,7 @@
 #include <AzFramework/Input/Devices/VirtualKeyboard/InputDeviceVirtualKeyboard.h>
 
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -237,6 +238,7 @@ namespace AzFramework
         // Create all enabled input devices
         CreateEnabledInputDevices();
 
+        AZ::Interface<InputChannelEventBuffer>::Register(&m_inputChannelEventBuffer);
         InputSystemRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
     }
@@ -246,6 +248,7 @@ namespace AzFramework
     {
         AZ::TickBus::Handler::BusDisconnect();
         InputSystemRequestBus::Handler::BusDisconnect();
+        AZ::Interface<InputChannelEventBuffer>::Unregister(&m_inputChannelEventBuffer);
 
         // Destroy all enabled input devices
         DestroyEnabledInputDevices();
@@ -270,6 +273,7 @@ namespace AzFramework
         m_currentlyUpdatingInputDevices = true;
         InputDeviceRequestBus::Broadcast(&InputDeviceRequests::TickInputDevice);
         m_currentlyUpdatingInputDevices = false;
+        m_inputChannelEventBuffer.Dispatch();
         InputSystemNotificationBus::Broadcast(&InputSystemNotifications::OnPostInputUpdate);
 
         if (m_recreateInputDevicesAfterUpdate)
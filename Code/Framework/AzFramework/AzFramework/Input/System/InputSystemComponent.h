@@ -9,6 +9,7 @@
 
 #include <AzFramework/Input/Buses/Requests/InputSystemRequestBus.h>
 #include <AzFramework/Input/Buses/Requests/InputSystemCursorRequestBus.h>
+#include <AzFramework/Input/Events/InputChannelEventBuffer.h>
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
@@ -116,6 +117,10 @@ namespace AzFramework
         AZStd::unique_ptr<InputDeviceTouch>                  m_touch;           //!< Touch device
         AZStd::unique_ptr<InputDeviceVirtualKeyboard>        m_virtualKeyboard; //!< Virtual keyboard device
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Input Event Variables
+        InputChannelEventBuffer m_inputChannelEventBuffer; //!< Input channel events of the frame
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Serialized Variables
         AZ::u32 m_mouseMovementSampleRateHertz; //!< The mouse movement sample rate in Hertz
@@ -10,17 +10,32 @@
 
 #include <AzFramework/Input/Buses/Notifications/InputTextNotificationBus.h>
 #include <AzFramework/Input/Channels/InputChannelId.h>
+#include <AzFramework/Input/Events/InputChannelEventBuffer.h>
 
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/typetraits/void_t.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace AzFramework
 {
+    namespace Internal
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Detects raw input event types that store when their input device received them
+        template<typename RawEventType, typename = void>
+        struct HasRawInputEventTimestamp : AZStd::false_type {};
+        template<typename RawEventType>
+        struct HasRawInputEventTimestamp<RawEventType, AZStd::void_t<decltype(AZStd::declval<const RawEventType&>().m_timestamp)>>
+            : AZStd::true_type {};
+    } // namespace Internal
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     //! Function template that processes a generic raw input event queue, given an InputChannelClass
     //! that defines a ProcessRawInputEvent function that takes a RawEventType as the only parameter.
+    //! If RawEventType has an m_timestamp member, any input channel events that are broadcast while
+    //! processing the raw event are timestamped with it in the InputChannelEventBuffer.
     //! \param[in] rawEventQueuesById A map (keyed by id) of raw input event queues.
     //! \param[in] inputChannelsById A map (keyed by id) of the input channels to potentially update.
     template<class InputChannelClass, typename RawEventType>
@@ -50,7 +65,15 @@ namespace AzFramework
                 // then clear the event queue so it can receive new events over the next frame.
                 for (const RawEventType& rawEvent : rawEventQueue)
                 {
-                    channel.ProcessRawInputEvent(rawEvent);
+                    if constexpr (Internal::HasRawInputEventTimestamp<RawEventType>::value)
+                    {
+                        InputChannelEventBuffer::ScopedEventTimestamp scopedEventTimestamp(rawEvent.m_timestamp);
+                        channel.ProcessRawInputEvent(rawEvent);
+                    }
+                    else
+                    {
+                        channel.ProcessRawInputEvent(rawEvent);
+                    }
                 }
                 rawEventQueue.clear();
             }
@@ -411,6 +411,11 @@ namespace AzFramework
         return m_entities;
     }
 
+    SpawnableClonePlan& Spawnable::GetClonePlan() const
+    {
+        return m_clonePlan;
+    }
+
     auto Spawnable::TryGetAliasesConst() const -> EntityAliasConstVisitor
     {
         int32_t expected = ShareState::NotShared;
@@ -14,6 +14,7 @@
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
 namespace AZ
@@ -167,6 +168,10 @@ namespace AzFramework
         EntityAliasVisitor TryGetAliases();
         bool IsEmpty() const;
 
+        //! Returns the plan used to quickly clone the entities in this spawnable.
+        //! The plan is a cache that's safe to use from multiple threads, so it's available on const spawnables as well.
+        SpawnableClonePlan& GetClonePlan() const;
+
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
@@ -180,6 +185,8 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+        // Cached instructions for cloning the entities in m_entities.
+        mutable SpawnableClonePlan m_clonePlan;
 
         mutable AZStd::atomic<int32_t> m_shareState{ ShareState::NotShared };
     };
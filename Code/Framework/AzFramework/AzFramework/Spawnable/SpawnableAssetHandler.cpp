@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/sort.h>
@@ -55,6 +56,14 @@ namespace AzFramework
         if (AZ::Utils::LoadObjectFromStreamInPlace(*stream, *spawnable, nullptr /*SerializeContext*/, filter))
         {
             SpawnableAssetUtils::ResolveEntityAliases(spawnable, asset.GetHint(), AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(stream->GetStreamingDeadline()), stream->GetStreamingPriority(), assetLoadFilterCB);
+
+            // Build the clone plans on the loading thread so the first spawn doesn't pay for them.
+            AZ::SerializeContext* serializeContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+            if (serializeContext)
+            {
+                spawnable->GetClonePlan().Build(spawnable->GetEntities(), *serializeContext);
+            }
             return AZ::Data::AssetHandler::LoadResult::LoadComplete;
         }
         else
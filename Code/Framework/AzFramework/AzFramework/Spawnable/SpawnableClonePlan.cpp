@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+
+namespace AzFramework
+{
+    namespace SpawnableClonePlanInternal
+    {
+        template<typename T>
+        char* GetRootAddress(T& object)
+        {
+            return reinterpret_cast<char*>(object.RTTI_AddressOf(object.RTTI_GetType()));
+        }
+
+        template<typename T>
+        const char* GetRootAddress(const T& object)
+        {
+            return reinterpret_cast<const char*>(object.RTTI_AddressOf(object.RTTI_GetType()));
+        }
+    } // namespace SpawnableClonePlanInternal
+
+    void SpawnableClonePlan::Build(const EntityList& entities, AZ::SerializeContext& serializeContext)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_entityPlansMutex);
+
+        TypeLookup typeLookup;
+        m_entityPlans.clear();
+        m_entityPlans.resize(entities.size());
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            if (entities[i])
+            {
+                BuildEntityPlan(m_entityPlans[i], *entities[i], serializeContext, typeLookup);
+            }
+        }
+    }
+
+    void SpawnableClonePlan::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_entityPlansMutex);
+        m_entityPlans.clear();
+    }
+
+    SpawnableClonePlan::SharedEntityIdMap::SharedEntityIdMap(const EntityIdMap& sharedMap)
+        : m_sharedMap(&sharedMap)
+    {
+    }
+
+    auto SpawnableClonePlan::SharedEntityIdMap::find(const AZ::EntityId& id) const -> iterator
+    {
+        // Entries in the shared map take precedence, so the generated ids only need to be checked for ids that aren't in it.
+        auto sharedIt = m_sharedMap->find(id);
+        if (sharedIt != m_sharedMap->end())
+        {
+            return &*sharedIt;
+        }
+        auto generatedIt = m_generatedIds.find(id);
+        return generatedIt != m_generatedIds.end() ? &*generatedIt : end();
+    }
+
+    auto SpawnableClonePlan::SharedEntityIdMap::end() const -> iterator
+    {
+        return nullptr;
+    }
+
+    auto SpawnableClonePlan::SharedEntityIdMap::emplace(const AZ::EntityId& id, const AZ::EntityId& cloneId)
+        -> AZStd::pair<iterator, bool>
+    {
+        auto sharedIt = m_sharedMap->find(id);
+        if (sharedIt != m_sharedMap->end())
+        {
+            return { &*sharedIt, false };
+        }
+        auto generatedIt = m_generatedIds.emplace(id, cloneId);
+        return { &*generatedIt.first, generatedIt.second };
+    }
+
+    size_t SpawnableClonePlan::SharedEntityIdMap::GetGeneratedIdCount() const
+    {
+        return m_generatedIds.size();
+    }
+
+    AZ::Entity* SpawnableClonePlan::CloneEntity(
+        const EntityList& entities, uint32_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        return CloneEntityWithMap(entities, entityIndex, prototypeToCloneMap, serializeContext);
+    }
+
+    AZ::Entity* SpawnableClonePlan::CloneEntity(
+        const EntityList& entities, uint32_t entityIndex, SharedEntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        return CloneEntityWithMap(entities, entityIndex, prototypeToCloneMap, serializeContext);
+    }
+
+    template<typename MapType>
+    AZ::Entity* SpawnableClonePlan::CloneEntityWithMap(
+        const EntityList& entities, uint32_t entityIndex, MapType& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        AZ_Assert(
+            entityIndex < entities.size(), "Entity index %u is out of range for a spawnable with %zu entities.", entityIndex,
+            entities.size());
+        const AZ::Entity& prototype = *entities[entityIndex];
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_entityPlansMutex);
+            if (entityIndex < m_entityPlans.size() && IsPlanValid(m_entityPlans[entityIndex], prototype, serializeContext))
+            {
+                return CloneWithPlan(m_entityPlans[entityIndex], prototype, prototypeToCloneMap, serializeContext);
+            }
+        }
+
+        {
+            // The spawnable was modified after the plans were built or the plans were never built, so (re)build the plan for this entity.
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_entityPlansMutex);
+            if (m_entityPlans.size() < entities.size())
+            {
+                m_entityPlans.resize(entities.size());
+            }
+            if (!IsPlanValid(m_entityPlans[entityIndex], prototype, serializeContext))
+            {
+                TypeLookup typeLookup;
+                BuildEntityPlan(m_entityPlans[entityIndex], prototype, serializeContext, typeLookup);
+            }
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_entityPlansMutex);
+        return CloneWithPlan(m_entityPlans[entityIndex], prototype, prototypeToCloneMap, serializeContext);
+    }
+
+    bool SpawnableClonePlan::IsPlanValid(const EntityPlan& plan, const AZ::Entity& prototype, const AZ::SerializeContext& serializeContext)
+    {
+        if (plan.m_prototype != &prototype || plan.m_serializeContext != &serializeContext)
+        {
+            return false;
+        }
+
+        const AZ::Entity::ComponentArrayType& components = prototype.GetComponents();
+        if (plan.m_componentPrototypes.size() != components.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < components.size(); ++i)
+        {
+            if (plan.m_componentPrototypes[i] != components[i] || plan.m_componentTypes[i] != components[i]->RTTI_GetType())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename MapType>
+    AZ::Entity* SpawnableClonePlan::CloneWithPlan(
+        const EntityPlan& plan, const AZ::Entity& prototype, MapType& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        if (plan.m_reflectEntity)
+        {
+            return AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                &prototype, prototypeToCloneMap, &serializeContext);
+        }
+
+        AZ::Entity* clone = serializeContext.CloneObject(&prototype);
+        if (!clone)
+        {
+            return nullptr;
+        }
+
+        const AZ::Entity::ComponentArrayType& components = clone->GetComponents();
+        AZ_Assert(
+            components.size() == plan.m_componentPrototypes.size(),
+            "Clone of entity '%s' has %zu components while its prototype has %zu.", prototype.GetName().c_str(), components.size(),
+            plan.m_componentPrototypes.size());
+
+        auto resolve = [clone, &components](const IdPatch& patch) -> AZ::EntityId&
+        {
+            char* root = (patch.m_root == 0) ? SpawnableClonePlanInternal::GetRootAddress(*clone)
+                                             : SpawnableClonePlanInternal::GetRootAddress(*components[patch.m_root - 1]);
+            return *reinterpret_cast<AZ::EntityId*>(root + patch.m_offset);
+        };
+
+        // Same order as the Remapper: generate all new ids first so references to them can be resolved afterwards.
+        for (const GeneratedIdPatch& patch : plan.m_generatedIds)
+        {
+            AZ::EntityId& id = resolve(patch.m_location);
+            auto it = prototypeToCloneMap.emplace(id, patch.m_generator->Invoke(nullptr));
+            id = it.first->second;
+        }
+
+        for (uint32_t componentIndex : plan.m_reflectedComponents)
+        {
+            AZ::IdUtils::Remapper<AZ::EntityId, false>::GenerateNewIdsAndFixRefs(
+                components[componentIndex], prototypeToCloneMap, &serializeContext);
+        }
+
+        for (const IdPatch& patch : plan.m_referencedIds)
+        {
+            AZ::EntityId& id = resolve(patch);
+            auto it = prototypeToCloneMap.find(id);
+            if (it != prototypeToCloneMap.end())
+            {
+                id = it->second;
+            }
+        }
+
+        return clone;
+    }
+
+    void SpawnableClonePlan::BuildEntityPlan(
+        EntityPlan& plan, const AZ::Entity& prototype, AZ::SerializeContext& serializeContext, TypeLookup& typeLookup)
+    {
+        plan = EntityPlan{};
+        plan.m_prototype = &prototype;
+        plan.m_serializeContext = &serializeContext;
+
+        const AZ::Entity::ComponentArrayType& components = prototype.GetComponents();
+        plan.m_componentPrototypes.assign(components.begin(), components.end());
+        plan.m_componentTypes.reserve(components.size());
+        for (const AZ::Component* component : components)
+        {
+            plan.m_componentTypes.push_back(component->RTTI_GetType());
+        }
+
+        // The components are planned individually so they can fall back to reflection separately, so skip them while planning the entity.
+        if (!GatherIdPatches(
+                plan, 0, SpawnableClonePlanInternal::GetRootAddress(prototype), prototype.RTTI_GetType(), &components, serializeContext,
+                typeLookup))
+        {
+            plan.m_reflectEntity = true;
+            return;
+        }
+
+        for (uint32_t i = 0; i < aznumeric_cast<uint32_t>(components.size()); ++i)
+        {
+            const AZ::Component& component = *components[i];
+            if (!GatherIdPatches(
+                    plan, i + 1, SpawnableClonePlanInternal::GetRootAddress(component), component.RTTI_GetType(), nullptr, serializeContext,
+                    typeLookup))
+            {
+                plan.m_reflectedComponents.push_back(i);
+            }
+        }
+    }
+
+    bool SpawnableClonePlan::GatherIdPatches(
+        EntityPlan& plan, uint32_t rootIndex, const void* root, const AZ::Uuid& rootType, const void* skippedElement,
+        AZ::SerializeContext& serializeContext, TypeLookup& typeLookup)
+    {
+        using ClassData = AZ::SerializeContext::ClassData;
+        using ClassElement = AZ::SerializeContext::ClassElement;
+
+        const AZ::Uuid& entityIdType = azrtti_typeid<AZ::EntityId>();
+        AZStd::vector<GeneratedIdPatch> generatedIds;
+        AZStd::vector<IdPatch> referencedIds;
+        bool canPatch = true;
+
+        auto beginCB = [&](void* ptr, const ClassData* classData, const ClassElement* elementData) -> bool
+        {
+            if (!canPatch || (elementData && ptr == skippedElement))
+            {
+                return false;
+            }
+
+            // Anything behind a pointer can move between the prototype and the clone, so it can't be addressed by an offset.
+            if (elementData && (elementData->m_flags & (ClassElement::FLG_POINTER | ClassElement::FLG_DYNAMIC_FIELD)))
+            {
+                canPatch = false;
+                return false;
+            }
+
+            if (classData->m_typeId == entityIdType)
+            {
+                const ptrdiff_t offset = reinterpret_cast<const char*>(ptr) - reinterpret_cast<const char*>(root);
+                const IdPatch patch{ rootIndex, aznumeric_cast<uint32_t>(offset) };
+
+                AZ::Attribute* attribute =
+                    elementData ? AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, elementData->m_attributes) : nullptr;
+                auto generator = azrtti_cast<AZ::AttributeFunction<AZ::EntityId()>*>(attribute);
+                if (generator)
+                {
+                    generatedIds.push_back(GeneratedIdPatch{ patch, generator });
+                }
+                else
+                {
+                    referencedIds.push_back(patch);
+                }
+                return false;
+            }
+
+            // The Remapper enumerates for write, which signals event handlers. Let the Remapper handle these types so that still happens.
+            if (classData->m_eventHandler)
+            {
+                canPatch = false;
+                return false;
+            }
+
+            if (classData->m_container)
+            {
+                // Container elements live in separately allocated storage, so ids inside containers are left to the Remapper.
+                if (TypeMayContainEntityId(classData->m_typeId, serializeContext, typeLookup))
+                {
+                    canPatch = false;
+                }
+                return false;
+            }
+
+            return true;
+        };
+
+        serializeContext.EnumerateInstanceConst(
+            root, rootType, beginCB, nullptr, AZ::SerializeContext::ENUM_ACCESS_FOR_READ, nullptr, nullptr);
+
+        if (canPatch)
+        {
+            plan.m_generatedIds.insert(plan.m_generatedIds.end(), generatedIds.begin(), generatedIds.end());
+            plan.m_referencedIds.insert(plan.m_referencedIds.end(), referencedIds.begin(), referencedIds.end());
+        }
+        return canPatch;
+    }
+
+    bool SpawnableClonePlan::TypeMayContainEntityId(const AZ::Uuid& typeId, AZ::SerializeContext& serializeContext, TypeLookup& typeLookup)
+    {
+        using ClassElement = AZ::SerializeContext::ClassElement;
+
+        if (typeId == azrtti_typeid<AZ::EntityId>() || typeId == azrtti_typeid<AZ::DynamicSerializableField>())
+        {
+            return true;
+        }
+
+        if (auto it = typeLookup.find(typeId); it != typeLookup.end())
+        {
+            return it->second;
+        }
+
+        const AZ::SerializeContext::ClassData* classData = serializeContext.FindClassData(typeId);
+        if (!classData)
+        {
+            // Types that aren't reflected aren't enumerated by the Remapper either.
+            typeLookup[typeId] = false;
+            return false;
+        }
+
+        // Be conservative for types that (indirectly) contain themselves.
+        typeLookup[typeId] = true;
+
+        auto elementMayContainEntityId = [&serializeContext, &typeLookup](const ClassElement& element)
+        {
+            // Pointers may refer to a derived type, so assume the worst.
+            return (element.m_flags & (ClassElement::FLG_POINTER | ClassElement::FLG_DYNAMIC_FIELD)) ||
+                TypeMayContainEntityId(element.m_typeId, serializeContext, typeLookup);
+        };
+
+        bool result = false;
+        for (const ClassElement& element : classData->m_elements)
+        {
+            if (elementMayContainEntityId(element))
+            {
+                result = true;
+                break;
+            }
+        }
+
+        if (!result && classData->m_container)
+        {
+            bool hasElementTypes = false;
+            classData->m_container->EnumTypes(
+                [&](const AZ::Uuid&, const ClassElement* element) -> bool
+                {
+                    hasElementTypes = true;
+                    if (element && elementMayContainEntityId(*element))
+                    {
+                        result = true;
+                        return false;
+                    }
+                    return true;
+                });
+            // Containers that can't report their element types could contain anything.
+            result = result || !hasElementTypes;
+        }
+
+        typeLookup[typeId] = result;
+        return result;
+    }
+} // namespace AzFramework
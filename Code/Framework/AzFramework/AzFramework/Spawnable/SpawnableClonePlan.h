@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class Component;
+    class Entity;
+    class SerializeContext;
+}
+
+namespace AzFramework
+{
+    //! Precompiled instructions for cloning the prototype entities of a spawnable.
+    //! Cloning an entity through AZ::IdUtils::Remapper walks the entire reflected hierarchy of the clone twice after copying it, once to
+    //! generate new entity ids and once to fix up references, resolving attributes for every entity id it encounters. A clone plan walks
+    //! each prototype once up front and records the byte offset of every entity id that lives at a fixed location inside the entity or
+    //! one of its components, so a clone only needs to copy the prototype and then patch those offsets directly.
+    //! Components that store entity ids somewhere that can't be addressed by a fixed offset, such as inside containers, behind pointers
+    //! or in classes that listen for serialization write events, fall back to the reflected remapping for that component only.
+    class SpawnableClonePlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableClonePlan, AZ::SystemAllocator);
+
+        using EntityList = AZStd::vector<AZStd::unique_ptr<AZ::Entity>>;
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! Id map for cloning on multiple threads at once. Lookups go to a map that's shared between the threads and not modified
+        //! while cloning, ids that are generated for anything that isn't in the shared map are added to a map local to this instance.
+        class SharedEntityIdMap final
+        {
+        public:
+            using value_type = EntityIdMap::value_type;
+            using iterator = const value_type*;
+
+            explicit SharedEntityIdMap(const EntityIdMap& sharedMap);
+
+            iterator find(const AZ::EntityId& id) const;
+            iterator end() const;
+            AZStd::pair<iterator, bool> emplace(const AZ::EntityId& id, const AZ::EntityId& cloneId);
+
+            //! Returns the number of ids that were generated for ids that weren't in the shared map.
+            size_t GetGeneratedIdCount() const;
+
+        private:
+            const EntityIdMap* m_sharedMap;
+            EntityIdMap m_generatedIds;
+        };
+
+        SpawnableClonePlan() = default;
+        SpawnableClonePlan(const SpawnableClonePlan& rhs) = delete;
+        SpawnableClonePlan& operator=(const SpawnableClonePlan& rhs) = delete;
+
+        //! Builds the plans for all provided prototype entities, replacing any previously built plans.
+        //! @param entities         the prototype entities to build plans for
+        //! @param serializeContext the serialize context used to clone the prototypes
+        void Build(const EntityList& entities, AZ::SerializeContext& serializeContext);
+
+        //! Removes all plans. Plans are rebuilt on demand by the next call to CloneEntity.
+        void Clear();
+
+        //! Clones a prototype entity, assigning new entity ids and remapping entity references through the provided map.
+        //! Behaves identically to AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs. The plan for the
+        //! entity is rebuilt first if the prototype or its list of components changed since the plan was built.
+        //! @param entities            the prototype entities of the spawnable
+        //! @param entityIndex         index of the prototype entity to clone
+        //! @param prototypeToCloneMap map of prototype entity ids to clone entity ids, newly generated ids are added to it
+        //! @param serializeContext    the serialize context used to clone the prototype
+        //! @return the cloned entity, or nullptr if cloning failed
+        AZ::Entity* CloneEntity(
+            const EntityList& entities, uint32_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Same as above, but can be called from multiple threads at once that all share the same underlying id map.
+        AZ::Entity* CloneEntity(
+            const EntityList& entities, uint32_t entityIndex, SharedEntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
+
+    private:
+        //! Location of an entity id relative to the start of the entity (root 0) or one of its components (root index + 1).
+        struct IdPatch
+        {
+            uint32_t m_root;
+            uint32_t m_offset;
+        };
+
+        struct GeneratedIdPatch
+        {
+            IdPatch m_location;
+            AZ::AttributeFunction<AZ::EntityId()>* m_generator;
+        };
+
+        struct EntityPlan
+        {
+            // Identify the prototype the plan was built for so changes to the spawnable can be detected.
+            const AZ::Entity* m_prototype{ nullptr };
+            const AZ::SerializeContext* m_serializeContext{ nullptr };
+            AZStd::vector<const AZ::Component*> m_componentPrototypes;
+            // Guards against a new component being allocated at the address of a deleted one.
+            AZStd::vector<AZ::TypeId> m_componentTypes;
+
+            AZStd::vector<GeneratedIdPatch> m_generatedIds;
+            AZStd::vector<IdPatch> m_referencedIds;
+            AZStd::vector<uint32_t> m_reflectedComponents;
+            //! Set if the entity itself stores ids that can't be patched directly, in which case the entire entity is remapped.
+            bool m_reflectEntity{ false };
+        };
+
+        using TypeLookup = AZStd::unordered_map<AZ::Uuid, bool>;
+
+        template<typename MapType>
+        AZ::Entity* CloneEntityWithMap(
+            const EntityList& entities, uint32_t entityIndex, MapType& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        static bool IsPlanValid(const EntityPlan& plan, const AZ::Entity& prototype, const AZ::SerializeContext& serializeContext);
+        template<typename MapType>
+        static AZ::Entity* CloneWithPlan(
+            const EntityPlan& plan, const AZ::Entity& prototype, MapType& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        static void BuildEntityPlan(
+            EntityPlan& plan, const AZ::Entity& prototype, AZ::SerializeContext& serializeContext, TypeLookup& typeLookup);
+        static bool GatherIdPatches(
+            EntityPlan& plan, uint32_t rootIndex, const void* root, const AZ::Uuid& rootType, const void* skippedElement,
+            AZ::SerializeContext& serializeContext, TypeLookup& typeLookup);
+        static bool TypeMayContainEntityId(const AZ::Uuid& typeId, AZ::SerializeContext& serializeContext, TypeLookup& typeLookup);
+
+        AZStd::vector<EntityPlan> m_entityPlans;
+        AZStd::shared_mutex m_entityPlansMutex;
+    };
+} // namespace AzFramework
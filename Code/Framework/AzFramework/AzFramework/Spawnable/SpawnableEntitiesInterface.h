@@ -203,6 +203,7 @@ namespace AzFramework
 
     using EntitySpawnCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
     using EntityPreInsertionCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableEntityContainerView)>;
+    using EntitySpawnProgressCallback = AZStd::function<void(EntitySpawnTicket::Id, size_t /*addedCount*/, size_t /*totalCount*/)>;
     using EntityDespawnCallback = AZStd::function<void(EntitySpawnTicket::Id)>;
     using RetrieveEntitySpawnTicketCallback = AZStd::function<void(EntitySpawnTicket&&)>;
     using ReloadSpawnableCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
@@ -220,6 +221,10 @@ namespace AzFramework
         //! Callback that's called when spawning entities has completed. This can be triggered from a different thread than the one that
         //!     made the function call to spawn. The returned list of entities contains all the newly created entities.
         EntitySpawnCallback m_completionCallback;
+        //! Callback that's called when adding the newly created entities to the world couldn't be completed within the activation budget
+        //!     and will continue in a later update. The callback receives the number of entities added so far and the total number of
+        //!     entities that will be added. The budget can be configured with the "spawnable_activationBudgetUs" console variable.
+        EntitySpawnProgressCallback m_progressCallback;
         //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Contetx will be used.
         AZ::SerializeContext* m_serializeContext { nullptr };
         //! The priority at which this call will be executed.
@@ -234,6 +239,10 @@ namespace AzFramework
         //! Callback that's called when spawning entities has completed. This can be triggered from a different thread than the one that
         //!     made the function call to spawn. The returned list of entities contains all the newly created entities.
         EntitySpawnCallback m_completionCallback;
+        //! Callback that's called when adding the newly created entities to the world couldn't be completed within the activation budget
+        //!     and will continue in a later update. The callback receives the number of entities added so far and the total number of
+        //!     entities that will be added. The budget can be configured with the "spawnable_activationBudgetUs" console variable.
+        EntitySpawnProgressCallback m_progressCallback;
         //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Contetx will be used.
         AZ::SerializeContext* m_serializeContext{ nullptr };
         //! The priority at which this call will be executed.
@@ -341,6 +350,10 @@ namespace AzFramework
         virtual ~SpawnableEntitiesDefinition() = default;
 
         //! Spawn instances of all entities in the spawnable.
+        //! Large spawnables may be cloned in parallel on the task graph, in which case the entities and their components are
+        //! constructed, including any serialization events they handle, on task graph worker threads instead of the thread that
+        //! processes the spawn queue. Components are only initialized and activated once the entities are added to the game.
+        //! Setting spawnable_parallelCloneThreshold to 0 keeps construction on the thread processing the queue.
         //! @param ticket Stores the results of the call. Use this ticket to spawn additional entities or to despawn them.
         //! @param optionalArgs Optional additional arguments, see SpawnAllEntitiesOptionalArgs.
         virtual void SpawnAllEntities(EntitySpawnTicket& ticket, SpawnAllEntitiesOptionalArgs optionalArgs = {}) = 0;
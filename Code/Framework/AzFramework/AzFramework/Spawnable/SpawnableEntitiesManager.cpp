@@ -8,10 +8,15 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
@@ -20,6 +25,14 @@
 
 namespace AzFramework
 {
+    AZ_CVAR(AZ::u32, spawnable_activationBudgetUs, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum time in microseconds a single update of the spawn queue spends adding spawned entities to the game. Requests that "
+        "exceed the budget continue in the next update. 0 means there's no limit.");
+    AZ_CVAR(AZ::u32, spawnable_parallelCloneThreshold, 128, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The minimum number of entities a request to spawn all entities needs to have to be cloned in parallel on the task graph. "
+        "Parallel cloning constructs the entities and their components on task graph worker threads. "
+        "0 disables parallel cloning, so construction stays on the thread processing the spawn queue.");
+
     template<typename T>
     void SpawnableEntitiesManager::QueueRequest(EntitySpawnTicket& ticket, SpawnablePriority priority, T&& request)
     {
@@ -62,6 +75,7 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_progressCallback = AZStd::move(optionalArgs.m_progressCallback);
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -77,6 +91,7 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_progressCallback = AZStd::move(optionalArgs.m_progressCallback);
         queueEntry.m_referencePreviouslySpawnedEntities = optionalArgs.m_referencePreviouslySpawnedEntities;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
@@ -212,6 +227,11 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessQueue(CommandQueuePriority priority) -> CommandQueueStatus
     {
+        const AZ::u32 activationBudgetUs = spawnable_activationBudgetUs;
+        m_activationDeadline = activationBudgetUs > 0
+            ? AZStd::chrono::steady_clock::now() + AZStd::chrono::microseconds(activationBudgetUs)
+            : AZStd::chrono::steady_clock::time_point::max();
+
         CommandQueueStatus result = CommandQueueStatus::NoCommandsLeft;
         if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
         {
@@ -342,18 +362,17 @@ namespace AzFramework
         return reinterpret_cast<Ticket*>(ticket)->m_spawnable;
     }
 
-    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const Spawnable& spawnable, uint32_t entityIndex,
         EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
     {
-        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
-        constexpr bool allowDuplicateIds = false;
-
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-            &entityPrototype, prototypeToCloneMap, &serializeContext);
+        // The clone plan doesn't allow duplicate ids, so if the same ID gets remapped more than once the original remapping is
+        // preserved instead of overwriting it.
+        return spawnable.GetClonePlan().CloneEntity(spawnable.GetEntities(), entityIndex, prototypeToCloneMap, serializeContext);
     }
 
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
-        const AZ::Entity& entityPrototype,
+        const Spawnable& spawnable,
+        uint32_t entityIndex,
         const Spawnable::EntityAlias& alias,
         EntityIdMap& prototypeToCloneMap,
         AZ::Entity* previouslySpawnedEntity,
@@ -364,20 +383,20 @@ namespace AzFramework
         {
         case Spawnable::EntityAliasType::Original:
             // Behave as the original version.
-            clone = CloneSingleEntity(entityPrototype, prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(spawnable, entityIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Disable:
             // Do nothing.
             return nullptr;
         case Spawnable::EntityAliasType::Replace:
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(*alias.m_spawnable, alias.m_targetIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Additional:
             // The asset handler will have sorted and inserted a Spawnable::EntityAliasType::Original, so the just
             // spawn the additional entity.
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(*alias.m_spawnable, alias.m_targetIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Merge:
@@ -411,6 +430,123 @@ namespace AzFramework
         }
     }
 
+    void SpawnableEntitiesManager::CloneAllEntities(
+        const Spawnable& spawnable, AZ::Entity** clones, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        const uint32_t entityCount = aznumeric_caster(spawnable.GetEntities().size());
+        const uint32_t parallelCloneThreshold = spawnable_parallelCloneThreshold;
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        const uint32_t batchCount = AZStd::min(entityCount, AZStd::max(1u, AZStd::thread::hardware_concurrency()));
+
+        const auto cloneInOrder = [&]()
+        {
+            for (uint32_t i = 0; i < entityCount; ++i)
+            {
+                clones[i] = CloneSingleEntity(spawnable, i, prototypeToCloneMap, serializeContext);
+            }
+        };
+
+        if (!useTaskGraph || parallelCloneThreshold == 0 || entityCount < parallelCloneThreshold || batchCount <= 1)
+        {
+            cloneInOrder();
+            return;
+        }
+
+        // Cloning only reads from the id map for the entities in the spawnable, but may add ids for other fields that generate new
+        // ids. The batches share the map without modifying it and each keeps the ids it generates itself, so they don't need to
+        // synchronize.
+        AZStd::vector<SpawnableClonePlan::SharedEntityIdMap> batchIdMaps;
+        batchIdMaps.reserve(batchCount);
+        for (uint32_t batch = 0; batch < batchCount; ++batch)
+        {
+            batchIdMaps.emplace_back(prototypeToCloneMap);
+        }
+
+        static const AZ::TaskDescriptor cloneTaskDescriptor{ "SpawnableEntitiesManager::CloneAllEntities", "Spawnables" };
+        AZ::TaskGraph cloneTaskGraph{ "SpawnableEntitiesManager::CloneAllEntities" };
+        AZ::TaskGraphEvent cloneFinishedEvent{ "SpawnableEntitiesManager::CloneAllEntities Wait" };
+        for (uint32_t batch = 0; batch < batchCount; ++batch)
+        {
+            const uint32_t begin = (entityCount * batch) / batchCount;
+            const uint32_t end = (entityCount * (batch + 1)) / batchCount;
+            cloneTaskGraph.AddTask(
+                cloneTaskDescriptor,
+                [&spawnable, clones, &idMap = batchIdMaps[batch], &serializeContext, begin, end]()
+                {
+                    for (uint32_t i = begin; i < end; ++i)
+                    {
+                        clones[i] = spawnable.GetClonePlan().CloneEntity(spawnable.GetEntities(), i, idMap, serializeContext);
+                    }
+                });
+        }
+        cloneTaskGraph.Submit(&cloneFinishedEvent);
+        cloneFinishedEvent.Wait();
+
+        // A generated id is shared by every entity cloned after it when cloning in order, but a batch only sees the ids it generated
+        // itself, so references across batches would point at different ids. This is rare, so in that case the parallel clones are
+        // discarded and the entities are cloned again in order to produce the same result as cloning in order to begin with.
+        const bool generatedIds = AZStd::any_of(
+            batchIdMaps.begin(), batchIdMaps.end(),
+            [](const SpawnableClonePlan::SharedEntityIdMap& batchIdMap)
+            {
+                return batchIdMap.GetGeneratedIdCount() != 0;
+            });
+        if (generatedIds)
+        {
+            for (uint32_t i = 0; i < entityCount; ++i)
+            {
+                delete clones[i];
+            }
+            cloneInOrder();
+        }
+    }
+
+    template<typename CommandType>
+    auto SpawnableEntitiesManager::AddSpawnedEntitiesToGame(CommandType& request) -> CommandResult
+    {
+        Ticket& ticket = *request.m_ticket;
+        auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount;
+        auto newEntitiesEnd = ticket.m_spawnedEntities.end();
+        const size_t totalCount = ticket.m_spawnedEntities.size() - request.m_spawnedEntitiesInitialCount;
+        const size_t initialAddedCount = request.m_addedEntitiesCount;
+
+        // Add to the game context, which activates the entities. Activation can be expensive, so stop if the budget runs out and
+        // continue in the next update. At least one entity is added per update to guarantee progress. The request stays the current
+        // request on the ticket so no other requests can modify the entities in the meantime.
+        while (request.m_addedEntitiesCount < totalCount)
+        {
+            if (request.m_addedEntitiesCount != initialAddedCount && !HasActivationBudget())
+            {
+                if (request.m_progressCallback)
+                {
+                    request.m_progressCallback(request.m_ticketId, request.m_addedEntitiesCount, totalCount);
+                }
+                return CommandResult::Requeue;
+            }
+
+            AZ::Entity* clone = *(newEntitiesBegin + request.m_addedEntitiesCount);
+            clone->SetEntitySpawnTicketId(request.m_ticketId);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+            ++request.m_addedEntitiesCount;
+        }
+
+        // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
+        if (request.m_completionCallback)
+        {
+            request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+        }
+
+        ticket.m_currentRequestId++;
+        return CommandResult::Executed;
+    }
+
+    bool SpawnableEntitiesManager::HasActivationBudget() const
+    {
+        return m_activationDeadline == AZStd::chrono::steady_clock::time_point::max() ||
+            AZStd::chrono::steady_clock::now() < m_activationDeadline;
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
         const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
     {
@@ -446,6 +582,11 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessRequest(SpawnAllEntitiesCommand& request) -> CommandResult
     {
+        if (request.m_isAddingEntities)
+        {
+            return AddSpawnedEntitiesToGame(request);
+        }
+
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
@@ -483,11 +624,14 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(
                             entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                         spawnedEntityIndices.push_back(i);
                     }
+
+                    // With the id map complete the entities no longer depend on each other and can be cloned in any order.
+                    spawnedEntities.resize(spawnedEntitiesInitialCount + entitiesToSpawnSize);
+                    CloneAllEntities(
+                        *ticket.m_spawnable, spawnedEntities.data() + spawnedEntitiesInitialCount, ticket.m_entityIdReferenceMap,
+                        *request.m_serializeContext);
                 }
                 else
                 {
@@ -500,7 +644,7 @@ namespace AzFramework
                         if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
                         {
                             spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                CloneSingleEntity(*ticket.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                             spawnedEntityIndices.push_back(i);
                         }
                         else
@@ -511,7 +655,7 @@ namespace AzFramework
                             do
                             {
                                 AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                    *ticket.m_spawnable, i, *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
                                     *request.m_serializeContext);
                                 previousEntity = clone;
                                 if (clone)
@@ -537,22 +681,9 @@ namespace AzFramework
                     request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
-                }
-
-                // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
-
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
+                request.m_spawnedEntitiesInitialCount = spawnedEntitiesInitialCount;
+                request.m_isAddingEntities = true;
+                return AddSpawnedEntitiesToGame(request);
             }
         }
         return CommandResult::Requeue;
@@ -560,6 +691,11 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessRequest(SpawnEntitiesCommand& request) -> CommandResult
     {
+        if (request.m_isAddingEntities)
+        {
+            return AddSpawnedEntitiesToGame(request);
+        }
+
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
@@ -608,7 +744,7 @@ namespace AzFramework
                                 entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
                             spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                CloneSingleEntity(*ticket.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                             spawnedEntityIndices.push_back(index);
                         }
                     }
@@ -633,7 +769,8 @@ namespace AzFramework
                             if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
                             {
                                 spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                    CloneSingleEntity(
+                                        *ticket.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                                 spawnedEntityIndices.push_back(index);
                             }
                             else
@@ -644,7 +781,7 @@ namespace AzFramework
                                 do
                                 {
                                     AZ::Entity* clone = CloneSingleAliasedEntity(
-                                        *entitiesToSpawn[index], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                        *ticket.m_spawnable, index, *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
                                         *request.m_serializeContext);
                                     previousEntity = clone;
                                     if (clone)
@@ -670,24 +807,9 @@ namespace AzFramework
                             ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
-                }
-
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(
-                        request.m_ticketId,
-                        SpawnableConstEntityContainerView(
-                            ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
-                }
-
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
+                request.m_spawnedEntitiesInitialCount = spawnedEntitiesInitialCount;
+                request.m_isAddingEntities = true;
+                return AddSpawnedEntitiesToGame(request);
             }
         }
         return CommandResult::Requeue;
@@ -802,7 +924,8 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone =
+                        CloneSingleEntity(*request.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -823,7 +946,8 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone =
+                            CloneSingleEntity(*request.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
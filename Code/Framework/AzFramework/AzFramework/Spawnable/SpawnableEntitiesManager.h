@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/variant.h>
@@ -130,21 +131,35 @@ namespace AzFramework
         {
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
+            EntitySpawnProgressCallback m_progressCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            //! Number of entities the ticket held before this request, the entities of this request start at this index.
+            size_t m_spawnedEntitiesInitialCount{ 0 };
+            //! Number of entities of this request that have been added to the game so far.
+            size_t m_addedEntitiesCount{ 0 };
+            //! Set once the entities have been cloned and the request is adding them to the game, possibly across multiple updates.
+            bool m_isAddingEntities{ false };
         };
         struct SpawnEntitiesCommand final
         {
             AZStd::vector<uint32_t> m_entityIndices;
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
+            EntitySpawnProgressCallback m_progressCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
             bool m_referencePreviouslySpawnedEntities;
+            //! Number of entities the ticket held before this request, the entities of this request start at this index.
+            size_t m_spawnedEntitiesInitialCount{ 0 };
+            //! Number of entities of this request that have been added to the game so far.
+            size_t m_addedEntitiesCount{ 0 };
+            //! Set once the entities have been cloned and the request is adding them to the game, possibly across multiple updates.
+            bool m_isAddingEntities{ false };
         };
         struct DespawnAllEntitiesCommand final
         {
@@ -265,9 +280,10 @@ namespace AzFramework
         CommandQueueStatus ProcessQueue(Queue& queue);
 
         AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+            const Spawnable& spawnable, uint32_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
         AZ::Entity* CloneSingleAliasedEntity(
-            const AZ::Entity& entityPrototype,
+            const Spawnable& spawnable,
+            uint32_t entityIndex,
             const Spawnable::EntityAlias& alias,
             EntityIdMap& prototypeToCloneMap,
             AZ::Entity* previouslySpawnedEntity,
@@ -277,6 +293,20 @@ namespace AzFramework
             const AZ::Entity::ComponentArrayType& componentPrototypes,
             EntityIdMap& prototypeToCloneMap,
             AZ::SerializeContext& serializeContext);
+        //! Clones all entities in the spawnable into the provided list, spreading the work over the task graph if it's available.
+        //! All prototype entity ids need to already be in the id map as entities are cloned in no particular order. If cloning
+        //! generates ids that aren't in the map, the entities are cloned again in order so all of them share the same new ids.
+        void CloneAllEntities(
+            const Spawnable& spawnable,
+            AZ::Entity** clones,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
+
+        //! Adds the entities spawned by a request to the game, stopping if the activation budget for the current update runs out.
+        //! Returns Requeue if not all entities could be added yet.
+        template<typename CommandType>
+        CommandResult AddSpawnedEntitiesToGame(CommandType& request);
+        bool HasActivationBudget() const;
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
@@ -306,6 +336,8 @@ namespace AzFramework
         Queue m_regularPriorityQueue;
 
         AZ::SerializeContext* m_defaultSerializeContext { nullptr };
+        //! Point in time after which no more spawned entities are added to the game during the current queue update.
+        AZStd::chrono::steady_clock::time_point m_activationDeadline{ AZStd::chrono::steady_clock::time_point::max() };
         //! The threshold used to determine if a request goes in the regular (if bigger than the value) or high priority queue (if smaller
         //! or equal to this value). The starting value of 64 is chosen as it's between default values SpawnablePriority_High and
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
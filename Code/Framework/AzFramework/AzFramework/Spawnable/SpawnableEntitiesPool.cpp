@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Entity/GameEntityContextBus.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesPool.h>
+
+namespace AzFramework
+{
+    namespace SpawnableEntitiesPoolInternal
+    {
+        // Cloning in place over an object with reflected pointers would replace the pointers without deleting what they point to.
+        // The check walks the reflected type rather than an instance, so pointers held by containers that are empty in the prototype
+        // are found as well and the result only depends on the type.
+        static bool CanResetInPlace(
+            const AZ::Uuid& type, AZ::SerializeContext& serializeContext, AZStd::unordered_set<AZ::Uuid>& visitedTypes)
+        {
+            if (!visitedTypes.insert(type).second)
+            {
+                return true;
+            }
+
+            const AZ::SerializeContext::ClassData* classData = serializeContext.FindClassData(type);
+            if (!classData)
+            {
+                return true;
+            }
+
+            auto canResetElement =
+                [&serializeContext, &visitedTypes](const AZ::Uuid& elementType, const AZ::SerializeContext::ClassElement& element)
+            {
+                return !(element.m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER) &&
+                    CanResetInPlace(elementType, serializeContext, visitedTypes);
+            };
+
+            bool canReset = true;
+            if (classData->m_container)
+            {
+                classData->m_container->EnumTypes(
+                    [&canReset, &canResetElement](const AZ::Uuid& elementType, const AZ::SerializeContext::ClassElement* genericElement)
+                    {
+                        canReset = !genericElement || canResetElement(elementType, *genericElement);
+                        return canReset;
+                    });
+                return canReset;
+            }
+
+            for (const AZ::SerializeContext::ClassElement& element : classData->m_elements)
+            {
+                if (!canResetElement(element.m_typeId, element))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Cloning in place overwrites existing container elements but doesn't remove elements that were added since the spawn, so
+        // containers are emptied before the prototype is copied back.
+        static void ClearContainers(void* instance, const AZ::Uuid& type, AZ::SerializeContext& serializeContext)
+        {
+            auto beginCB =
+                [&serializeContext](void* ptr, const AZ::SerializeContext::ClassData* classData, const AZ::SerializeContext::ClassElement*)
+            {
+                if (classData->m_container)
+                {
+                    classData->m_container->ClearElements(ptr, &serializeContext);
+                    return false;
+                }
+                return true;
+            };
+            serializeContext.EnumerateInstance(
+                instance, type, beginCB, nullptr, AZ::SerializeContext::ENUM_ACCESS_FOR_WRITE, nullptr, nullptr);
+        }
+    } // namespace SpawnableEntitiesPoolInternal
+
+    SpawnableEntitiesPool::SpawnableEntitiesPool(AZ::Data::Asset<Spawnable> spawnable, uint32_t maxParkedInstances)
+        : m_spawnable(AZStd::move(spawnable))
+        , m_maxParkedInstances(maxParkedInstances)
+    {
+        AZ::ComponentApplicationBus::BroadcastResult(m_serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+        AZ_Assert(m_serializeContext, "Failed to retrieve serialization context for the spawnable entities pool.");
+        m_parkedInstances.reserve(m_maxParkedInstances);
+    }
+
+    SpawnableEntitiesPool::~SpawnableEntitiesPool()
+    {
+        // Releasing the instances destroys their tickets, which despawns all entities, including instances that are still spawning.
+        m_activeInstances.clear();
+        m_parkedInstances.clear();
+    }
+
+    auto SpawnableEntitiesPool::Acquire(AcquireCallback callback) -> InstanceId
+    {
+        InstanceId instanceId = m_nextInstanceId++;
+
+        while (!m_parkedInstances.empty())
+        {
+            AZStd::shared_ptr<Instance> instance = AZStd::move(m_parkedInstances.back());
+            m_parkedInstances.pop_back();
+
+            // The spawnable may have been reloaded while the instance was parked, in which case its entities no longer match the
+            // prototypes and the instance is despawned instead.
+            if (ResetInstance(*instance))
+            {
+                ActivateInstance(*instance);
+                Instance& activeInstance = *m_activeInstances.emplace(instanceId, AZStd::move(instance)).first->second;
+                if (callback)
+                {
+                    callback(
+                        instanceId,
+                        SpawnableConstEntityContainerView(activeInstance.m_entities.data(), activeInstance.m_entities.size()));
+                }
+                return instanceId;
+            }
+        }
+
+        auto instance = AZStd::make_shared<Instance>();
+        instance->m_ticket = EntitySpawnTicket(m_spawnable);
+
+        SpawnableEntitiesInterface* spawnableEntitiesInterface = SpawnableEntitiesInterface::Get();
+        spawnableEntitiesInterface->SpawnAllEntities(instance->m_ticket);
+        // Commands on the same ticket are executed in order, so the listing happens directly after the spawn has completed.
+        spawnableEntitiesInterface->ListIndicesAndEntities(
+            instance->m_ticket,
+            [weakInstance = AZStd::weak_ptr<Instance>(instance), instanceId, callback = AZStd::move(callback),
+             spawnable = m_spawnable](EntitySpawnTicket::Id, SpawnableConstIndexEntityContainerView view)
+            {
+                // If the instance was released or the pool was destroyed before the spawn completed, the ticket has been destroyed
+                // and the entities will be despawned.
+                AZStd::shared_ptr<Instance> instance = weakInstance.lock();
+                if (!instance)
+                {
+                    return;
+                }
+
+                const Spawnable::EntityList& prototypes = spawnable->GetEntities();
+                instance->m_entities.reserve(view.size());
+                instance->m_prototypeIndices.reserve(view.size());
+                instance->m_prototypeToInstanceMap.reserve(view.size());
+                for (SpawnableIndexEntityPair& entry : view)
+                {
+                    AZ::Entity* entity = entry.GetEntity();
+                    instance->m_entities.push_back(entity);
+                    instance->m_prototypeIndices.push_back(entry.GetIndex());
+                    if (entry.GetIndex() < prototypes.size())
+                    {
+                        instance->m_prototypeToInstanceMap.emplace(prototypes[entry.GetIndex()]->GetId(), entity->GetId());
+                    }
+                }
+                instance->m_isSpawned = true;
+
+                if (callback)
+                {
+                    callback(instanceId, SpawnableConstEntityContainerView(instance->m_entities.data(), instance->m_entities.size()));
+                }
+            });
+
+        m_activeInstances.emplace(instanceId, AZStd::move(instance));
+        return instanceId;
+    }
+
+    void SpawnableEntitiesPool::Release(InstanceId instanceId)
+    {
+        auto it = m_activeInstances.find(instanceId);
+        if (it == m_activeInstances.end())
+        {
+            AZ_Warning("Spawnables", false, "Releasing instance %llu which isn't active in the spawnable entities pool.", instanceId);
+            return;
+        }
+
+        AZStd::shared_ptr<Instance> instance = AZStd::move(it->second);
+        m_activeInstances.erase(it);
+
+        // Instances that are still spawning or can't be parked are dropped here, which destroys their ticket and despawns the entities.
+        if (instance->m_isSpawned && m_parkedInstances.size() < m_maxParkedInstances)
+        {
+            DeactivateInstance(*instance);
+            m_parkedInstances.push_back(AZStd::move(instance));
+        }
+    }
+
+    void SpawnableEntitiesPool::Trim()
+    {
+        m_parkedInstances.clear();
+    }
+
+    size_t SpawnableEntitiesPool::GetActiveInstanceCount() const
+    {
+        return m_activeInstances.size();
+    }
+
+    size_t SpawnableEntitiesPool::GetParkedInstanceCount() const
+    {
+        return m_parkedInstances.size();
+    }
+
+    bool SpawnableEntitiesPool::CanResetInPlace(const AZ::TypeId& componentType)
+    {
+        auto it = m_canResetInPlaceCache.find(componentType);
+        if (it == m_canResetInPlaceCache.end())
+        {
+            AZStd::unordered_set<AZ::Uuid> visitedTypes;
+            const bool canReset = SpawnableEntitiesPoolInternal::CanResetInPlace(componentType, *m_serializeContext, visitedTypes);
+            it = m_canResetInPlaceCache.emplace(componentType, canReset).first;
+        }
+        return it->second;
+    }
+
+    bool SpawnableEntitiesPool::ResetInstance(Instance& instance)
+    {
+        if (!m_serializeContext || !m_spawnable.IsReady())
+        {
+            return false;
+        }
+
+        const Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        const AZ::IdUtils::Remapper<AZ::EntityId>::IdReplacer replacer = [&instance](const AZ::EntityId& originalId)
+        {
+            auto it = instance.m_prototypeToInstanceMap.find(originalId);
+            return it != instance.m_prototypeToInstanceMap.end() ? it->second : originalId;
+        };
+
+        // Verify all entities before changing any of them so a mismatch doesn't leave the instance partially reset.
+        const size_t entityCount = instance.m_entities.size();
+        for (size_t i = 0; i < entityCount; ++i)
+        {
+            const uint32_t prototypeIndex = instance.m_prototypeIndices[i];
+            if (prototypeIndex >= prototypes.size())
+            {
+                return false;
+            }
+
+            const AZ::Entity::ComponentArrayType& components = instance.m_entities[i]->GetComponents();
+            const AZ::Entity::ComponentArrayType& prototypeComponents = prototypes[prototypeIndex]->GetComponents();
+            if (components.size() != prototypeComponents.size())
+            {
+                return false;
+            }
+            for (size_t c = 0; c < components.size(); ++c)
+            {
+                const AZ::TypeId& componentType = prototypeComponents[c]->RTTI_GetType();
+                if (components[c]->RTTI_GetType() != componentType || !CanResetInPlace(componentType))
+                {
+                    return false;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < entityCount; ++i)
+        {
+            const AZ::Entity::ComponentArrayType& components = instance.m_entities[i]->GetComponents();
+            const AZ::Entity::ComponentArrayType& prototypeComponents = prototypes[instance.m_prototypeIndices[i]]->GetComponents();
+            for (size_t c = 0; c < components.size(); ++c)
+            {
+                // The reflected functions expect the address of the most derived type, which for components with multiple base classes
+                // isn't the address of the AZ::Component base.
+                const AZ::TypeId& componentType = prototypeComponents[c]->RTTI_GetType();
+                void* component = components[c]->RTTI_AddressOf(componentType);
+                const void* prototypeComponent = prototypeComponents[c]->RTTI_AddressOf(componentType);
+                SpawnableEntitiesPoolInternal::ClearContainers(component, componentType, *m_serializeContext);
+                m_serializeContext->CloneObjectInplace(component, prototypeComponent, componentType);
+                AZ::IdUtils::Remapper<AZ::EntityId>::RemapIdsAndIdRefs(component, componentType, replacer, m_serializeContext);
+            }
+        }
+        return true;
+    }
+
+    void SpawnableEntitiesPool::ActivateInstance(Instance& instance)
+    {
+        for (AZ::Entity* entity : instance.m_entities)
+        {
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequests::ActivateGameEntity, entity->GetId());
+        }
+    }
+
+    void SpawnableEntitiesPool::DeactivateInstance(Instance& instance)
+    {
+        // Deactivate in the reverse order of activation so children are deactivated before their parents.
+        for (auto it = instance.m_entities.rbegin(); it != instance.m_entities.rend(); ++it)
+        {
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequests::DeactivateGameEntity, (*it)->GetId());
+        }
+    }
+} // namespace AzFramework
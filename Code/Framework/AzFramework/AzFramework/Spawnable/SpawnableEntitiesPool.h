@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+
+namespace AZ
+{
+    class Entity;
+    class SerializeContext;
+}
+
+namespace AzFramework
+{
+    //! A utility class that recycles the entities created from a Spawnable.
+    //! Every acquired instance is a full set of entities spawned from the spawnable. Releasing an instance deactivates its entities and
+    //! parks them in the pool instead of despawning them. A later acquire reuses a parked instance by copying the state of the prototype
+    //! components back into the existing components and activating the entities again, which avoids the allocation, cloning and
+    //! component construction costs of a new spawn. This is intended for short lived objects that are frequently spawned such as
+    //! projectiles or effects.
+    //! Calls to the pool and all callbacks happen on the main thread. Entities of an acquired instance are owned by the pool and should
+    //! not be destroyed individually. Components that own data that isn't reflected to the Serialize Context won't have that data reset,
+    //! and instances with components that store reflected pointers can't be reset in place and are despawned instead of reused.
+    class SpawnableEntitiesPool final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableEntitiesPool, AZ::SystemAllocator);
+
+        using InstanceId = uint64_t;
+        using AcquireCallback = AZStd::function<void(InstanceId, SpawnableConstEntityContainerView)>;
+
+        static constexpr InstanceId InvalidInstanceId = 0;
+        static constexpr uint32_t DefaultMaxParkedInstances = 16;
+
+        //! Constructs a new pool that spawns instances from the provided spawnable.
+        //! @param spawnable The Spawnable that's used as a template to create entities from.
+        //! @param maxParkedInstances The maximum number of released instances kept for reuse. Instances released beyond this number are
+        //!     despawned.
+        explicit SpawnableEntitiesPool(AZ::Data::Asset<Spawnable> spawnable, uint32_t maxParkedInstances = DefaultMaxParkedInstances);
+        ~SpawnableEntitiesPool();
+
+        SpawnableEntitiesPool(const SpawnableEntitiesPool&) = delete;
+        SpawnableEntitiesPool& operator=(const SpawnableEntitiesPool&) = delete;
+
+        //! Acquires an instance of the spawnable. If a parked instance is available it's reset and activated before this function
+        //!     returns and the callback is called immediately, otherwise a new instance is spawned and the callback is called once the
+        //!     spawn has completed.
+        //! @param callback Optional callback that receives the entities of the instance once they're active.
+        //! @return The id of the acquired instance.
+        InstanceId Acquire(AcquireCallback callback = {});
+        //! Returns an instance to the pool. The entities are deactivated and parked for reuse if there's room in the pool and the
+        //!     entities still match the spawnable, otherwise they're despawned. Releasing an instance that's still being spawned
+        //!     will despawn it.
+        //! @param instanceId The id of the instance to release.
+        void Release(InstanceId instanceId);
+        //! Despawns all parked instances.
+        void Trim();
+
+        //! Returns the number of instances that have been acquired and not released yet.
+        [[nodiscard]] size_t GetActiveInstanceCount() const;
+        //! Returns the number of released instances that are available for reuse.
+        [[nodiscard]] size_t GetParkedInstanceCount() const;
+
+    private:
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        struct Instance final
+        {
+            AZ_CLASS_ALLOCATOR(SpawnableEntitiesPool::Instance, AZ::SystemAllocator);
+
+            EntitySpawnTicket m_ticket;
+            //! The spawned entities in the order they were added to the game.
+            AZStd::vector<AZ::Entity*> m_entities;
+            //! For each spawned entity the index of the prototype entity in the spawnable it was spawned from.
+            AZStd::vector<uint32_t> m_prototypeIndices;
+            //! Maps the ids of the prototype entities to the ids of the spawned entities.
+            EntityIdMap m_prototypeToInstanceMap;
+            bool m_isSpawned{ false };
+        };
+
+        //! Returns true if components of the provided type can be reset by copying the prototype over them. The result only depends on
+        //!     the reflection of the type and is cached for the lifetime of the pool.
+        bool CanResetInPlace(const AZ::TypeId& componentType);
+        bool ResetInstance(Instance& instance);
+        static void ActivateInstance(Instance& instance);
+        static void DeactivateInstance(Instance& instance);
+
+        AZ::Data::Asset<Spawnable> m_spawnable;
+        AZStd::unordered_map<InstanceId, AZStd::shared_ptr<Instance>> m_activeInstances;
+        AZStd::vector<AZStd::shared_ptr<Instance>> m_parkedInstances;
+        AZStd::unordered_map<AZ::TypeId, bool> m_canResetInPlaceCache;
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+        InstanceId m_nextInstanceId{ 1 };
+        uint32_t m_maxParkedInstances{ DefaultMaxParkedInstances };
+    };
+} // namespace AzFramework
@@ -0,0 +1,861 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(uint32_t, bg_bvhLeafMaxEntries, 16, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any visibility BVH leaf before forcing a split");
+    AZ_CVAR(float,    bg_bvhLeafMargin,   0.5f, nullptr, AZ::ConsoleFunctorFlags::Null, "Distance by which visibility BVH leaf bounds are expanded so small movements don't require updating the tree");
+    AZ_CVAR(uint32_t, bg_bvhParallelTaskCount, 32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of subtrees a parallel multi-frustum enumeration is split into before being distributed across tasks");
+
+    // A balanced tree with 2^32 nodes is less than 64 levels deep, and a depth first traversal never holds more than one entry per level
+    static constexpr uint32_t MaxTraversalDepth = 128;
+
+    namespace
+    {
+        //! The planes of a frustum stored as separate registers per plane component, so a box can be tested against all planes at once.
+        //! The six planes are padded to eight with planes that every box is in front of.
+        class SimdFrustumPlanes
+        {
+        public:
+            explicit SimdFrustumPlanes(const AZ::Frustum& frustum)
+            {
+                float normalX[PaddedPlaneCount] = { 0.0f };
+                float normalY[PaddedPlaneCount] = { 0.0f };
+                float normalZ[PaddedPlaneCount] = { 0.0f };
+                float distance[PaddedPlaneCount] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+                for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const AZ::Plane plane = frustum.GetPlane(planeId);
+                    normalX[planeId] = plane.GetNormal().GetX();
+                    normalY[planeId] = plane.GetNormal().GetY();
+                    normalZ[planeId] = plane.GetNormal().GetZ();
+                    distance[planeId] = plane.GetDistance();
+                }
+
+                for (uint32_t group = 0; group < GroupCount; ++group)
+                {
+                    const uint32_t offset = group * AZ::Simd::Vec4::ElementCount;
+                    m_normalX[group] = AZ::Simd::Vec4::LoadUnaligned(&normalX[offset]);
+                    m_normalY[group] = AZ::Simd::Vec4::LoadUnaligned(&normalY[offset]);
+                    m_normalZ[group] = AZ::Simd::Vec4::LoadUnaligned(&normalZ[offset]);
+                    m_distance[group] = AZ::Simd::Vec4::LoadUnaligned(&distance[offset]);
+                    m_absNormalX[group] = AZ::Simd::Vec4::Abs(m_normalX[group]);
+                    m_absNormalY[group] = AZ::Simd::Vec4::Abs(m_normalY[group]);
+                    m_absNormalZ[group] = AZ::Simd::Vec4::Abs(m_normalZ[group]);
+                }
+            }
+
+            //! Returns -1 if the box is fully behind any plane, 1 if the box is fully in front of all planes, and 0 otherwise.
+            //! The comparisons match ShapeIntersection::Overlaps and ShapeIntersection::Contains for frustums and boxes.
+            int32_t Classify(float minX, float minY, float minZ, float maxX, float maxY, float maxZ) const
+            {
+                using AZ::Simd::Vec4;
+
+                const Vec4::FloatType centerX = Vec4::Splat(0.5f * maxX + 0.5f * minX);
+                const Vec4::FloatType centerY = Vec4::Splat(0.5f * maxY + 0.5f * minY);
+                const Vec4::FloatType centerZ = Vec4::Splat(0.5f * maxZ + 0.5f * minZ);
+                const Vec4::FloatType extentX = Vec4::Splat(0.5f * maxX - 0.5f * minX);
+                const Vec4::FloatType extentY = Vec4::Splat(0.5f * maxY - 0.5f * minY);
+                const Vec4::FloatType extentZ = Vec4::Splat(0.5f * maxZ - 0.5f * minZ);
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+                bool inside = true;
+                for (uint32_t group = 0; group < GroupCount; ++group)
+                {
+                    const Vec4::FloatType dist = Vec4::Madd(m_normalX[group], centerX,
+                        Vec4::Madd(m_normalY[group], centerY, Vec4::Madd(m_normalZ[group], centerZ, m_distance[group])));
+                    const Vec4::FloatType radius = Vec4::Madd(
+                        m_absNormalX[group], extentX, Vec4::Madd(m_absNormalY[group], extentY, Vec4::Mul(m_absNormalZ[group], extentZ)));
+                    if (!Vec4::CmpAllGt(Vec4::Add(dist, radius), zero))
+                    {
+                        return -1;
+                    }
+                    inside = inside && Vec4::CmpAllGtEq(Vec4::Sub(dist, radius), zero);
+                }
+                return inside ? 1 : 0;
+            }
+
+        private:
+            static constexpr uint32_t PaddedPlaneCount = 8;
+            static constexpr uint32_t GroupCount = PaddedPlaneCount / AZ::Simd::Vec4::ElementCount;
+
+            AZ::Simd::Vec4::FloatType m_normalX[GroupCount];
+            AZ::Simd::Vec4::FloatType m_normalY[GroupCount];
+            AZ::Simd::Vec4::FloatType m_normalZ[GroupCount];
+            AZ::Simd::Vec4::FloatType m_distance[GroupCount];
+            AZ::Simd::Vec4::FloatType m_absNormalX[GroupCount];
+            AZ::Simd::Vec4::FloatType m_absNormalY[GroupCount];
+            AZ::Simd::Vec4::FloatType m_absNormalZ[GroupCount];
+        };
+    }
+
+    static AZStd::vector<SimdFrustumPlanes> GetSimdFrustumPlanes(AZStd::span<const AZ::Frustum> frusta)
+    {
+        AZStd::vector<SimdFrustumPlanes> planes;
+        planes.reserve(frusta.size());
+        for (const AZ::Frustum& frustum : frusta)
+        {
+            planes.emplace_back(frustum);
+        }
+        return planes;
+    }
+
+    static float GetSurfaceCost(const AZ::Aabb& aabb)
+    {
+        // Half the surface area, the constant factor doesn't matter when comparing costs
+        const AZ::Vector3 extents = aabb.GetExtents();
+        return extents.GetX() * extents.GetY() + extents.GetY() * extents.GetZ() + extents.GetZ() * extents.GetX();
+    }
+
+    BvhScene::BvhScene(const AZ::Name& sceneName)
+        : m_sceneName(sceneName)
+    {
+        AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+    }
+
+    BvhScene::~BvhScene()
+    {
+        for (Node& node : m_nodes)
+        {
+            delete node.m_leaf;
+        }
+        for (BvhLeaf* leaf : m_freeLeaves)
+        {
+            delete leaf;
+        }
+    }
+
+    const AZ::Name& BvhScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+    void BvhScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode != nullptr)
+        {
+            const uint32_t leafNode = static_cast<BvhLeaf*>(entry.m_internalNode)->m_nodeIndex;
+            if (GetNodeBounds(leafNode).Contains(entry.m_boundingVolume))
+            {
+                // Entry moved, but is still within the loose bounds of its leaf
+                return;
+            }
+            RemoveFromTree(entry);
+            InsertIntoTree(entry);
+        }
+        else
+        {
+            InsertIntoTree(entry);
+            ++m_entryCount;
+        }
+    }
+
+    void BvhScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode != nullptr)
+        {
+            RemoveFromTree(entry);
+            --m_entryCount;
+        }
+    }
+
+    void BvhScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper([this, &aabb](uint32_t node)
+        {
+            const AZ::Aabb bounds = GetNodeBounds(node);
+            if (!AZ::ShapeIntersection::Overlaps(aabb, bounds))
+            {
+                return Containment::Outside;
+            }
+            return AZ::ShapeIntersection::Contains(aabb, bounds) ? Containment::Inside : Containment::Intersects;
+        }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper([this, &sphere](uint32_t node)
+        {
+            const AZ::Aabb bounds = GetNodeBounds(node);
+            if (!AZ::ShapeIntersection::Overlaps(sphere, bounds))
+            {
+                return Containment::Outside;
+            }
+            return AZ::ShapeIntersection::Contains(sphere, bounds) ? Containment::Inside : Containment::Intersects;
+        }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper([this, &hemisphere](uint32_t node)
+        {
+            const AZ::Aabb bounds = GetNodeBounds(node);
+            return AZ::ShapeIntersection::Overlaps(hemisphere, bounds) ? Containment::Intersects : Containment::Outside;
+        }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper([this, &capsule](uint32_t node)
+        {
+            const AZ::Aabb bounds = GetNodeBounds(node);
+            return AZ::ShapeIntersection::Overlaps(capsule, bounds) ? Containment::Intersects : Containment::Outside;
+        }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        const SimdFrustumPlanes planes(frustum);
+        EnumerateHelper([this, &planes](uint32_t node)
+        {
+            const int32_t result = planes.Classify(m_minX[node], m_minY[node], m_minZ[node], m_maxX[node], m_maxY[node], m_maxZ[node]);
+            return (result < 0) ? Containment::Outside : (result > 0) ? Containment::Inside : Containment::Intersects;
+        }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        const SimdFrustumPlanes includePlanes(includeFrustum);
+        const SimdFrustumPlanes excludePlanes(excludeFrustum);
+        EnumerateHelper([this, &includePlanes, &excludePlanes](uint32_t node)
+        {
+            const float minX = m_minX[node], minY = m_minY[node], minZ = m_minZ[node];
+            const float maxX = m_maxX[node], maxY = m_maxY[node], maxZ = m_maxZ[node];
+            if (includePlanes.Classify(minX, minY, minZ, maxX, maxY, maxZ) < 0 ||
+                excludePlanes.Classify(minX, minY, minZ, maxX, maxY, maxZ) > 0)
+            {
+                return Containment::Outside;
+            }
+            // Children may still be fully inside the exclude frustum, so they're always tested
+            return Containment::Intersects;
+        }, callback);
+    }
+
+    void BvhScene::EnumerateFrusta(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const
+    {
+        AZ_Assert(frusta.size() <= MaxEnumerateFrusta, "EnumerateFrusta supports at most %zu frusta", MaxEnumerateFrusta);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (m_root == InvalidNodeIndex)
+        {
+            return;
+        }
+
+        const AZStd::vector<SimdFrustumPlanes> planes = GetSimdFrustumPlanes(frusta);
+        EnumerateFrustaHelper(m_root, GetFrustumMask(frusta.size()), 0, [this, &planes](uint32_t frustumIndex, uint32_t node)
+        {
+            const int32_t result =
+                planes[frustumIndex].Classify(m_minX[node], m_minY[node], m_minZ[node], m_maxX[node], m_maxY[node], m_maxZ[node]);
+            return (result < 0) ? Containment::Outside : (result > 0) ? Containment::Inside : Containment::Intersects;
+        }, callback);
+    }
+
+    void BvhScene::EnumerateFrustaParallel(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const
+    {
+        AZ_Assert(frusta.size() <= MaxEnumerateFrusta, "EnumerateFrustaParallel supports at most %zu frusta", MaxEnumerateFrusta);
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActiveInterface || !taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            // Without an active task graph the tasks would never run, so enumerate on the calling thread instead
+            EnumerateFrusta(frusta, callback);
+            return;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (m_root == InvalidNodeIndex)
+        {
+            return;
+        }
+
+        const AZStd::vector<SimdFrustumPlanes> planes = GetSimdFrustumPlanes(frusta);
+        auto classify = [this, &planes](uint32_t frustumIndex, uint32_t node)
+        {
+            const int32_t result =
+                planes[frustumIndex].Classify(m_minX[node], m_minY[node], m_minZ[node], m_maxX[node], m_maxY[node], m_maxZ[node]);
+            return (result < 0) ? Containment::Outside : (result > 0) ? Containment::Inside : Containment::Intersects;
+        };
+
+        struct Subtree
+        {
+            uint32_t m_node;
+            FrustumMask m_intersectMask;
+            FrustumMask m_insideMask;
+        };
+
+        // The top of the tree is split on the calling thread until there are enough visible subtrees to spread across tasks.
+        // Each task classifies the root of its own subtree, so only the split nodes are classified on the calling thread.
+        AZStd::vector<Subtree> subtrees;
+        AZStd::vector<Subtree> nextSubtrees;
+        subtrees.push_back({ m_root, GetFrustumMask(frusta.size()), 0 });
+        while (!subtrees.empty() && subtrees.size() < bg_bvhParallelTaskCount)
+        {
+            nextSubtrees.clear();
+            bool splitAny = false;
+            for (const Subtree& subtree : subtrees)
+            {
+                const Node& node = m_nodes[subtree.m_node];
+                if (node.m_leaf != nullptr)
+                {
+                    nextSubtrees.push_back(subtree);
+                    continue;
+                }
+
+                FrustumMask intersectMask = subtree.m_intersectMask;
+                FrustumMask insideMask = subtree.m_insideMask;
+                ClassifyFrusta(classify, subtree.m_node, intersectMask, insideMask);
+                if ((intersectMask | insideMask) != 0)
+                {
+                    nextSubtrees.push_back({ node.m_children[0], intersectMask, insideMask });
+                    nextSubtrees.push_back({ node.m_children[1], intersectMask, insideMask });
+                    splitAny = true;
+                }
+            }
+            AZStd::swap(subtrees, nextSubtrees);
+            if (!splitAny)
+            {
+                // Only leaves remain
+                break;
+            }
+        }
+
+        static const AZ::TaskDescriptor descriptor{ "AzFramework::BvhScene::EnumerateFrusta", "Visibility" };
+        AZ::TaskGraph taskGraph{ "BvhScene::EnumerateFrustaParallel" };
+        for (const Subtree& subtree : subtrees)
+        {
+            taskGraph.AddTask(descriptor, [this, subtree, &classify, &callback]()
+            {
+                EnumerateFrustaHelper(subtree.m_node, subtree.m_intersectMask, subtree.m_insideMask, classify, callback);
+            });
+        }
+
+        if (!taskGraph.IsEmpty())
+        {
+            AZ::TaskGraphEvent waitForCompletion{ "BvhScene::EnumerateFrustaParallel Wait" };
+            taskGraph.Submit(&waitForCompletion);
+            waitForCompletion.Wait();
+        }
+    }
+
+    void BvhScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper([](uint32_t)
+        {
+            return Containment::Inside;
+        }, callback);
+    }
+
+    uint32_t BvhScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+    uint32_t BvhScene::GetNodeCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_nodes.size() - m_freeNodes.size());
+    }
+
+    uint32_t BvhScene::GetLeafCount() const
+    {
+        return m_leafCount;
+    }
+
+    uint32_t BvhScene::GetHeight() const
+    {
+        return (m_root != InvalidNodeIndex) ? aznumeric_cast<uint32_t>(m_nodes[m_root].m_height) : 0;
+    }
+
+    void BvhScene::DumpStats()
+    {
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::NodeCount = %u", GetName().GetCStr(), GetNodeCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::LeafCount = %u", GetName().GetCStr(), GetLeafCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::Height = %u", GetName().GetCStr(), GetHeight());
+    }
+
+    void BvhScene::InsertIntoTree(VisibilityEntry& entry)
+    {
+        AZ_Assert(entry.m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the BvhScene");
+
+        uint32_t leafNode = InvalidNodeIndex;
+        if (m_root == InvalidNodeIndex)
+        {
+            leafNode = AllocateNode();
+            BvhLeaf* leaf = AllocateLeaf();
+            leaf->m_nodeIndex = leafNode;
+            m_nodes[leafNode].m_leaf = leaf;
+            m_root = leafNode;
+        }
+        else
+        {
+            leafNode = FindBestLeafNode(entry.m_boundingVolume);
+        }
+
+        BvhLeaf* leaf = m_nodes[leafNode].m_leaf;
+        entry.m_internalNode = leaf;
+        entry.m_internalNodeIndex = aznumeric_cast<uint32_t>(leaf->m_entries.size());
+        leaf->m_entries.push_back(&entry);
+
+        if (leaf->m_entries.size() > bg_bvhLeafMaxEntries)
+        {
+            SplitLeafNode(leafNode);
+        }
+        else if (leaf->m_entries.size() == 1 || !GetNodeBounds(leafNode).Contains(entry.m_boundingVolume))
+        {
+            AZ::Aabb bounds = (leaf->m_entries.size() == 1) ? entry.m_boundingVolume : GetNodeBounds(leafNode);
+            bounds.AddAabb(entry.m_boundingVolume);
+            bounds.Expand(AZ::Vector3(bg_bvhLeafMargin));
+            SetNodeBounds(leafNode, bounds);
+            RefitAncestors(m_nodes[leafNode].m_parent);
+        }
+    }
+
+    void BvhScene::RemoveFromTree(VisibilityEntry& entry)
+    {
+        BvhLeaf* leaf = static_cast<BvhLeaf*>(entry.m_internalNode);
+        AZ_Assert(leaf->m_entries[entry.m_internalNodeIndex] == &entry, "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry
+        const uint32_t removeIndex = entry.m_internalNodeIndex;
+        entry.m_internalNode = nullptr;
+        entry.m_internalNodeIndex = 0;
+        if (removeIndex < (leaf->m_entries.size() - 1))
+        {
+            AZStd::swap(leaf->m_entries[removeIndex], leaf->m_entries.back());
+            leaf->m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+        }
+        leaf->m_entries.pop_back();
+
+        const uint32_t leafNode = leaf->m_nodeIndex;
+        if (leaf->m_entries.empty())
+        {
+            DetachLeafNode(leafNode);
+            ReleaseNode(leafNode);
+            ReleaseLeaf(leaf);
+        }
+        else
+        {
+            // Shrink the leaf so bounds don't keep growing as entries move through it
+            RecomputeLeafBounds(leafNode);
+            RefitAncestors(m_nodes[leafNode].m_parent);
+        }
+    }
+
+    uint32_t BvhScene::FindBestLeafNode(const AZ::Aabb& bounds) const
+    {
+        // Descend towards the child whose bounds grow the least by adding the entry
+        uint32_t node = m_root;
+        while (m_nodes[node].m_leaf == nullptr)
+        {
+            float bestCost = AZStd::numeric_limits<float>::max();
+            uint32_t bestChild = m_nodes[node].m_children[0];
+            for (uint32_t child : m_nodes[node].m_children)
+            {
+                AZ::Aabb childBounds = GetNodeBounds(child);
+                const float childCost = GetSurfaceCost(childBounds);
+                childBounds.AddAabb(bounds);
+                const float cost = GetSurfaceCost(childBounds) - childCost;
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestChild = child;
+                }
+            }
+            node = bestChild;
+        }
+        return node;
+    }
+
+    void BvhScene::SplitLeafNode(uint32_t leafNode)
+    {
+        BvhLeaf* leaf = m_nodes[leafNode].m_leaf;
+
+        // Partition the entries at the median along the axis of the largest spread of their centers
+        AZ::Aabb centerBounds = AZ::Aabb::CreateNull();
+        for (const VisibilityEntry* entry : leaf->m_entries)
+        {
+            centerBounds.AddPoint(entry->m_boundingVolume.GetCenter());
+        }
+        const AZ::Vector3 spread = centerBounds.GetExtents();
+        const int axis = (spread.GetX() >= spread.GetY() && spread.GetX() >= spread.GetZ()) ? 0 : (spread.GetY() >= spread.GetZ()) ? 1 : 2;
+        AZStd::sort(leaf->m_entries.begin(), leaf->m_entries.end(), [axis](const VisibilityEntry* lhs, const VisibilityEntry* rhs)
+        {
+            return lhs->m_boundingVolume.GetCenter().GetElement(axis) < rhs->m_boundingVolume.GetCenter().GetElement(axis);
+        });
+
+        const uint32_t newLeafNode = AllocateNode();
+        BvhLeaf* newLeaf = AllocateLeaf();
+        newLeaf->m_nodeIndex = newLeafNode;
+        m_nodes[newLeafNode].m_leaf = newLeaf;
+
+        const size_t splitIndex = leaf->m_entries.size() / 2;
+        newLeaf->m_entries.assign(leaf->m_entries.begin() + splitIndex, leaf->m_entries.end());
+        leaf->m_entries.erase(leaf->m_entries.begin() + splitIndex, leaf->m_entries.end());
+        for (BvhLeaf* target : { leaf, newLeaf })
+        {
+            for (uint32_t index = 0; index < target->m_entries.size(); ++index)
+            {
+                target->m_entries[index]->m_internalNode = target;
+                target->m_entries[index]->m_internalNodeIndex = index;
+            }
+        }
+
+        RecomputeLeafBounds(leafNode);
+        RecomputeLeafBounds(newLeafNode);
+        AttachLeafNode(newLeafNode, leafNode);
+    }
+
+    void BvhScene::AttachLeafNode(uint32_t leafNode, uint32_t siblingNode)
+    {
+        const uint32_t oldParent = m_nodes[siblingNode].m_parent;
+        const uint32_t newParent = AllocateNode();
+
+        Node& parent = m_nodes[newParent];
+        parent.m_parent = oldParent;
+        parent.m_children[0] = siblingNode;
+        parent.m_children[1] = leafNode;
+        m_nodes[siblingNode].m_parent = newParent;
+        m_nodes[leafNode].m_parent = newParent;
+
+        if (oldParent != InvalidNodeIndex)
+        {
+            Node& grandParent = m_nodes[oldParent];
+            grandParent.m_children[(grandParent.m_children[0] == siblingNode) ? 0 : 1] = newParent;
+        }
+        else
+        {
+            m_root = newParent;
+        }
+
+        RefitAncestors(newParent);
+    }
+
+    void BvhScene::DetachLeafNode(uint32_t leafNode)
+    {
+        if (leafNode == m_root)
+        {
+            m_root = InvalidNodeIndex;
+            return;
+        }
+
+        // The sibling of the leaf takes the place of their shared parent
+        const uint32_t parentNode = m_nodes[leafNode].m_parent;
+        const uint32_t grandParentNode = m_nodes[parentNode].m_parent;
+        const Node& parent = m_nodes[parentNode];
+        const uint32_t siblingNode = (parent.m_children[0] == leafNode) ? parent.m_children[1] : parent.m_children[0];
+
+        m_nodes[siblingNode].m_parent = grandParentNode;
+        m_nodes[leafNode].m_parent = InvalidNodeIndex;
+        if (grandParentNode != InvalidNodeIndex)
+        {
+            Node& grandParent = m_nodes[grandParentNode];
+            grandParent.m_children[(grandParent.m_children[0] == parentNode) ? 0 : 1] = siblingNode;
+            ReleaseNode(parentNode);
+            RefitAncestors(grandParentNode);
+        }
+        else
+        {
+            m_root = siblingNode;
+            ReleaseNode(parentNode);
+        }
+    }
+
+    void BvhScene::RefitAncestors(uint32_t node)
+    {
+        while (node != InvalidNodeIndex)
+        {
+            node = Balance(node);
+
+            Node& current = m_nodes[node];
+            current.m_height = 1 + AZStd::max(m_nodes[current.m_children[0]].m_height, m_nodes[current.m_children[1]].m_height);
+            SetNodeBoundsFromChildren(node);
+
+            node = current.m_parent;
+        }
+    }
+
+    uint32_t BvhScene::Balance(uint32_t indexA)
+    {
+        // Performs a left or right rotation if node A is imbalanced, returns the index of the node now in A's place
+        Node& nodeA = m_nodes[indexA];
+        if (nodeA.m_leaf != nullptr || nodeA.m_height < 2)
+        {
+            return indexA;
+        }
+
+        const uint32_t indexB = nodeA.m_children[0];
+        const uint32_t indexC = nodeA.m_children[1];
+        Node& nodeB = m_nodes[indexB];
+        Node& nodeC = m_nodes[indexC];
+        const int32_t balance = nodeC.m_height - nodeB.m_height;
+
+        // Rotates the taller child of A up into A's place and moves the shorter grandchild under A
+        auto rotateUp = [this, indexA, &nodeA](uint32_t indexUp, Node& nodeUp, uint32_t upSlot, uint32_t otherChild)
+        {
+            const uint32_t indexF = nodeUp.m_children[0];
+            const uint32_t indexG = nodeUp.m_children[1];
+
+            // Swap A and the rotated child
+            nodeUp.m_children[0] = indexA;
+            nodeUp.m_parent = nodeA.m_parent;
+            nodeA.m_parent = indexUp;
+
+            // A's old parent should point to the rotated child
+            if (nodeUp.m_parent != InvalidNodeIndex)
+            {
+                Node& parent = m_nodes[nodeUp.m_parent];
+                parent.m_children[(parent.m_children[0] == indexA) ? 0 : 1] = indexUp;
+            }
+            else
+            {
+                m_root = indexUp;
+            }
+
+            // Keep the taller grandchild under the rotated child
+            const bool keepF = m_nodes[indexF].m_height > m_nodes[indexG].m_height;
+            const uint32_t keep = keepF ? indexF : indexG;
+            const uint32_t move = keepF ? indexG : indexF;
+            nodeUp.m_children[1] = keep;
+            nodeA.m_children[upSlot] = move;
+            m_nodes[move].m_parent = indexA;
+
+            SetNodeBoundsFromChildren(indexA);
+            SetNodeBoundsFromChildren(indexUp);
+            nodeA.m_height = 1 + AZStd::max(m_nodes[otherChild].m_height, m_nodes[move].m_height);
+            nodeUp.m_height = 1 + AZStd::max(nodeA.m_height, m_nodes[keep].m_height);
+        };
+
+        if (balance > 1)
+        {
+            rotateUp(indexC, nodeC, 1, indexB);
+            return indexC;
+        }
+
+        if (balance < -1)
+        {
+            rotateUp(indexB, nodeB, 0, indexC);
+            return indexB;
+        }
+
+        return indexA;
+    }
+
+    void BvhScene::RecomputeLeafBounds(uint32_t leafNode)
+    {
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        for (const VisibilityEntry* entry : m_nodes[leafNode].m_leaf->m_entries)
+        {
+            bounds.AddAabb(entry->m_boundingVolume);
+        }
+        bounds.Expand(AZ::Vector3(bg_bvhLeafMargin));
+        SetNodeBounds(leafNode, bounds);
+    }
+
+    template <typename Classifier>
+    void BvhScene::EnumerateHelper(const Classifier& classify, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        if (m_root == InvalidNodeIndex)
+        {
+            return;
+        }
+
+        // Nodes found to be fully inside the query volume are flagged so their subtree isn't tested any further
+        struct StackEntry
+        {
+            uint32_t m_node;
+            bool m_inside;
+        };
+        AZStd::fixed_vector<StackEntry, MaxTraversalDepth> stack;
+        stack.push_back({ m_root, false });
+
+        while (!stack.empty())
+        {
+            const StackEntry current = stack.back();
+            stack.pop_back();
+
+            bool inside = current.m_inside;
+            if (!inside)
+            {
+                const Containment containment = classify(current.m_node);
+                if (containment == Containment::Outside)
+                {
+                    continue;
+                }
+                inside = (containment == Containment::Inside);
+            }
+
+            const Node& node = m_nodes[current.m_node];
+            if (node.m_leaf != nullptr)
+            {
+                callback({ GetNodeBounds(current.m_node), node.m_leaf->m_entries });
+            }
+            else
+            {
+                AZ_Assert(stack.size() + 2 <= MaxTraversalDepth, "BvhScene traversal exceeded the maximum supported tree depth");
+                stack.push_back({ node.m_children[1], inside });
+                stack.push_back({ node.m_children[0], inside });
+            }
+        }
+    }
+
+    template <typename FrustumClassifier>
+    void BvhScene::ClassifyFrusta(const FrustumClassifier& classify, uint32_t node, FrustumMask& intersectMask, FrustumMask& insideMask)
+    {
+        // Frusta that don't overlap the node are dropped, and frusta that entirely contain the node aren't tested against its children
+        for (FrustumMask remaining = intersectMask; remaining != 0; remaining &= remaining - 1)
+        {
+            const uint32_t frustumIndex = aznumeric_cast<uint32_t>(az_ctz_u64(remaining));
+            const FrustumMask frustumBit = FrustumMask(1) << frustumIndex;
+            const Containment containment = classify(frustumIndex, node);
+            if (containment != Containment::Intersects)
+            {
+                intersectMask &= ~frustumBit;
+            }
+            if (containment == Containment::Inside)
+            {
+                insideMask |= frustumBit;
+            }
+        }
+    }
+
+    template <typename FrustumClassifier>
+    void BvhScene::EnumerateFrustaHelper(
+        uint32_t subtreeRoot,
+        FrustumMask intersectMask,
+        FrustumMask insideMask,
+        const FrustumClassifier& classify,
+        const MultiFrustumEnumerateCallback& callback) const
+    {
+        struct StackEntry
+        {
+            uint32_t m_node;
+            FrustumMask m_intersectMask;
+            FrustumMask m_insideMask;
+        };
+        AZStd::fixed_vector<StackEntry, MaxTraversalDepth> stack;
+        stack.push_back({ subtreeRoot, intersectMask, insideMask });
+
+        while (!stack.empty())
+        {
+            StackEntry current = stack.back();
+            stack.pop_back();
+
+            ClassifyFrusta(classify, current.m_node, current.m_intersectMask, current.m_insideMask);
+            const FrustumMask visibleMask = current.m_intersectMask | current.m_insideMask;
+            if (visibleMask == 0)
+            {
+                continue;
+            }
+
+            const Node& node = m_nodes[current.m_node];
+            if (node.m_leaf != nullptr)
+            {
+                callback({ GetNodeBounds(current.m_node), node.m_leaf->m_entries }, visibleMask);
+            }
+            else
+            {
+                AZ_Assert(stack.size() + 2 <= MaxTraversalDepth, "BvhScene traversal exceeded the maximum supported tree depth");
+                stack.push_back({ node.m_children[1], current.m_intersectMask, current.m_insideMask });
+                stack.push_back({ node.m_children[0], current.m_intersectMask, current.m_insideMask });
+            }
+        }
+    }
+
+    uint32_t BvhScene::AllocateNode()
+    {
+        uint32_t node;
+        if (!m_freeNodes.empty())
+        {
+            node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+            m_nodes[node] = Node();
+        }
+        else
+        {
+            node = aznumeric_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+            m_minX.push_back(0.0f);
+            m_minY.push_back(0.0f);
+            m_minZ.push_back(0.0f);
+            m_maxX.push_back(0.0f);
+            m_maxY.push_back(0.0f);
+            m_maxZ.push_back(0.0f);
+        }
+        return node;
+    }
+
+    void BvhScene::ReleaseNode(uint32_t node)
+    {
+        m_nodes[node] = Node();
+        m_freeNodes.push_back(node);
+    }
+
+    BvhLeaf* BvhScene::AllocateLeaf()
+    {
+        ++m_leafCount;
+        if (!m_freeLeaves.empty())
+        {
+            BvhLeaf* leaf = m_freeLeaves.back();
+            m_freeLeaves.pop_back();
+            return leaf;
+        }
+        return aznew BvhLeaf;
+    }
+
+    void BvhScene::ReleaseLeaf(BvhLeaf* leaf)
+    {
+        --m_leafCount;
+        leaf->m_entries.clear();
+        m_freeLeaves.push_back(leaf);
+    }
+
+    AZ::Aabb BvhScene::GetNodeBounds(uint32_t node) const
+    {
+        return AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(m_minX[node], m_minY[node], m_minZ[node]), AZ::Vector3(m_maxX[node], m_maxY[node], m_maxZ[node]));
+    }
+
+    void BvhScene::SetNodeBounds(uint32_t node, const AZ::Aabb& bounds)
+    {
+        m_minX[node] = bounds.GetMin().GetX();
+        m_minY[node] = bounds.GetMin().GetY();
+        m_minZ[node] = bounds.GetMin().GetZ();
+        m_maxX[node] = bounds.GetMax().GetX();
+        m_maxY[node] = bounds.GetMax().GetY();
+        m_maxZ[node] = bounds.GetMax().GetZ();
+    }
+
+    void BvhScene::SetNodeBoundsFromChildren(uint32_t node)
+    {
+        const uint32_t child0 = m_nodes[node].m_children[0];
+        const uint32_t child1 = m_nodes[node].m_children[1];
+        m_minX[node] = AZStd::min(m_minX[child0], m_minX[child1]);
+        m_minY[node] = AZStd::min(m_minY[child0], m_minY[child1]);
+        m_minZ[node] = AZStd::min(m_minZ[child0], m_minZ[child1]);
+        m_maxX[node] = AZStd::max(m_maxX[child0], m_maxX[child1]);
+        m_maxY[node] = AZStd::max(m_maxY[child0], m_maxY[child1]);
+        m_maxZ[node] = AZStd::max(m_maxZ[child0], m_maxZ[child1]);
+    }
+}
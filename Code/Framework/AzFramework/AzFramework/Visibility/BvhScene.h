@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AzFramework
+{
+    //! A leaf within the bounding volume hierarchy.
+    //! Each leaf holds a small bucket of entries so that enumeration callbacks are invoked per bucket rather than per entry.
+    class BvhLeaf
+        : public VisibilityNode
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BvhLeaf, AZ::SystemAllocator);
+
+        AZStd::vector<VisibilityEntry*> m_entries;
+        uint32_t m_nodeIndex = 0;
+    };
+
+    //! Alternative implementation of the visibility scene interface using a dynamic bounding volume hierarchy.
+    //! Leaf bounds are loose, they are expanded by a margin so entries that move a small distance don't touch the tree at all.
+    //! The tree is kept balanced through rotations as leaves are added and removed, and node bounds are stored as separate arrays
+    //! per component so frustum queries can test a node against all frustum planes at once using SIMD.
+    class BvhScene
+        : public IVisibilityScene
+    {
+    public:
+        AZ_RTTI(BvhScene, "{5A7E2C1B-9D4F-4E83-B6A0-2F1C8D3E7B95}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(BvhScene, AZ::SystemAllocator);
+        AZ_DISABLE_COPY_MOVE(BvhScene);
+
+        explicit BvhScene(const AZ::Name& sceneName);
+        virtual ~BvhScene();
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
+        void EnumerateFrusta(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const override;
+        void EnumerateFrustaParallel(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetLeafCount() const;
+        uint32_t GetHeight() const;
+        void DumpStats();
+        //! @}
+
+    private:
+        static constexpr uint32_t InvalidNodeIndex = 0xFFFFFFFF;
+
+        struct Node
+        {
+            uint32_t m_parent = InvalidNodeIndex;
+            uint32_t m_children[2] = { InvalidNodeIndex, InvalidNodeIndex };
+            int32_t m_height = 0;
+            BvhLeaf* m_leaf = nullptr; //< Non-null for leaf nodes.
+        };
+
+        enum class Containment
+        {
+            Outside,
+            Intersects,
+            Inside
+        };
+
+        void InsertIntoTree(VisibilityEntry& entry);
+        void RemoveFromTree(VisibilityEntry& entry);
+        uint32_t FindBestLeafNode(const AZ::Aabb& bounds) const;
+        void SplitLeafNode(uint32_t leafNode);
+        void AttachLeafNode(uint32_t leafNode, uint32_t siblingNode);
+        void DetachLeafNode(uint32_t leafNode);
+        void RefitAncestors(uint32_t node);
+        uint32_t Balance(uint32_t node);
+        void RecomputeLeafBounds(uint32_t leafNode);
+
+        template <typename Classifier>
+        void EnumerateHelper(const Classifier& classify, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        template <typename FrustumClassifier>
+        static void ClassifyFrusta(const FrustumClassifier& classify, uint32_t node, FrustumMask& intersectMask, FrustumMask& insideMask);
+        template <typename FrustumClassifier>
+        void EnumerateFrustaHelper(
+            uint32_t subtreeRoot,
+            FrustumMask intersectMask,
+            FrustumMask insideMask,
+            const FrustumClassifier& classify,
+            const MultiFrustumEnumerateCallback& callback) const;
+
+        uint32_t AllocateNode();
+        void ReleaseNode(uint32_t node);
+        BvhLeaf* AllocateLeaf();
+        void ReleaseLeaf(BvhLeaf* leaf);
+
+        AZ::Aabb GetNodeBounds(uint32_t node) const;
+        void SetNodeBounds(uint32_t node, const AZ::Aabb& bounds);
+        void SetNodeBoundsFromChildren(uint32_t node);
+
+        mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+
+        AZStd::vector<Node> m_nodes; //< Tree topology, indexed by node.
+        //! Node bounds, stored per component so queries only touch the bounds while traversing.
+        //! @{
+        AZStd::vector<float> m_minX;
+        AZStd::vector<float> m_minY;
+        AZStd::vector<float> m_minZ;
+        AZStd::vector<float> m_maxX;
+        AZStd::vector<float> m_maxY;
+        AZStd::vector<float> m_maxZ;
+        //! @}
+        AZStd::vector<uint32_t> m_freeNodes; //< Indices of released nodes available for reuse.
+        AZStd::vector<BvhLeaf*> m_freeLeaves; //< Released leaves kept to reuse their entry storage.
+        uint32_t m_root = InvalidNodeIndex;
+
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the tree.
+        uint32_t m_leafCount = 0; //< Metric tracking the number of leaves in the tree.
+    };
+}
@@ -19,6 +19,7 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -63,6 +64,19 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! Bitmask of the frusta a node is visible to in a multi-frustum enumeration, bit N is set if the node overlaps frusta[N].
+        using FrustumMask = uint64_t;
+        using MultiFrustumEnumerateCallback = AZStd::function<void(const NodeData&, FrustumMask)>;
+
+        //! The maximum number of frusta that can be tested against in a single multi-frustum enumeration.
+        static constexpr size_t MaxEnumerateFrusta = sizeof(FrustumMask) * 8;
+
+        //! Returns a mask with the bits set for the first frustumCount frusta.
+        static constexpr FrustumMask GetFrustumMask(size_t frustumCount)
+        {
+            return (frustumCount >= MaxEnumerateFrusta) ? ~FrustumMask(0) : (FrustumMask(1) << frustumCount) - 1;
+        }
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -111,6 +125,22 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a set of frusta against the visibility system in a single traversal.
+        //! Each visible node is reported once along with the mask of frusta it overlaps, which is cheaper than enumerating each frustum
+        //! separately when many views (shadow cascades, cubemap faces, etc.) look at the same part of the scene.
+        //! @param frusta the frusta to test against, at most MaxEnumerateFrusta
+        //! @param callback the callback to invoke when a node is visible to at least one frustum
+        virtual void EnumerateFrusta(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const = 0;
+
+        //! Same as EnumerateFrusta, but the traversal is split into tasks that run on the task executor.
+        //! The callback may be invoked concurrently from multiple threads, and this function returns once all tasks are complete.
+        //! This blocks on a task graph event, so it must not be called from within a task.
+        //! If the task graph isn't active, this behaves like EnumerateFrusta and enumerates on the calling thread.
+        //! @param frusta the frusta to test against, at most MaxEnumerateFrusta
+        //! @param callback the callback to invoke when a node is visible to at least one frustum
+        virtual void EnumerateFrustaParallel(
+            AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
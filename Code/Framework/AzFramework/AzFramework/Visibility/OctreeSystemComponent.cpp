@@ -7,8 +7,12 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace AzFramework
 {
@@ -16,6 +20,8 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(uint32_t, bg_octreeParallelTaskCount,     32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of subtrees a parallel multi-frustum enumeration is split into before being distributed across tasks");
+    AZ_CVAR(bool,     bg_visibilityUseBvh,         false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "If set to true, visibility scenes use a dynamic bounding volume hierarchy with loose leaf bounds instead of an octree");
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,6 +30,30 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    // Narrows the frustum masks down for a node, frusta that don't overlap the node are dropped and frusta that entirely contain the node
+    // are moved to the inside mask so they aren't tested against any of its children
+    static void ClassifyFrusta(
+        AZStd::span<const AZ::Frustum> frusta,
+        const AZ::Aabb& bounds,
+        IVisibilityScene::FrustumMask& intersectMask,
+        IVisibilityScene::FrustumMask& insideMask)
+    {
+        for (IVisibilityScene::FrustumMask remaining = intersectMask; remaining != 0; remaining &= remaining - 1)
+        {
+            const uint32_t frustumIndex = aznumeric_cast<uint32_t>(az_ctz_u64(remaining));
+            const IVisibilityScene::FrustumMask frustumBit = IVisibilityScene::FrustumMask(1) << frustumIndex;
+            if (!AZ::ShapeIntersection::Overlaps(frusta[frustumIndex], bounds))
+            {
+                intersectMask &= ~frustumBit;
+            }
+            else if (AZ::ShapeIntersection::Contains(frusta[frustumIndex], bounds))
+            {
+                intersectMask &= ~frustumBit;
+                insideMask |= frustumBit;
+            }
+        }
+    }
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
     {
@@ -207,6 +237,36 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::EnumerateFrusta(
+        AZStd::span<const AZ::Frustum> frusta,
+        IVisibilityScene::FrustumMask intersectMask,
+        IVisibilityScene::FrustumMask insideMask,
+        const IVisibilityScene::MultiFrustumEnumerateCallback& callback) const
+    {
+        ClassifyFrusta(frusta, m_bounds, intersectMask, insideMask);
+        const IVisibilityScene::FrustumMask visibleMask = intersectMask | insideMask;
+        if (visibleMask == 0)
+        {
+            return;
+        }
+
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({ m_bounds, m_entries }, visibleMask);
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                m_children[child].EnumerateFrusta(frusta, intersectMask, insideMask, callback);
+            }
+        }
+    }
+
     void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         // Invoke the callback for the current node
@@ -231,6 +291,11 @@ namespace AzFramework
         return m_entries;
     }
 
+    const AZ::Aabb& OctreeNode::GetBounds() const
+    {
+        return m_bounds;
+    }
+
     OctreeNode* OctreeNode::GetChildren() const
     {
         return m_children;
@@ -446,6 +511,86 @@ namespace AzFramework
         m_root.Enumerate(includeFrustum, excludeFrustum, callback);
     }
 
+    void OctreeScene::EnumerateFrusta(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const
+    {
+        AZ_Assert(frusta.size() <= MaxEnumerateFrusta, "EnumerateFrusta supports at most %zu frusta", MaxEnumerateFrusta);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateFrusta(frusta, GetFrustumMask(frusta.size()), 0, callback);
+    }
+
+    void OctreeScene::EnumerateFrustaParallel(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const
+    {
+        AZ_Assert(frusta.size() <= MaxEnumerateFrusta, "EnumerateFrustaParallel supports at most %zu frusta", MaxEnumerateFrusta);
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActiveInterface || !taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            // Without an active task graph the tasks would never run, so enumerate on the calling thread instead
+            EnumerateFrusta(frusta, callback);
+            return;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        struct Subtree
+        {
+            const OctreeNode* m_node;
+            FrustumMask m_intersectMask;
+            FrustumMask m_insideMask;
+        };
+
+        // The levels closest to the root are enumerated on the calling thread until there are enough visible subtrees to spread
+        // across tasks
+        AZStd::vector<Subtree> subtrees;
+        AZStd::vector<Subtree> nextSubtrees;
+        subtrees.push_back({ &m_root, GetFrustumMask(frusta.size()), 0 });
+        while (!subtrees.empty() && subtrees.size() < bg_octreeParallelTaskCount)
+        {
+            nextSubtrees.clear();
+            for (const Subtree& subtree : subtrees)
+            {
+                FrustumMask intersectMask = subtree.m_intersectMask;
+                FrustumMask insideMask = subtree.m_insideMask;
+                ClassifyFrusta(frusta, subtree.m_node->GetBounds(), intersectMask, insideMask);
+                if ((intersectMask | insideMask) == 0)
+                {
+                    continue;
+                }
+
+                if (!subtree.m_node->GetEntries().empty())
+                {
+                    callback({ subtree.m_node->GetBounds(), subtree.m_node->GetEntries() }, intersectMask | insideMask);
+                }
+
+                if (OctreeNode* children = subtree.m_node->GetChildren())
+                {
+                    const uint32_t childCount = GetChildNodeCount();
+                    for (uint32_t child = 0; child < childCount; ++child)
+                    {
+                        nextSubtrees.push_back({ &children[child], intersectMask, insideMask });
+                    }
+                }
+            }
+            AZStd::swap(subtrees, nextSubtrees);
+        }
+
+        static const AZ::TaskDescriptor descriptor{ "AzFramework::OctreeScene::EnumerateFrusta", "Visibility" };
+        AZ::TaskGraph taskGraph{ "OctreeScene::EnumerateFrustaParallel" };
+        for (const Subtree& subtree : subtrees)
+        {
+            taskGraph.AddTask(descriptor, [subtree, frusta, &callback]()
+            {
+                subtree.m_node->EnumerateFrusta(frusta, subtree.m_intersectMask, subtree.m_insideMask, callback);
+            });
+        }
+
+        if (!taskGraph.IsEmpty())
+        {
+            AZ::TaskGraphEvent waitForCompletion{ "OctreeScene::EnumerateFrustaParallel Wait" };
+            taskGraph.Submit(&waitForCompletion);
+            waitForCompletion.Wait();
+        }
+    }
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -580,7 +725,7 @@ namespace AzFramework
         AZ::Interface<IVisibilitySystem>::Register(this);
         IVisibilitySystemRequestBus::Handler::BusConnect();
 
-        m_defaultScene = aznew OctreeScene(AZ::Name("DefaultVisibilityScene"));
+        m_defaultScene = CreateScene(AZ::Name("DefaultVisibilityScene"));
     }
 
     OctreeSystemComponent::~OctreeSystemComponent()
@@ -611,7 +756,7 @@ namespace AzFramework
     IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
     {
         AZ_Assert(FindVisibilityScene(sceneName) == nullptr, "Scene with same name already created!");
-        OctreeScene* newScene = aznew OctreeScene(sceneName);
+        IVisibilityScene* newScene = CreateScene(sceneName);
         m_scenes.push_back(newScene);
         return newScene;
     }
@@ -630,9 +775,18 @@ namespace AzFramework
         AZ_Assert(false, "visScene[\"%s\"] not found in the OctreeSystemComponent", visScene->GetName().GetCStr());
     }
 
+    IVisibilityScene* OctreeSystemComponent::CreateScene(const AZ::Name& sceneName)
+    {
+        if (bg_visibilityUseBvh)
+        {
+            return aznew BvhScene(sceneName);
+        }
+        return aznew OctreeScene(sceneName);
+    }
+
     IVisibilityScene* OctreeSystemComponent::FindVisibilityScene(const AZ::Name& sceneName)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             if(scene->GetName() == sceneName)
             {
@@ -644,10 +798,17 @@ namespace AzFramework
 
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             AZ_TracePrintf("Console", "============================================");
-            scene->DumpStats();
+            if (auto* octreeScene = azrtti_cast<OctreeScene*>(scene))
+            {
+                octreeScene->DumpStats();
+            }
+            else if (auto* bvhScene = azrtti_cast<BvhScene*>(scene))
+            {
+                bvhScene->DumpStats();
+            }
         }
         AZ_TracePrintf("Console", "============================================");
     }
@@ -57,12 +57,24 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively enumerates any OctreeNodes and their children that intersect any of the provided frusta.
+        //! @param intersectMask the frusta that intersect the parent node and still need to be tested against this node
+        //! @param insideMask the frusta that entirely contain the parent node
+        void EnumerateFrusta(
+            AZStd::span<const AZ::Frustum> frusta,
+            IVisibilityScene::FrustumMask intersectMask,
+            IVisibilityScene::FrustumMask insideMask,
+            const IVisibilityScene::MultiFrustumEnumerateCallback& callback) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
+        //! Returns the bounds of this node.
+        const AZ::Aabb& GetBounds() const;
+
         //! Returns the array of child nodes for this OctreeNode, may be nullptr if this OctreeNode is a leaf node.
         OctreeNode* GetChildren() const;
 
@@ -95,7 +107,7 @@ namespace AzFramework
         : public IVisibilityScene
     {
     public:
-        AZ_RTTI(OctreeScene, "{A88E4D86-11F1-4E3F-A91A-66DE99502B93}");
+        AZ_RTTI(OctreeScene, "{A88E4D86-11F1-4E3F-A91A-66DE99502B93}", IVisibilityScene);
         AZ_CLASS_ALLOCATOR(OctreeScene, AZ::SystemAllocator);
         AZ_DISABLE_COPY_MOVE(OctreeScene);
 
@@ -113,6 +125,8 @@ namespace AzFramework
         void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
+        void EnumerateFrusta(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const override;
+        void EnumerateFrustaParallel(AZStd::span<const AZ::Frustum> frusta, const MultiFrustumEnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -184,11 +198,14 @@ namespace AzFramework
         //! @}
 
     private:
+        //! Creates either an OctreeScene or a BvhScene depending on the bg_visibilityUseBvh cvar.
+        static IVisibilityScene* CreateScene(const AZ::Name& sceneName);
+
         //! The default scene used for most entities (e.g. gameplay, networking)
-        OctreeScene* m_defaultScene = nullptr;
+        IVisibilityScene* m_defaultScene = nullptr;
 
         //! Other scenes (e.g. each rendering scene) are stored here and looked up by name.
-        AZStd::vector<OctreeScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
+        AZStd::vector<IVisibilityScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
         
     };
 }
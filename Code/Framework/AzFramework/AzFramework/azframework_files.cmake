@@ -33,12 +33,14 @@ set(FILES
     Archive/ZipDirCache.cpp
     Archive/ZipDirCacheFactory.cpp
     Archive/ZipDirFind.cpp
+    Archive/ZipDirFlatIndex.cpp
     Archive/ZipDirList.cpp
     Archive/ZipDirStructures.cpp
     Archive/ZipDirTree.cpp
     Archive/ZipDirCache.h
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
+    Archive/ZipDirFlatIndex.h
     Archive/ZipDirList.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
@@ -136,6 +138,11 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformHierarchy.cpp
+    Components/TransformHierarchy.h
+    Components/TransformHierarchyBus.h
+    Components/TransformHierarchySystem.cpp
+    Components/TransformHierarchySystem.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -364,12 +371,16 @@ set(FILES
     Spawnable/SpawnableAssetHandler.cpp
     Spawnable/SpawnableAssetUtils.h
     Spawnable/SpawnableAssetUtils.cpp
+    Spawnable/SpawnableClonePlan.h
+    Spawnable/SpawnableClonePlan.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
     Spawnable/SpawnableEntitiesInterface.cpp
     Spawnable/SpawnableEntitiesManager.h
     Spawnable/SpawnableEntitiesManager.cpp
+    Spawnable/SpawnableEntitiesPool.h
+    Spawnable/SpawnableEntitiesPool.cpp
     Spawnable/SpawnableMetaData.cpp
     Spawnable/SpawnableMetaData.h
     Spawnable/SpawnableMonitor.h
@@ -386,6 +397,7 @@ set(FILES
     Windowing/WindowBus.h
     Windowing/NativeWindow.cpp
     Windowing/NativeWindow.h
+    Input/Buses/Notifications/InputChannelEventBatchNotificationBus.h
     Input/Buses/Notifications/InputChannelNotificationBus.h
     Input/Buses/Notifications/InputDeviceNotificationBus.h
     Input/Buses/Notifications/InputSystemNotificationBus.h
@@ -449,6 +461,10 @@ set(FILES
     Input/Devices/VirtualKeyboard/InputDeviceVirtualKeyboard.h
     Input/Devices/Touch/InputDeviceTouch.cpp
     Input/Devices/Touch/InputDeviceTouch.h
+    Input/Events/InputChannelEventBatchListener.cpp
+    Input/Events/InputChannelEventBatchListener.h
+    Input/Events/InputChannelEventBuffer.cpp
+    Input/Events/InputChannelEventBuffer.h
     Input/Events/InputChannelEventFilter.cpp
     Input/Events/InputChannelEventFilter.h
     Input/Events/InputChannelEventListener.cpp
@@ -483,6 +499,8 @@ set(FILES
     Slice/SliceInstantiationTicket.cpp
     Visibility/BoundsBus.cpp
     Visibility/BoundsBus.h
+    Visibility/BvhScene.cpp
+    Visibility/BvhScene.h
     Visibility/EntityBoundsUnionBus.h
     Visibility/EntityVisibilityBoundsUnionSystem.cpp
     Visibility/EntityVisibilityBoundsUnionSystem.h
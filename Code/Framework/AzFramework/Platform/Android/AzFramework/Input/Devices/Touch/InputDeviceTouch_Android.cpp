@@ -209,12 +209,18 @@ namespace AzFramework
             windowHeight = 1;
         }
 
+        // The event time is in nanoseconds on the CLOCK_MONOTONIC time base used by steady_clock
+        const AZStd::chrono::steady_clock::time_point eventTime(
+            AZStd::chrono::duration_cast<AZStd::chrono::steady_clock::duration>(
+                AZStd::chrono::nanoseconds(AMotionEvent_getEventTime(rawInputEvent))));
+
         // Push the raw touch event onto the thread safe queue for processing in TickInputDevice
         const RawTouchEvent rawTouchEvent(x / static_cast<float>(windowWidth),
                                           y / static_cast<float>(windowHeight),
                                           rawTouchState == RawTouchEvent::State::Ended ? 0.0f : pressure,
                                           pointerId,
-                                          rawTouchState);
+                                          rawTouchState,
+                                          eventTime);
         AZStd::lock_guard<AZStd::mutex> lock(m_threadAwareRawTouchEventsMutex);
         m_threadAwareRawTouchEvents.push_back(rawTouchEvent);
     }
@@ -23,6 +23,9 @@
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ArchiveVars.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirFind.h>
+#include <AzFramework/Archive/ZipDirFlatIndex.h>
+#include <AzFramework/Archive/ZipDirTree.h>
 
 namespace UnitTest
 {
@@ -878,4 +881,65 @@ namespace UnitTest
         EXPECT_EQ(resolvedAddedPath, resolvedResourcePath);
         reslist->Clear();
     }
+
+    TEST_F(ArchiveTestFixture, ZipDirFlatIndex_FindFile_MatchesFileEntryTree)
+    {
+        using AZ::IO::ZipDir::FlatIndex;
+
+        constexpr AZStd::string_view paths[] = {
+            "levels/level1.spawnable", "levels/level2.spawnable", "textures/diffuse/rock.dds", "textures/normal/rock.dds",
+            "readme.txt", "levels/level1.spawnable" };
+        AZStd::vector<FlatIndex::SourceEntry> entries;
+        for (size_t i = 0; i < AZStd::size(paths); ++i)
+        {
+            AZ::IO::ZipDir::FileEntryBase fileEntry;
+            fileEntry.nFileDataOffset = aznumeric_cast<uint32_t>(i * 100);
+            fileEntry.desc.lSizeUncompressed = aznumeric_cast<uint32_t>(i);
+            entries.emplace_back(paths[i], fileEntry);
+        }
+
+        constexpr uint32_t cdrCrc = 0x1234;
+        AZStd::unique_ptr<FlatIndex> index = FlatIndex::Create(entries, cdrCrc);
+        ASSERT_NE(nullptr, index);
+        // the duplicated path only keeps the first entry
+        EXPECT_EQ(5u, index->NumFilesTotal());
+
+        AZ::IO::ZipDir::FileEntryTree tree;
+        index->AddToTree(tree);
+        EXPECT_EQ(5u, tree.NumFilesTotal());
+
+        for (size_t i = 0; i + 1 < AZStd::size(paths); ++i)
+        {
+            AZ::IO::ZipDir::FileEntry* fileEntry = nullptr;
+            ASSERT_TRUE(index->FindFile(AZ::IO::PathView(paths[i]), fileEntry));
+            ASSERT_NE(nullptr, fileEntry);
+            EXPECT_TRUE(index->IsOwnerOf(fileEntry));
+            EXPECT_EQ(i * 100, fileEntry->nFileDataOffset);
+
+            AZ::IO::ZipDir::FileEntry* treeEntry = AZ::IO::ZipDir::FindFile(&tree).FindExact(AZ::IO::PathView(paths[i]));
+            ASSERT_NE(nullptr, treeEntry);
+            EXPECT_EQ(fileEntry->nFileDataOffset, treeEntry->nFileDataOffset);
+        }
+
+        AZ::IO::ZipDir::FileEntry* fileEntry = nullptr;
+        EXPECT_TRUE(index->FindFile(AZ::IO::PathView("levels/level3.spawnable"), fileEntry));
+        EXPECT_EQ(nullptr, fileEntry);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+        const AZ::IO::Path indexPath = FlatIndex::GetIndexPath("@usercache@/flatindex.pak");
+        ASSERT_TRUE(index->Save(fileIo, indexPath.c_str()));
+
+        // an index saved for a different central directory is rejected
+        EXPECT_EQ(nullptr, FlatIndex::Load(fileIo, indexPath.c_str(), cdrCrc + 1));
+
+        AZStd::unique_ptr<FlatIndex> loadedIndex = FlatIndex::Load(fileIo, indexPath.c_str(), cdrCrc);
+        ASSERT_NE(nullptr, loadedIndex);
+        EXPECT_EQ(index->NumFilesTotal(), loadedIndex->NumFilesTotal());
+        ASSERT_TRUE(loadedIndex->FindFile(AZ::IO::PathView("textures/normal/rock.dds"), fileEntry));
+        ASSERT_NE(nullptr, fileEntry);
+        EXPECT_EQ(300u, fileEntry->nFileDataOffset);
+
+        fileIo->Remove(indexPath.c_str());
+    }
 }
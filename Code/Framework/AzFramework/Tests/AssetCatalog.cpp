@@ -27,6 +27,7 @@
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Asset/AssetCatalog.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
+#include <AzFramework/Asset/AssetRegistry.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
 #include <AzFramework/Application/Application.h>
@@ -916,6 +917,208 @@ namespace UnitTest
         EXPECT_FALSE(m_assetCatalog->DoesAssetIdMatchWildcardPattern(m_firstAssetId, ""));
     }
 
+    TEST_F(AssetCatalogAPITest, AssetRegistrySnapshot_Lookups_MatchRegistry)
+    {
+        using namespace AZ::Data;
+
+        AzFramework::AssetRegistry registry;
+        AZStd::vector<AssetId> assetIds;
+        for (int i = 0; i < 100; ++i)
+        {
+            AssetInfo assetInfo;
+            assetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), i);
+            assetInfo.m_relativePath = AZStd::string::format("Folder/Asset%d.txt", i);
+            assetInfo.m_sizeBytes = i + 1;
+            registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+            assetIds.push_back(assetInfo.m_assetId);
+        }
+
+        // legacy ids alias the info of another asset
+        const AssetId legacyAssetId(AZ::Uuid::CreateRandom(), 0);
+        registry.m_assetIdToInfo[legacyAssetId] = registry.m_assetIdToInfo[assetIds[0]];
+
+        const AzFramework::AssetRegistrySnapshot snapshot(registry);
+        EXPECT_EQ(registry.m_assetIdToInfo.size(), snapshot.GetAssetCount());
+
+        for (const AssetId& assetId : assetIds)
+        {
+            const AssetInfo* assetInfo = snapshot.FindAssetInfo(assetId);
+            ASSERT_NE(nullptr, assetInfo);
+            EXPECT_EQ(registry.m_assetIdToInfo[assetId].m_relativePath, assetInfo->m_relativePath);
+            EXPECT_EQ(registry.m_assetIdToInfo[assetId].m_sizeBytes, assetInfo->m_sizeBytes);
+            EXPECT_EQ(assetId, snapshot.GetAssetIdByPath(assetInfo->m_relativePath.c_str()));
+        }
+
+        const AssetInfo* legacyAssetInfo = snapshot.FindAssetInfo(legacyAssetId);
+        ASSERT_NE(nullptr, legacyAssetInfo);
+        EXPECT_EQ(assetIds[0], legacyAssetInfo->m_assetId);
+
+        // path lookups ignore case and slash direction, like the registry
+        EXPECT_EQ(assetIds[5], snapshot.GetAssetIdByPath("folder\\ASSET5.txt"));
+        EXPECT_EQ(registry.GetAssetIdByPath("folder\\ASSET5.txt"), snapshot.GetAssetIdByPath("folder\\ASSET5.txt"));
+
+        EXPECT_EQ(nullptr, snapshot.FindAssetInfo(AssetId(AZ::Uuid::CreateRandom(), 0)));
+        EXPECT_FALSE(snapshot.GetAssetIdByPath("Folder/Missing.txt").IsValid());
+        EXPECT_FALSE(snapshot.GetAssetIdByPath("").IsValid());
+    }
+
+    TEST_F(AssetCatalogAPITest, AssetRegistrySnapshot_Updates_MatchRegistry)
+    {
+        using namespace AZ::Data;
+
+        AzFramework::AssetRegistry registry;
+        AZStd::vector<AssetInfo> assetInfos;
+        for (int i = 0; i < 10; ++i)
+        {
+            AssetInfo assetInfo;
+            assetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), i);
+            assetInfo.m_relativePath = AZStd::string::format("Folder/Asset%d.txt", i);
+            registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+            assetInfos.push_back(assetInfo);
+        }
+        const AzFramework::AssetRegistrySnapshot snapshot(registry);
+        EXPECT_EQ(0, snapshot.GetChangeCount());
+
+        // registering a new asset
+        AssetInfo newAssetInfo;
+        newAssetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), 0);
+        newAssetInfo.m_relativePath = "Folder/NewAsset.txt";
+        registry.RegisterAsset(newAssetInfo.m_assetId, newAssetInfo);
+        const AzFramework::AssetRegistrySnapshot addedSnapshot(snapshot, registry, newAssetInfo.m_assetId, newAssetInfo.m_relativePath.c_str());
+        ASSERT_NE(nullptr, addedSnapshot.FindAssetInfo(newAssetInfo.m_assetId));
+        EXPECT_EQ(newAssetInfo.m_relativePath, addedSnapshot.FindAssetInfo(newAssetInfo.m_assetId)->m_relativePath);
+        EXPECT_EQ(newAssetInfo.m_assetId, addedSnapshot.GetAssetIdByPath("folder/newasset.txt"));
+        EXPECT_EQ(registry.m_assetIdToInfo.size(), addedSnapshot.GetAssetCount());
+        EXPECT_EQ(assetInfos[1].m_assetId, addedSnapshot.GetAssetIdByPath(assetInfos[1].m_relativePath.c_str()));
+
+        // the previous snapshot doesn't change
+        EXPECT_EQ(nullptr, snapshot.FindAssetInfo(newAssetInfo.m_assetId));
+        EXPECT_FALSE(snapshot.GetAssetIdByPath("Folder/NewAsset.txt").IsValid());
+
+        // changing the info of an asset in the tables
+        AssetInfo changedAssetInfo = assetInfos[2];
+        changedAssetInfo.m_sizeBytes = 1234;
+        registry.RegisterAsset(changedAssetInfo.m_assetId, changedAssetInfo);
+        const AzFramework::AssetRegistrySnapshot changedSnapshot(
+            addedSnapshot, registry, changedAssetInfo.m_assetId, changedAssetInfo.m_relativePath.c_str());
+        ASSERT_NE(nullptr, changedSnapshot.FindAssetInfo(changedAssetInfo.m_assetId));
+        EXPECT_EQ(1234, changedSnapshot.FindAssetInfo(changedAssetInfo.m_assetId)->m_sizeBytes);
+        EXPECT_EQ(registry.m_assetIdToInfo.size(), changedSnapshot.GetAssetCount());
+        EXPECT_NE(nullptr, changedSnapshot.FindAssetInfo(newAssetInfo.m_assetId));
+
+        // unregistering an asset in the tables removes its info and its path
+        const AssetInfo& removedAssetInfo = assetInfos[3];
+        registry.UnregisterAsset(removedAssetInfo.m_assetId);
+        const AzFramework::AssetRegistrySnapshot removedSnapshot(
+            changedSnapshot, registry, removedAssetInfo.m_assetId, removedAssetInfo.m_relativePath.c_str());
+        EXPECT_EQ(nullptr, removedSnapshot.FindAssetInfo(removedAssetInfo.m_assetId));
+        EXPECT_FALSE(removedSnapshot.GetAssetIdByPath(removedAssetInfo.m_relativePath.c_str()).IsValid());
+        EXPECT_EQ(registry.m_assetIdToInfo.size(), removedSnapshot.GetAssetCount());
+        EXPECT_NE(nullptr, changedSnapshot.FindAssetInfo(removedAssetInfo.m_assetId));
+
+        // and registering it again brings both back
+        registry.RegisterAsset(removedAssetInfo.m_assetId, removedAssetInfo);
+        const AzFramework::AssetRegistrySnapshot restoredSnapshot(
+            removedSnapshot, registry, removedAssetInfo.m_assetId, removedAssetInfo.m_relativePath.c_str());
+        EXPECT_NE(nullptr, restoredSnapshot.FindAssetInfo(removedAssetInfo.m_assetId));
+        EXPECT_EQ(removedAssetInfo.m_assetId, restoredSnapshot.GetAssetIdByPath(removedAssetInfo.m_relativePath.c_str()));
+        EXPECT_EQ(registry.m_assetIdToInfo.size(), restoredSnapshot.GetAssetCount());
+    }
+
+    TEST_F(AssetCatalogAPITest, AssetRegistrySnapshot_UpdatesOfLargeCatalog_ChangesStayBelowSquareRootBound)
+    {
+        using namespace AZ::Data;
+
+        constexpr int AssetCount = 20000;
+        constexpr int UpdateCount = 2000;
+
+        AzFramework::AssetRegistry registry;
+        AZStd::vector<AssetInfo> assetInfos;
+        assetInfos.reserve(AssetCount + UpdateCount);
+        for (int i = 0; i < AssetCount; ++i)
+        {
+            AssetInfo assetInfo;
+            assetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), i);
+            assetInfo.m_relativePath = AZStd::string::format("Folder/Asset%d.txt", i);
+            registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+            assetInfos.push_back(assetInfo);
+        }
+
+        // applies updates the way the catalog does, building new tables whenever the snapshot asks for it
+        auto snapshot = AZStd::make_shared<const AzFramework::AssetRegistrySnapshot>(registry);
+        size_t rebuildCount = 0;
+        size_t maxChangeCount = 0;
+        for (int update = 0; update < UpdateCount; ++update)
+        {
+            AZStd::string assetPath;
+            AssetId assetId;
+            switch (update % 3)
+            {
+            case 0:
+            {
+                AssetInfo& assetInfo = assetInfos.emplace_back();
+                assetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), 0);
+                assetInfo.m_relativePath = AZStd::string::format("Folder/NewAsset%d.txt", update);
+                registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+                assetId = assetInfo.m_assetId;
+                assetPath = assetInfo.m_relativePath;
+                break;
+            }
+            case 1:
+            {
+                AssetInfo& assetInfo = assetInfos[update];
+                assetInfo.m_sizeBytes = update;
+                registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+                assetId = assetInfo.m_assetId;
+                assetPath = assetInfo.m_relativePath;
+                break;
+            }
+            default:
+                assetId = assetInfos[update].m_assetId;
+                assetPath = assetInfos[update].m_relativePath;
+                registry.UnregisterAsset(assetId);
+                break;
+            }
+
+            if (snapshot->ShouldRebuild())
+            {
+                snapshot = AZStd::make_shared<const AzFramework::AssetRegistrySnapshot>(registry);
+                ++rebuildCount;
+            }
+            else
+            {
+                snapshot = AZStd::make_shared<const AzFramework::AssetRegistrySnapshot>(*snapshot, registry, assetId, assetPath.c_str());
+            }
+            if (snapshot->GetChangeCount() > maxChangeCount)
+            {
+                maxChangeCount = snapshot->GetChangeCount();
+            }
+        }
+
+        // every update copies the changes, so they're bounded by about sqrt(2N) instead of growing with the asset count
+        EXPECT_GT(rebuildCount, 0);
+        EXPECT_LE(maxChangeCount * maxChangeCount, 2 * (AssetCount + UpdateCount) + 4 * maxChangeCount);
+        EXPECT_LT(maxChangeCount, AssetCount / 16);
+
+        EXPECT_EQ(registry.m_assetIdToInfo.size(), snapshot->GetAssetCount());
+        for (int update = 0; update < UpdateCount; ++update)
+        {
+            const AssetInfo& assetInfo = (update % 3 == 0) ? assetInfos[AssetCount + update / 3] : assetInfos[update];
+            const AssetInfo* snapshotInfo = snapshot->FindAssetInfo(assetInfo.m_assetId);
+            if (update % 3 == 2)
+            {
+                EXPECT_EQ(nullptr, snapshotInfo);
+                EXPECT_FALSE(snapshot->GetAssetIdByPath(assetInfo.m_relativePath.c_str()).IsValid());
+            }
+            else
+            {
+                ASSERT_NE(nullptr, snapshotInfo);
+                EXPECT_EQ(assetInfo.m_sizeBytes, snapshotInfo->m_sizeBytes);
+                EXPECT_EQ(assetInfo.m_assetId, snapshot->GetAssetIdByPath(assetInfo.m_relativePath.c_str()));
+            }
+        }
+    }
+
     TEST_F(AssetCatalogAPITest, EnumerateAssetsListsCorrectAssets)
     {
         AZStd::vector<AZ::Data::AssetId> foundAssets;
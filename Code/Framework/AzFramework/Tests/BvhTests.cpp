@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Visibility/BvhScene.h>
+#include <cmath>
+#include <random>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    //! Reports whether the task graph is active, parallel enumerations fall back to enumerating on the calling thread if it isn't.
+    class TestTaskGraphActive
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        explicit TestTaskGraphActive(bool active)
+            : m_active(active)
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+
+        ~TestTaskGraphActive()
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return m_active;
+        }
+
+    private:
+        bool m_active;
+    };
+
+    class BvhTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+            m_bvhScene = aznew BvhScene(AZ::Name("BvhUnitTestScene"));
+        }
+
+        void TearDown() override
+        {
+            delete m_bvhScene;
+            m_bvhScene = nullptr;
+
+            AZ::NameDictionary::Destroy();
+        }
+
+        void FillRandomEntries(AZStd::vector<VisibilityEntry>& entries, std::mt19937_64& rng)
+        {
+            std::uniform_real_distribution<float> unif;
+            for (VisibilityEntry& entry : entries)
+            {
+                const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 1000.0f;
+                const AZ::Vector3 aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 10.0f + aabbMin;
+                entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMax);
+            }
+        }
+
+        //! Every entry overlapping the query must be enumerated exactly once.
+        template <typename T>
+        void ValidateQuery(const T& query, const AZStd::vector<VisibilityEntry>& entries)
+        {
+            AZStd::unordered_map<const VisibilityEntry*, uint32_t> enumerated;
+            m_bvhScene->Enumerate(query, [&enumerated](const IVisibilityScene::NodeData& nodeData)
+            {
+                EXPECT_FALSE(nodeData.m_entries.empty());
+                for (const VisibilityEntry* entry : nodeData.m_entries)
+                {
+                    ++enumerated[entry];
+                }
+            });
+
+            for (const VisibilityEntry& entry : entries)
+            {
+                if (AZ::ShapeIntersection::Overlaps(query, entry.m_boundingVolume))
+                {
+                    EXPECT_EQ(1, enumerated[&entry]);
+                }
+            }
+            for (const auto& [entry, count] : enumerated)
+            {
+                EXPECT_EQ(1, count);
+            }
+        }
+
+        //! Both multi-frustum enumerations must report each node once with the mask of the single frustum enumerations that report it.
+        void ValidateEnumerateFrusta(AZStd::span<const AZ::Frustum> frusta)
+        {
+            // Nodes are identified by the address of their entry vector
+            using NodeMasks = AZStd::unordered_map<const void*, IVisibilityScene::FrustumMask>;
+
+            NodeMasks expectedMasks;
+            for (size_t i = 0; i < frusta.size(); ++i)
+            {
+                m_bvhScene->Enumerate(frusta[i], [&expectedMasks, i](const IVisibilityScene::NodeData& nodeData)
+                {
+                    expectedMasks[&nodeData.m_entries] |= IVisibilityScene::FrustumMask(1) << i;
+                });
+            }
+
+            auto expectMasksMatch = [&expectedMasks](const NodeMasks& masks)
+            {
+                EXPECT_EQ(expectedMasks.size(), masks.size());
+                for (const auto& [node, mask] : expectedMasks)
+                {
+                    auto it = masks.find(node);
+                    ASSERT_TRUE(it != masks.end());
+                    EXPECT_EQ(mask, it->second);
+                }
+            };
+
+            NodeMasks masks;
+            m_bvhScene->EnumerateFrusta(frusta,
+                [&masks](const IVisibilityScene::NodeData& nodeData, IVisibilityScene::FrustumMask mask)
+            {
+                EXPECT_TRUE(masks.emplace(&nodeData.m_entries, mask).second);
+            });
+            expectMasksMatch(masks);
+
+            // Without an active task graph the parallel enumeration runs on the calling thread
+            for (const bool taskGraphActive : { true, false })
+            {
+                TestTaskGraphActive taskGraphActiveInterface(taskGraphActive);
+                NodeMasks parallelMasks;
+                AZStd::mutex parallelMasksMutex;
+                m_bvhScene->EnumerateFrustaParallel(frusta,
+                    [&parallelMasks, &parallelMasksMutex](const IVisibilityScene::NodeData& nodeData, IVisibilityScene::FrustumMask mask)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(parallelMasksMutex);
+                    EXPECT_TRUE(parallelMasks.emplace(&nodeData.m_entries, mask).second);
+                });
+                expectMasksMatch(parallelMasks);
+            }
+        }
+
+        BvhScene* m_bvhScene = nullptr;
+    };
+
+    static void ValidateEntryCountEqualsExpectedCount(const IVisibilityScene* visScene, uint32_t expectedEntryCount)
+    {
+        size_t manualEntryCount = 0;
+        visScene->EnumerateNoCull([&manualEntryCount](const IVisibilityScene::NodeData& nodeData)
+        {
+            manualEntryCount += nodeData.m_entries.size();
+        });
+
+        EXPECT_EQ(manualEntryCount, expectedEntryCount);
+        EXPECT_EQ(visScene->GetEntryCount(), expectedEntryCount);
+    }
+
+    TEST_F(BvhTests, InsertDeleteSingleEntry)
+    {
+        VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+
+        m_bvhScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode != nullptr);
+        EXPECT_EQ(0, visEntry.m_internalNodeIndex);
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, 1);
+        EXPECT_EQ(1, m_bvhScene->GetNodeCount());
+
+        m_bvhScene->RemoveEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, 0);
+        EXPECT_EQ(0, m_bvhScene->GetNodeCount());
+    }
+
+    TEST_F(BvhTests, UpdateWithinLooseBounds_EntryStaysInLeaf)
+    {
+        VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+        m_bvhScene->InsertOrUpdateEntry(visEntry);
+        VisibilityNode* leaf = visEntry.m_internalNode;
+
+        // A movement smaller than the leaf margin doesn't touch the tree
+        visEntry.m_boundingVolume.Translate(AZ::Vector3(0.1f));
+        m_bvhScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_EQ(leaf, visEntry.m_internalNode);
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, 1);
+
+        // A large movement reinserts the entry, and the enumerated bounds follow it
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(100.0f), AZ::Vector3(101.0f));
+        m_bvhScene->InsertOrUpdateEntry(visEntry);
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, 1);
+        m_bvhScene->EnumerateNoCull([&visEntry](const IVisibilityScene::NodeData& nodeData)
+        {
+            EXPECT_TRUE(nodeData.m_bounds.Contains(visEntry.m_boundingVolume));
+        });
+
+        m_bvhScene->RemoveEntry(visEntry);
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, 0);
+    }
+
+    TEST_F(BvhTests, RandomInsertUpdateRemove_QueriesMatchBruteForce)
+    {
+        constexpr uint32_t EntryCount = 2000;
+        std::mt19937_64 rng(1);
+        std::uniform_real_distribution<float> unif;
+
+        AZStd::vector<VisibilityEntry> entries(EntryCount);
+        FillRandomEntries(entries, rng);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, EntryCount);
+        EXPECT_GT(m_bvhScene->GetLeafCount(), 1);
+        // The tree must stay balanced, an unbalanced tree would be close to one level per leaf
+        EXPECT_LT(m_bvhScene->GetHeight(), 4 * static_cast<uint32_t>(std::log2(m_bvhScene->GetLeafCount()) + 1));
+
+        // Move every entry, some by small amounts that stay within their leaf and some across the world
+        for (uint32_t i = 0; i < EntryCount; ++i)
+        {
+            const AZ::Vector3 offset = (i % 2) ? AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 0.25f
+                                               : AZ::Vector3(unif(rng) - 0.5f, unif(rng) - 0.5f, unif(rng) - 0.5f) * 500.0f;
+            entries[i].m_boundingVolume.Translate(offset);
+            m_bvhScene->InsertOrUpdateEntry(entries[i]);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, EntryCount);
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            const AZ::Vector3 center = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 1000.0f;
+            ValidateQuery(AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(unif(rng) * 200.0f)), entries);
+            ValidateQuery(AZ::Sphere(center, unif(rng) * 200.0f), entries);
+
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(
+                AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetNormalized(), unif(rng) * AZ::Constants::TwoPi);
+            const AZ::Frustum frustum(AZ::ViewFrustumAttributes(
+                AZ::Transform::CreateFromQuaternionAndTranslation(rotation, center), 1.0f, 2.0f * atanf(0.5f), 1.0f, 500.0f));
+            ValidateQuery(frustum, entries);
+        }
+
+        for (uint32_t i = 0; i < EntryCount; i += 2)
+        {
+            m_bvhScene->RemoveEntry(entries[i]);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, EntryCount / 2);
+
+        for (uint32_t i = 1; i < EntryCount; i += 2)
+        {
+            m_bvhScene->RemoveEntry(entries[i]);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_bvhScene, 0);
+        EXPECT_EQ(0, m_bvhScene->GetNodeCount());
+    }
+
+    TEST_F(BvhTests, EnumerateExcludeFrustum_EntriesInsideExcludeAreSkipped)
+    {
+        constexpr uint32_t EntryCount = 500;
+        std::mt19937_64 rng(2);
+        AZStd::vector<VisibilityEntry> entries(EntryCount);
+        FillRandomEntries(entries, rng);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->InsertOrUpdateEntry(entry);
+        }
+
+        const AZ::Transform cameraTransform = AZ::Transform::CreateTranslation(AZ::Vector3(500.0f, -100.0f, 500.0f));
+        const AZ::Frustum includeFrustum(AZ::ViewFrustumAttributes(cameraTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 2000.0f));
+        const AZ::Frustum excludeFrustum(AZ::ViewFrustumAttributes(cameraTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 500.0f));
+
+        AZStd::unordered_map<const VisibilityEntry*, uint32_t> enumerated;
+        m_bvhScene->Enumerate(includeFrustum, excludeFrustum, [&enumerated](const IVisibilityScene::NodeData& nodeData)
+        {
+            for (const VisibilityEntry* entry : nodeData.m_entries)
+            {
+                ++enumerated[entry];
+            }
+        });
+
+        for (const VisibilityEntry& entry : entries)
+        {
+            // Entries are only skipped if their whole node is excluded, so only entries that must be visible can be checked exactly
+            if (AZ::ShapeIntersection::Overlaps(includeFrustum, entry.m_boundingVolume) &&
+                !AZ::ShapeIntersection::Contains(excludeFrustum, entry.m_boundingVolume))
+            {
+                EXPECT_EQ(1, enumerated[&entry]);
+            }
+        }
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(BvhTests, EnumerateFrusta_MatchesEnumeratingEachFrustum)
+    {
+        AZ::TaskExecutor* executor = aznew AZ::TaskExecutor();
+        AZ::TaskExecutor::SetInstance(executor); // SetInstance is a null-op if there is already a default instance set
+
+        constexpr uint32_t EntryCount = 2000;
+        std::mt19937_64 rng(3);
+        std::uniform_real_distribution<float> unif;
+        AZStd::vector<VisibilityEntry> entries(EntryCount);
+        FillRandomEntries(entries, rng);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->InsertOrUpdateEntry(entry);
+        }
+
+        // Frusta around a shared point, similar to shadow cascades and cubemap faces
+        const AZ::Vector3 center(500.0f);
+        AZStd::vector<AZ::Frustum> frusta;
+        for (uint32_t i = 0; i < 12; ++i)
+        {
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateFromEulerRadiansXYZ(AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 6.0f);
+            const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(rotation, center);
+            frusta.emplace_back(AZ::ViewFrustumAttributes(transform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 100.0f + unif(rng) * 400.0f));
+        }
+        ValidateEnumerateFrusta(frusta);
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->RemoveEntry(entry);
+        }
+        ValidateEnumerateFrusta(frusta);
+
+        if (&AZ::TaskExecutor::Instance() == executor) // if this test created the default instance unset it before destroying it
+        {
+            AZ::TaskExecutor::SetInstance(nullptr);
+        }
+        azdestroy(executor);
+    }
+}
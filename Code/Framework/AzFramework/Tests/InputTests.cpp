@@ -6,15 +6,19 @@
  *
  */
 
+#include <AzFramework/Input/Buses/Notifications/InputChannelEventBatchNotificationBus.h>
 #include <AzFramework/Input/Contexts/InputContext.h>
 #include <AzFramework/Input/Mappings/InputMapping.h>
 #include <AzFramework/Input/Mappings/InputMappingAnd.h>
 #include <AzFramework/Input/Mappings/InputMappingOr.h>
 #include <AzFramework/Input/Devices/Gamepad/InputDeviceGamepad.h>
 #include <AzFramework/Input/Devices/Keyboard/InputDeviceKeyboard.h>
+#include <AzFramework/Input/Events/InputChannelEventBatchListener.h>
+#include <AzFramework/Input/Events/InputChannelEventBuffer.h>
 #include <AzFramework/Input/System/InputSystemComponent.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -445,6 +449,182 @@ namespace InputUnitTests
         EXPECT_EQ(inputMapping->GetDelta(), 1.0f);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    class InputChannelEventBatchRecorder : public InputChannelEventBatchNotificationBus::Handler
+    {
+    public:
+        InputChannelEventBatchRecorder() { InputChannelEventBatchNotificationBus::Handler::BusConnect(); }
+        ~InputChannelEventBatchRecorder() override { InputChannelEventBatchNotificationBus::Handler::BusDisconnect(); }
+
+        void OnInputChannelEventBatch(AZStd::span<const BufferedInputChannelEvent> inputChannelEvents) override
+        {
+            ++m_batchCount;
+            m_events.insert(m_events.end(), inputChannelEvents.begin(), inputChannelEvents.end());
+        }
+
+        int m_batchCount = 0;
+        AZStd::vector<BufferedInputChannelEvent> m_events;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    TEST_F(InputTest, InputChannelEventBatch_SimulatedInput_DispatchedOncePerTick)
+    {
+        if (!m_gamepadSupported)
+        {
+        #if defined(GTEST_SKIP)
+            GTEST_SKIP() << "Skipping test InputChannelEventBatch_SimulatedInput_DispatchedOncePerTick";
+        #else
+            SUCCEED() << "Skipping test InputChannelEventBatch_SimulatedInput_DispatchedOncePerTick";
+        #endif
+            return;
+        }
+
+        // Create an input context that consumes the gamepad button it is mapped to.
+        InputContext::InitData initData;
+        initData.autoActivate = true;
+        initData.consumesProcessedInput = true;
+        InputContext inputContext("TestInputContext", initData);
+        AZStd::shared_ptr<InputMappingOr> inputMapping = AZStd::make_shared<InputMappingOr>(InputChannelId("TestInputMapping"), inputContext);
+        EXPECT_TRUE(inputMapping->AddSourceInput(InputDeviceGamepad::Button::A));
+        EXPECT_TRUE(inputContext.AddInputMapping(inputMapping));
+
+        // Simulate two button presses, then validate that nothing is dispatched until the input system ticks.
+        InputChannelEventBatchRecorder batchListener;
+        AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::A,
+                                                   &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                   1.0f);
+        AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::B,
+                                                   &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                   1.0f);
+        EXPECT_EQ(batchListener.m_batchCount, 0);
+
+        // Tick the input system, then validate both events were dispatched in order in a single batch.
+        AzFramework::InputSystemRequestBus::Broadcast(&InputSystemRequests::TickInput);
+        EXPECT_EQ(batchListener.m_batchCount, 1);
+        auto findEvent = [&batchListener](const InputChannelId& channelId)
+        {
+            return AZStd::find_if(batchListener.m_events.begin(), batchListener.m_events.end(),
+                [&channelId](const BufferedInputChannelEvent& event) { return event.m_snapshot.m_channelId == channelId; });
+        };
+        const auto eventA = findEvent(InputDeviceGamepad::Button::A);
+        const auto eventB = findEvent(InputDeviceGamepad::Button::B);
+        ASSERT_NE(eventA, batchListener.m_events.end());
+        ASSERT_NE(eventB, batchListener.m_events.end());
+        EXPECT_LT(eventA, eventB);
+        EXPECT_EQ(eventA->m_snapshot.m_state, InputChannel::State::Began);
+        EXPECT_TRUE(eventA->m_hasBeenConsumed);
+        EXPECT_EQ(eventB->m_snapshot.m_state, InputChannel::State::Began);
+        EXPECT_FALSE(eventB->m_hasBeenConsumed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    class TestInputChannelEventBatchListener : public InputChannelEventBatchListener
+    {
+    public:
+        explicit TestInputChannelEventBatchListener(AZStd::shared_ptr<InputChannelEventFilter> filter)
+            : InputChannelEventBatchListener(filter, 0, true)
+        {
+        }
+
+        void OnInputChannelEventFiltered(const BufferedInputChannelEvent& inputChannelEvent) override
+        {
+            m_channelIds.push_back(inputChannelEvent.m_snapshot.m_channelId);
+        }
+
+        AZStd::vector<InputChannelId> m_channelIds;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    TEST_F(InputTest, InputChannelEventBatchListener_SimulatedInput_SkipsConsumedAndFilteredEvents)
+    {
+        if (!m_gamepadSupported)
+        {
+        #if defined(GTEST_SKIP)
+            GTEST_SKIP() << "Skipping test InputChannelEventBatchListener_SimulatedInput_SkipsConsumedAndFilteredEvents";
+        #else
+            SUCCEED() << "Skipping test InputChannelEventBatchListener_SimulatedInput_SkipsConsumedAndFilteredEvents";
+        #endif
+            return;
+        }
+
+        // Create an input context that consumes the gamepad button it is mapped to.
+        InputContext::InitData initData;
+        initData.autoActivate = true;
+        initData.consumesProcessedInput = true;
+        InputContext inputContext("TestInputContext", initData);
+        AZStd::shared_ptr<InputMappingOr> inputMapping = AZStd::make_shared<InputMappingOr>(InputChannelId("TestInputMapping"), inputContext);
+        EXPECT_TRUE(inputMapping->AddSourceInput(InputDeviceGamepad::Button::A));
+        EXPECT_TRUE(inputContext.AddInputMapping(inputMapping));
+
+        // Create a batch listener that excludes one of the gamepad buttons.
+        AZStd::shared_ptr<InputChannelEventFilterExclusionList> filter = AZStd::make_shared<InputChannelEventFilterExclusionList>();
+        filter->ExcludeChannelName(InputDeviceGamepad::Button::X.GetNameCrc32());
+        TestInputChannelEventBatchListener batchListener(filter);
+
+        // Simulate three button presses and tick the input system, then validate the listener was
+        // notified only of the event that was neither consumed by the input context nor filtered.
+        AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::A,
+                                                   &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                   1.0f);
+        AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::B,
+                                                   &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                   1.0f);
+        AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::X,
+                                                   &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                   1.0f);
+        AzFramework::InputSystemRequestBus::Broadcast(&InputSystemRequests::TickInput);
+        auto wasNotified = [&batchListener](const InputChannelId& channelId)
+        {
+            return AZStd::find(batchListener.m_channelIds.begin(), batchListener.m_channelIds.end(), channelId) != batchListener.m_channelIds.end();
+        };
+        EXPECT_FALSE(wasNotified(InputDeviceGamepad::Button::A));
+        EXPECT_TRUE(wasNotified(InputDeviceGamepad::Button::B));
+        EXPECT_FALSE(wasNotified(InputDeviceGamepad::Button::X));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    TEST_F(InputTest, InputChannelEventBuffer_ScopedEventTimestamp_TimestampsRecordedEvents)
+    {
+        if (!m_gamepadSupported)
+        {
+        #if defined(GTEST_SKIP)
+            GTEST_SKIP() << "Skipping test InputChannelEventBuffer_ScopedEventTimestamp_TimestampsRecordedEvents";
+        #else
+            SUCCEED() << "Skipping test InputChannelEventBuffer_ScopedEventTimestamp_TimestampsRecordedEvents";
+        #endif
+            return;
+        }
+
+        // Simulate one button press while a device timestamp is in scope, and one without it.
+        InputChannelEventBatchRecorder batchListener;
+        const AZStd::chrono::steady_clock::time_point deviceTimestamp = AZStd::chrono::steady_clock::now() - AZStd::chrono::seconds(1);
+        {
+            InputChannelEventBuffer::ScopedEventTimestamp scopedEventTimestamp(deviceTimestamp);
+            AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::A,
+                                                       &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                       1.0f);
+        }
+        const AZStd::chrono::steady_clock::time_point broadcastTimestamp = AZStd::chrono::steady_clock::now();
+        AzFramework::InputChannelRequestBus::Event(InputDeviceGamepad::Button::B,
+                                                   &AzFramework::InputChannelRequests::SimulateRawInput,
+                                                   1.0f);
+
+        // Tick the input system, then validate the first event kept the device timestamp and the
+        // second event was timestamped when it was broadcast.
+        AzFramework::InputSystemRequestBus::Broadcast(&InputSystemRequests::TickInput);
+        auto findEvent = [&batchListener](const InputChannelId& channelId)
+        {
+            return AZStd::find_if(batchListener.m_events.begin(), batchListener.m_events.end(),
+                [&channelId](const BufferedInputChannelEvent& event) { return event.m_snapshot.m_channelId == channelId; });
+        };
+        const auto eventA = findEvent(InputDeviceGamepad::Button::A);
+        const auto eventB = findEvent(InputDeviceGamepad::Button::B);
+        ASSERT_NE(eventA, batchListener.m_events.end());
+        ASSERT_NE(eventB, batchListener.m_events.end());
+        EXPECT_EQ(eventA->m_timestamp, deviceTimestamp);
+        EXPECT_GE(eventB->m_timestamp, broadcastTimestamp);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     TEST_F(InputTest, InputMappingOr_AddRemoveSourceInput_Successful)
     {
@@ -12,6 +12,10 @@
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -467,4 +471,118 @@ namespace UnitTest
         }
 
     }
+
+    //! Reports whether the task graph is active, parallel enumerations fall back to enumerating on the calling thread if it isn't.
+    class TestTaskGraphActive
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        explicit TestTaskGraphActive(bool active)
+            : m_active(active)
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+
+        ~TestTaskGraphActive()
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return m_active;
+        }
+
+    private:
+        bool m_active;
+    };
+
+    // Validates the multi-frustum enumerations against enumerating each frustum separately, nodes are identified by their entry vector
+    void ValidateEnumerateFrusta(const IVisibilityScene* visScene, AZStd::span<const AZ::Frustum> frusta)
+    {
+        using NodeMasks = AZStd::unordered_map<const void*, IVisibilityScene::FrustumMask>;
+        NodeMasks expectedMasks;
+        for (size_t i = 0; i < frusta.size(); ++i)
+        {
+            visScene->Enumerate(frusta[i], [&expectedMasks, i](const IVisibilityScene::NodeData& nodeData)
+            {
+                expectedMasks[&nodeData.m_entries] |= IVisibilityScene::FrustumMask(1) << i;
+            });
+        }
+
+        auto expectMasksMatch = [&expectedMasks](const NodeMasks& masks)
+        {
+            EXPECT_EQ(expectedMasks.size(), masks.size());
+            for (const auto& [node, mask] : expectedMasks)
+            {
+                auto it = masks.find(node);
+                ASSERT_TRUE(it != masks.end());
+                EXPECT_EQ(mask, it->second);
+            }
+        };
+
+        NodeMasks masks;
+        visScene->EnumerateFrusta(frusta, [&masks](const IVisibilityScene::NodeData& nodeData, IVisibilityScene::FrustumMask mask)
+        {
+            EXPECT_TRUE(masks.emplace(&nodeData.m_entries, mask).second);
+        });
+        expectMasksMatch(masks);
+
+        // Without an active task graph the parallel enumeration runs on the calling thread
+        for (const bool taskGraphActive : { true, false })
+        {
+            TestTaskGraphActive taskGraphActiveInterface(taskGraphActive);
+            NodeMasks parallelMasks;
+            AZStd::mutex parallelMasksMutex;
+            visScene->EnumerateFrustaParallel(frusta,
+                [&parallelMasks, &parallelMasksMutex](const IVisibilityScene::NodeData& nodeData, IVisibilityScene::FrustumMask mask)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(parallelMasksMutex);
+                EXPECT_TRUE(parallelMasks.emplace(&nodeData.m_entries, mask).second);
+            });
+            expectMasksMatch(parallelMasks);
+        }
+    }
+
+    TEST_F(OctreeTests, EnumerateFrusta_MatchesEnumeratingEachFrustum)
+    {
+        AZ::TaskExecutor* executor = aznew AZ::TaskExecutor();
+        AZ::TaskExecutor::SetInstance(executor); // SetInstance is a null-op if there is already a default instance set
+
+        std::mt19937_64 rng(1);
+        std::uniform_real_distribution<float> unif(-0.9f, 0.9f);
+        AZStd::vector<VisibilityEntry> visEntries(200);
+        for (VisibilityEntry& visEntry : visEntries)
+        {
+            const AZ::Vector3 center(unif(rng), unif(rng), unif(rng));
+            visEntry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(0.05f));
+            m_octreeScene->InsertOrUpdateEntry(visEntry);
+        }
+
+        AZStd::vector<AZ::Frustum> frusta;
+        for (uint32_t i = 0; i < 12; ++i)
+        {
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateFromEulerRadiansXYZ(AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 4.0f);
+            const AZ::Vector3 position(unif(rng), unif(rng), unif(rng));
+            const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position);
+            frusta.emplace_back(AZ::ViewFrustumAttributes(transform, 1.0f, 2.0f * atanf(0.5f), 0.1f, 1.5f));
+        }
+        ValidateEnumerateFrusta(m_octreeScene, frusta);
+
+        // A frustum that contains the whole world
+        const AZ::Transform worldViewTransform = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, -5.0f, 0.0f));
+        frusta.emplace_back(AZ::ViewFrustumAttributes(worldViewTransform, 1.0f, 2.0f * atanf(1.0f), 1.0f, 10.0f));
+        ValidateEnumerateFrusta(m_octreeScene, frusta);
+
+        for (VisibilityEntry& visEntry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(visEntry);
+        }
+
+        if (&AZ::TaskExecutor::Instance() == executor) // if this test created the default instance unset it before destroying it
+        {
+            AZ::TaskExecutor::SetInstance(nullptr);
+        }
+        azdestroy(executor);
+    }
 }
@@ -6,11 +6,19 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesPool.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzTest/AzTest.h>
 
@@ -55,6 +63,163 @@ namespace UnitTest
         AZ::EntityId m_entityReference;
     };
 
+    // Test component that stores entity references both inline and in a container, which the clone plan has to remap differently.
+    class ComponentWithEntityReferenceList : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithEntityReferenceList, "{2F6E1B8C-5D4A-4E93-A0C7-8B3D9F1E6A24}");
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithEntityReferenceList, AZ::Component>()
+                    ->Field("EntityReference", &ComponentWithEntityReferenceList::m_entityReference)
+                    ->Field("EntityReferences", &ComponentWithEntityReferenceList::m_entityReferences)
+                    ;
+            }
+        }
+
+        AZ::EntityId m_entityReference;
+        AZStd::vector<AZ::EntityId> m_entityReferences;
+    };
+
+    // Base class without RTTI that's placed before AZ::Component, so the component's address differs from its AZ::Component address.
+    class NonComponentBase
+    {
+    public:
+        virtual ~NonComponentBase() = default;
+
+        int m_unreflectedValue = 0;
+    };
+
+    class ComponentWithNonComponentBase
+        : public NonComponentBase
+        , public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithNonComponentBase, "{8D0F4C6B-3A1E-4F27-9B52-6E7C1D4A8F30}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithNonComponentBase, AZ::Component>()
+                    ->Field("Value", &ComponentWithNonComponentBase::m_value)
+                    ->Field("Values", &ComponentWithNonComponentBase::m_values);
+            }
+        }
+
+        int m_value = 0;
+        AZStd::vector<int> m_values;
+    };
+
+    // Test component with an id that gets a newly generated id for every clone, the same way the id of an entity does.
+    class ComponentWithGeneratedId : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithGeneratedId, "{5B7E2D19-C84A-4F63-9E1D-3A6F0B8C2E47}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithGeneratedId, AZ::Component>()
+                    ->Field("GeneratedId", &ComponentWithGeneratedId::m_generatedId)
+                        ->Attribute(AZ::Edit::Attributes::IdGeneratorFunction, &AZ::Entity::MakeId)
+                    ->Field("GeneratedIdReference", &ComponentWithGeneratedId::m_generatedIdReference);
+            }
+        }
+
+        AZ::EntityId m_generatedId;
+        AZ::EntityId m_generatedIdReference;
+    };
+
+    // Test component that counts how many instances were constructed on threads other than the one running the test, which only
+    // happens if the entities are cloned on the task graph.
+    class ComponentCountingWorkerThreadClones : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentCountingWorkerThreadClones, "{9A3C6E41-7D2B-4B58-A1F0-E2964C7D3B85}");
+
+        ComponentCountingWorkerThreadClones()
+        {
+            if (AZStd::this_thread::get_id() != s_testThreadId)
+            {
+                ++s_workerThreadCloneCount;
+            }
+        }
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentCountingWorkerThreadClones, AZ::Component>();
+            }
+        }
+
+        static inline AZStd::thread::id s_testThreadId;
+        static inline AZStd::atomic<size_t> s_workerThreadCloneCount{ 0 };
+    };
+
+    // Activates the task graph and lowers the number of entities needed to clone in parallel for as long as it exists.
+    class ParallelCloneScope : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        ParallelCloneScope()
+        {
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor); // SetInstance is a null-op if there is already a default instance set
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("spawnable_parallelCloneThreshold", { "2" });
+
+            ComponentCountingWorkerThreadClones::s_testThreadId = AZStd::this_thread::get_id();
+            ComponentCountingWorkerThreadClones::s_workerThreadCloneCount = 0;
+        }
+
+        ~ParallelCloneScope()
+        {
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("spawnable_parallelCloneThreshold", { "128" });
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            if (&AZ::TaskExecutor::Instance() == m_executor) // if this scope created the default instance unset it before destroying it
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_executor);
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+        //! Cloning is only spread over the task graph if there's more than one thread to spread it over.
+        static bool CanCloneInParallel()
+        {
+            return AZStd::thread::hardware_concurrency() > 1;
+        }
+
+    private:
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
     class SourceSpawnableComponent : public AZ::Component
     {
     public:
@@ -113,6 +278,10 @@ namespace UnitTest
             startupParameters.m_loadSettingsRegistry = false;
             m_application->Start(descriptor, startupParameters);
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithEntityReferenceList::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithNonComponentBase::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithGeneratedId::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentCountingWorkerThreadClones::CreateDescriptor());
             m_application->RegisterComponentDescriptor(SourceSpawnableComponent::CreateDescriptor());
             m_application->RegisterComponentDescriptor(TargetSpawnableComponent::CreateDescriptor());
 
@@ -581,6 +750,54 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ReferencesInlineAndInContainers_EntityIdsAreMappedCorrectly)
+    {
+        // Inline references are patched directly by the clone plan while references inside containers fall back to reflection,
+        // both have to end up pointing to the entities in the same batch.
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            auto component = prototypes[i]->CreateComponent<ComponentWithEntityReferenceList>();
+            component->m_entityReference = prototypes[(i + 1) % NumEntities]->GetId();
+            for (size_t j = 0; j < NumEntities; ++j)
+            {
+                component->m_entityReferences.push_back(prototypes[j]->GetId());
+            }
+        }
+
+        size_t spawnCount = 0;
+        auto callback =
+            [&spawnCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(NumEntities, entities.size());
+            for (size_t i = 0; i < NumEntities; ++i)
+            {
+                const AZ::Entity* entity = *(entities.begin() + i);
+                auto component = entity->FindComponent<ComponentWithEntityReferenceList>();
+                ASSERT_NE(nullptr, component);
+                EXPECT_EQ((*(entities.begin() + (i + 1) % NumEntities))->GetId(), component->m_entityReference);
+                ASSERT_EQ(NumEntities, component->m_entityReferences.size());
+                for (size_t j = 0; j < NumEntities; ++j)
+                {
+                    EXPECT_EQ((*(entities.begin() + j))->GetId(), component->m_entityReferences[j]);
+                }
+            }
+            ++spawnCount;
+        };
+
+        // Spawn twice so the second batch is cloned from an already built plan.
+        for (size_t i = 0; i < 2; ++i)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            ProcessQueueTillEmtpy();
+        }
+        EXPECT_EQ(2, spawnCount);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllEntitiesReferenceOtherEntities_EntityIdsOnlyReferWithinASingleCall)
     {
         // This tests that entity id references get mapped correctly with multiple SpawnAllEntities calls.  Each call should only map
@@ -622,6 +839,149 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ActivationBudgetExceeded_EntitiesAddedAcrossUpdates)
+    {
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+        // A budget of a single microsecond makes sure adding the entities has to be spread over multiple updates.
+        console->PerformCommand("spawnable_activationBudgetUs", { "1" });
+
+        static constexpr size_t NumEntities = 64;
+        FillSpawnable(NumEntities);
+
+        size_t lastAddedCount = 0;
+        size_t progressCallCount = 0;
+        auto progressCallback =
+            [&lastAddedCount, &progressCallCount](AzFramework::EntitySpawnTicket::Id, size_t addedCount, size_t totalCount)
+        {
+            EXPECT_EQ(NumEntities, totalCount);
+            EXPECT_GT(addedCount, lastAddedCount);
+            EXPECT_LT(addedCount, totalCount);
+            lastAddedCount = addedCount;
+            ++progressCallCount;
+        };
+
+        size_t completionCallCount = 0;
+        size_t spawnedEntitiesCount = 0;
+        auto completionCallback = [&completionCallCount, &spawnedEntitiesCount](
+                                      AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+            ++completionCallCount;
+        };
+
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_progressCallback = AZStd::move(progressCallback);
+        optionalArgs.m_completionCallback = AZStd::move(completionCallback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        console->PerformCommand("spawnable_activationBudgetUs", { "0" });
+
+        EXPECT_EQ(1, completionCallCount);
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        EXPECT_LT(0, progressCallCount);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ClonedInParallel_EntityIdsAreMappedCorrectly)
+    {
+        ParallelCloneScope parallelCloneScope;
+
+        // Enough entities for every batch to reference entities cloned by other batches, inline and in containers.
+        constexpr size_t NumEntities = 256;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+        AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            prototypes[i]->CreateComponent<ComponentCountingWorkerThreadClones>();
+            auto component = prototypes[i]->CreateComponent<ComponentWithEntityReferenceList>();
+            component->m_entityReference = prototypes[(i + NumEntities - 1) % NumEntities]->GetId();
+            component->m_entityReferences.push_back(prototypes[0]->GetId());
+            component->m_entityReferences.push_back(prototypes[NumEntities - 1]->GetId());
+        }
+
+        size_t spawnCount = 0;
+        auto callback = [this, &spawnCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(NumEntities, entities.size());
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+            for (size_t i = 0; i < NumEntities; ++i)
+            {
+                const AZ::Entity* entity = *(entities.begin() + i);
+                auto component = entity->FindComponent<ComponentWithEntityReferenceList>();
+                ASSERT_NE(nullptr, component);
+                EXPECT_EQ((*(entities.begin() + (i + NumEntities - 1) % NumEntities))->GetId(), component->m_entityReference);
+                ASSERT_EQ(2, component->m_entityReferences.size());
+                EXPECT_EQ((*entities.begin())->GetId(), component->m_entityReferences[0]);
+                EXPECT_EQ((*(entities.begin() + NumEntities - 1))->GetId(), component->m_entityReferences[1]);
+            }
+            ++spawnCount;
+        };
+
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(1, spawnCount);
+        if (ParallelCloneScope::CanCloneInParallel())
+        {
+            EXPECT_EQ(NumEntities, ComponentCountingWorkerThreadClones::s_workerThreadCloneCount.load());
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ClonedInParallelWithGeneratedIds_ClonedAgainInOrder)
+    {
+        ParallelCloneScope parallelCloneScope;
+
+        // All prototypes share an id that isn't an entity id but gets a newly generated id when cloned. Cloning in order generates it
+        // once and every following clone reuses it, while each parallel batch would generate its own, so the parallel clones have to
+        // be discarded.
+        constexpr size_t NumEntities = 256;
+        const AZ::EntityId sharedPrototypeId(1);
+        FillSpawnable(NumEntities);
+        for (AZStd::unique_ptr<AZ::Entity>& prototype : m_spawnable->GetEntities())
+        {
+            prototype->CreateComponent<ComponentCountingWorkerThreadClones>();
+            auto component = prototype->CreateComponent<ComponentWithGeneratedId>();
+            component->m_generatedId = sharedPrototypeId;
+            component->m_generatedIdReference = sharedPrototypeId;
+        }
+
+        size_t spawnCount = 0;
+        auto callback =
+            [&spawnCount, sharedPrototypeId](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(NumEntities, entities.size());
+            auto firstComponent = (*entities.begin())->FindComponent<ComponentWithGeneratedId>();
+            ASSERT_NE(nullptr, firstComponent);
+            const AZ::EntityId generatedId = firstComponent->m_generatedId;
+            EXPECT_TRUE(generatedId.IsValid());
+            EXPECT_NE(sharedPrototypeId, generatedId);
+            for (const AZ::Entity* entity : entities)
+            {
+                auto component = entity->FindComponent<ComponentWithGeneratedId>();
+                ASSERT_NE(nullptr, component);
+                EXPECT_EQ(generatedId, component->m_generatedId);
+                EXPECT_EQ(generatedId, component->m_generatedIdReference);
+            }
+            ++spawnCount;
+        };
+
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(1, spawnCount);
+        if (ParallelCloneScope::CanCloneInParallel())
+        {
+            // The parallel clones were made and discarded before cloning again on the thread processing the queue.
+            EXPECT_EQ(NumEntities, ComponentCountingWorkerThreadClones::s_workerThreadCloneCount.load());
+        }
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -1543,4 +1903,257 @@ namespace UnitTest
 
         EXPECT_LT(defaultPriorityCallId, highPriorityCallId);
     }
+
+    //
+    // SpawnableEntitiesPool
+    //
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnableEntitiesPool_ReleaseAndAcquire_EntitiesAreReusedAndReset)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            auto component = prototypes[i]->CreateComponent<ComponentWithEntityReferenceList>();
+            component->m_entityReference = prototypes[(i + 1) % NumEntities]->GetId();
+            component->m_entityReferences.push_back(prototypes[i]->GetId());
+        }
+
+        AzFramework::SpawnableEntitiesPool pool(*m_spawnableAsset);
+
+        AZStd::vector<AZ::Entity*> spawnedEntities;
+        AzFramework::SpawnableEntitiesPool::InstanceId instanceId = pool.Acquire(
+            [&spawnedEntities](AzFramework::SpawnableEntitiesPool::InstanceId, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                for (const AZ::Entity* entity : entities)
+                {
+                    spawnedEntities.push_back(const_cast<AZ::Entity*>(entity));
+                }
+            });
+        ProcessQueueTillEmtpy();
+        ASSERT_EQ(NumEntities, spawnedEntities.size());
+        EXPECT_EQ(1, pool.GetActiveInstanceCount());
+
+        // Change the state of the spawned entities so the reset can be verified.
+        for (AZ::Entity* entity : spawnedEntities)
+        {
+            auto component = entity->FindComponent<ComponentWithEntityReferenceList>();
+            ASSERT_NE(nullptr, component);
+            component->m_entityReference.SetInvalid();
+            component->m_entityReferences.push_back(AZ::EntityId(1));
+        }
+
+        pool.Release(instanceId);
+        EXPECT_EQ(0, pool.GetActiveInstanceCount());
+        EXPECT_EQ(1, pool.GetParkedInstanceCount());
+
+        // Parked instances are reused immediately without going through the spawnable entities manager.
+        size_t callbackCount = 0;
+        pool.Acquire(
+            [&spawnedEntities, &callbackCount](
+                AzFramework::SpawnableEntitiesPool::InstanceId, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                ASSERT_EQ(NumEntities, entities.size());
+                for (size_t i = 0; i < NumEntities; ++i)
+                {
+                    const AZ::Entity* entity = *(entities.begin() + i);
+                    EXPECT_EQ(spawnedEntities[i], entity);
+                    auto component = entity->FindComponent<ComponentWithEntityReferenceList>();
+                    ASSERT_NE(nullptr, component);
+                    EXPECT_EQ(spawnedEntities[(i + 1) % NumEntities]->GetId(), component->m_entityReference);
+                    ASSERT_EQ(1, component->m_entityReferences.size());
+                    EXPECT_EQ(entity->GetId(), component->m_entityReferences[0]);
+                }
+                ++callbackCount;
+            });
+        EXPECT_EQ(1, callbackCount);
+        EXPECT_EQ(1, pool.GetActiveInstanceCount());
+        EXPECT_EQ(0, pool.GetParkedInstanceCount());
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnableEntitiesPool_ReleaseBeyondCapacity_InstancesAreDespawned)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+
+        AzFramework::SpawnableEntitiesPool pool(*m_spawnableAsset, 1);
+        AzFramework::SpawnableEntitiesPool::InstanceId first = pool.Acquire();
+        AzFramework::SpawnableEntitiesPool::InstanceId second = pool.Acquire();
+        // An instance that hasn't finished spawning can't be parked.
+        AzFramework::SpawnableEntitiesPool::InstanceId pending = pool.Acquire();
+        pool.Release(pending);
+        ProcessQueueTillEmtpy();
+        EXPECT_EQ(2, pool.GetActiveInstanceCount());
+        EXPECT_EQ(0, pool.GetParkedInstanceCount());
+
+        pool.Release(first);
+        pool.Release(second);
+        EXPECT_EQ(0, pool.GetActiveInstanceCount());
+        EXPECT_EQ(1, pool.GetParkedInstanceCount());
+
+        pool.Trim();
+        EXPECT_EQ(0, pool.GetParkedInstanceCount());
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnableEntitiesPool_ComponentWithNonComponentBase_IsResetAtItsOwnAddress)
+    {
+        static constexpr size_t NumEntities = 2;
+        FillSpawnable(NumEntities);
+        for (AZStd::unique_ptr<AZ::Entity>& prototype : m_spawnable->GetEntities())
+        {
+            auto component = prototype->CreateComponent<ComponentWithNonComponentBase>();
+            component->m_value = 42;
+            component->m_values.push_back(7);
+        }
+
+        AzFramework::SpawnableEntitiesPool pool(*m_spawnableAsset);
+        AZStd::vector<AZ::Entity*> spawnedEntities;
+        AzFramework::SpawnableEntitiesPool::InstanceId instanceId = pool.Acquire(
+            [&spawnedEntities](AzFramework::SpawnableEntitiesPool::InstanceId, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                for (const AZ::Entity* entity : entities)
+                {
+                    spawnedEntities.push_back(const_cast<AZ::Entity*>(entity));
+                }
+            });
+        ProcessQueueTillEmtpy();
+        ASSERT_EQ(NumEntities, spawnedEntities.size());
+
+        for (AZ::Entity* entity : spawnedEntities)
+        {
+            auto component = entity->FindComponent<ComponentWithNonComponentBase>();
+            ASSERT_NE(nullptr, component);
+            component->m_value = 0;
+            component->m_values.push_back(8);
+            component->m_unreflectedValue = 3;
+        }
+
+        pool.Release(instanceId);
+        pool.Acquire();
+
+        for (AZ::Entity* entity : spawnedEntities)
+        {
+            auto component = entity->FindComponent<ComponentWithNonComponentBase>();
+            ASSERT_NE(nullptr, component);
+            EXPECT_EQ(42, component->m_value);
+            ASSERT_EQ(1, component->m_values.size());
+            EXPECT_EQ(7, component->m_values[0]);
+            // Data that isn't reflected is left untouched, which also verifies the reset didn't write over the non-component base.
+            EXPECT_EQ(3, component->m_unreflectedValue);
+        }
+    }
 } // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Compares reusing parked instances from a SpawnableEntitiesPool with despawning and spawning a new instance through a ticket.
+    class BM_SpawnableEntitiesPool : public ::benchmark::Fixture
+    {
+        void internalSetUp(size_t entityCount)
+        {
+            m_application = new UnitTest::TestApplication();
+            AZ::ComponentApplication::Descriptor descriptor;
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application->Start(descriptor, startupParameters);
+            m_application->RegisterComponentDescriptor(UnitTest::ComponentWithEntityReferenceList::CreateDescriptor());
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            m_spawnable = aznew AzFramework::Spawnable(
+                AZ::Data::AssetId::CreateString("{5A3C7E21-9D4B-4B8F-8E16-2F0A6C9D3B75}:0"), AZ::Data::AssetData::AssetStatus::Ready);
+            m_spawnableAsset = new AZ::Data::Asset<AzFramework::Spawnable>(m_spawnable, AZ::Data::AssetLoadBehavior::Default);
+
+            AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+            entities.reserve(entityCount);
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                auto entity = AZStd::make_unique<AZ::Entity>();
+                entity->SetId(AZ::EntityId(UnitTest::SpawnableEntitiesManagerTest::EntityIdStartId + i));
+                entities.push_back(AZStd::move(entity));
+            }
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                auto component = entities[i]->CreateComponent<UnitTest::ComponentWithEntityReferenceList>();
+                component->m_entityReference = entities[(i + 1) % entityCount]->GetId();
+                component->m_entityReferences.push_back(entities[i]->GetId());
+            }
+
+            m_manager = azrtti_cast<AzFramework::SpawnableEntitiesManager*>(AzFramework::SpawnableEntitiesInterface::Get());
+        }
+
+        void internalTearDown()
+        {
+            ProcessQueue();
+            delete m_spawnableAsset;
+            m_spawnableAsset = nullptr;
+            delete m_application;
+            m_application = nullptr;
+        }
+
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(aznumeric_cast<size_t>(state.range(0)));
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void ProcessQueue()
+        {
+            while (m_manager->ProcessQueue(
+                       AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                       AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular) !=
+                   AzFramework::SpawnableEntitiesManager::CommandQueueStatus::NoCommandsLeft)
+                ;
+        }
+
+        UnitTest::TestApplication* m_application{ nullptr };
+        AzFramework::Spawnable* m_spawnable{ nullptr };
+        AZ::Data::Asset<AzFramework::Spawnable>* m_spawnableAsset{ nullptr };
+        AzFramework::SpawnableEntitiesManager* m_manager{ nullptr };
+    };
+
+    BENCHMARK_DEFINE_F(BM_SpawnableEntitiesPool, DespawnAndSpawn)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AzFramework::EntitySpawnTicket ticket(*m_spawnableAsset);
+            AzFramework::SpawnableEntitiesInterface::Get()->SpawnAllEntities(ticket);
+            ProcessQueue();
+            // Destroying the ticket despawns the entities once the queue is processed.
+        }
+        ProcessQueue();
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(BM_SpawnableEntitiesPool, ReleaseAndAcquire)(::benchmark::State& state)
+    {
+        AzFramework::SpawnableEntitiesPool pool(*m_spawnableAsset, 1);
+        AzFramework::SpawnableEntitiesPool::InstanceId instanceId = pool.Acquire();
+        ProcessQueue();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            pool.Release(instanceId);
+            instanceId = pool.Acquire();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(BM_SpawnableEntitiesPool, DespawnAndSpawn)->RangeMultiplier(8)->Range(8, 512)->Unit(::benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_SpawnableEntitiesPool, ReleaseAndAcquire)->RangeMultiplier(8)->Range(8, 512)->Unit(::benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
+#include <random>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    class TransformHierarchyTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static AZ::Transform CreateTransform(float x, float y, float z, float angle)
+        {
+            return AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(angle), AZ::Vector3(x, y, z));
+        }
+    };
+
+    TEST_F(TransformHierarchyTests, UpdateWorldTransforms_ChangedRoot_PropagatesToDescendantsInDepthOrder)
+    {
+        TransformHierarchy hierarchy;
+        const TransformHierarchy::NodeId grandChild = hierarchy.AddNode(CreateTransform(0.0f, 0.0f, 3.0f, 0.0f));
+        const TransformHierarchy::NodeId child = hierarchy.AddNode(CreateTransform(0.0f, 2.0f, 0.0f, 0.5f));
+        const TransformHierarchy::NodeId root = hierarchy.AddNode(CreateTransform(1.0f, 0.0f, 0.0f, 0.0f));
+        const TransformHierarchy::NodeId other = hierarchy.AddNode(AZ::Transform::CreateIdentity());
+        hierarchy.SetParent(grandChild, child);
+        hierarchy.SetParent(child, root);
+
+        AZStd::vector<TransformHierarchy::NodeId> changedNodes;
+        hierarchy.UpdateWorldTransforms(changedNodes);
+        EXPECT_EQ(hierarchy.GetDepthCount(), 3);
+        EXPECT_FALSE(hierarchy.HasPendingChanges());
+
+        hierarchy.SetLocalTM(root, CreateTransform(5.0f, 0.0f, 0.0f, 1.0f));
+        changedNodes.clear();
+        hierarchy.UpdateWorldTransforms(changedNodes);
+
+        ASSERT_EQ(changedNodes.size(), 3);
+        EXPECT_EQ(changedNodes[0], root);
+        EXPECT_EQ(changedNodes[1], child);
+        EXPECT_EQ(changedNodes[2], grandChild);
+
+        const AZ::Transform expected = hierarchy.GetLocalTM(root) * hierarchy.GetLocalTM(child) * hierarchy.GetLocalTM(grandChild);
+        EXPECT_THAT(hierarchy.GetWorldTM(grandChild), IsClose(expected));
+        EXPECT_THAT(hierarchy.GetWorldTM(other), IsClose(AZ::Transform::CreateIdentity()));
+    }
+
+    TEST_F(TransformHierarchyTests, GetWorldTM_PendingChangeOnAncestor_ResolvesBeforeUpdate)
+    {
+        TransformHierarchy hierarchy;
+        const TransformHierarchy::NodeId root = hierarchy.AddNode(AZ::Transform::CreateIdentity());
+        const TransformHierarchy::NodeId child = hierarchy.AddNode(CreateTransform(0.0f, 1.0f, 0.0f, 0.0f));
+        const TransformHierarchy::NodeId grandChild = hierarchy.AddNode(CreateTransform(0.0f, 0.0f, 1.0f, 0.0f));
+        hierarchy.SetParent(child, root);
+        hierarchy.SetParent(grandChild, child);
+        AZStd::vector<TransformHierarchy::NodeId> changedNodes;
+        hierarchy.UpdateWorldTransforms(changedNodes);
+
+        hierarchy.SetLocalTM(child, CreateTransform(0.0f, 4.0f, 0.0f, 0.0f));
+        EXPECT_TRUE(hierarchy.HasPendingChanges());
+        EXPECT_THAT(hierarchy.GetWorldTM(grandChild).GetTranslation(), IsClose(AZ::Vector3(0.0f, 4.0f, 1.0f)));
+
+        // Resolving a single node doesn't consume the change, the update still reports everything that moved.
+        changedNodes.clear();
+        hierarchy.UpdateWorldTransforms(changedNodes);
+        EXPECT_EQ(changedNodes.size(), 2);
+    }
+
+    TEST_F(TransformHierarchyTests, GetWorldTM_MovedRoot_ResolvesGrandChildBeforeUpdate)
+    {
+        TransformHierarchy hierarchy;
+        const TransformHierarchy::NodeId root = hierarchy.AddNode(AZ::Transform::CreateIdentity());
+        const TransformHierarchy::NodeId child = hierarchy.AddNode(CreateTransform(0.0f, 1.0f, 0.0f, 0.0f));
+        const TransformHierarchy::NodeId grandChild = hierarchy.AddNode(CreateTransform(0.0f, 0.0f, 1.0f, 0.0f));
+        hierarchy.SetParent(child, root);
+        hierarchy.SetParent(grandChild, child);
+        AZStd::vector<TransformHierarchy::NodeId> changedNodes;
+        hierarchy.UpdateWorldTransforms(changedNodes);
+
+        // Moving a root sets its world transform directly, its descendants still have to pick up the change.
+        hierarchy.SetLocalTM(root, CreateTransform(3.0f, 0.0f, 0.0f, 0.0f));
+        EXPECT_THAT(hierarchy.GetWorldTM(grandChild).GetTranslation(), IsClose(AZ::Vector3(3.0f, 1.0f, 1.0f)));
+        EXPECT_THAT(hierarchy.GetWorldTM(child).GetTranslation(), IsClose(AZ::Vector3(3.0f, 1.0f, 0.0f)));
+
+        // Moving the root again invalidates what was resolved before.
+        hierarchy.SetWorldTM(root, CreateTransform(-2.0f, 0.0f, 0.0f, 0.0f));
+        EXPECT_THAT(hierarchy.GetWorldTM(grandChild).GetTranslation(), IsClose(AZ::Vector3(-2.0f, 1.0f, 1.0f)));
+
+        changedNodes.clear();
+        hierarchy.UpdateWorldTransforms(changedNodes);
+        EXPECT_EQ(changedNodes.size(), 3);
+        EXPECT_THAT(hierarchy.GetWorldTM(grandChild).GetTranslation(), IsClose(AZ::Vector3(-2.0f, 1.0f, 1.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, GetWorldTM_ResolvedAncestor_ResolvesOtherDescendants)
+    {
+        TransformHierarchy hierarchy;
+        const TransformHierarchy::NodeId root = hierarchy.AddNode(AZ::Transform::CreateIdentity());
+        const TransformHierarchy::NodeId child = hierarchy.AddNode(CreateTransform(0.0f, 1.0f, 0.0f, 0.0f));
+        const TransformHierarchy::NodeId firstGrandChild = hierarchy.AddNode(CreateTransform(1.0f, 0.0f, 0.0f, 0.0f));
+        const TransformHierarchy::NodeId secondGrandChild = hierarchy.AddNode(CreateTransform(-1.0f, 0.0f, 0.0f, 0.0f));
+        hierarchy.SetParent(child, root);
+        hierarchy.SetParent(firstGrandChild, child);
+        hierarchy.SetParent(secondGrandChild, child);
+        AZStd::vector<TransformHierarchy::NodeId> changedNodes;
+        hierarchy.UpdateWorldTransforms(changedNodes);
+
+        hierarchy.SetLocalTM(child, CreateTransform(0.0f, 5.0f, 0.0f, 0.0f));
+        EXPECT_THAT(hierarchy.GetWorldTM(child).GetTranslation(), IsClose(AZ::Vector3(0.0f, 5.0f, 0.0f)));
+
+        // The walk up from the grandchildren stops at the child, which was already resolved for this change.
+        EXPECT_THAT(hierarchy.GetWorldTM(firstGrandChild).GetTranslation(), IsClose(AZ::Vector3(1.0f, 5.0f, 0.0f)));
+        EXPECT_THAT(hierarchy.GetWorldTM(secondGrandChild).GetTranslation(), IsClose(AZ::Vector3(-1.0f, 5.0f, 0.0f)));
+
+        changedNodes.clear();
+        hierarchy.UpdateWorldTransforms(changedNodes);
+        EXPECT_EQ(changedNodes.size(), 3);
+    }
+
+    TEST_F(TransformHierarchyTests, SetWorldTM_ChildNode_DerivesLocalFromParent)
+    {
+        TransformHierarchy hierarchy;
+        const TransformHierarchy::NodeId root = hierarchy.AddNode(CreateTransform(1.0f, 2.0f, 3.0f, 0.25f));
+        const TransformHierarchy::NodeId child = hierarchy.AddNode(AZ::Transform::CreateIdentity());
+        hierarchy.SetParent(child, root);
+
+        const AZ::Transform worldTM = CreateTransform(-4.0f, 0.0f, 2.0f, 1.5f);
+        hierarchy.SetWorldTM(child, worldTM);
+        EXPECT_THAT(hierarchy.GetWorldTM(root) * hierarchy.GetLocalTM(child), IsClose(worldTM));
+
+        AZStd::vector<TransformHierarchy::NodeId> changedNodes;
+        hierarchy.UpdateWorldTransforms(changedNodes);
+        ASSERT_EQ(changedNodes.size(), 1);
+        EXPECT_EQ(changedNodes[0], child);
+        EXPECT_THAT(hierarchy.GetWorldTM(child), IsClose(worldTM));
+    }
+
+    TEST_F(TransformHierarchyTests, RemoveNode_WithChildren_ChildrenBecomeRootsAndKeepWorldTransform)
+    {
+        TransformHierarchy hierarchy;
+        const TransformHierarchy::NodeId root = hierarchy.AddNode(CreateTransform(1.0f, 0.0f, 0.0f, 0.0f));
+        const TransformHierarchy::NodeId child = hierarchy.AddNode(CreateTransform(0.0f, 1.0f, 0.0f, 0.0f));
+        hierarchy.SetParent(child, root);
+        AZStd::vector<TransformHierarchy::NodeId> changedNodes;
+        hierarchy.UpdateWorldTransforms(changedNodes);
+        const AZ::Transform childWorldTM = hierarchy.GetWorldTM(child);
+
+        hierarchy.RemoveNode(root);
+        EXPECT_EQ(hierarchy.GetParent(child), TransformHierarchy::InvalidNodeId);
+        EXPECT_THAT(hierarchy.GetLocalTM(child), IsClose(childWorldTM));
+
+        // The released id is reused, which must not attach the old children to the new node.
+        const TransformHierarchy::NodeId newNode = hierarchy.AddNode(CreateTransform(0.0f, 0.0f, 9.0f, 0.0f));
+        EXPECT_EQ(newNode, root);
+        changedNodes.clear();
+        hierarchy.UpdateWorldTransforms(changedNodes);
+        EXPECT_EQ(hierarchy.GetNodeCount(), 2);
+        EXPECT_THAT(hierarchy.GetWorldTM(child), IsClose(childWorldTM));
+    }
+
+    TEST_F(TransformHierarchyTests, SetParent_CreatesCycle_IsRejected)
+    {
+        TransformHierarchy hierarchy;
+        const TransformHierarchy::NodeId root = hierarchy.AddNode(AZ::Transform::CreateIdentity());
+        const TransformHierarchy::NodeId child = hierarchy.AddNode(AZ::Transform::CreateIdentity());
+        hierarchy.SetParent(child, root);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        hierarchy.SetParent(root, child);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_EQ(hierarchy.GetParent(root), TransformHierarchy::InvalidNodeId);
+    }
+
+    TEST_F(TransformHierarchyTests, UpdateWorldTransforms_RandomForestWithReparenting_MatchesRecursiveComputation)
+    {
+        constexpr uint32_t NodeCount = 500;
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> unif(-10.0f, 10.0f);
+
+        TransformHierarchy hierarchy;
+        AZStd::vector<TransformHierarchy::NodeId> nodes;
+        for (uint32_t index = 0; index < NodeCount; ++index)
+        {
+            nodes.push_back(hierarchy.AddNode(CreateTransform(unif(rng), unif(rng), unif(rng), unif(rng))));
+            // Parent to an earlier node most of the time, which builds deep chains and never creates cycles.
+            if (index > 0 && rng() % 8 != 0)
+            {
+                hierarchy.SetParent(nodes.back(), nodes[rng() % index]);
+            }
+        }
+
+        auto computeWorldTM = [&hierarchy](TransformHierarchy::NodeId node)
+        {
+            AZ::Transform worldTM = hierarchy.GetLocalTM(node);
+            for (TransformHierarchy::NodeId parent = hierarchy.GetParent(node); parent != TransformHierarchy::InvalidNodeId;
+                 parent = hierarchy.GetParent(parent))
+            {
+                worldTM = hierarchy.GetLocalTM(parent) * worldTM;
+            }
+            return worldTM;
+        };
+
+        AZStd::vector<TransformHierarchy::NodeId> changedNodes;
+        for (uint32_t iteration = 0; iteration < 4; ++iteration)
+        {
+            for (uint32_t change = 0; change < 50; ++change)
+            {
+                const uint32_t index = rng() % NodeCount;
+                hierarchy.SetLocalTM(nodes[index], CreateTransform(unif(rng), unif(rng), unif(rng), unif(rng)));
+                if (index > 0 && change % 10 == 0)
+                {
+                    hierarchy.SetParent(nodes[index], nodes[rng() % index]);
+                }
+            }
+
+            changedNodes.clear();
+            hierarchy.UpdateWorldTransforms(changedNodes);
+            EXPECT_FALSE(changedNodes.empty());
+            for (TransformHierarchy::NodeId node : nodes)
+            {
+                EXPECT_THAT(hierarchy.GetWorldTM(node), IsCloseTolerance(computeWorldTM(node), 1e-3f));
+            }
+        }
+    }
+
+    TEST_F(TransformHierarchyTests, TransformHierarchySystem_GetWorldTMWhileAddingAndRemovingNodes_ReturnsNodeTransform)
+    {
+        TransformHierarchySystem hierarchySystem;
+        const AZ::Transform rootWorldTM = CreateTransform(1.0f, 0.0f, 0.0f, 0.5f);
+        const AZ::Transform childLocalTM = CreateTransform(0.0f, 2.0f, 0.0f, 0.0f);
+        const ITransformHierarchy::NodeId root = hierarchySystem.AddTransform(nullptr, rootWorldTM);
+        const ITransformHierarchy::NodeId child = hierarchySystem.AddTransform(nullptr, AZ::Transform::CreateIdentity());
+        hierarchySystem.SetParent(child, root, childLocalTM);
+        hierarchySystem.ProcessTransformHierarchy();
+        const AZ::Transform childWorldTM = rootWorldTM * childLocalTM;
+
+        // Adding nodes grows the stored transforms, removing and reparenting them moves the remaining ones to other slots.
+        AZStd::atomic_bool done{ false };
+        AZStd::atomic<uint32_t> mismatchCount{ 0 };
+        AZStd::thread reader([&]()
+        {
+            while (!done)
+            {
+                if (!hierarchySystem.GetWorldTM(child).IsClose(childWorldTM) || !hierarchySystem.GetWorldTM(root).IsClose(rootWorldTM))
+                {
+                    ++mismatchCount;
+                }
+            }
+        });
+
+        AZStd::vector<ITransformHierarchy::NodeId> nodes;
+        for (uint32_t iteration = 0; iteration < 20; ++iteration)
+        {
+            for (uint32_t index = 0; index < 500; ++index)
+            {
+                nodes.push_back(hierarchySystem.AddTransform(nullptr, CreateTransform(float(index), 0.0f, 0.0f, 0.0f)));
+                if (index % 4 == 0)
+                {
+                    hierarchySystem.SetParent(nodes.back(), (index % 8 == 0) ? root : child, AZ::Transform::CreateIdentity());
+                }
+            }
+            hierarchySystem.ProcessTransformHierarchy();
+
+            for (ITransformHierarchy::NodeId node : nodes)
+            {
+                hierarchySystem.RemoveTransform(node);
+            }
+            nodes.clear();
+        }
+
+        done = true;
+        reader.join();
+        EXPECT_EQ(mismatchCount.load(), 0);
+    }
+} // namespace UnitTest
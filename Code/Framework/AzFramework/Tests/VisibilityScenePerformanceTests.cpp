@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Runs the same workload against both visibility scene backends, selected by the first benchmark argument.
+    //! Entries move every iteration the way scene content does in a game: most of them move a short distance and a few jump far.
+    class BM_VisibilityScene
+        : public benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+
+            const AZ::Name sceneName("VisibilitySceneBenchmark");
+            if (state.range(0) == Backend_Bvh)
+            {
+                m_visScene = aznew AzFramework::BvhScene(sceneName);
+            }
+            else
+            {
+                m_visScene = aznew AzFramework::OctreeScene(sceneName);
+            }
+
+            m_dataArray.resize(EntryCount);
+            m_velocityArray.resize(EntryCount);
+            m_queryDataArray.resize(1000);
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif;
+
+            std::generate(m_dataArray.begin(), m_dataArray.end(), [&unif, &rng]()
+            {
+                AzFramework::VisibilityEntry data;
+                AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 8000.0f;
+                AZ::Vector3 aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 50.0f + aabbMin;
+                data.m_internalNode = nullptr;
+                data.m_internalNodeIndex = 0;
+                data.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMax);
+                data.m_userData = nullptr;
+                data.m_typeFlags = AzFramework::VisibilityEntry::TYPE_None;
+                return data;
+            });
+
+            std::generate(m_velocityArray.begin(), m_velocityArray.end(), [&unif, &rng]()
+            {
+                const AZ::Vector3 direction = (AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 2.0f - AZ::Vector3(1.0f)).GetNormalizedSafe();
+                const float distance = (unif(rng) < 0.9f) ? 0.5f : 100.0f;
+                return direction * distance;
+            });
+
+            std::generate(m_queryDataArray.begin(), m_queryDataArray.end(), [&unif, &rng]()
+            {
+                QueryData data;
+                AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 8000.0f;
+                AZ::Vector3 aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 250.0f + aabbMin;
+                AZ::Vector3 frustumCenter = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 8000.0f;
+                AZ::Quaternion quaternion = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetNormalized(), unif(rng));
+                data.aabb = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMax);
+                data.frustum = AZ::Frustum(AZ::ViewFrustumAttributes(
+                    AZ::Transform::CreateFromQuaternionAndTranslation(quaternion, frustumCenter), 1.0f,
+                    2.0f * atanf(0.5f), unif(rng) * 10.0f, unif(rng) * 1000.0f));
+                return data;
+            });
+        }
+
+        void internalTearDown()
+        {
+            delete m_visScene;
+            m_visScene = nullptr;
+            AZ::NameDictionary::Destroy();
+
+            m_dataArray.clear();
+            m_dataArray.shrink_to_fit();
+
+            m_velocityArray.clear();
+            m_velocityArray.shrink_to_fit();
+
+            m_queryDataArray.clear();
+            m_queryDataArray.shrink_to_fit();
+        }
+
+    public:
+        enum Backend : int64_t
+        {
+            Backend_Octree = 0,
+            Backend_Bvh = 1
+        };
+
+        static constexpr uint32_t EntryCount = 100000;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void SetBackendLabel(benchmark::State& state)
+        {
+            state.SetLabel(state.range(0) == Backend_Bvh ? "Bvh" : "Octree");
+        }
+
+        void InsertEntries()
+        {
+            for (AzFramework::VisibilityEntry& entry : m_dataArray)
+            {
+                m_visScene->InsertOrUpdateEntry(entry);
+            }
+        }
+
+        void RemoveEntries()
+        {
+            for (AzFramework::VisibilityEntry& entry : m_dataArray)
+            {
+                m_visScene->RemoveEntry(entry);
+            }
+        }
+
+        //! Moves every entry by its velocity, reversing direction every other step so entries stay within the world.
+        void MoveEntries()
+        {
+            const float direction = (m_moveStep++ & 1) ? -1.0f : 1.0f;
+            for (uint32_t i = 0; i < EntryCount; ++i)
+            {
+                AzFramework::VisibilityEntry& entry = m_dataArray[i];
+                entry.m_boundingVolume.Translate(m_velocityArray[i] * direction);
+                m_visScene->InsertOrUpdateEntry(entry);
+            }
+        }
+
+        struct QueryData
+        {
+            AZ::Aabb aabb;
+            AZ::Frustum frustum;
+        };
+
+        AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
+        AZStd::vector<AZ::Vector3> m_velocityArray;
+        AZStd::vector<QueryData> m_queryDataArray;
+        AzFramework::IVisibilityScene* m_visScene = nullptr;
+        uint32_t m_moveStep = 0;
+    };
+
+    BENCHMARK_DEFINE_F(BM_VisibilityScene, Insert)(benchmark::State& state)
+    {
+        SetBackendLabel(state);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntries();
+
+            state.PauseTiming();
+            RemoveEntries();
+            state.ResumeTiming();
+        }
+    }
+
+    BENCHMARK_DEFINE_F(BM_VisibilityScene, Update)(benchmark::State& state)
+    {
+        SetBackendLabel(state);
+        InsertEntries();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntries();
+        }
+        RemoveEntries();
+    }
+
+    BENCHMARK_DEFINE_F(BM_VisibilityScene, EnumerateAabbAfterUpdates)(benchmark::State& state)
+    {
+        SetBackendLabel(state);
+        InsertEntries();
+
+        // Queries run against the tree left behind by moving entries, not the one built by inserting them
+        constexpr uint32_t UpdateCount = 10;
+        for (uint32_t i = 0; i < UpdateCount; ++i)
+        {
+            MoveEntries();
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries();
+    }
+
+    BENCHMARK_DEFINE_F(BM_VisibilityScene, EnumerateFrustumAfterUpdates)(benchmark::State& state)
+    {
+        SetBackendLabel(state);
+        InsertEntries();
+
+        constexpr uint32_t UpdateCount = 10;
+        for (uint32_t i = 0; i < UpdateCount; ++i)
+        {
+            MoveEntries();
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries();
+    }
+
+    BENCHMARK_REGISTER_F(BM_VisibilityScene, Insert)
+        ->Arg(BM_VisibilityScene::Backend_Octree)->Arg(BM_VisibilityScene::Backend_Bvh)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(BM_VisibilityScene, Update)
+        ->Arg(BM_VisibilityScene::Backend_Octree)->Arg(BM_VisibilityScene::Backend_Bvh)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(BM_VisibilityScene, EnumerateAabbAfterUpdates)
+        ->Arg(BM_VisibilityScene::Backend_Octree)->Arg(BM_VisibilityScene::Backend_Bvh)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(BM_VisibilityScene, EnumerateFrustumAfterUpdates)
+        ->Arg(BM_VisibilityScene::Backend_Octree)->Arg(BM_VisibilityScene::Backend_Bvh)->Unit(benchmark::kMillisecond);
+}
+
+#endif
@@ -16,6 +16,7 @@ set(FILES
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
     BinToTextEncode.cpp
+    BvhTests.cpp
     CameraInputTests.cpp
     ClickDetectorTests.cpp
     CursorStateTests.cpp
@@ -25,12 +26,14 @@ set(FILES
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    VisibilityScenePerformanceTests.cpp
     AssetCatalog.cpp
     AssetProcessorConnection.cpp
     ProcessLaunchParseTests.cpp
     Application.cpp
     PlatformHelper.cpp
     Scene.cpp
+    TransformHierarchyTests.cpp
     CameraState.cpp
     DocumentPropertyEditor/AdapterBuilderTests.cpp
     DocumentPropertyEditor/SchemaTests.cpp
@@ -14,9 +14,12 @@
 #include <AzNetworking/ConnectionLayer/IConnectionSet.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AzNetworking
 {
+    class PacketCaptureWriter;
+
     //! @class INetworkInterface
     //! @brief Network interface class to abstract client/server and protocol concerns from application code.
     //!
@@ -127,9 +130,18 @@ namespace AzNetworking
         //! @return boolean true if this connection instance is in an open state
         virtual bool IsOpen() const = 0;
 
+        //! Sets the packet capture that all application packets sent and received on this network interface are recorded to.
+        //! @param packetCapture the packet capture to record to, or nullptr to stop recording
+        void SetPacketCapture(PacketCaptureWriter* packetCapture);
+
+        //! Returns the packet capture this network interface records to, or nullptr if it isn't recording.
+        //! @return the packet capture this network interface records to
+        PacketCaptureWriter* GetPacketCapture() const;
+
     private:
 
         NetworkInterfaceMetrics m_metrics;
+        AZStd::atomic<PacketCaptureWriter*> m_packetCapture{ nullptr };
     };
 
     inline const NetworkInterfaceMetrics& INetworkInterface::GetMetrics() const
@@ -141,4 +153,14 @@ namespace AzNetworking
     {
         return m_metrics;
     }
+
+    inline void INetworkInterface::SetPacketCapture(PacketCaptureWriter* packetCapture)
+    {
+        m_packetCapture = packetCapture;
+    }
+
+    inline PacketCaptureWriter* INetworkInterface::GetPacketCapture() const
+    {
+        return m_packetCapture;
+    }
 }
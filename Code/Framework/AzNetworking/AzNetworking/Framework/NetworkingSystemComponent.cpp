@@ -18,6 +18,7 @@
 namespace AzNetworking
 {
     AZ_CVAR(bool, net_validateSerializedTypes, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Validate that all serialized types are correct");
+    AZ_CVAR(float, net_PacketReplayTimeScale, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scales the rate at which packet captures are replayed, 0 replays the entire capture in a single tick");
 
     void NetworkingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -51,6 +52,10 @@ namespace AzNetworking
 
     NetworkingSystemComponent::~NetworkingSystemComponent()
     {
+        // Any replay connections must be torn down while their listener is still alive
+        m_packetReplay = nullptr;
+        m_packetCapture.Close();
+
         // Delete all our network interfaces first so they can unregister from the reader and listen threads
         m_networkInterfaces.clear();
 
@@ -82,6 +87,11 @@ namespace AzNetworking
         {
             networkInterface.second->Update();
         }
+
+        if (m_packetReplay != nullptr)
+        {
+            UpdatePacketReplay();
+        }
     }
 
     INetworkInterface* NetworkingSystemComponent::CreateNetworkInterface(const AZ::Name& name, ProtocolType protocolType, TrustZone trustZone, IConnectionListener& listener)
@@ -101,6 +111,10 @@ namespace AzNetworking
         INetworkInterface* returnResult = result.get();
         if (result != nullptr)
         {
+            if (m_packetCapture.IsOpen())
+            {
+                result->SetPacketCapture(&m_packetCapture);
+            }
             m_networkInterfaces.emplace(name, AZStd::move(result));
         }
         return returnResult;
@@ -207,4 +221,100 @@ namespace AzNetworking
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
         }
     }
+
+    void NetworkingSystemComponent::StartPacketCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZLOG_WARN("net_StartPacketCapture requires the path of the capture file to write");
+            return;
+        }
+
+        const AZ::CVarFixedString capturePath(arguments.front());
+        if (!m_packetCapture.Open(capturePath.c_str()))
+        {
+            return;
+        }
+
+        for (auto& networkInterface : m_networkInterfaces)
+        {
+            networkInterface.second->SetPacketCapture(&m_packetCapture);
+        }
+        AZLOG_INFO("Started packet capture to %s", capturePath.c_str());
+    }
+
+    void NetworkingSystemComponent::StopPacketCapture([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (!m_packetCapture.IsOpen())
+        {
+            return;
+        }
+
+        for (auto& networkInterface : m_networkInterfaces)
+        {
+            networkInterface.second->SetPacketCapture(nullptr);
+        }
+        m_packetCapture.Close();
+        AZLOG_INFO("Stopped packet capture, recorded %llu packets", aznumeric_cast<AZ::u64>(m_packetCapture.GetRecordedPacketCount()));
+    }
+
+    void NetworkingSystemComponent::ReplayPacketCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("net_ReplayPacketCapture requires the path of the capture file and the name of the network interface to replay into");
+            return;
+        }
+
+        const AZ::CVarFixedString capturePath(arguments[0]);
+        INetworkInterface* networkInterface = RetrieveNetworkInterface(AZ::Name(arguments[1]));
+        if (networkInterface == nullptr)
+        {
+            AZLOG_WARN("No network interface named %.*s exists to replay into", AZ_STRING_ARG(arguments[1]));
+            return;
+        }
+
+        // A listening interface receives traffic from connectors, so its replayed connections act as acceptors
+        const ConnectionRole connectionRole = (networkInterface->GetPort() != 0) ? ConnectionRole::Acceptor : ConnectionRole::Connector;
+        m_packetReplay = nullptr;
+        m_packetReplay = AZStd::make_unique<PacketReplayDriver>(networkInterface->GetConnectionListener(), connectionRole);
+        if (!m_packetReplay->Open(capturePath.c_str()))
+        {
+            m_packetReplay = nullptr;
+            return;
+        }
+
+        m_packetReplayStartTimeUs = AZ::GetElapsedTimeUs();
+        m_packetReplayLastTimeUs = m_packetReplayStartTimeUs;
+        m_packetReplayCaptureTimeUs = 0.0;
+        AZLOG_INFO("Replaying packet capture %s into %s", capturePath.c_str(), networkInterface->GetName().GetCStr());
+    }
+
+    void NetworkingSystemComponent::UpdatePacketReplay()
+    {
+        const AZ::TimeUs currentTimeUs = AZ::GetElapsedTimeUs();
+        if (net_PacketReplayTimeScale > 0.0f)
+        {
+            m_packetReplayCaptureTimeUs += static_cast<double>(currentTimeUs - m_packetReplayLastTimeUs) * static_cast<float>(net_PacketReplayTimeScale);
+            m_packetReplay->ReplayUntil(static_cast<AZ::TimeUs>(static_cast<int64_t>(m_packetReplayCaptureTimeUs)));
+        }
+        else
+        {
+            m_packetReplay->ReplayUntil(static_cast<AZ::TimeUs>(AZStd::numeric_limits<int64_t>::max()));
+        }
+        m_packetReplayLastTimeUs = currentTimeUs;
+
+        if (m_packetReplay->IsComplete())
+        {
+            // Finish() releases the replay connections, which own the sent byte counts
+            const uint64_t replayedPacketCount = m_packetReplay->GetReplayedPacketCount();
+            const uint64_t sentBytes = m_packetReplay->GetSentBytes();
+            m_packetReplay->Finish();
+            AZLOG_INFO("Packet replay complete, dispatched %llu packets and sent %llu bytes in %lld microseconds",
+                aznumeric_cast<AZ::u64>(replayedPacketCount),
+                aznumeric_cast<AZ::u64>(sentBytes),
+                aznumeric_cast<AZ::s64>(currentTimeUs - m_packetReplayStartTimeUs));
+            m_packetReplay = nullptr;
+        }
+    }
 }
@@ -12,6 +12,8 @@
 #include <AzNetworking/Framework/ICompressor.h>
 #include <AzNetworking/Framework/INetworking.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/Framework/PacketCapture.h>
+#include <AzNetworking/Framework/PacketReplayDriver.h>
 #include <AzNetworking/TcpTransport/TcpListenThread.h>
 #include <AzNetworking/UdpTransport/UdpHeartbeatThread.h>
 #include <AzNetworking/UdpTransport/UdpReaderThread.h>
@@ -70,11 +72,19 @@ namespace AzNetworking
         //! Console commands.
         //! @{
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void StartPacketCapture(const AZ::ConsoleCommandContainer& arguments);
+        void StopPacketCapture(const AZ::ConsoleCommandContainer& arguments);
+        void ReplayPacketCapture(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
     private:
 
+        void UpdatePacketReplay();
+
         AZ_CONSOLEFUNC(NetworkingSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for all instantiated network interfaces");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, StartPacketCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Records all application packets on every network interface to the provided capture file");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, StopPacketCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Stops any active packet capture and flushes it to disk");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, ReplayPacketCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Replays a packet capture into the listener of the named network interface without using any sockets: <capture file> <interface name>");
 
         NetworkInterfaces m_networkInterfaces;
         AZStd::unique_ptr<TcpListenThread> m_listenThread;
@@ -83,5 +93,11 @@ namespace AzNetworking
 
         using CompressionFactories = AZStd::unordered_map<AZ::Crc32, AZStd::unique_ptr<ICompressorFactory>>;
         CompressionFactories m_compressorFactories;
+
+        PacketCaptureWriter m_packetCapture;
+        AZStd::unique_ptr<PacketReplayDriver> m_packetReplay;
+        AZ::TimeUs m_packetReplayStartTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_packetReplayLastTimeUs = AZ::Time::ZeroTimeUs;
+        double m_packetReplayCaptureTimeUs = 0.0;
     };
 }
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Framework/PacketCapture.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    static constexpr uint32_t PacketCaptureMagic = 0x434E5A41; // 'AZNC'
+    static constexpr uint32_t PacketCaptureVersion = 1;
+    static constexpr uint32_t PacketCaptureHeaderSize = sizeof(uint32_t) * 2;
+
+    // Large enough for the record fields plus a maximum size payload and its size prefixes
+    static constexpr uint32_t MaxCapturedRecordSize = MaxPacketSize + 64;
+
+    // Records are flushed to disk once this much data is buffered
+    static constexpr uint32_t PacketCaptureFlushSize = 256 * 1024;
+
+    bool CapturedPacket::Serialize(ISerializer& serializer)
+    {
+        return serializer.Serialize(m_timeUs, "TimeUs")
+            && serializer.Serialize(m_direction, "Direction")
+            && serializer.Serialize(m_protocolType, "ProtocolType")
+            && serializer.Serialize(m_connectionId, "ConnectionId")
+            && serializer.Serialize(m_packetType, "PacketType")
+            && serializer.Serialize(m_packetId, "PacketId")
+            && serializer.Serialize(m_payload, "Payload");
+    }
+
+    PacketCaptureWriter::~PacketCaptureWriter()
+    {
+        Close();
+    }
+
+    bool PacketCaptureWriter::Open(const char* path)
+    {
+        Close();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (!m_file.Open(path, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZLOG_WARN("Failed to open packet capture %s for writing", path);
+            return false;
+        }
+
+        const uint32_t header[] = { PacketCaptureMagic, PacketCaptureVersion };
+        m_file.Write(header, sizeof(header));
+
+        m_pendingRecords.reserve(PacketCaptureFlushSize + MaxCapturedRecordSize);
+        m_startTimeUs = AZ::GetElapsedTimeUs();
+        m_recordedPacketCount = 0;
+        m_isOpen = true;
+        return true;
+    }
+
+    void PacketCaptureWriter::Close()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_isOpen)
+        {
+            FlushInternal();
+            m_file.Close();
+            m_isOpen = false;
+        }
+    }
+
+    bool PacketCaptureWriter::IsOpen() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_isOpen;
+    }
+
+    void PacketCaptureWriter::Record
+    (
+        PacketCaptureDirection direction,
+        ProtocolType protocolType,
+        ConnectionId connectionId,
+        PacketType packetType,
+        PacketId packetId,
+        const uint8_t* payload,
+        uint32_t payloadSize
+    )
+    {
+        CapturedPacket capturedPacket;
+        capturedPacket.m_direction = direction;
+        capturedPacket.m_protocolType = protocolType;
+        capturedPacket.m_connectionId = connectionId;
+        capturedPacket.m_packetType = packetType;
+        capturedPacket.m_packetId = packetId;
+        if (!capturedPacket.m_payload.CopyValues(payload, payloadSize))
+        {
+            AZLOG_WARN("Packet of type %u is too large to capture", aznumeric_cast<uint32_t>(packetType));
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (!m_isOpen)
+        {
+            return;
+        }
+
+        capturedPacket.m_timeUs = AZ::GetElapsedTimeUs() - m_startTimeUs;
+
+        // Serialize the record straight onto the end of the pending buffer
+        const size_t recordOffset = m_pendingRecords.size();
+        m_pendingRecords.resize_no_construct(recordOffset + MaxCapturedRecordSize);
+        NetworkInputSerializer serializer(m_pendingRecords.data() + recordOffset, MaxCapturedRecordSize);
+        if (!capturedPacket.Serialize(serializer))
+        {
+            m_pendingRecords.resize_no_construct(recordOffset);
+            return;
+        }
+        m_pendingRecords.resize_no_construct(recordOffset + serializer.GetSize());
+        ++m_recordedPacketCount;
+
+        if (m_pendingRecords.size() >= PacketCaptureFlushSize)
+        {
+            FlushInternal();
+        }
+    }
+
+    uint64_t PacketCaptureWriter::GetRecordedPacketCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_recordedPacketCount;
+    }
+
+    void PacketCaptureWriter::FlushInternal()
+    {
+        if (!m_pendingRecords.empty())
+        {
+            m_file.Write(m_pendingRecords.data(), m_pendingRecords.size());
+            m_pendingRecords.clear();
+        }
+    }
+
+    bool PacketCaptureReader::Open(const char* path)
+    {
+        m_data.clear();
+        m_readOffset = 0;
+        m_firstRecordOffset = 0;
+
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(path);
+        if (fileSize < PacketCaptureHeaderSize)
+        {
+            AZLOG_WARN("Packet capture %s is missing or empty", path);
+            return false;
+        }
+
+        m_data.resize_no_construct(fileSize);
+        if (AZ::IO::SystemFile::Read(path, m_data.data(), fileSize) != fileSize)
+        {
+            AZLOG_WARN("Failed to read packet capture %s", path);
+            m_data.clear();
+            return false;
+        }
+
+        if (!HasCaptureHeader(m_data.data(), m_data.size()))
+        {
+            AZLOG_WARN("Packet capture %s has an unsupported format", path);
+            m_data.clear();
+            return false;
+        }
+
+        m_firstRecordOffset = PacketCaptureHeaderSize;
+        m_readOffset = m_firstRecordOffset;
+        return true;
+    }
+
+    bool PacketCaptureReader::ReadNext(CapturedPacket& outPacket)
+    {
+        if (m_readOffset >= m_data.size())
+        {
+            return false;
+        }
+
+        NetworkOutputSerializer serializer(m_data.data() + m_readOffset, static_cast<uint32_t>(m_data.size() - m_readOffset));
+        if (!outPacket.Serialize(serializer))
+        {
+            AZLOG_WARN("Packet capture is corrupt at offset %u", m_readOffset);
+            m_readOffset = static_cast<uint32_t>(m_data.size());
+            return false;
+        }
+
+        m_readOffset += serializer.GetReadSize();
+        return true;
+    }
+
+    void PacketCaptureReader::Rewind()
+    {
+        m_readOffset = m_firstRecordOffset;
+    }
+
+    bool PacketCaptureReader::HasCaptureHeader(const uint8_t* data, size_t size)
+    {
+        if (size < PacketCaptureHeaderSize)
+        {
+            return false;
+        }
+
+        uint32_t header[2] = {};
+        memcpy(header, data, sizeof(header));
+        return (header[0] == PacketCaptureMagic) && (header[1] == PacketCaptureVersion);
+    }
+}
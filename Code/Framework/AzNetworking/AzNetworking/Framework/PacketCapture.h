@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/PacketLayer/IPacketHeader.h>
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Preprocessor/Enum.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AzNetworking
+{
+    AZ_ENUM_CLASS(PacketCaptureDirection
+        , Inbound
+        , Outbound
+    );
+
+    //! A single application packet recorded by a PacketCaptureWriter.
+    //! Only packets dispatched to or sent by the connection listener are recorded, transport level core packets are not.
+    struct CapturedPacket
+    {
+        AZ::TimeUs m_timeUs = AZ::Time::ZeroTimeUs; //!< Time the packet was recorded at, relative to the start of the capture
+        PacketCaptureDirection m_direction = PacketCaptureDirection::Inbound;
+        ProtocolType m_protocolType = ProtocolType::Udp;
+        ConnectionId m_connectionId = InvalidConnectionId;
+        PacketType m_packetType = PacketType{ 0 };
+        PacketId m_packetId = InvalidPacketId;
+        PacketEncodingBuffer m_payload; //!< The serialized packet without any transport header, decrypted and decompressed
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+    };
+
+    //! @class PacketCaptureWriter
+    //! @brief Records timestamped application packets to a compact binary capture file.
+    //!
+    //! Network interfaces record every packet they hand to or receive from their connection listener while a capture writer
+    //! is assigned to them. Records are buffered and flushed to disk in large writes, recording is safe from any thread.
+    class PacketCaptureWriter
+    {
+    public:
+
+        PacketCaptureWriter() = default;
+        ~PacketCaptureWriter();
+
+        //! Opens a new capture file, closing any previously open capture.
+        //! @param path the path of the capture file to create
+        //! @return boolean true on success
+        bool Open(const char* path);
+
+        //! Flushes any buffered records and closes the capture file.
+        void Close();
+
+        //! Returns true if a capture file is currently open.
+        //! @return boolean true if a capture file is currently open
+        bool IsOpen() const;
+
+        //! Records a single packet.
+        //! @param direction    whether the packet was received or sent
+        //! @param protocolType the protocol of the network interface recording the packet
+        //! @param connectionId the connection the packet was received on or sent to
+        //! @param packetType   the type of the packet
+        //! @param packetId     the packet id assigned by the transport
+        //! @param payload      the serialized packet data, excluding transport headers
+        //! @param payloadSize  the size of the serialized packet data
+        void Record(PacketCaptureDirection direction, ProtocolType protocolType, ConnectionId connectionId, PacketType packetType, PacketId packetId, const uint8_t* payload, uint32_t payloadSize);
+
+        //! Returns the number of packets recorded since the capture was opened.
+        //! @return the number of packets recorded since the capture was opened
+        uint64_t GetRecordedPacketCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketCaptureWriter);
+
+        //! Writes all buffered records to the capture file, must be called with the mutex held.
+        void FlushInternal();
+
+        mutable AZStd::mutex m_mutex;
+        AZ::IO::SystemFile m_file;
+        AZStd::vector<uint8_t> m_pendingRecords;
+        AZ::TimeUs m_startTimeUs = AZ::Time::ZeroTimeUs;
+        uint64_t m_recordedPacketCount = 0;
+        bool m_isOpen = false;
+    };
+
+    //! @class PacketCaptureReader
+    //! @brief Reads back the packets recorded by a PacketCaptureWriter, in recording order.
+    class PacketCaptureReader
+    {
+    public:
+
+        PacketCaptureReader() = default;
+        ~PacketCaptureReader() = default;
+
+        //! Loads a capture file.
+        //! @param path the path of the capture file to load
+        //! @return boolean true if the file was loaded and has a valid capture header
+        bool Open(const char* path);
+
+        //! Reads the next recorded packet.
+        //! @param outPacket the packet to read into
+        //! @return boolean true if a packet was read, false at the end of the capture or if the capture is corrupt
+        bool ReadNext(CapturedPacket& outPacket);
+
+        //! Rewinds the reader to the first recorded packet.
+        void Rewind();
+
+        //! Returns true if the data starts with a packet capture header, which identifies a capture file without logging.
+        //! @param data the beginning of a file
+        //! @param size the number of bytes available at data
+        //! @return boolean true if the data starts with a supported capture header
+        static bool HasCaptureHeader(const uint8_t* data, size_t size);
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketCaptureReader);
+
+        AZStd::vector<uint8_t> m_data;
+        uint32_t m_readOffset = 0;
+        uint32_t m_firstRecordOffset = 0;
+    };
+}
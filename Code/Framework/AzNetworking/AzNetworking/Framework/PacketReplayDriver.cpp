@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Framework/PacketReplayDriver.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    //! Packet header reconstructed from a captured packet.
+    class CapturedPacketHeader final
+        : public IPacketHeader
+    {
+    public:
+
+        CapturedPacketHeader(PacketType packetType, PacketId packetId)
+            : m_packetType(packetType)
+            , m_packetId(packetId)
+        {
+            ;
+        }
+
+        PacketType GetPacketType() const override
+        {
+            return m_packetType;
+        }
+
+        PacketId GetPacketId() const override
+        {
+            return m_packetId;
+        }
+
+        bool IsPacketFlagSet([[maybe_unused]] PacketFlag flag) const override
+        {
+            // Captured payloads are always stored decompressed
+            return false;
+        }
+
+        void SetPacketFlag([[maybe_unused]] PacketFlag flag, [[maybe_unused]] bool value) override
+        {
+            ;
+        }
+
+    private:
+
+        PacketType m_packetType;
+        PacketId m_packetId;
+    };
+
+    ReplayConnection::ReplayConnection(ConnectionId connectionId, ConnectionRole connectionRole)
+        : IConnection(connectionId, IpAddress(127, 0, 0, 1, 0))
+        , m_connectionRole(connectionRole)
+    {
+        ;
+    }
+
+    bool ReplayConnection::SendReliablePacket(const IPacket& packet)
+    {
+        return SerializeSentPacket(packet) != InvalidPacketId;
+    }
+
+    PacketId ReplayConnection::SendUnreliablePacket(const IPacket& packet)
+    {
+        return SerializeSentPacket(packet);
+    }
+
+    bool ReplayConnection::WasPacketAcked([[maybe_unused]] PacketId packetId) const
+    {
+        return true;
+    }
+
+    ConnectionState ReplayConnection::GetConnectionState() const
+    {
+        return m_state;
+    }
+
+    ConnectionRole ReplayConnection::GetConnectionRole() const
+    {
+        return m_connectionRole;
+    }
+
+    bool ReplayConnection::Disconnect([[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint)
+    {
+        if (m_state == ConnectionState::Disconnected)
+        {
+            return false;
+        }
+        m_state = ConnectionState::Disconnected;
+        return true;
+    }
+
+    void ReplayConnection::SetConnectionMtu(uint32_t connectionMtu)
+    {
+        m_connectionMtu = connectionMtu;
+    }
+
+    uint32_t ReplayConnection::GetConnectionMtu() const
+    {
+        return m_connectionMtu;
+    }
+
+    uint64_t ReplayConnection::GetSentBytes() const
+    {
+        return m_sentBytes;
+    }
+
+    PacketId ReplayConnection::SerializeSentPacket(const IPacket& packet)
+    {
+        if (m_state != ConnectionState::Connected)
+        {
+            return InvalidPacketId;
+        }
+
+        PacketEncodingBuffer buffer;
+        NetworkInputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+        if (!const_cast<IPacket&>(packet).Serialize(serializer))
+        {
+            AZLOG_WARN("Replay connection failed to serialize packet of type %u", aznumeric_cast<uint32_t>(packet.GetPacketType()));
+            return InvalidPacketId;
+        }
+
+        m_sentBytes += serializer.GetSize();
+        const PacketId packetId = m_nextPacketId;
+        m_nextPacketId = PacketId{ aznumeric_cast<uint32_t>(m_nextPacketId) + 1 };
+        return packetId;
+    }
+
+    PacketReplayDriver::PacketReplayDriver(IConnectionListener& listener, ConnectionRole connectionRole)
+        : m_listener(listener)
+        , m_connectionRole(connectionRole)
+    {
+        ;
+    }
+
+    PacketReplayDriver::~PacketReplayDriver()
+    {
+        Finish();
+    }
+
+    bool PacketReplayDriver::Open(const char* path)
+    {
+        Finish();
+        m_replayedPacketCount = 0;
+        if (!m_reader.Open(path))
+        {
+            m_hasNextPacket = false;
+            return false;
+        }
+        m_hasNextPacket = m_reader.ReadNext(m_nextPacket);
+        return true;
+    }
+
+    uint32_t PacketReplayDriver::ReplayUntil(AZ::TimeUs captureTimeUs)
+    {
+        uint32_t dispatchedPackets = 0;
+        while (m_hasNextPacket && (m_nextPacket.m_timeUs <= captureTimeUs))
+        {
+            if (m_nextPacket.m_direction == PacketCaptureDirection::Inbound)
+            {
+                ReplayConnection* connection = GetOrCreateConnection(m_nextPacket.m_connectionId);
+                if (connection->GetConnectionState() == ConnectionState::Connected)
+                {
+                    const CapturedPacketHeader header(m_nextPacket.m_packetType, m_nextPacket.m_packetId);
+                    NetworkOutputSerializer serializer(m_nextPacket.m_payload.GetBuffer(), static_cast<uint32_t>(m_nextPacket.m_payload.GetSize()));
+                    if (m_listener.OnPacketReceived(connection, header, serializer) == PacketDispatchResult::Failure)
+                    {
+                        AZLOG(NET_Replay, "Replayed packet of type %u failed to dispatch", aznumeric_cast<uint32_t>(m_nextPacket.m_packetType));
+                    }
+                    ++dispatchedPackets;
+
+                    if (connection->GetConnectionState() == ConnectionState::Disconnected)
+                    {
+                        // The listener dropped the connection, any further captured traffic for it is ignored
+                        m_listener.OnDisconnect(connection, DisconnectReason::TerminatedByUser, TerminationEndpoint::Local);
+                    }
+                }
+            }
+            m_hasNextPacket = m_reader.ReadNext(m_nextPacket);
+        }
+        m_replayedPacketCount += dispatchedPackets;
+        return dispatchedPackets;
+    }
+
+    bool PacketReplayDriver::IsComplete() const
+    {
+        return !m_hasNextPacket;
+    }
+
+    void PacketReplayDriver::Finish()
+    {
+        for (auto& connection : m_connections)
+        {
+            if (connection.second->Disconnect(DisconnectReason::TerminatedByUser, TerminationEndpoint::Local))
+            {
+                m_listener.OnDisconnect(connection.second.get(), DisconnectReason::TerminatedByUser, TerminationEndpoint::Local);
+            }
+        }
+        m_connections.clear();
+    }
+
+    uint64_t PacketReplayDriver::GetReplayedPacketCount() const
+    {
+        return m_replayedPacketCount;
+    }
+
+    uint64_t PacketReplayDriver::GetSentBytes() const
+    {
+        uint64_t sentBytes = 0;
+        for (const auto& connection : m_connections)
+        {
+            sentBytes += connection.second->GetSentBytes();
+        }
+        return sentBytes;
+    }
+
+    ReplayConnection* PacketReplayDriver::GetOrCreateConnection(ConnectionId connectionId)
+    {
+        auto iter = m_connections.find(connectionId);
+        if (iter != m_connections.end())
+        {
+            return iter->second.get();
+        }
+
+        ReplayConnection* connection = m_connections.emplace(connectionId, AZStd::make_unique<ReplayConnection>(connectionId, m_connectionRole)).first->second.get();
+        m_listener.OnConnect(connection);
+        return connection;
+    }
+}
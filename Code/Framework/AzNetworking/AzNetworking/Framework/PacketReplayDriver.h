@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Framework/PacketCapture.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    //! @class ReplayConnection
+    //! @brief A socketless connection used to replay captured traffic.
+    //!
+    //! Packets sent on a replay connection are fully serialized, so the cost of generating outbound traffic is preserved,
+    //! and then discarded. Every sent packet is considered acknowledged, as if delivered over a perfect network.
+    class ReplayConnection final
+        : public IConnection
+    {
+    public:
+
+        ReplayConnection(ConnectionId connectionId, ConnectionRole connectionRole);
+        ~ReplayConnection() override = default;
+
+        //! IConnection interface.
+        //! @{
+        bool SendReliablePacket(const IPacket& packet) override;
+        PacketId SendUnreliablePacket(const IPacket& packet) override;
+        bool WasPacketAcked(PacketId packetId) const override;
+        ConnectionState GetConnectionState() const override;
+        ConnectionRole GetConnectionRole() const override;
+        bool Disconnect(DisconnectReason reason, TerminationEndpoint endpoint) override;
+        void SetConnectionMtu(uint32_t connectionMtu) override;
+        uint32_t GetConnectionMtu() const override;
+        //! @}
+
+        //! Returns the total number of bytes serialized by packets sent on this connection.
+        //! @return the total number of bytes serialized by packets sent on this connection
+        uint64_t GetSentBytes() const;
+
+    private:
+
+        PacketId SerializeSentPacket(const IPacket& packet);
+
+        ConnectionRole m_connectionRole;
+        ConnectionState m_state = ConnectionState::Connected;
+        PacketId m_nextPacketId = PacketId{ 1 };
+        uint64_t m_sentBytes = 0;
+        uint32_t m_connectionMtu = MaxUdpTransmissionUnit;
+    };
+
+    //! @class PacketReplayDriver
+    //! @brief Feeds a packet capture into a connection listener without any sockets.
+    //!
+    //! Inbound packets from the capture are dispatched to the listener in recording order, on ReplayConnection instances
+    //! standing in for each captured connection. Outbound packets in the capture are skipped, the listener regenerates them.
+    //! Advancing the replay by capture time rather than by packet count keeps the ratio of received packets to application
+    //! ticks identical to the recording, making replays deterministic and comparable across runs.
+    class PacketReplayDriver
+    {
+    public:
+
+        //! Constructor.
+        //! @param listener       the connection listener to dispatch captured packets to
+        //! @param connectionRole the role the replay connections should report, Acceptor when replaying a server capture
+        PacketReplayDriver(IConnectionListener& listener, ConnectionRole connectionRole);
+        ~PacketReplayDriver();
+
+        //! Loads a capture file to replay.
+        //! @param path the path of the capture file to load
+        //! @return boolean true on success
+        bool Open(const char* path);
+
+        //! Dispatches all captured inbound packets recorded up to the provided capture time.
+        //! @param captureTimeUs the capture time to replay up to
+        //! @return the number of packets dispatched
+        uint32_t ReplayUntil(AZ::TimeUs captureTimeUs);
+
+        //! Returns true once every packet in the capture has been replayed.
+        //! @return boolean true once every packet in the capture has been replayed
+        bool IsComplete() const;
+
+        //! Disconnects all replay connections, notifying the listener.
+        void Finish();
+
+        //! Returns the total number of packets dispatched to the listener.
+        //! @return the total number of packets dispatched to the listener
+        uint64_t GetReplayedPacketCount() const;
+
+        //! Returns the total number of bytes sent by the listener on replay connections.
+        //! @return the total number of bytes sent by the listener on replay connections
+        uint64_t GetSentBytes() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketReplayDriver);
+
+        ReplayConnection* GetOrCreateConnection(ConnectionId connectionId);
+
+        IConnectionListener& m_listener;
+        ConnectionRole m_connectionRole;
+        PacketCaptureReader m_reader;
+        CapturedPacket m_nextPacket;
+        bool m_hasNextPacket = false;
+        uint64_t m_replayedPacketCount = 0;
+        AZStd::unordered_map<ConnectionId, AZStd::unique_ptr<ReplayConnection>> m_connections;
+    };
+}
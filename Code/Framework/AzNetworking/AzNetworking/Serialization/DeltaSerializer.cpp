@@ -10,6 +10,7 @@
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzCore/std/string/conversions.h>
+#include <AzCore/std/limits.h>
 
 namespace AzNetworking
 {
@@ -61,6 +62,117 @@ namespace AzNetworking
             && serializer.Serialize(m_deltaBytes, "DeltaBytes");
     }
 
+    // XOR deltas are encoded as a 16-bit output size followed by a sequence of runs.
+    // Each run consists of a count of unchanged bytes, a count of literal bytes, and the literal XOR'd bytes themselves.
+    static constexpr uint32_t XorDeltaHeaderSize = sizeof(uint16_t);
+    static constexpr uint32_t XorDeltaMaxRunLength = AZStd::numeric_limits<uint8_t>::max();
+
+    static inline uint8_t XorDeltaBaselineByte(const uint8_t* baseline, uint32_t baselineSize, uint32_t index)
+    {
+        return (index < baselineSize) ? baseline[index] : 0;
+    }
+
+    bool EncodeXorDelta
+    (
+        const uint8_t* baseline, uint32_t baselineSize,
+        const uint8_t* current, uint32_t currentSize,
+        uint8_t* outBuffer, uint32_t outCapacity, uint32_t& outSize
+    )
+    {
+        outSize = 0;
+        if ((currentSize > AZStd::numeric_limits<uint16_t>::max()) || (outCapacity < XorDeltaHeaderSize))
+        {
+            return false;
+        }
+
+        outBuffer[outSize++] = static_cast<uint8_t>(currentSize & 0xFF);
+        outBuffer[outSize++] = static_cast<uint8_t>(currentSize >> 8);
+
+        uint32_t index = 0;
+        while (index < currentSize)
+        {
+            // Count unchanged bytes
+            uint32_t zeroCount = 0;
+            while ((index < currentSize) && (zeroCount < XorDeltaMaxRunLength)
+                && (current[index] == XorDeltaBaselineByte(baseline, baselineSize, index)))
+            {
+                ++zeroCount;
+                ++index;
+            }
+
+            // Count changed bytes
+            const uint32_t literalStart = index;
+            while ((index < currentSize) && (index - literalStart < XorDeltaMaxRunLength)
+                && (current[index] != XorDeltaBaselineByte(baseline, baselineSize, index)))
+            {
+                ++index;
+            }
+            const uint32_t literalCount = index - literalStart;
+
+            if (outSize + 2 + literalCount > outCapacity)
+            {
+                return false;
+            }
+
+            outBuffer[outSize++] = static_cast<uint8_t>(zeroCount);
+            outBuffer[outSize++] = static_cast<uint8_t>(literalCount);
+            for (uint32_t i = literalStart; i < literalStart + literalCount; ++i)
+            {
+                outBuffer[outSize++] = current[i] ^ XorDeltaBaselineByte(baseline, baselineSize, i);
+            }
+        }
+
+        return true;
+    }
+
+    bool DecodeXorDelta
+    (
+        const uint8_t* baseline, uint32_t baselineSize,
+        const uint8_t* delta, uint32_t deltaSize,
+        uint8_t* outBuffer, uint32_t outCapacity, uint32_t& outSize
+    )
+    {
+        outSize = 0;
+        if (deltaSize < XorDeltaHeaderSize)
+        {
+            return false;
+        }
+
+        const uint32_t decodedSize = static_cast<uint32_t>(delta[0]) | (static_cast<uint32_t>(delta[1]) << 8);
+        if (decodedSize > outCapacity)
+        {
+            return false;
+        }
+
+        uint32_t readOffset = XorDeltaHeaderSize;
+        while (outSize < decodedSize)
+        {
+            if (readOffset + 2 > deltaSize)
+            {
+                return false;
+            }
+
+            const uint32_t zeroCount = delta[readOffset++];
+            const uint32_t literalCount = delta[readOffset++];
+            if ((outSize + zeroCount + literalCount > decodedSize) || (readOffset + literalCount > deltaSize))
+            {
+                return false;
+            }
+
+            for (uint32_t i = 0; i < zeroCount; ++i, ++outSize)
+            {
+                outBuffer[outSize] = XorDeltaBaselineByte(baseline, baselineSize, outSize);
+            }
+
+            for (uint32_t i = 0; i < literalCount; ++i, ++outSize)
+            {
+                outBuffer[outSize] = delta[readOffset++] ^ XorDeltaBaselineByte(baseline, baselineSize, outSize);
+            }
+        }
+
+        return readOffset == deltaSize;
+    }
+
     DeltaSerializerCreate::DeltaSerializerCreate(SerializerDelta& delta)
         : m_delta(delta)
         , m_dataSerializer(m_delta.GetBufferPtr(), m_delta.GetBufferCapacity())
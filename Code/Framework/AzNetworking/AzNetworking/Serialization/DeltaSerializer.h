@@ -45,6 +45,41 @@ namespace AzNetworking
         ByteBuffer<1024> m_deltaBytes;
     };
 
+    //! Encodes the bytewise XOR of a serialized buffer against a baseline buffer, run-length encoding unchanged bytes.
+    //! Unlike DeltaSerializerCreate this operates on already serialized (and quantized) data and has no limit on the number
+    //! of serialized values, which makes it suitable for encoding complete entity snapshots against an acknowledged baseline.
+    //! Any bytes in current that extend past the end of baseline are encoded against zero.
+    //! @param baseline     the baseline buffer the remote endpoint is known to have, may be nullptr if baselineSize is 0
+    //! @param baselineSize the size of the baseline buffer in bytes
+    //! @param current      the buffer to encode
+    //! @param currentSize  the size of the buffer to encode in bytes
+    //! @param outBuffer    the buffer to write the encoded delta to
+    //! @param outCapacity  the capacity of outBuffer in bytes
+    //! @param outSize      the number of bytes written to outBuffer
+    //! @return boolean true on success, false if the encoded delta would not fit within outCapacity
+    bool EncodeXorDelta
+    (
+        const uint8_t* baseline, uint32_t baselineSize,
+        const uint8_t* current, uint32_t currentSize,
+        uint8_t* outBuffer, uint32_t outCapacity, uint32_t& outSize
+    );
+
+    //! Reconstructs a buffer previously encoded with EncodeXorDelta by applying the delta to the same baseline buffer.
+    //! @param baseline     the baseline buffer the delta was encoded against, may be nullptr if baselineSize is 0
+    //! @param baselineSize the size of the baseline buffer in bytes
+    //! @param delta        the encoded delta
+    //! @param deltaSize    the size of the encoded delta in bytes
+    //! @param outBuffer    the buffer to write the reconstructed data to
+    //! @param outCapacity  the capacity of outBuffer in bytes
+    //! @param outSize      the number of bytes written to outBuffer
+    //! @return boolean true on success, false if the delta was malformed or the output would not fit within outCapacity
+    bool DecodeXorDelta
+    (
+        const uint8_t* baseline, uint32_t baselineSize,
+        const uint8_t* delta, uint32_t deltaSize,
+        uint8_t* outBuffer, uint32_t outCapacity, uint32_t& outSize
+    );
+
     //! A serializer that is used to produce a SerializerDelta between two objects.
     //! This delta can be reapplied to the same base object to reconstruct the second object using 
     //! the DeltaSerializerApply serializer
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/QuantizingSerializer.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AzNetworking
+{
+    QuantizingSerializer::QuantizingSerializer(ISerializer& serializer, uint32_t elementCount, uint32_t bitsPerElement, float minValue, float maxValue)
+        : m_serializer(serializer)
+        , m_elementCount(elementCount)
+        , m_bitsPerElement(bitsPerElement)
+        , m_minValue(minValue)
+        , m_maxValue(maxValue)
+    {
+        AZ_Assert((bitsPerElement > 0) && (bitsPerElement <= 32), "Quantized elements must use between 1 and 32 bits");
+        AZ_Assert(elementCount * bitsPerElement <= MaxPackedBits, "Quantized value requires more than %u bits", MaxPackedBits);
+        AZ_Assert(maxValue > minValue, "Quantization range is empty");
+
+        const uint32_t packedBits = GetPackedBitCount();
+        m_maxPackedValue = (packedBits >= MaxPackedBits) ? AZStd::numeric_limits<AZ::u64>::max() : ((AZ::u64{ 1 } << packedBits) - 1);
+        m_elementMask = (bitsPerElement >= 32) ? AZStd::numeric_limits<uint32_t>::max() : ((1u << bitsPerElement) - 1);
+        // Scales are kept in double precision, a float can't represent every step of elements wider than 24 bits
+        m_quantizeScale = static_cast<double>(m_elementMask) / (static_cast<double>(maxValue) - static_cast<double>(minValue));
+        m_dequantizeScale = (static_cast<double>(maxValue) - static_cast<double>(minValue)) / static_cast<double>(m_elementMask);
+    }
+
+    uint32_t QuantizingSerializer::GetPackedBitCount() const
+    {
+        return m_elementCount * m_bitsPerElement;
+    }
+
+    bool QuantizingSerializer::IsValid() const
+    {
+        return ISerializer::IsValid() && m_serializer.IsValid();
+    }
+
+    SerializerMode QuantizingSerializer::GetSerializerMode() const
+    {
+        return m_serializer.GetSerializerMode();
+    }
+
+    bool QuantizingSerializer::Serialize(bool& value, const char* name)
+    {
+        return m_serializer.Serialize(value, name);
+    }
+
+    bool QuantizingSerializer::Serialize(int8_t& value, const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(int16_t& value, const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(int32_t& value, const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(long& value, const char* name, long minValue, long maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(AZ::s64& value, const char* name, AZ::s64 minValue, AZ::s64 maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(uint8_t& value, const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(unsigned long& value, const char* name, unsigned long minValue, unsigned long maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(AZ::u64& value, const char* name, AZ::u64 minValue, AZ::u64 maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::Serialize(float& value, const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        if (m_elementIndex >= m_elementCount)
+        {
+            // The value serialized more floats than it was declared to have
+            Invalidate();
+            return false;
+        }
+
+        const uint32_t shift = m_elementIndex * m_bitsPerElement;
+        ++m_elementIndex;
+
+        if (m_serializer.GetSerializerMode() == SerializerMode::ReadFromObject)
+        {
+            m_packedValue |= static_cast<AZ::u64>(Quantize(value)) << shift;
+            if (m_elementIndex == m_elementCount)
+            {
+                // All elements have been gathered, write out the packed value
+                return m_serializer.Serialize(m_packedValue, name, AZ::u64{ 0 }, m_maxPackedValue);
+            }
+            return true;
+        }
+
+        if ((shift == 0) && !m_serializer.Serialize(m_packedValue, name, AZ::u64{ 0 }, m_maxPackedValue))
+        {
+            return false;
+        }
+
+        const float newValue = Dequantize(static_cast<uint32_t>(m_packedValue >> shift) & m_elementMask);
+        m_hasChanged |= (newValue != value);
+        value = newValue;
+        return true;
+    }
+
+    bool QuantizingSerializer::Serialize(double& value, const char* name, double minValue, double maxValue)
+    {
+        return m_serializer.Serialize(value, name, minValue, maxValue);
+    }
+
+    bool QuantizingSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name)
+    {
+        return m_serializer.SerializeBytes(buffer, bufferCapacity, isString, outSize, name);
+    }
+
+    bool QuantizingSerializer::BeginObject(const char* name)
+    {
+        return m_serializer.BeginObject(name);
+    }
+
+    bool QuantizingSerializer::EndObject(const char* name)
+    {
+        return m_serializer.EndObject(name);
+    }
+
+    const uint8_t* QuantizingSerializer::GetBuffer() const
+    {
+        return m_serializer.GetBuffer();
+    }
+
+    uint32_t QuantizingSerializer::GetCapacity() const
+    {
+        return m_serializer.GetCapacity();
+    }
+
+    uint32_t QuantizingSerializer::GetSize() const
+    {
+        return m_serializer.GetSize();
+    }
+
+    void QuantizingSerializer::ClearTrackedChangesFlag()
+    {
+        m_hasChanged = false;
+        m_serializer.ClearTrackedChangesFlag();
+    }
+
+    bool QuantizingSerializer::GetTrackedChangesFlag() const
+    {
+        // Quantized floats are compared after dequantization, the wrapped serializer only ever sees the packed value
+        return m_hasChanged;
+    }
+
+    uint32_t QuantizingSerializer::Quantize(float value) const
+    {
+        // Clamp and round without branching, the clamps compile down to min/max instructions.
+        // The rounded value is clamped again since it can exceed the element mask at maxValue, converting that to uint32_t would be undefined.
+        const float clamped = AZ::GetClamp(value, m_minValue, m_maxValue);
+        const double rounded = (static_cast<double>(clamped) - static_cast<double>(m_minValue)) * m_quantizeScale + 0.5;
+        return static_cast<uint32_t>(AZ::GetMin(rounded, static_cast<double>(m_elementMask)));
+    }
+
+    float QuantizingSerializer::Dequantize(uint32_t value) const
+    {
+        return static_cast<float>(static_cast<double>(m_minValue) + static_cast<double>(value) * m_dequantizeScale);
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Math/Quaternion.h>
+
+namespace AzNetworking
+{
+    //! The number of floating point elements a type serializes, used to size the packed representation of quantized values.
+    template <typename TYPE>
+    struct QuantizedElementCount;
+
+    template <> struct QuantizedElementCount<float> { static constexpr uint32_t Value = 1; };
+    template <> struct QuantizedElementCount<AZ::Vector2> { static constexpr uint32_t Value = 2; };
+    template <> struct QuantizedElementCount<AZ::Vector3> { static constexpr uint32_t Value = 3; };
+    template <> struct QuantizedElementCount<AZ::Vector4> { static constexpr uint32_t Value = 4; };
+    template <> struct QuantizedElementCount<AZ::Quaternion> { static constexpr uint32_t Value = 4; };
+
+    //! @class QuantizingSerializer
+    //! @brief Serializer decorator that quantizes floating point values to a fixed number of bits within a known range.
+    //! All elements of a value are bit-packed into a single bounded integer on the wrapped serializer, so a Vector3 quantized
+    //! to 10 bits per element costs 4 bytes rather than 12. All non floating point values are forwarded unmodified.
+    //! NOTE: The serialized value must always produce exactly elementCount floats
+    class QuantizingSerializer
+        : public ISerializer
+    {
+    public:
+
+        //! Maximum number of bits that can be packed into a single quantized value.
+        static constexpr uint32_t MaxPackedBits = 64;
+
+        //! Constructor.
+        //! @param serializer     the serializer to write the packed value to or read the packed value from
+        //! @param elementCount   the number of floats the serialized value consists of
+        //! @param bitsPerElement the number of bits to quantize each float to
+        //! @param minValue       the minimum value of each element, smaller values are clamped
+        //! @param maxValue       the maximum value of each element, larger values are clamped
+        QuantizingSerializer(ISerializer& serializer, uint32_t elementCount, uint32_t bitsPerElement, float minValue, float maxValue);
+        ~QuantizingSerializer() override = default;
+
+        //! Returns the number of bits actually carrying quantized data.
+        //! @return the number of bits actually carrying quantized data
+        uint32_t GetPackedBitCount() const;
+
+        // ISerializer interfaces
+        using ISerializer::Serialize;
+
+        bool IsValid() const override;
+        SerializerMode GetSerializerMode() const override;
+        bool Serialize(bool& value, const char* name) override;
+        bool Serialize(int8_t& value, const char* name, int8_t minValue, int8_t maxValue) override;
+        bool Serialize(int16_t& value, const char* name, int16_t minValue, int16_t maxValue) override;
+        bool Serialize(int32_t& value, const char* name, int32_t minValue, int32_t maxValue) override;
+        bool Serialize(long& value, const char* name, long minValue, long maxValue) override;
+        bool Serialize(AZ::s64& value, const char* name, AZ::s64 minValue, AZ::s64 maxValue) override;
+        bool Serialize(uint8_t& value, const char* name, uint8_t minValue, uint8_t maxValue) override;
+        bool Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue) override;
+        bool Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue) override;
+        bool Serialize(unsigned long& value, const char* name, unsigned long minValue, unsigned long maxValue) override;
+        bool Serialize(AZ::u64& value, const char* name, AZ::u64 minValue, AZ::u64 maxValue) override;
+        bool Serialize(float& value, const char* name, float minValue, float maxValue) override;
+        bool Serialize(double& value, const char* name, double minValue, double maxValue) override;
+        bool SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name) override;
+        bool BeginObject(const char* name) override;
+        bool EndObject(const char* name) override;
+
+        const uint8_t* GetBuffer() const override;
+        uint32_t GetCapacity() const override;
+        uint32_t GetSize() const override;
+        void ClearTrackedChangesFlag() override;
+        bool GetTrackedChangesFlag() const override;
+        // ISerializer interfaces
+
+    private:
+
+        QuantizingSerializer(const QuantizingSerializer&) = delete;
+        QuantizingSerializer& operator=(const QuantizingSerializer&) = delete;
+
+        uint32_t Quantize(float value) const;
+        float Dequantize(uint32_t value) const;
+
+        ISerializer& m_serializer;
+        AZ::u64 m_packedValue = 0;
+        AZ::u64 m_maxPackedValue = 0;
+        uint32_t m_elementCount = 0;
+        uint32_t m_bitsPerElement = 0;
+        uint32_t m_elementIndex = 0;
+        uint32_t m_elementMask = 0;
+        float m_minValue = 0.0f;
+        float m_maxValue = 0.0f;
+        double m_quantizeScale = 0.0;
+        double m_dequantizeScale = 0.0;
+        bool m_hasChanged = false;
+    };
+}
@@ -14,6 +14,7 @@
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnectionSet.h>
 #include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/Framework/PacketCapture.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -125,6 +126,11 @@ namespace AzNetworking
         GetMetrics().LogPacketRecv(0, startTimeMs);
 
         // Read new data off the input socket
+        // Edge triggered socket managers only signal once per arrival, so keep reading until the socket would block and any
+        // data buffered by the socket itself (decrypted TLS records) has been consumed. Complete packets are dispatched
+        // between reads so the receive buffer always has room for the next block.
+        bool retriedPendingBytes = false;
+        while (m_state != ConnectionState::Disconnected)
         {
             uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
             if (srcData == nullptr)
@@ -137,9 +143,16 @@ namespace AzNetworking
             const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
             if (receivedBytes == 0)
             {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
+                // Data buffered by the socket will not be signalled again, so retry before giving up on it
+                if (!retriedPendingBytes && (m_socket->GetPendingReceiveBytes() > 0))
+                {
+                    retriedPendingBytes = true;
+                    continue;
+                }
+                // No data on the socket, can happen if we're not in select or epoll mode or the socket has been drained
+                break;
             }
+            retriedPendingBytes = false;
 
             const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
             if (disconnectReason != DisconnectReason::MAX)
@@ -150,15 +163,22 @@ namespace AzNetworking
             m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
             m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
             m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
+
+            ProcessReceivedPackets(startTimeMs);
         }
 
-        // Process received packets
+        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+        return true;
+    }
+
+    void TcpConnection::ProcessReceivedPackets(AZ::TimeMs currentTimeMs)
+    {
         for (;;)
         {
             TcpPacketHeader header(PacketType(0), 0);
             TcpPacketEncodingBuffer buffer;
 
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
+            if (!ReceivePacketInternal(header, buffer, currentTimeMs))
             {
                 break;
             }
@@ -179,12 +199,14 @@ namespace AzNetworking
 
             if (m_state == ConnectionState::Connected)
             {
+                if (PacketCaptureWriter* packetCapture = m_networkInterface.GetPacketCapture())
+                {
+                    packetCapture->Record(PacketCaptureDirection::Inbound, ProtocolType::Tcp, GetConnectionId(),
+                        header.GetPacketType(), header.GetPacketId(), buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+                }
                 m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
             }
         }
-
-        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
-        return true;
     }
 
     bool TcpConnection::SendReliablePacket(const IPacket& packet)
@@ -202,6 +224,13 @@ namespace AzNetworking
 
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
         ++m_lastSentPacketId;
+
+        PacketCaptureWriter* packetCapture = m_networkInterface.GetPacketCapture();
+        if (packetCapture && (packet.GetPacketType() >= aznumeric_cast<PacketType>(CorePackets::PacketType::MAX)))
+        {
+            packetCapture->Record(PacketCaptureDirection::Outbound, ProtocolType::Tcp, GetConnectionId(),
+                packet.GetPacketType(), m_lastSentPacketId, buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+        }
         return SendPacketInternal(packet.GetPacketType(), buffer, currentTimeMs);
     }
 
@@ -324,26 +353,65 @@ namespace AzNetworking
         }
 
         const uint16_t headerSize = aznumeric_cast<uint16_t>(headerBuffer.GetSize());
-        uint8_t* dstData = reinterpret_cast<uint8_t*>(m_sendRingbuffer.ReserveBlockForWrite(headerSize + payloadSize));
+        const uint32_t payloadBytes = aznumeric_cast<uint32_t>(payloadSize);
+        const uint32_t packetSize = headerSize + payloadBytes;
 
-        if (dstData == nullptr)
+        // If nothing is queued ahead of this packet, gather the header and payload straight from their encoding buffers
+        // and only copy whatever the socket would not accept into the send ring buffer
+        uint32_t sentBytes = 0;
+        if (!m_socket->IsEncrypted() && (m_sendRingbuffer.GetReadBufferSize() == 0))
         {
-            AZLOG_ERROR("Send ringbuffer full, dropped packet");
-            return false;
-        }
+            const SocketSendSegment segments[] =
+            {
+                { headerBuffer.GetBuffer(), headerSize },
+                { srcData, payloadBytes }
+            };
+            const int32_t result = m_socket->SendSegments(segments, static_cast<uint32_t>(AZ_ARRAY_SIZE(segments)));
+            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(result);
+            if (disconnectReason != DisconnectReason::MAX)
+            {
+                Disconnect(disconnectReason, TerminationEndpoint::Remote);
+                return false;
+            }
 
-        // Copy the header data to the ring buffer
-        {
-            memcpy(dstData, headerBuffer.GetBuffer(), headerSize);
+            sentBytes = (result > 0) ? aznumeric_cast<uint32_t>(result) : 0;
+            m_networkInterface.GetMetrics().m_sendBytes += sentBytes;
+            m_networkInterface.GetMetrics().m_sendBytesUncompressed += sentBytes;
         }
 
-        // Write payload...
+        if (sentBytes < packetSize)
         {
-            memcpy(dstData + headerSize, srcData, payloadSize);
+            const uint32_t queuedSize = packetSize - sentBytes;
+            uint8_t* dstData = reinterpret_cast<uint8_t*>(m_sendRingbuffer.ReserveBlockForWrite(queuedSize));
+
+            if (dstData == nullptr)
+            {
+                AZLOG_ERROR("Send ringbuffer full, dropped packet");
+                if (sentBytes > 0)
+                {
+                    // Part of the packet is already on the wire, dropping the rest would corrupt the stream
+                    Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                }
+                return false;
+            }
+
+            // Copy any unsent header data to the ring buffer
+            if (sentBytes < headerSize)
+            {
+                memcpy(dstData, headerBuffer.GetBuffer() + sentBytes, headerSize - sentBytes);
+                dstData += headerSize - sentBytes;
+            }
+
+            // Copy any unsent payload data to the ring buffer
+            {
+                const uint32_t payloadOffset = (sentBytes > headerSize) ? (sentBytes - headerSize) : 0;
+                memcpy(dstData, srcData + payloadOffset, payloadBytes - payloadOffset);
+            }
+
+            m_sendRingbuffer.AdvanceWriteBuffer(queuedSize);
         }
 
-        m_sendRingbuffer.AdvanceWriteBuffer(headerSize + payloadSize);
-        GetMetrics().LogPacketSent(headerSize + payloadSize, currentTimeMs);
+        GetMetrics().LogPacketSent(packetSize, currentTimeMs);
         m_networkInterface.GetMetrics().m_sendPackets++;
         UpdateSend();
         return true;
@@ -112,6 +112,10 @@ namespace AzNetworking
         //! @return boolean true if the packet was transmitted (NOT AN INDICATION OF DELIVERY)
         bool SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs);
 
+        //! Dispatches every complete packet currently held in the receive ring buffer.
+        //! @param currentTimeMs the current time in milliseconds
+        void ProcessReceivedPackets(AZ::TimeMs currentTimeMs);
+
         //! Receives a packet from the connected connection.
         //! @param outHeader      header of the received packet
         //! @param outBuffer      encoded buffer of the received packet
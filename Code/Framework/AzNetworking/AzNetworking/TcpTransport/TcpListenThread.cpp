@@ -125,7 +125,11 @@ namespace AzNetworking
             {
                 if (listenPort.m_listenSocket.GetSocketFd() == socketFd)
                 {
-                    HandleSocketAccept((void*)&newConnection, connectionLength, listenPort);
+                    // Accept every pending connection, edge triggered socket managers won't signal again until a new one arrives
+                    while (HandleSocketAccept((void*)&newConnection, connectionLength, listenPort))
+                    {
+                        ;
+                    }
                 }
             };
             m_listenPorts.Visit(visitor);
@@ -175,6 +179,10 @@ namespace AzNetworking
         if (newSocketFd <= SocketFd{ 0 })
         {
             const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error)) // No more pending connections
+            {
+                return false;
+            }
             AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
             return false;
         }
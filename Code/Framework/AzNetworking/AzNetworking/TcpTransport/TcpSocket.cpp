@@ -42,6 +42,11 @@ namespace AzNetworking
         return false;
     }
 
+    uint32_t TcpSocket::GetPendingReceiveBytes() const
+    {
+        return 0;
+    }
+
     TcpSocket* TcpSocket::CloneAndTakeOwnership()
     {
         TcpSocket* result = new TcpSocket(m_socketFd);
@@ -96,6 +101,17 @@ namespace AzNetworking
         return SendInternal(data, size);
     }
 
+    int32_t TcpSocket::SendSegments(const SocketSendSegment* segments, uint32_t segmentCount) const
+    {
+        AZ_Assert(segmentCount > 0 && segmentCount <= MaxSocketSendSegments, "Invalid segment count for send");
+        AZ_Assert(segments != nullptr, "NULL segment pointer passed to send");
+        if (!IsOpen())
+        {
+            return SocketOpResultErrorNotOpen;
+        }
+        return SendSegmentsInternal(segments, segmentCount);
+    }
+
     int32_t TcpSocket::Receive(uint8_t* outData, uint32_t size) const
     {
         AZ_Assert(size > 0, "Invalid data size for receive");
@@ -124,6 +140,23 @@ namespace AzNetworking
         return sentBytes;
     }
 
+    int32_t TcpSocket::SendSegmentsInternal(const SocketSendSegment* segments, uint32_t segmentCount) const
+    {
+        const int32_t sentBytes = AzNetworking::SendSegments(m_socketFd, segments, segmentCount);
+
+        if (sentBytes < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+            AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        }
+
+        return sentBytes;
+    }
+
     int32_t TcpSocket::ReceiveInternal(uint8_t* outData, uint32_t size) const
     {
         const int32_t receivedBytes = static_cast<int32_t>(recv(aznumeric_cast<int32_t>(m_socketFd), (char*)outData, (int32_t)size, 0));
@@ -36,6 +36,11 @@ namespace AzNetworking
         //! @return boolean true if this is an encrypted socket, false if not
         virtual bool IsEncrypted() const;
 
+        //! Returns the number of received bytes the socket has buffered itself and that Receive can return without reading
+        //! the underlying socket, such as decrypted TLS data. Socket managers will not signal the socket for these bytes.
+        //! @return number of bytes that can be received without waiting on the underlying socket
+        virtual uint32_t GetPendingReceiveBytes() const;
+
         //! Opens the TCP socket and binds it in listen mode.
         //! @param port the port number to open the TCP socket and begin listening on, 0 will bind to any available port
         //! @return boolean true on success
@@ -69,6 +74,12 @@ namespace AzNetworking
         //! @return number of bytes sent, <= 0 on error
         int32_t Send(const uint8_t* data, uint32_t size) const;
 
+        //! Sends a set of non-contiguous buffers to the connected endpoint as a single contiguous stream.
+        //! @param segments     the buffers to send, in order
+        //! @param segmentCount the number of buffers to send, must not exceed MaxSocketSendSegments
+        //! @return number of bytes sent, <= 0 on error
+        int32_t SendSegments(const SocketSendSegment* segments, uint32_t segmentCount) const;
+
         //! Receives a payload from the TCP socket.
         //! @param outAddress on success, the address of the endpoint that sent the data
         //! @param outData    on success, address to write the received data to
@@ -79,6 +90,7 @@ namespace AzNetworking
     protected:
 
         virtual int32_t SendInternal(const uint8_t* data, uint32_t size) const;
+        virtual int32_t SendSegmentsInternal(const SocketSendSegment* segments, uint32_t segmentCount) const;
         virtual int32_t ReceiveInternal(uint8_t* outData, uint32_t size) const;
 
         bool BindSocketForListenInternal(uint16_t port);
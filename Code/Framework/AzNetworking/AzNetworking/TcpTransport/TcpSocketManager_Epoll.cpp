@@ -36,7 +36,7 @@ namespace AzNetworking
         }
 
         struct epoll_event fdEvents;
-        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLET;
+        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
         fdEvents.data.fd = static_cast<int32_t>(socketFd);
 
         if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_ADD, static_cast<int32_t>(socketFd), &fdEvents) < 0)
@@ -53,17 +53,37 @@ namespace AzNetworking
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
         ClearSocketHelper(socketFd);
+
+        // Closing a socket implicitly removes it from the epoll set, but the descriptor may still be shared or not yet closed
+        if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), nullptr) < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (error != ENOENT && error != EBADF)
+            {
+                AZLOG_ERROR("Call to epoll_ctl to unbind socket failed (%d:%s)", error, GetNetworkErrorDesc(error));
+                return false;
+            }
+        }
         return true;
     }
 
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
+        if (m_socketFds.empty())
+        {
+            // There are no available sockets to process
+            return;
+        }
+
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
         if (numEpollEvents < 0)
         {
             const int32_t error = GetLastNetworkError();
-            AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            if (error != EINTR) // Interrupted by a signal before any events were raised
+            {
+                AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
         }
 
         if (numEpollEvents > 0)
@@ -71,7 +91,10 @@ namespace AzNetworking
             for (int32_t event = 0; event < numEpollEvents; ++event)
             {
                 const SocketFd socketFd = static_cast<SocketFd>(socketEvents[event].data.fd);
-                if (socketEvents[event].events & EPOLLIN)
+
+                // Sockets are registered edge triggered, errors and hangups are surfaced through the read callback so the
+                // subsequent receive reports the failure and tears the connection down
+                if (socketEvents[event].events & (EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP))
                 {
                     readCallback(socketFd);
                 }
@@ -66,6 +66,18 @@ namespace AzNetworking
         return true;
     }
 
+    uint32_t TlsSocket::GetPendingReceiveBytes() const
+    {
+#if AZ_TRAIT_USE_OPENSSL
+        if (m_sslSocket != nullptr)
+        {
+            const int32_t pendingBytes = SSL_pending(m_sslSocket);
+            return (pendingBytes > 0) ? aznumeric_cast<uint32_t>(pendingBytes) : 0;
+        }
+#endif
+        return 0;
+    }
+
     TcpSocket* TlsSocket::CloneAndTakeOwnership()
     {
         TlsSocket* result = new TlsSocket(m_socketFd, m_trustZone);
@@ -197,6 +209,26 @@ namespace AzNetworking
 #endif
     }
 
+    int32_t TlsSocket::SendSegmentsInternal(const SocketSendSegment* segments, uint32_t segmentCount) const
+    {
+        // Every segment has to pass through the SSL record layer, so submit them one at a time
+        int32_t totalSentBytes = 0;
+        for (uint32_t i = 0; i < segmentCount; ++i)
+        {
+            const int32_t sentBytes = SendInternal(segments[i].m_data, segments[i].m_size);
+            if (sentBytes < 0)
+            {
+                return (totalSentBytes > 0) ? totalSentBytes : sentBytes;
+            }
+            totalSentBytes += sentBytes;
+            if (aznumeric_cast<uint32_t>(sentBytes) < segments[i].m_size)
+            {
+                break;
+            }
+        }
+        return totalSentBytes;
+    }
+
     int32_t TlsSocket::ReceiveInternal([[maybe_unused]] uint8_t* outData, [[maybe_unused]] uint32_t size) const
     {
         if (m_sslSocket == nullptr)
@@ -33,6 +33,10 @@ namespace AzNetworking
         //! @return boolean true if this is an encrypted socket, false if not
         bool IsEncrypted() const override;
 
+        //! Returns the number of decrypted bytes SSL has buffered that Receive can return without reading the socket.
+        //! @return number of bytes that can be received without waiting on the underlying socket
+        uint32_t GetPendingReceiveBytes() const override;
+
         //! Creates a new socket instance, transferring all ownership from the current instance to the new instance.
         //! @return new socket instance
         TcpSocket* CloneAndTakeOwnership() override;
@@ -54,6 +58,7 @@ namespace AzNetworking
     protected:
 
         int32_t SendInternal(const uint8_t* data, uint32_t size) const override;
+        int32_t SendSegmentsInternal(const SocketSendSegment* segments, uint32_t segmentCount) const override;
         int32_t ReceiveInternal(uint8_t* outData, uint32_t size) const override;
 
         SSL_CTX* m_sslContext;
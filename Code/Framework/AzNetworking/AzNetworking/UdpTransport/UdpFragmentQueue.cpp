@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
 #include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+#include <AzNetworking/Framework/PacketCapture.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
@@ -164,6 +165,11 @@ namespace AzNetworking
         }
         else
         {
+            if (PacketCaptureWriter* packetCapture = connection->m_networkInterface.GetPacketCapture())
+            {
+                packetCapture->Record(PacketCaptureDirection::Inbound, ProtocolType::Udp, connection->GetConnectionId(),
+                    header.GetPacketType(), header.GetPacketId(), networkSerializer.GetUnreadData(), networkSerializer.GetUnreadSize());
+            }
             handledPacket = connectionListener.OnPacketReceived(connection, header, networkSerializer);
         }
 
@@ -14,6 +14,7 @@
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/Framework/PacketCapture.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -299,6 +300,11 @@ namespace AzNetworking
                 }
                 else
                 {
+                    if (PacketCaptureWriter* packetCapture = GetPacketCapture())
+                    {
+                        packetCapture->Record(PacketCaptureDirection::Inbound, ProtocolType::Udp, connection->GetConnectionId(),
+                            header.GetPacketType(), header.GetPacketId(), packetSerializer.GetUnreadData(), packetSerializer.GetUnreadSize());
+                    }
                     handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
                 }
 
@@ -534,6 +540,7 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
+            const uint32_t payloadOffset = serializer.GetSize();
             if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
             {
                 AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
@@ -541,6 +548,13 @@ namespace AzNetworking
             }
 
             buffer.Resize(serializer.GetSize());
+
+            PacketCaptureWriter* packetCapture = GetPacketCapture();
+            if (packetCapture && (packet.GetPacketType() >= aznumeric_cast<PacketType>(CorePackets::PacketType::MAX)))
+            {
+                packetCapture->Record(PacketCaptureDirection::Outbound, ProtocolType::Udp, connection.GetConnectionId(),
+                    packet.GetPacketType(), localPacketId, buffer.GetBuffer() + payloadOffset, serializer.GetSize() - payloadOffset);
+            }
         }
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
@@ -18,6 +18,7 @@ namespace AzNetworking
         bool SocketLayerShutdown();
         bool SetSocketNonBlocking(SocketFd socketFd);
         void CloseSocket(SocketFd socketFd);
+        int32_t SendSegments(SocketFd socketFd, const SocketSendSegment* segments, uint32_t segmentCount);
         int32_t GetLastNetworkError();
         bool ErrorIsWouldBlock(int32_t errorCode);
         bool ErrorIsForciblyClosed(int32_t errorCode, bool& ignoreError);
@@ -100,6 +101,12 @@ namespace AzNetworking
         Platform::CloseSocket(socketFd);
     }
 
+    int32_t SendSegments(SocketFd socketFd, const SocketSendSegment* segments, uint32_t segmentCount)
+    {
+        AZ_Assert(segmentCount <= MaxSocketSendSegments, "Too many segments passed to a gathered send");
+        return Platform::SendSegments(socketFd, segments, segmentCount);
+    }
+
     int32_t GetLastNetworkError()
     {
         return Platform::GetLastNetworkError();
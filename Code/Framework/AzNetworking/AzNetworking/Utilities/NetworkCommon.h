@@ -36,6 +36,16 @@ namespace AzNetworking
     static const int32_t SocketOpResultErrorNotOpen = -3;
     static const int32_t SocketOpResultErrorNoSsl   = -4;
 
+    //! A contiguous block of data submitted as part of a gathered socket send.
+    struct SocketSendSegment
+    {
+        const uint8_t* m_data = nullptr;
+        uint32_t m_size = 0;
+    };
+
+    //! Maximum number of segments that may be submitted to a single gathered send.
+    static constexpr uint32_t MaxSocketSendSegments = 8;
+
     //! Returns a valid disconnect reason if the provided socket result requires a disconnect.
     DisconnectReason GetDisconnectReasonForSocketResult(int32_t socketResult);
 
@@ -86,6 +96,13 @@ namespace AzNetworking
     //! @param socketFd identifier of socket to close
     void CloseSocket(SocketFd socketFd);
 
+    //! Sends a set of non-contiguous buffers on a connected socket with a single system call, without coalescing them first.
+    //! @param socketFd     identifier of the socket to send on
+    //! @param segments     the buffers to send, in order
+    //! @param segmentCount the number of buffers to send, must not exceed MaxSocketSendSegments
+    //! @return number of bytes sent, < 0 on error
+    int32_t SendSegments(SocketFd socketFd, const SocketSendSegment* segments, uint32_t segmentCount);
+
     //! Returns the global error code from the last performed network operation, value is platform specific.
     //! @return platform specific error result for the last performed network operation
     int32_t GetLastNetworkError();
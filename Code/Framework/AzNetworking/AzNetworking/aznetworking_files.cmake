@@ -45,6 +45,10 @@ set(FILES
     Framework/NetworkingSystemComponent.cpp
     Framework/NetworkingSystemComponent.h
     Framework/NetworkInterfaceMetrics.h
+    Framework/PacketCapture.cpp
+    Framework/PacketCapture.h
+    Framework/PacketReplayDriver.cpp
+    Framework/PacketReplayDriver.h
     PacketLayer/IPacket.h
     PacketLayer/IPacketHeader.h
     Serialization/AbstractValue.h
@@ -61,6 +65,8 @@ set(FILES
     Serialization/NetworkOutputSerializer.cpp
     Serialization/NetworkOutputSerializer.h
     Serialization/NetworkOutputSerializer.inl
+    Serialization/QuantizingSerializer.cpp
+    Serialization/QuantizingSerializer.h
     Serialization/StringifySerializer.cpp
     Serialization/StringifySerializer.h
     Serialization/TrackChangedSerializer.h
@@ -10,6 +10,7 @@
 #include <AzCore/Console/ILogger.h>
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <fcntl.h>
@@ -53,6 +54,21 @@ namespace AzNetworking
             close(int32_t(socketFd));
         }
 
+        int32_t SendSegments(SocketFd socketFd, const SocketSendSegment* segments, uint32_t segmentCount)
+        {
+            struct iovec buffers[MaxSocketSendSegments];
+            for (uint32_t i = 0; i < segmentCount; ++i)
+            {
+                buffers[i].iov_base = const_cast<uint8_t*>(segments[i].m_data);
+                buffers[i].iov_len = segments[i].m_size;
+            }
+
+            struct msghdr message = {};
+            message.msg_iov = buffers;
+            message.msg_iovlen = segmentCount;
+            return static_cast<int32_t>(sendmsg(int32_t(socketFd), &message, 0));
+        }
+
         int32_t GetLastNetworkError()
         {
             return errno;
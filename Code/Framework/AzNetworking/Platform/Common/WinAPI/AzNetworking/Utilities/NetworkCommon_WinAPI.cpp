@@ -58,6 +58,23 @@ namespace AzNetworking
             closesocket(int32_t(socketFd));
         }
 
+        int32_t SendSegments(SocketFd socketFd, const SocketSendSegment* segments, uint32_t segmentCount)
+        {
+            WSABUF buffers[MaxSocketSendSegments];
+            for (uint32_t i = 0; i < segmentCount; ++i)
+            {
+                buffers[i].buf = const_cast<CHAR*>(reinterpret_cast<const CHAR*>(segments[i].m_data));
+                buffers[i].len = segments[i].m_size;
+            }
+
+            DWORD sentBytes = 0;
+            if (WSASend(int32_t(socketFd), buffers, segmentCount, &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            {
+                return SocketOpResultError;
+            }
+            return static_cast<int32_t>(sentBytes);
+        }
+
         int32_t GetLastNetworkError()
         {
             return WSAGetLastError();
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Framework/PacketCapture.h>
+#include <AzNetworking/Framework/PacketReplayDriver.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class TestReplayPacket final
+        : public IPacket
+    {
+    public:
+        PacketType GetPacketType() const override
+        {
+            return PacketType{ 1000 };
+        }
+
+        AZStd::unique_ptr<IPacket> Clone() const override
+        {
+            return AZStd::make_unique<TestReplayPacket>(*this);
+        }
+
+        bool Serialize(ISerializer& serializer) override
+        {
+            return serializer.Serialize(m_value, "Value");
+        }
+
+        uint32_t m_value = 0;
+    };
+
+    class TestReplayConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ++m_connectCount;
+        }
+
+        PacketDispatchResult OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            TestReplayPacket packet;
+            EXPECT_EQ(packetHeader.GetPacketType(), packet.GetPacketType());
+            EXPECT_TRUE(packet.Serialize(serializer));
+            m_receivedSum += packet.m_value;
+            ++m_receivedCount;
+
+            // Echo the packet back, the replay connection should serialize and discard it
+            EXPECT_TRUE(connection->SendReliablePacket(packet));
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ++m_disconnectCount;
+        }
+
+        uint32_t m_connectCount = 0;
+        uint32_t m_disconnectCount = 0;
+        uint32_t m_receivedCount = 0;
+        uint32_t m_receivedSum = 0;
+    };
+
+    class PacketCaptureTests
+        : public LeakDetectionFixture
+    {
+    public:
+
+        void SetUp() override
+        {
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_capturePath = m_tempDirectory.Resolve("test.aznc").Native();
+        }
+
+        void TearDown() override
+        {
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+        }
+
+        void RecordTestPacket(PacketCaptureWriter& writer, PacketCaptureDirection direction, ConnectionId connectionId, uint32_t value)
+        {
+            TestReplayPacket packet;
+            packet.m_value = value;
+
+            PacketEncodingBuffer buffer;
+            NetworkInputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            EXPECT_TRUE(packet.Serialize(serializer));
+            writer.Record(direction, ProtocolType::Udp, connectionId, packet.GetPacketType(), PacketId{ value }, buffer.GetBuffer(), serializer.GetSize());
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::string m_capturePath;
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+    };
+
+    TEST_F(PacketCaptureTests, WriterReaderRoundTrip)
+    {
+        PacketCaptureWriter writer;
+        EXPECT_TRUE(writer.Open(m_capturePath.c_str()));
+        RecordTestPacket(writer, PacketCaptureDirection::Inbound, ConnectionId{ 3 }, 7);
+        RecordTestPacket(writer, PacketCaptureDirection::Outbound, ConnectionId{ 4 }, 9);
+        EXPECT_EQ(writer.GetRecordedPacketCount(), 2);
+        writer.Close();
+        EXPECT_FALSE(writer.IsOpen());
+
+        PacketCaptureReader reader;
+        EXPECT_TRUE(reader.Open(m_capturePath.c_str()));
+
+        CapturedPacket packet;
+        EXPECT_TRUE(reader.ReadNext(packet));
+        EXPECT_EQ(packet.m_direction, PacketCaptureDirection::Inbound);
+        EXPECT_EQ(packet.m_connectionId, ConnectionId{ 3 });
+        EXPECT_EQ(packet.m_packetId, PacketId{ 7 });
+        EXPECT_EQ(packet.m_packetType, PacketType{ 1000 });
+        EXPECT_EQ(packet.m_payload.GetSize(), sizeof(uint32_t));
+
+        const AZ::TimeUs firstTimeUs = packet.m_timeUs;
+        EXPECT_TRUE(reader.ReadNext(packet));
+        EXPECT_EQ(packet.m_direction, PacketCaptureDirection::Outbound);
+        EXPECT_EQ(packet.m_connectionId, ConnectionId{ 4 });
+        EXPECT_GE(packet.m_timeUs, firstTimeUs);
+        EXPECT_FALSE(reader.ReadNext(packet));
+
+        reader.Rewind();
+        EXPECT_TRUE(reader.ReadNext(packet));
+        EXPECT_EQ(packet.m_connectionId, ConnectionId{ 3 });
+    }
+
+    TEST_F(PacketCaptureTests, ReaderRejectsInvalidFile)
+    {
+        PacketCaptureReader reader;
+        EXPECT_FALSE(reader.Open(m_capturePath.c_str()));
+    }
+
+    TEST_F(PacketCaptureTests, ReplayDispatchesInboundPackets)
+    {
+        PacketCaptureWriter writer;
+        EXPECT_TRUE(writer.Open(m_capturePath.c_str()));
+        RecordTestPacket(writer, PacketCaptureDirection::Inbound, ConnectionId{ 1 }, 1);
+        RecordTestPacket(writer, PacketCaptureDirection::Outbound, ConnectionId{ 1 }, 100);
+        RecordTestPacket(writer, PacketCaptureDirection::Inbound, ConnectionId{ 2 }, 2);
+        RecordTestPacket(writer, PacketCaptureDirection::Inbound, ConnectionId{ 1 }, 3);
+        writer.Close();
+
+        TestReplayConnectionListener listener;
+        PacketReplayDriver driver(listener, ConnectionRole::Acceptor);
+        EXPECT_TRUE(driver.Open(m_capturePath.c_str()));
+        EXPECT_FALSE(driver.IsComplete());
+
+        EXPECT_EQ(driver.ReplayUntil(AZ::TimeUs{ AZStd::numeric_limits<int64_t>::max() }), 3);
+        EXPECT_TRUE(driver.IsComplete());
+        EXPECT_EQ(listener.m_connectCount, 2);
+        EXPECT_EQ(listener.m_receivedCount, 3);
+        EXPECT_EQ(listener.m_receivedSum, 6);
+        EXPECT_EQ(driver.GetReplayedPacketCount(), 3);
+        EXPECT_EQ(driver.GetSentBytes(), 3 * sizeof(uint32_t));
+
+        driver.Finish();
+        EXPECT_EQ(listener.m_disconnectCount, 2);
+    }
+}
@@ -244,4 +244,77 @@ namespace UnitTest
         EXPECT_TRUE(applySerializer.BeginObject("CreateSerializer"));
         EXPECT_TRUE(applySerializer.EndObject("CreateSerializer"));
     }
+
+    TEST_F(DeltaSerializerTests, XorDeltaRoundTrip)
+    {
+        AZStd::array<uint8_t, 1024> baseline;
+        AZStd::array<uint8_t, 1200> current;
+        for (uint32_t i = 0; i < baseline.size(); ++i)
+        {
+            baseline[i] = static_cast<uint8_t>(i * 7);
+        }
+        for (uint32_t i = 0; i < current.size(); ++i)
+        {
+            current[i] = (i < baseline.size()) ? baseline[i] : static_cast<uint8_t>(i);
+        }
+        // Sparse changes, including a run longer than the maximum literal length
+        current[3] ^= 0xFF;
+        current[600] ^= 0x01;
+        for (uint32_t i = 700; i < 1000; ++i)
+        {
+            current[i] ^= 0x5A;
+        }
+
+        AZStd::array<uint8_t, 2048> deltaBuffer;
+        uint32_t deltaSize = 0;
+        EXPECT_TRUE(AzNetworking::EncodeXorDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), current.data(),
+            static_cast<uint32_t>(current.size()), deltaBuffer.data(), static_cast<uint32_t>(deltaBuffer.size()), deltaSize));
+
+        AZStd::array<uint8_t, 2048> decodedBuffer;
+        uint32_t decodedSize = 0;
+        EXPECT_TRUE(AzNetworking::DecodeXorDelta(baseline.data(), static_cast<uint32_t>(baseline.size()), deltaBuffer.data(),
+            deltaSize, decodedBuffer.data(), static_cast<uint32_t>(decodedBuffer.size()), decodedSize));
+        EXPECT_EQ(decodedSize, current.size());
+        EXPECT_EQ(memcmp(decodedBuffer.data(), current.data(), current.size()), 0);
+    }
+
+    TEST_F(DeltaSerializerTests, XorDeltaUnchangedIsCompact)
+    {
+        AZStd::array<uint8_t, 1024> buffer;
+        for (uint32_t i = 0; i < buffer.size(); ++i)
+        {
+            buffer[i] = static_cast<uint8_t>(i);
+        }
+
+        AZStd::array<uint8_t, 64> deltaBuffer;
+        uint32_t deltaSize = 0;
+        EXPECT_TRUE(AzNetworking::EncodeXorDelta(buffer.data(), static_cast<uint32_t>(buffer.size()), buffer.data(),
+            static_cast<uint32_t>(buffer.size()), deltaBuffer.data(), static_cast<uint32_t>(deltaBuffer.size()), deltaSize));
+        EXPECT_LT(deltaSize, 16u);
+    }
+
+    TEST_F(DeltaSerializerTests, XorDeltaNoBaseline)
+    {
+        AZStd::array<uint8_t, 32> current;
+        for (uint32_t i = 0; i < current.size(); ++i)
+        {
+            current[i] = static_cast<uint8_t>(i + 1);
+        }
+
+        AZStd::array<uint8_t, 64> deltaBuffer;
+        uint32_t deltaSize = 0;
+        EXPECT_TRUE(AzNetworking::EncodeXorDelta(nullptr, 0, current.data(), static_cast<uint32_t>(current.size()),
+            deltaBuffer.data(), static_cast<uint32_t>(deltaBuffer.size()), deltaSize));
+
+        AZStd::array<uint8_t, 32> decodedBuffer;
+        uint32_t decodedSize = 0;
+        EXPECT_TRUE(AzNetworking::DecodeXorDelta(nullptr, 0, deltaBuffer.data(), deltaSize, decodedBuffer.data(),
+            static_cast<uint32_t>(decodedBuffer.size()), decodedSize));
+        EXPECT_EQ(decodedSize, current.size());
+        EXPECT_EQ(memcmp(decodedBuffer.data(), current.data(), current.size()), 0);
+
+        // Truncated deltas must be rejected
+        EXPECT_FALSE(AzNetworking::DecodeXorDelta(nullptr, 0, deltaBuffer.data(), deltaSize - 1, decodedBuffer.data(),
+            static_cast<uint32_t>(decodedBuffer.size()), decodedSize));
+    }
 }
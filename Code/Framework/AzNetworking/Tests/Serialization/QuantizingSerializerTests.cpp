@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/QuantizingSerializer.h>
+#include <AzNetworking/Serialization/AzContainerSerializers.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class QuantizingSerializerTests : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(QuantizingSerializerTests, PacksVector3)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        AZ::Vector3 inValue(-0.5f, 0.25f, 1.0f);
+        {
+            AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            AzNetworking::QuantizingSerializer quantizingSerializer(inSerializer, AzNetworking::QuantizedElementCount<AZ::Vector3>::Value, 10, -1.0f, 1.0f);
+            EXPECT_TRUE(quantizingSerializer.Serialize(inValue, "Vector"));
+            EXPECT_TRUE(quantizingSerializer.IsValid());
+            EXPECT_EQ(quantizingSerializer.GetPackedBitCount(), 30u);
+            // 30 bits of packed data fit in a single 4 byte bounded value, rather than 12 bytes for 3 full floats
+            EXPECT_EQ(inSerializer.GetSize(), 4u);
+        }
+
+        AZ::Vector3 outValue = AZ::Vector3::CreateZero();
+        {
+            AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), 4);
+            AzNetworking::QuantizingSerializer quantizingSerializer(outSerializer, AzNetworking::QuantizedElementCount<AZ::Vector3>::Value, 10, -1.0f, 1.0f);
+            EXPECT_TRUE(quantizingSerializer.Serialize(outValue, "Vector"));
+            EXPECT_TRUE(quantizingSerializer.IsValid());
+            EXPECT_TRUE(quantizingSerializer.GetTrackedChangesFlag());
+        }
+
+        // Quantization error is bounded by half the step size
+        const float stepSize = 2.0f / 1023.0f;
+        EXPECT_TRUE(outValue.IsClose(inValue, stepSize * 0.5f + AZ::Constants::FloatEpsilon));
+    }
+
+    TEST_F(QuantizingSerializerTests, ClampsOutOfRange)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        float inValue = 100.0f;
+        {
+            AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            AzNetworking::QuantizingSerializer quantizingSerializer(inSerializer, 1, 8, 0.0f, 10.0f);
+            EXPECT_TRUE(quantizingSerializer.Serialize(inValue, "Float"));
+            EXPECT_EQ(inSerializer.GetSize(), 1u);
+        }
+
+        float outValue = 0.0f;
+        AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), 1);
+        AzNetworking::QuantizingSerializer quantizingSerializer(outSerializer, 1, 8, 0.0f, 10.0f);
+        EXPECT_TRUE(quantizingSerializer.Serialize(outValue, "Float"));
+        EXPECT_FLOAT_EQ(outValue, 10.0f);
+    }
+
+    TEST_F(QuantizingSerializerTests, UnchangedValueIsNotTracked)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        float inValue = 0.0f;
+        {
+            AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            AzNetworking::QuantizingSerializer quantizingSerializer(inSerializer, 1, 12, -1.0f, 1.0f);
+            EXPECT_TRUE(quantizingSerializer.Serialize(inValue, "Float"));
+        }
+
+        float outValue = 0.0f;
+        {
+            AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            AzNetworking::QuantizingSerializer quantizingSerializer(outSerializer, 1, 12, -1.0f, 1.0f);
+            EXPECT_TRUE(quantizingSerializer.Serialize(outValue, "Float"));
+        }
+
+        // Apply the dequantized value a second time, it should not register as a change
+        AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::QuantizingSerializer quantizingSerializer(outSerializer, 1, 12, -1.0f, 1.0f);
+        quantizingSerializer.ClearTrackedChangesFlag();
+        EXPECT_TRUE(quantizingSerializer.Serialize(outValue, "Float"));
+        EXPECT_FALSE(quantizingSerializer.GetTrackedChangesFlag());
+    }
+
+    TEST_F(QuantizingSerializerTests, QuantizesMaxValue)
+    {
+        // maxValue maps to the largest element value, including for 32 bit elements where that is UINT32_MAX
+        for (uint32_t bitsPerElement : { 8u, 24u, 32u })
+        {
+            AZStd::array<uint8_t, 64> buffer;
+            float inValue = 1.0f;
+            uint32_t packedSize = 0;
+            {
+                AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+                AzNetworking::QuantizingSerializer quantizingSerializer(inSerializer, 1, bitsPerElement, -1.0f, 1.0f);
+                EXPECT_TRUE(quantizingSerializer.Serialize(inValue, "Float"));
+                EXPECT_TRUE(quantizingSerializer.IsValid());
+                packedSize = inSerializer.GetSize();
+            }
+
+            float outValue = 0.0f;
+            AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), packedSize);
+            AzNetworking::QuantizingSerializer quantizingSerializer(outSerializer, 1, bitsPerElement, -1.0f, 1.0f);
+            EXPECT_TRUE(quantizingSerializer.Serialize(outValue, "Float"));
+            EXPECT_TRUE(quantizingSerializer.IsValid());
+            EXPECT_FLOAT_EQ(outValue, 1.0f);
+        }
+    }
+
+    TEST_F(QuantizingSerializerTests, TooManyElementsInvalidates)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        AZ::Vector3 inValue = AZ::Vector3::CreateZero();
+        AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::QuantizingSerializer quantizingSerializer(inSerializer, 2, 8, -1.0f, 1.0f);
+        EXPECT_FALSE(quantizingSerializer.Serialize(inValue, "Vector"));
+        EXPECT_FALSE(quantizingSerializer.IsValid());
+    }
+}
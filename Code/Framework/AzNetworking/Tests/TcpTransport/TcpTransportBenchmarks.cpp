@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    static constexpr uint16_t ThroughputTestPort = 12346;
+    static constexpr uint32_t PacketsPerIteration = 256;
+
+    class ThroughputTestPacket
+        : public IPacket
+    {
+    public:
+        static constexpr PacketType Type = static_cast<PacketType>(CorePackets::PacketType::MAX);
+
+        PacketType GetPacketType() const override
+        {
+            return Type;
+        }
+
+        AZStd::unique_ptr<IPacket> Clone() const override
+        {
+            return AZStd::make_unique<ThroughputTestPacket>(*this);
+        }
+
+        bool Serialize(ISerializer& serializer) override
+        {
+            return serializer.Serialize(m_payload, "Payload");
+        }
+
+        ByteBuffer<8192> m_payload;
+    };
+
+    class ThroughputConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ;
+        }
+
+        PacketDispatchResult OnPacketReceived([[maybe_unused]] IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            if (packetHeader.GetPacketType() == ThroughputTestPacket::Type)
+            {
+                ThroughputTestPacket packet;
+                if (packet.Serialize(serializer))
+                {
+                    m_receivedBytes += packet.m_payload.GetSize();
+                    ++m_receivedPackets;
+                }
+            }
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ;
+        }
+
+        uint64_t m_receivedBytes = 0;
+        uint64_t m_receivedPackets = 0;
+    };
+
+    //! Measures the rate at which a single loopback TCP connection can move packets from client to server.
+    class TcpThroughputBenchmark
+        : public benchmark::Fixture
+        , public UnitTest::LeakDetectionBase
+    {
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void internalSetUp()
+        {
+            AZ::NameDictionary::Create();
+
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_networkingSystemComponent = AZStd::make_unique<NetworkingSystemComponent>();
+
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            m_serverNetworkInterface = networking->CreateNetworkInterface(m_serverName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, m_serverListener);
+            m_serverNetworkInterface->Listen(ThroughputTestPort);
+            m_clientNetworkInterface = networking->CreateNetworkInterface(m_clientName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, m_clientListener);
+            m_connectionId = m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, ThroughputTestPort));
+
+            constexpr AZ::TimeMs ConnectTimeoutMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            while ((m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == 0) && (AZ::GetElapsedTimeMs() - startTimeMs < ConnectTimeoutMs))
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                m_networkingSystemComponent->OnSystemTick();
+            }
+        }
+
+        void internalTearDown()
+        {
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            networking->DestroyNetworkInterface(m_clientName);
+            networking->DestroyNetworkInterface(m_serverName);
+
+            m_networkingSystemComponent.reset();
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+
+            AZ::NameDictionary::Destroy();
+        }
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<NetworkingSystemComponent> m_networkingSystemComponent;
+
+        AZ::Name m_serverName = AZ::Name(AZStd::string_view("TcpThroughputServer"));
+        AZ::Name m_clientName = AZ::Name(AZStd::string_view("TcpThroughputClient"));
+        ThroughputConnectionListener m_serverListener;
+        ThroughputConnectionListener m_clientListener;
+        INetworkInterface* m_serverNetworkInterface = nullptr;
+        INetworkInterface* m_clientNetworkInterface = nullptr;
+        ConnectionId m_connectionId = InvalidConnectionId;
+    };
+
+    BENCHMARK_DEFINE_F(TcpThroughputBenchmark, SendReliablePackets)(benchmark::State& state)
+    {
+        ThroughputTestPacket packet;
+        packet.m_payload.Resize(aznumeric_cast<AZStd::size_t>(state.range(0)));
+        memset(packet.m_payload.GetBuffer(), 0xA5, packet.m_payload.GetSize());
+
+        uint64_t expectedPackets = m_serverListener.m_receivedPackets;
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (uint32_t i = 0; i < PacketsPerIteration; ++i)
+            {
+                m_clientNetworkInterface->SendReliablePacket(m_connectionId, packet);
+            }
+            expectedPackets += PacketsPerIteration;
+
+            // Pump both endpoints until everything queued this iteration has been delivered
+            while ((m_serverListener.m_receivedPackets < expectedPackets) && (m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() > 0))
+            {
+                m_networkingSystemComponent->OnSystemTick();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PacketsPerIteration);
+        state.SetBytesProcessed(state.iterations() * PacketsPerIteration * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(TcpThroughputBenchmark, SendReliablePackets)
+        ->RangeMultiplier(4)
+        ->Range(64, 4096)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
@@ -6,7 +6,9 @@
  *
  */
 
+#include <AzNetworking/TcpTransport/TcpConnection.h>
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/TcpTransport/TcpSocket.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
@@ -93,6 +95,72 @@ namespace UnitTest
         INetworkInterface* m_serverNetworkInterface;
     };
 
+    //! Records what a TcpConnection writes to its socket, accepting only as many bytes as it is told to
+    struct TestTcpSocketState
+    {
+        AZStd::vector<uint8_t> m_sentData;
+        uint32_t m_segmentAcceptBytes = UINT32_MAX;
+        uint32_t m_sendAcceptBytes = UINT32_MAX;
+    };
+
+    class TestTcpSocket final
+        : public TcpSocket
+    {
+    public:
+        explicit TestTcpSocket(TestTcpSocketState& state)
+            : m_state(state)
+        {
+            // Any positive descriptor makes the socket report itself open, it is never passed to the OS
+            m_socketFd = SocketFd{ AZStd::numeric_limits<int32_t>::max() };
+        }
+
+        ~TestTcpSocket() override
+        {
+            // The descriptor is fake, make sure the base class never closes it
+            m_socketFd = InvalidSocketFd;
+        }
+
+        TcpSocket* CloneAndTakeOwnership() override
+        {
+            TestTcpSocket* result = new TestTcpSocket(m_state);
+            m_socketFd = InvalidSocketFd;
+            return result;
+        }
+
+        void Close() override
+        {
+            m_socketFd = InvalidSocketFd;
+        }
+
+    protected:
+        int32_t SendInternal(const uint8_t* data, uint32_t size) const override
+        {
+            const uint32_t acceptedBytes = AZStd::min(size, m_state.m_sendAcceptBytes);
+            m_state.m_sentData.insert(m_state.m_sentData.end(), data, data + acceptedBytes);
+            return aznumeric_cast<int32_t>(acceptedBytes);
+        }
+
+        int32_t SendSegmentsInternal(const SocketSendSegment* segments, uint32_t segmentCount) const override
+        {
+            uint32_t acceptedBytes = 0;
+            for (uint32_t i = 0; i < segmentCount; ++i)
+            {
+                const uint32_t segmentBytes = AZStd::min(segments[i].m_size, m_state.m_segmentAcceptBytes - acceptedBytes);
+                m_state.m_sentData.insert(m_state.m_sentData.end(), segments[i].m_data, segments[i].m_data + segmentBytes);
+                acceptedBytes += segmentBytes;
+            }
+            return aznumeric_cast<int32_t>(acceptedBytes);
+        }
+
+        int32_t ReceiveInternal([[maybe_unused]] uint8_t* outData, [[maybe_unused]] uint32_t size) const override
+        {
+            return 0;
+        }
+
+    private:
+        TestTcpSocketState& m_state;
+    };
+
     class TcpTransportTests
         : public LeakDetectionFixture
     {
@@ -190,4 +258,42 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(TcpTransportTests, PartialGatheredSendQueuesTheUnsentTail)
+    {
+        TestTcpConnectionListener connectionListener;
+        const AZ::Name interfaceName = AZ::Name(AZStd::string_view("TcpGatheredSend"));
+        INetworkInterface* networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(
+            interfaceName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, connectionListener);
+        ASSERT_NE(networkInterface, nullptr);
+        TcpNetworkInterface& tcpNetworkInterface = static_cast<TcpNetworkInterface&>(*networkInterface);
+
+        // Sends two packets, so the second one is queued behind whatever part of the first the socket did not accept
+        const auto sendPackets = [&tcpNetworkInterface](TestTcpSocketState& state)
+        {
+            TestTcpSocket socket(state);
+            TcpConnection connection(ConnectionId{ 1 }, IpAddress(127, 0, 0, 1, 12345), tcpNetworkInterface, socket);
+            EXPECT_TRUE(connection.SendReliablePacket(CorePackets::HeartbeatPacket(true)));
+            EXPECT_TRUE(connection.SendReliablePacket(CorePackets::HeartbeatPacket(false)));
+            state.m_sendAcceptBytes = UINT32_MAX;
+            connection.UpdateSend();
+        };
+
+        TestTcpSocketState referenceState;
+        sendPackets(referenceState);
+        const AZStd::vector<uint8_t>& expectedData = referenceState.m_sentData;
+        ASSERT_FALSE(expectedData.empty());
+
+        // Cut the gathered send at every offset, including inside the header and before the first byte
+        for (uint32_t acceptedBytes = 0; acceptedBytes < expectedData.size(); ++acceptedBytes)
+        {
+            TestTcpSocketState state;
+            state.m_segmentAcceptBytes = acceptedBytes;
+            state.m_sendAcceptBytes = 0;
+            sendPackets(state);
+            EXPECT_EQ(state.m_sentData, expectedData) << "Gathered send accepted " << acceptedBytes << " bytes";
+        }
+
+        AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(interfaceName);
+    }
 }
@@ -15,12 +15,15 @@ set(FILES
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
     DataStructures/TimeoutQueueTests.cpp
+    Framework/PacketCaptureTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
     Serialization/NetworkInputOutputSerializerTests.cpp
+    Serialization/QuantizingSerializerTests.cpp
     Serialization/StringifySerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     Serialization/TypeValidatingSerializerTests.cpp
+    TcpTransport/TcpTransportBenchmarks.cpp
     TcpTransport/TcpTransportTests.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
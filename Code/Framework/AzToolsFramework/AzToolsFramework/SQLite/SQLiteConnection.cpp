@@ -10,6 +10,7 @@
 
 // note that this includes the 3rd Party sqlite implementation.
 // if we need to add compile switches, we would add them here.
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Casting/numeric_cast.h>
@@ -111,6 +112,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -221,7 +223,8 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            ExecuteTransactionStatement("BEGIN TRANSACTION;", "SAVEPOINT nested_transaction_%d;", m_transactionDepth);
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -231,7 +234,8 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            m_transactionDepth = AZStd::max(m_transactionDepth - 1, 0);
+            ExecuteTransactionStatement("COMMIT TRANSACTION;", "RELEASE SAVEPOINT nested_transaction_%d;", m_transactionDepth);
         }
 
         void Connection::RollbackTransaction()
@@ -241,7 +245,28 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            m_transactionDepth = AZStd::max(m_transactionDepth - 1, 0);
+            // rolling back to a savepoint leaves it open, so it is released as well
+            ExecuteTransactionStatement(
+                "ROLLBACK;", "ROLLBACK TO SAVEPOINT nested_transaction_%d; RELEASE SAVEPOINT nested_transaction_%d;", m_transactionDepth);
+        }
+
+        bool Connection::InTransaction() const
+        {
+            return m_transactionDepth > 0;
+        }
+
+        void Connection::ExecuteTransactionStatement(const char* outermostStatement, const char* nestedStatementFormat, int depth)
+        {
+            if (depth == 0)
+            {
+                sqlite3_exec(m_db, outermostStatement, NULL, NULL, NULL);
+            }
+            else
+            {
+                // the depth is passed twice for statements which name the savepoint twice
+                sqlite3_exec(m_db, AZStd::string::format(nestedStatementFormat, depth, depth).c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::Vacuum()
@@ -54,9 +54,13 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested.  A transaction begun inside another one is a savepoint of the outer
+            //! transaction, so committing it does not commit the outer transaction, and rolling it back only
+            //! undoes what was written since it began.  Nothing is written to disk until the outermost one commits.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
+            bool InTransaction() const;
             // -------------------------------
 
             //! SQLite-specific, compacts the database and cleans up any temporary space allocated.
@@ -94,7 +98,11 @@ namespace AzToolsFramework
             bool DoesTableExist(const char* name);
 
         private:
+            //! Executes a transaction control statement, for the transaction at the given nesting depth
+            void ExecuteTransactionStatement(const char* outermostStatement, const char* nestedStatementFormat, int depth);
+
             sqlite3* m_db;
+            int m_transactionDepth = 0;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
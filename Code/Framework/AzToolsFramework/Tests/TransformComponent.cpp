@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Random.h>
@@ -16,6 +17,7 @@
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/UnitTest/AzToolsFrameworkTestHelpers.h>
@@ -720,6 +722,121 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Fixture provides a root, child and grandchild whose transform components are part of the central transform hierarchy.
+    class TransformComponentInTransformHierarchy
+        : public TransformComponentApplication
+        , public TransformNotificationBus::Handler
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("az_transform_hierarchy true");
+
+            // The hierarchy is owned by the game entity context, provide one if the application didn't start it.
+            if (!AZ::Interface<ITransformHierarchy>::Get())
+            {
+                m_transformHierarchySystem = AZStd::make_unique<TransformHierarchySystem>();
+                m_transformHierarchySystem->Connect();
+            }
+            m_transformHierarchy = AZ::Interface<ITransformHierarchy>::Get();
+
+            m_rootEntity = CreateEntity("Root", Transform::CreateTranslation(Vector3(1.0f, 0.0f, 0.0f)), EntityId());
+            m_childEntity = CreateEntity("Child", Transform::CreateTranslation(Vector3(0.0f, 2.0f, 0.0f)), m_rootEntity->GetId());
+            m_grandChildEntity = CreateEntity("GrandChild", Transform::CreateTranslation(Vector3(0.0f, 0.0f, 3.0f)), m_childEntity->GetId());
+            m_transformHierarchy->ProcessTransformHierarchy();
+
+            TransformNotificationBus::Handler::BusConnect(m_grandChildEntity->GetId());
+        }
+
+        void TearDown() override
+        {
+            TransformNotificationBus::Handler::BusDisconnect();
+
+            for (Entity* entity : { m_grandChildEntity, m_childEntity, m_rootEntity })
+            {
+                entity->Deactivate();
+                delete entity;
+            }
+
+            if (m_transformHierarchySystem)
+            {
+                m_transformHierarchySystem->Disconnect();
+                m_transformHierarchySystem.reset();
+            }
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("az_transform_hierarchy false");
+
+            TransformComponentApplication::TearDown();
+        }
+
+        void OnTransformChanged(const Transform& /*local*/, const Transform& world) override
+        {
+            m_grandChildNotifications++;
+            m_grandChildNotifiedWorldTM = world;
+        }
+
+        Entity* CreateEntity(const char* name, const Transform& localTM, EntityId parentId)
+        {
+            Entity* entity = aznew Entity(name);
+            AZ::TransformConfig config(localTM);
+            config.m_parentId = parentId;
+            config.m_parentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode::MaintainOriginalRelativeTransform;
+            entity->CreateComponent<TransformComponent>()->SetConfiguration(config);
+            entity->Init();
+            entity->Activate();
+            return entity;
+        }
+
+        AZStd::unique_ptr<TransformHierarchySystem> m_transformHierarchySystem;
+        ITransformHierarchy* m_transformHierarchy = nullptr;
+        Entity* m_rootEntity = nullptr;
+        Entity* m_childEntity = nullptr;
+        Entity* m_grandChildEntity = nullptr;
+        int m_grandChildNotifications = 0;
+        Transform m_grandChildNotifiedWorldTM = Transform::CreateIdentity();
+    };
+
+    TEST_F(TransformComponentInTransformHierarchy, MoveRoot_GrandChildWorldTMIsCurrentBeforeHierarchyIsProcessed)
+    {
+        Vector3 grandChildWorldPos = Vector3::CreateZero();
+        TransformBus::EventResult(grandChildWorldPos, m_grandChildEntity->GetId(), &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(grandChildWorldPos, IsClose(Vector3(1.0f, 2.0f, 3.0f)));
+
+        TransformBus::Event(m_rootEntity->GetId(), &TransformBus::Events::SetWorldTranslation, Vector3(5.0f, 0.0f, 0.0f));
+
+        // The move is visible through the TransformBus right away, the notification waits for the batched update.
+        Transform grandChildWorldTM = Transform::CreateIdentity();
+        TransformBus::EventResult(grandChildWorldTM, m_grandChildEntity->GetId(), &TransformBus::Events::GetWorldTM);
+        EXPECT_THAT(grandChildWorldTM.GetTranslation(), IsClose(Vector3(5.0f, 2.0f, 3.0f)));
+        EXPECT_EQ(m_grandChildNotifications, 0);
+
+        m_transformHierarchy->ProcessTransformHierarchy();
+        EXPECT_EQ(m_grandChildNotifications, 1);
+        EXPECT_THAT(m_grandChildNotifiedWorldTM, IsClose(grandChildWorldTM));
+    }
+
+    TEST_F(TransformComponentInTransformHierarchy, SetChildLocalTM_GrandChildWorldTMMatchesComponentsOutsideHierarchy)
+    {
+        const Transform childLocalTM = Transform::CreateFromQuaternionAndTranslation(
+            Quaternion::CreateRotationZ(0.5f), Vector3(0.0f, 4.0f, 0.0f));
+        TransformBus::Event(m_childEntity->GetId(), &TransformBus::Events::SetLocalTM, childLocalTM);
+
+        Transform rootWorldTM = Transform::CreateIdentity();
+        TransformBus::EventResult(rootWorldTM, m_rootEntity->GetId(), &TransformBus::Events::GetWorldTM);
+        Transform grandChildLocalTM = Transform::CreateIdentity();
+        TransformBus::EventResult(grandChildLocalTM, m_grandChildEntity->GetId(), &TransformBus::Events::GetLocalTM);
+        Transform grandChildWorldTM = Transform::CreateIdentity();
+        TransformBus::EventResult(grandChildWorldTM, m_grandChildEntity->GetId(), &TransformBus::Events::GetWorldTM);
+        EXPECT_THAT(grandChildWorldTM, IsClose(rootWorldTM * childLocalTM * grandChildLocalTM));
+
+        // Leaving the hierarchy keeps the world transform
+        m_grandChildEntity->Deactivate();
+        m_grandChildEntity->Activate();
+        TransformBus::EventResult(grandChildWorldTM, m_grandChildEntity->GetId(), &TransformBus::Events::GetWorldTM);
+        EXPECT_THAT(grandChildWorldTM, IsClose(rootWorldTM * childLocalTM * grandChildLocalTM));
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
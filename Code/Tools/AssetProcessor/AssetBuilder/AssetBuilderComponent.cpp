@@ -11,6 +11,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
@@ -54,6 +55,7 @@ static const char* const s_paramDebugProcess = "debug_process"; // Debug mode fo
 static const char* const s_paramPlatformTags = "tags"; // Additional list of tags to add platform tag list.
 static const char* const s_paramPlatform = "platform"; // Platform to use
 static const char* const s_paramRegisterBuilders = "register"; // Indicates the AP is starting up and requesting a list of registered builders
+static const char* const s_paramRemote = "remote"; // Optional, for resident mode on another host than the AP.  Job sources and products are sent over the connection.
 
 // Task modes:
 static const char* const s_taskResident = "resident"; // stays up and running indefinitely, accepting jobs via network connection
@@ -157,6 +159,8 @@ void AssetBuilderComponent::PrintHelp()
     AZ_TracePrintf("Help", "%s - Debug mode for the process job of the specified file.\n", s_paramDebugProcess);
     AZ_TracePrintf("Help", "%s - Additional tags to add to the debug platform for job processing. One tag can be supplied per option\n", s_paramPlatformTags);
     AZ_TracePrintf("Help", "%s - Platform to use for debugging. ex: pc\n", s_paramPlatform);
+    AZ_TracePrintf("Help", "%s - Optional, for resident mode on another host than the AP.  Job sources and products are sent over the connection.\n", s_paramRemote);
+    AZ_TracePrintf("Help", "  The AP must allow remote builders, and -%s, -%s and -%s must be given.  Any UUID can be used as the -%s.\n", s_paramIp, s_paramPort, s_paramId, s_paramId);
 }
 
 bool AssetBuilderComponent::IsInDebugMode(const AzFramework::CommandLine& commandLine)
@@ -221,6 +225,7 @@ bool AssetBuilderComponent::DoHelloPing()
     }
 
     request.m_uuid = AZ::Uuid::CreateString(id.c_str());
+    request.m_transferFiles = m_transferFiles;
 
     AZ_TracePrintf(
         "AssetBuilderComponent", "RunInResidentMode: Pinging asset processor with the builder UUID %s\n",
@@ -289,6 +294,8 @@ bool AssetBuilderComponent::Run()
         }
     }
 
+    m_transferFiles = commandLine->HasSwitch(s_paramRemote);
+
     AZ_TracePrintf("AssetBuilderComponent", "Run: Connecting back to Asset Processor...\n");
     bool connectedToAssetProcessor = ConnectToAssetProcessor();
     //AP connection is required to access the asset catalog
@@ -445,6 +452,12 @@ bool AssetBuilderComponent::RunInResidentMode(bool sendRegistration)
     AzFramework::SocketConnection::GetInstance()->AddMessageHandler(CreateJobsNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::CreateJobsResidentHandler, this, _1, _2, _3, _4));
     AzFramework::SocketConnection::GetInstance()->AddMessageHandler(ProcessJobNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::ProcessJobResidentHandler, this, _1, _2, _3, _4));
 
+    if (m_transferFiles)
+    {
+        // the AP doesn't know about inputs received by an earlier run of this builder, and sends them again
+        AZ::IO::FileIOBase::GetInstance()->DestroyPath(GetTransferFolder().c_str());
+    }
+
     bool result = DoHelloPing() && ((sendRegistration && SendRegisteredBuildersToAp()) || !sendRegistration);
 
     if (result)
@@ -757,6 +770,127 @@ void AssetBuilderComponent::ProcessJob(const AssetBuilderSDK::ProcessJobFunction
     UpdateResultCode(request, outResponse);
 }
 
+AZ::IO::Path AssetBuilderComponent::GetTransferFolder() const
+{
+    return AZ::IO::Path(m_gameCache) / "RemoteBuilder";
+}
+
+void AssetBuilderComponent::ProcessTransferredJob(
+    const AssetBuilderSDK::ProcessJobFunction& job,
+    const AssetBuilder::ProcessJobNetRequest& netRequest,
+    AssetBuilder::ProcessJobNetResponse& netResponse)
+{
+    auto* fileIO = AZ::IO::FileIOBase::GetInstance();
+
+    // The paths of the request are on the host of the AP, so the job runs on copies of its inputs in a local workspace.
+    // Inputs are also kept by hash, since the AP only sends them once.
+    const AZ::IO::Path inputsFolder = GetTransferFolder() / "Inputs";
+    const AZ::IO::Path workspace = GetTransferFolder() / AZStd::string::format("Job-%llu", static_cast<unsigned long long>(netRequest.m_request.m_jobId));
+    const AZ::IO::Path watchFolder = workspace / "Source";
+    const AZ::IO::Path tempDirPath = workspace / "Temp";
+
+    fileIO->DestroyPath(workspace.c_str());
+    fileIO->CreatePath(tempDirPath.c_str());
+    fileIO->CreatePath(inputsFolder.c_str());
+
+    AssetBuilderSDK::ProcessJobResponse& response = netResponse.m_response;
+    response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+
+    AZ::IO::MemoryStream emptyStream(nullptr, 0);
+    const AZ::u64 emptyFileHash = AssetBuilderSDK::GetHashFromIOStream(emptyStream);
+
+    for (const AssetBuilder::TransferredFile& inputFile : netRequest.m_inputFiles)
+    {
+        const AZ::IO::Path inputPath = watchFolder / inputFile.m_relativePath;
+        const AZ::IO::Path cachedInputPath = inputsFolder / AZStd::string::format("%016llx", static_cast<unsigned long long>(inputFile.m_hash));
+
+        // Inputs are reported back as stored once they are kept in the inputs folder, empty ones don't need to be kept
+        if (inputFile.m_hash == emptyFileHash)
+        {
+            if (!inputFile.WriteTo(watchFolder.c_str()))
+            {
+                AZ_Error("AssetBuilder", false, "Failed to write input %s of job for source file %s", inputFile.m_relativePath.c_str(), netRequest.m_request.m_sourceFile.c_str());
+                fileIO->DestroyPath(workspace.c_str());
+                return;
+            }
+            netResponse.m_storedInputHashes.push_back(inputFile.m_hash);
+        }
+        else if (!inputFile.m_contents.empty())
+        {
+            if (!inputFile.WriteTo(watchFolder.c_str()))
+            {
+                AZ_Error("AssetBuilder", false, "Failed to write input %s of job for source file %s", inputFile.m_relativePath.c_str(), netRequest.m_request.m_sourceFile.c_str());
+                fileIO->DestroyPath(workspace.c_str());
+                return;
+            }
+            if (fileIO->Copy(inputPath.c_str(), cachedInputPath.c_str()))
+            {
+                netResponse.m_storedInputHashes.push_back(inputFile.m_hash);
+            }
+        }
+        else if (fileIO->Exists(cachedInputPath.c_str())
+            && fileIO->CreatePath(inputPath.ParentPath().FixedMaxPathString().c_str())
+            && fileIO->Copy(cachedInputPath.c_str(), inputPath.c_str()))
+        {
+            netResponse.m_storedInputHashes.push_back(inputFile.m_hash);
+        }
+        else
+        {
+            // The AP sends the contents again when the hash of an input it didn't send is not reported as stored
+            AZ_Warning("AssetBuilder", false, "Input %s of job for source file %s is missing from the inputs received earlier, requesting it again",
+                inputFile.m_relativePath.c_str(), netRequest.m_request.m_sourceFile.c_str());
+            fileIO->DestroyPath(workspace.c_str());
+            return;
+        }
+    }
+
+    AssetBuilderSDK::ProcessJobRequest request = netRequest.m_request;
+    const AZ::IO::Path originalWatchFolder(request.m_watchFolder);
+    for (AssetBuilderSDK::SourceFileDependency& sourceDependency : request.m_sourceFileDependencyList)
+    {
+        AZ::IO::PathView sourceDependencyPath(sourceDependency.m_sourceFileDependencyPath);
+        if (sourceDependencyPath.IsRelativeTo(originalWatchFolder))
+        {
+            sourceDependency.m_sourceFileDependencyPath = (watchFolder / sourceDependencyPath.LexicallyRelative(originalWatchFolder)).Native();
+        }
+    }
+    request.m_watchFolder = watchFolder.Native();
+    request.m_fullPath = (watchFolder / request.m_sourceFile).Native();
+    request.m_tempDirPath = tempDirPath.Native();
+
+    ProcessJob(job, request, response);
+
+    if (response.m_resultCode == AssetBuilderSDK::ProcessJobResult_Success)
+    {
+        // Send the products back, named relative to the temp folder so the AP can place them in its own
+        for (AssetBuilderSDK::JobProduct& product : response.m_outputProducts)
+        {
+            AZ::IO::Path productPath(product.m_productFileName);
+            if (productPath.IsRelative())
+            {
+                productPath = tempDirPath / productPath;
+            }
+
+            AssetBuilder::TransferredFile& outputFile = netResponse.m_outputFiles.emplace_back();
+            outputFile.m_relativePath = productPath.LexicallyRelative(tempDirPath).StringAsPosix();
+            if (!productPath.IsRelativeTo(tempDirPath) || !outputFile.ReadFrom(productPath.c_str()))
+            {
+                AZ_Error("AssetBuilder", false, "Failed to send product %s to the Asset Processor, products must be in the temp folder of the job",
+                    product.m_productFileName.c_str());
+                response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+                netResponse.m_outputFiles.clear();
+                break;
+            }
+            product.m_productFileName = outputFile.m_relativePath;
+        }
+    }
+
+    if (!response.m_keepTempFolder)
+    {
+        fileIO->DestroyPath(workspace.c_str());
+    }
+}
+
 bool AssetBuilderComponent::RunOneShotTask(const AZStd::string& task)
 {
     AZ_TracePrintf("AssetBuilderComponent", "RunOneShotTask - running one-shot task [%s]\n", task.c_str());
@@ -990,7 +1124,14 @@ void AssetBuilderComponent::JobThread()
                         AZ_Warning("AssetBuilder", false, "Failed to retrieve IToolsAssetCatalog interface, cannot set current platform");
                     }
 
-                    ProcessJob(assetBuilderDescIt->second->m_processJobFunction, netRequest->m_request, netResponse->m_response);
+                    if (netRequest->m_transferFiles)
+                    {
+                        ProcessTransferredJob(assetBuilderDescIt->second->m_processJobFunction, *netRequest, *netResponse);
+                    }
+                    else
+                    {
+                        ProcessJob(assetBuilderDescIt->second->m_processJobFunction, netRequest->m_request, netResponse->m_response);
+                    }
                 }
                 else
                 {
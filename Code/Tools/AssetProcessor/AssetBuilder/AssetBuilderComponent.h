@@ -11,11 +11,13 @@
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzFramework/Network/SocketConnection.h>
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include "AssetBuilderInfo.h"
+#include "AssetBuilderStatic.h"
 
 //! This bus is used to signal to the AssetBuilderComponent to start up and execute while providing a return code
 class BuilderBusTraits
@@ -122,6 +124,16 @@ protected:
 
     void ProcessJob(const AssetBuilderSDK::ProcessJobFunction& job, const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& outResponse);
 
+    //! Runs a job sent by an AP on another host: writes the transferred inputs to a local workspace, runs the job there
+    //! and adds the products to the response
+    void ProcessTransferredJob(
+        const AssetBuilderSDK::ProcessJobFunction& job,
+        const AssetBuilder::ProcessJobNetRequest& netRequest,
+        AssetBuilder::ProcessJobNetResponse& netResponse);
+
+    //! Folder where jobs transferred from the AP run
+    AZ::IO::Path GetTransferFolder() const;
+
     //! If needed looks at collected data and updates the result code from the job accordingly.
     void UpdateResultCode(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const;
 
@@ -159,6 +171,9 @@ protected:
     //! Stored job that is waiting to be picked up for processing by the job thread
     AZStd::unique_ptr<Job> m_queuedJob;
 
+    //! Indicates the builder runs on another host than the AP, and receives job inputs over the connection
+    bool m_transferFiles = false;
+
     AZStd::string m_gameName;
     AZStd::string m_projectPath;
     AZStd::string m_gameCache;
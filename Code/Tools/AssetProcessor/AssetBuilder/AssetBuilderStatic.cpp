@@ -8,12 +8,16 @@
 
 #include <AssetBuilderStatic.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 
 namespace AssetBuilder
 {
     void Reflect(AZ::ReflectContext* context)
     {
         BuilderRegistrationRequest::Reflect(context);
+        TransferredFile::Reflect(context);
 
         BuilderHelloRequest::Reflect(context);
         BuilderHelloResponse::Reflect(context);
@@ -38,7 +42,10 @@ namespace AssetBuilder
         auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
         if (serialize)
         {
-            serialize->Class<BuilderHelloRequest>()->Version(1)->Field("UUID", &BuilderHelloRequest::m_uuid);
+            serialize->Class<BuilderHelloRequest>()
+                ->Version(2)
+                ->Field("UUID", &BuilderHelloRequest::m_uuid)
+                ->Field("TransferFiles", &BuilderHelloRequest::m_transferFiles);
         }
     }
 
@@ -113,7 +120,11 @@ namespace AssetBuilder
         auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
         if (serialize)
         {
-            serialize->Class<ProcessJobNetRequest>()->Version(1)->Field("Request", &ProcessJobNetRequest::m_request);
+            serialize->Class<ProcessJobNetRequest>()
+                ->Version(2)
+                ->Field("Request", &ProcessJobNetRequest::m_request)
+                ->Field("InputFiles", &ProcessJobNetRequest::m_inputFiles)
+                ->Field("TransferFiles", &ProcessJobNetRequest::m_transferFiles);
         }
     }
 
@@ -134,7 +145,11 @@ namespace AssetBuilder
         auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
         if (serialize)
         {
-            serialize->Class<ProcessJobNetResponse>()->Version(1)->Field("Response", &ProcessJobNetResponse::m_response);
+            serialize->Class<ProcessJobNetResponse>()
+                ->Version(2)
+                ->Field("Response", &ProcessJobNetResponse::m_response)
+                ->Field("OutputFiles", &ProcessJobNetResponse::m_outputFiles)
+                ->Field("StoredInputHashes", &ProcessJobNetResponse::m_storedInputHashes);
         }
     }
 
@@ -143,6 +158,65 @@ namespace AssetBuilder
         return ProcessJobNetRequest::MessageType();
     }
 
+    //////////////////////////////////////////////////////////////////////////
+
+    void TransferredFile::Reflect(AZ::ReflectContext* context)
+    {
+        auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<TransferredFile>()
+                ->Version(1)
+                ->Field("RelativePath", &TransferredFile::m_relativePath)
+                ->Field("Hash", &TransferredFile::m_hash)
+                ->Field("Contents", &TransferredFile::m_contents);
+        }
+    }
+
+    bool TransferredFile::ReadFrom(const char* filePath)
+    {
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        AZ::IO::SystemFile::SizeType length = file.Length();
+        m_contents.resize_no_construct(length);
+        if (file.Read(length, m_contents.data()) != length)
+        {
+            m_contents.clear();
+            return false;
+        }
+
+        AZ::IO::MemoryStream contentsStream(m_contents.data(), m_contents.size());
+        m_hash = AssetBuilderSDK::GetHashFromIOStream(contentsStream);
+        return true;
+    }
+
+    bool TransferredFile::WriteTo(const char* folder) const
+    {
+        // the path comes from another process, make sure it can't write outside of the folder
+        const AZ::IO::FixedMaxPath relativePath = AZ::IO::PathView(m_relativePath).LexicallyNormal();
+        if (relativePath.empty() || relativePath.HasRootPath() || relativePath.begin()->Native() == "..")
+        {
+            return false;
+        }
+
+        AZ::IO::Path filePath(folder);
+        filePath /= AZ::IO::PathView(relativePath);
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(
+                filePath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            return false;
+        }
+
+        return file.Write(m_contents.data(), m_contents.size()) == m_contents.size();
+    }
+
     //---------------------------------------------------------------------
     void BuilderRegistration::Reflect(AZ::ReflectContext* context)
     {
@@ -17,6 +17,27 @@ namespace AssetBuilder
 
     void InitializeSerializationContext();
 
+    //! A file sent along with a job, to or from a builder that doesn't share the file system of the AssetProcessor
+    struct TransferredFile
+    {
+        AZ_CLASS_ALLOCATOR(TransferredFile, AZ::OSAllocator);
+        AZ_TYPE_INFO(TransferredFile, "{0C7B409E-CAA5-4081-AFE6-2FF9BF4E8184}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Reads the contents of the file and computes their hash.  Returns false if the file can't be read
+        bool ReadFrom(const char* filePath);
+
+        //! Writes the contents to the relative path under the folder, creating any missing folders
+        bool WriteTo(const char* folder) const;
+
+        //! Relative to the scan folder for job inputs, and to the job temp folder for products
+        AZStd::string m_relativePath;
+        AZ::u64 m_hash = 0;
+        //! Left empty for job inputs the builder has already received with an earlier job
+        AZStd::vector<AZ::u8> m_contents;
+    };
+
     //! BuilderHelloRequest is sent by an AssetBuilder that is attempting to connect to the AssetProcessor to register itself as a worker
     class BuilderHelloRequest : public AzFramework::AssetSystem::BaseAssetProcessorMessage
     {
@@ -31,6 +52,10 @@ namespace AssetBuilder
 
         //! Unique ID assigned to this builder to identify it
         AZ::Uuid m_uuid = AZ::Uuid::CreateNull();
+
+        //! Set by builders running on another host.  The AssetProcessor then sends the job inputs along with each ProcessJob
+        //! request, and the builder sends the products back with the response
+        bool m_transferFiles = false;
     };
 
     //! BuilderHelloResponse contains the AssetProcessor's response to a builder connection attempt, indicating if it is accepted and the ID
@@ -91,6 +116,11 @@ namespace AssetBuilder
         unsigned int GetMessageType() const override;
 
         AssetBuilderSDK::ProcessJobRequest m_request;
+
+        //! The source file and the sources of the job dependencies, when the builder doesn't share the file system of the
+        //! AssetProcessor.  Paths in m_request then refer to the file system of the AssetProcessor
+        AZStd::vector<TransferredFile> m_inputFiles;
+        bool m_transferFiles = false;
     };
 
     class ProcessJobNetResponse : public AzFramework::AssetSystem::BaseAssetProcessorMessage
@@ -104,6 +134,13 @@ namespace AssetBuilder
         unsigned int GetMessageType() const override;
 
         AssetBuilderSDK::ProcessJobResponse m_response;
+
+        //! The products of the job when the request transferred files, product file names are then relative to the job temp folder
+        AZStd::vector<TransferredFile> m_outputFiles;
+
+        //! Hashes of the job inputs the builder keeps, so the AssetProcessor doesn't send their contents again.
+        //! The contents of any other input sent without them are sent again
+        AZStd::vector<AZ::u64> m_storedInputHashes;
     };
 
     //////////////////////////////////////////////////////////////////////////
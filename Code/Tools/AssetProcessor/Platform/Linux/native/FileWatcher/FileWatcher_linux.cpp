@@ -59,6 +59,7 @@
 static constexpr size_t s_inotifyMaxEntries = 1024 * 16;         // Control the maximum number of entries (from inotify) that can be read at one time
 static constexpr size_t s_inotifyEventSize = sizeof(struct inotify_event);
 static constexpr size_t s_inotifyReadBufferSize = s_inotifyMaxEntries * s_inotifyEventSize;
+static constexpr size_t s_maxPendingNotifications = 1024 * 16;   // Notifications are sent at least this often while coalescing a burst of events
 
 bool FileWatcher::PlatformImplementation::Initialize()
 {
@@ -108,6 +109,9 @@ void FileWatcher::PlatformImplementation::Finalize()
     }
     m_handleToFolderMap.clear();
     m_alreadyNotifiedCreate.clear();
+    m_knownFiles.clear();
+    m_pendingNotifications.clear();
+    m_latestPendingNotification.clear();
 }
 
 bool FileWatcher::PlatformImplementation::TryToWatch(const QString &pathStr, int* errnoPtr)
@@ -201,7 +205,7 @@ void FileWatcher::PlatformImplementation::AddWatchFolder(QString folder, bool re
             if (!m_alreadyNotifiedCreate.contains(dirPath))
             {
                 DEBUG_FILEWATCHER("%s rawFileAdded for root AddWatchFolder\n", dirPath.toUtf8().constData());
-                source.rawFileAdded(dirPath, {});
+                QueueNotification(NotificationType::Added, dirPath);
                 m_alreadyNotifiedCreate.insert(dirPath);
             }
         }
@@ -238,28 +242,28 @@ void FileWatcher::PlatformImplementation::AddWatchFolder(QString folder, bool re
         }
     }
 
-    // we only need to check files if we've been asked to notify when they change.
-    if (notifyFiles)
+    // the files are always listed, so that the rescan after an overflow knows which ones were there,
+    // but we only notify about them if we've been asked to.
+    for (const QString& addedDir : dirsAdded)
     {
-        for (const QString& addedDir : dirsAdded)
-        {
-            QFileInfoList filesInDir = QDir(addedDir).entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+        QFileInfoList filesInDir = QDir(addedDir).entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
 
-            for (const QFileInfo& fileInfo : filesInDir)
+        for (const QFileInfo& fileInfo : filesInDir)
+        {
+            QString filePath = fileInfo.absoluteFilePath();
+            if (source.IsExcluded(filePath))
             {
-                QString filePath = fileInfo.absoluteFilePath();
-                if (source.IsExcluded(filePath))
-                {
-                    DEBUG_FILEWATCHER("%s matches an exclusion rule during file traversal.  Not Notifying.\n", filePath.toUtf8().constData());
-                    continue; // do not "see" excluded files at all.
-                }
+                DEBUG_FILEWATCHER("%s matches an exclusion rule during file traversal.  Not Notifying.\n", filePath.toUtf8().constData());
+                continue; // do not "see" excluded files at all.
+            }
 
-                if (!m_alreadyNotifiedCreate.contains(filePath))
-                {
-                    DEBUG_FILEWATCHER("%s rawFileAdded via recursive directory crawl for file\n", filePath.toUtf8().constData());
-                    source.rawFileAdded(filePath, {});
-                    m_alreadyNotifiedCreate.insert(filePath);
-                }
+            AddKnownFile(addedDir, fileInfo.fileName());
+
+            if (notifyFiles && !m_alreadyNotifiedCreate.contains(filePath))
+            {
+                DEBUG_FILEWATCHER("%s rawFileAdded via recursive directory crawl for file\n", filePath.toUtf8().constData());
+                QueueNotification(NotificationType::Added, filePath);
+                m_alreadyNotifiedCreate.insert(filePath);
             }
         }
     }
@@ -272,12 +276,175 @@ void FileWatcher::PlatformImplementation::RemoveWatchFolder(int watchHandle)
         return;
     }
 
-    if (m_handleToFolderMap.remove(watchHandle))
+    auto folderItr = m_handleToFolderMap.find(watchHandle);
+    if (folderItr != m_handleToFolderMap.end())
     {
+        m_knownFiles.remove(folderItr.value());
+        m_handleToFolderMap.erase(folderItr);
         inotify_rm_watch(m_inotifyHandle, watchHandle);
     }
 }
 
+void FileWatcher::PlatformImplementation::AddKnownFile(const QString& folder, const QString& fileName)
+{
+    m_knownFiles[folder].insert(fileName);
+}
+
+void FileWatcher::PlatformImplementation::RemoveKnownFile(const QString& folder, const QString& fileName)
+{
+    auto knownItr = m_knownFiles.find(folder);
+    if (knownItr != m_knownFiles.end())
+    {
+        knownItr.value().remove(fileName);
+    }
+}
+
+void FileWatcher::PlatformImplementation::QueueNotification(NotificationType type, const QString& path)
+{
+    auto latestItr = m_latestPendingNotification.find(path);
+    if (latestItr != m_latestPendingNotification.end())
+    {
+        if (type == NotificationType::Modified && latestItr.value() == NotificationType::Modified)
+        {
+            DEBUG_FILEWATCHER("coalescing modification of %s\n", path.toUtf8().constData());
+            return;
+        }
+        latestItr.value() = type;
+    }
+    else
+    {
+        m_latestPendingNotification.insert(path, type);
+    }
+
+    m_pendingNotifications.push_back({ path, type });
+}
+
+void FileWatcher::PlatformImplementation::FlushNotifications(FileWatcher& source)
+{
+    for (const PendingNotification& notification : m_pendingNotifications)
+    {
+        switch (notification.m_type)
+        {
+        case NotificationType::Added:
+            source.rawFileAdded(notification.m_path, {});
+            break;
+        case NotificationType::Removed:
+            source.rawFileRemoved(notification.m_path, {});
+            break;
+        case NotificationType::Modified:
+            source.rawFileModified(notification.m_path, {});
+            break;
+        }
+    }
+
+    m_pendingNotifications.clear();
+    m_latestPendingNotification.clear();
+}
+
+void FileWatcher::PlatformImplementation::RescanAfterOverflow(const QDateTime& changedSince, FileWatcher& source)
+{
+    AZ_Warning(
+        "FileWatcher", false,
+        "The inotify event queue overflowed, rescanning %i watched folders for changes (try increasing fs.inotify.max_queued_events with sysctl)",
+        static_cast<int>(m_handleToFolderMap.size()));
+
+    // AddWatchFolder and RemoveWatchFolder change the map, so iterate over a copy of it.
+    const QHash<int, QString> watchedFolders = m_handleToFolderMap;
+    QSet<QString> watchedPaths;
+    for (const QString& folder : watchedFolders)
+    {
+        watchedPaths.insert(folder);
+    }
+
+    for (auto folderItr = watchedFolders.begin(); folderItr != watchedFolders.end(); ++folderItr)
+    {
+        const QString& folder = folderItr.value();
+        QFileInfo folderInfo(folder);
+        if (!folderInfo.isDir())
+        {
+            // the folder was deleted or moved away while its events were dropped.
+            DEBUG_FILEWATCHER("overflow rescan: %s is gone\n", folder.toUtf8().constData());
+            m_alreadyNotifiedCreate.remove(folder);
+            QueueNotification(NotificationType::Removed, folder);
+            RemoveWatchFolder(folderItr.key());
+            continue;
+        }
+
+        // subfolders of a non-recursive root are neither watched nor reported, same as for regular events.
+        const auto root = AZStd::find_if(begin(source.m_folderWatchRoots), end(source.m_folderWatchRoots), [&folder](const WatchRoot& watchRoot)
+            {
+                return watchRoot.m_directory == folder;
+            });
+        const bool watchSubfolders = (root == end(source.m_folderWatchRoots)) || root->m_recursive;
+
+        // a folder's modification time changes whenever an entry is added to it, removed or renamed,
+        // so only those folders can contain new subfolders.
+        const bool entriesChanged = folderInfo.lastModified() >= changedSince;
+
+        QDir::Filters filters = QDir::NoDotAndDotDot | QDir::Files;
+        if (entriesChanged && watchSubfolders)
+        {
+            filters |= QDir::Dirs;
+        }
+
+        const QSet<QString> knownFiles = m_knownFiles.value(folder);
+        QSet<QString> currentFiles;
+
+        QFileInfoList entries = QDir(folder).entryInfoList(filters);
+        for (const QFileInfo& entry : entries)
+        {
+            QString entryPath = entry.absoluteFilePath();
+            if (source.IsExcluded(entryPath))
+            {
+                continue;
+            }
+
+            if (entry.isDir())
+            {
+                if (!watchedPaths.contains(entryPath))
+                {
+                    // a folder created while events were dropped - report it and everything in it, like a regular IN_CREATE.
+                    if (!m_alreadyNotifiedCreate.remove(entryPath))
+                    {
+                        QueueNotification(NotificationType::Added, entryPath);
+                    }
+                    AddWatchFolder(entryPath, true, source, true);
+                }
+            }
+            else
+            {
+                currentFiles.insert(entry.fileName());
+                if (!knownFiles.contains(entry.fileName()))
+                {
+                    // a file created or moved in while events were dropped.  Its modification time can be older than
+                    // the overflow (when it was moved, or copied with its timestamps), so it is not checked.
+                    if (!m_alreadyNotifiedCreate.remove(entryPath))
+                    {
+                        QueueNotification(NotificationType::Added, entryPath);
+                    }
+                }
+                else if (entry.lastModified() >= changedSince)
+                {
+                    QueueNotification(NotificationType::Modified, entryPath);
+                }
+            }
+        }
+
+        // the known files that are no longer there were deleted or moved away while events were dropped.
+        for (const QString& knownFile : knownFiles)
+        {
+            const QString filePath = QDir(folder).absoluteFilePath(knownFile);
+            if (!currentFiles.contains(knownFile) && !source.IsExcluded(filePath))
+            {
+                DEBUG_FILEWATCHER("overflow rescan: %s is gone\n", filePath.toUtf8().constData());
+                m_alreadyNotifiedCreate.remove(filePath);
+                QueueNotification(NotificationType::Removed, filePath);
+            }
+        }
+        m_knownFiles.insert(folder, currentFiles);
+    }
+}
+
 bool FileWatcher::PlatformStart()
 {
     // inotify will be used by linux to monitor file changes within directories under the root folder
@@ -321,12 +488,13 @@ void FileWatcher::WatchFolderLoop()
     constexpr const nfds_t nfds = 2;
     struct pollfd fds[nfds];
 
+    // The last time the inotify queue was seen empty.  Any event dropped because the queue overflowed happened after this.
+    QDateTime queueEmptyTime = QDateTime::currentDateTimeUtc();
+
     m_startedSignal = true; // signal that we are no longer going to drop any events.
 
     while (!m_shutdownThreadSignal)
     {
-        memset(eventBuffer, 0, s_inotifyReadBufferSize);
-
         fds[0].fd = m_platformImpl->m_wakeThreadHandle; 
         fds[0].events = POLLIN;
         fds[1].fd = m_platformImpl->m_inotifyHandle; 
@@ -356,6 +524,7 @@ void FileWatcher::WatchFolderLoop()
             
             if (!bytesRead)
             {
+                m_platformImpl->FlushNotifications(*this);
                 continue;
             }
         }
@@ -367,15 +536,22 @@ void FileWatcher::WatchFolderLoop()
 
         cycleCount++;
 
+        bool queueOverflowed = false;
         for (size_t index=0; index<bytesRead;)
         {
             const auto* event = reinterpret_cast<inotify_event*>(&eventBuffer[index]);
 
-            if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE | IN_DELETE_SELF | IN_MOVE_SELF ))
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                DEBUG_FILEWATCHER("notify event is IN_Q_OVERFLOW cycle: %i\n", cycleCount);
+                queueOverflowed = true;
+            }
+            else if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE | IN_DELETE_SELF | IN_MOVE_SELF ))
             {
                 // note that the event->name coming in is relative to the thing being watched.  Since we watch folders,
                 // for the folder itself, this will be blank, for files in it, it will be the file name.
-                QDir watchedDir(m_platformImpl->m_handleToFolderMap[event->wd]);
+                const QString watchedFolder = m_platformImpl->m_handleToFolderMap[event->wd];
+                QDir watchedDir(watchedFolder);
                 const QString pathStr = watchedDir.absoluteFilePath(event->name);
 
                 if (event->mask & (IN_CREATE | IN_MOVED_TO))
@@ -407,7 +583,7 @@ void FileWatcher::WatchFolderLoop()
                                 if (!m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr))
                                 {
                                     DEBUG_FILEWATCHER("sending rawFileAdded(%s) from file monitor cycle: %i \n", pathStr.toUtf8().constData(), cycleCount);
-                                    rawFileAdded(pathStr, {});
+                                    m_platformImpl->QueueNotification(PlatformImplementation::NotificationType::Added, pathStr);
                                 }
 
                                 // when a folder is MOVED, we don't notify for all the files inside that folder, only
@@ -425,10 +601,11 @@ void FileWatcher::WatchFolderLoop()
                     {
                         // if we get here, we're looking at a file create/move.  In that case, we always send the notify.  
                         // note that rawFileAdded will eventually check it for ignore anyway.
+                        m_platformImpl->AddKnownFile(watchedFolder, event->name);
                         if (!m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr))
                         {
                             DEBUG_FILEWATCHER("sending rawFileAdded(%s) from file monitor cycle: %i \n", pathStr.toUtf8().constData(), cycleCount);
-                            rawFileAdded(pathStr, {});
+                            m_platformImpl->QueueNotification(PlatformImplementation::NotificationType::Added, pathStr);
                         }
                         else
                         {
@@ -442,7 +619,8 @@ void FileWatcher::WatchFolderLoop()
                     DEBUG_FILEWATCHER("notify event is IN_DELETE | IN_MOVED_FROM: %s (from '%s' - handle %i) cycle: %i\n", pathStr.toUtf8().constData(), event->name, event->wd, cycleCount);
                     DEBUG_FILEWATCHER("sending rawFileRemoved(%s)\n", pathStr.toUtf8().constData());
                     m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr);
-                    rawFileRemoved(pathStr, {});
+                    m_platformImpl->RemoveKnownFile(watchedFolder, event->name);
+                    m_platformImpl->QueueNotification(PlatformImplementation::NotificationType::Removed, pathStr);
                 }
 
                 if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF))
@@ -461,10 +639,32 @@ void FileWatcher::WatchFolderLoop()
                 {
                     DEBUG_FILEWATCHER("notify event is modify, sending rawFileModified: '%s' (from event-Name '%s') cycle: %i mask 0x%08x\n", pathStr.toUtf8().constData(), event->name, cycleCount, event->mask);
                     m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr);
-                    rawFileModified(pathStr, {});
+                    m_platformImpl->QueueNotification(PlatformImplementation::NotificationType::Modified, pathStr);
                 }
             }
             index += s_inotifyEventSize + event->len;
         }
+
+        if (queueOverflowed)
+        {
+            // allow for the precision of file system timestamps
+            m_platformImpl->RescanAfterOverflow(queueEmptyTime.addSecs(-1), *this);
+        }
+
+        // Bursts of changes, like switching branches, arrive faster than a single read can take them.  Keep reading
+        // while more events are already queued, so that repeated modifications are coalesced over the whole burst,
+        // but send the notifications at least every s_maxPendingNotifications so consumers see progress.
+        const QDateTime pollTime = QDateTime::currentDateTimeUtc();
+        struct pollfd inotifyFd = { m_platformImpl->m_inotifyHandle, POLLIN, 0 };
+        const bool moreEventsQueued = poll(&inotifyFd, 1, 0) > 0 && (inotifyFd.revents & POLLIN);
+        if (!moreEventsQueued)
+        {
+            queueEmptyTime = pollTime;
+        }
+
+        if (!moreEventsQueued || m_platformImpl->m_pendingNotifications.size() >= s_maxPendingNotifications)
+        {
+            m_platformImpl->FlushNotifications(*this);
+        }
     }
 }
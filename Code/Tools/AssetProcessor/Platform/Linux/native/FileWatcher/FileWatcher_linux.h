@@ -9,6 +9,7 @@
 #pragma once
 
 #include <FileWatcher/FileWatcher.h>
+#include <QDateTime>
 #include <QMutex>
 #include <QHash>
 #include <QSet>
@@ -29,6 +30,31 @@ public:
     //! @return Was the watch successful?
     bool TryToWatch(const QString &path, int* errnoPtr = nullptr);
 
+    enum class NotificationType
+    {
+        Added,
+        Removed,
+        Modified
+    };
+
+    //! Queue a notification to be sent by the next FlushNotifications.
+    //! A modification of a file whose latest queued notification is already a modification is dropped,
+    //! since writing a file usually generates one IN_MODIFY per write.
+    void QueueNotification(NotificationType type, const QString& path);
+
+    //! Send all queued notifications, in the order they were queued.
+    void FlushNotifications(FileWatcher& source);
+
+    //! Called when the kernel dropped events because the inotify queue overflowed.
+    //! Rescans the watched folders for anything that changed since the given time, notifies about deleted folders,
+    //! new folders and the files in them, files added to or deleted from the known files of a folder, and files
+    //! modified since then.
+    void RescanAfterOverflow(const QDateTime& changedSince, FileWatcher& source);
+
+    //! Track the files in each watched folder, so that the rescan after an overflow can find the deleted ones.
+    void AddKnownFile(const QString& folder, const QString& fileName);
+    void RemoveKnownFile(const QString& folder, const QString& fileName);
+
     // This handle represents the handle to the entire notify tree.
     // Individual watches will be added to this same handle.
     int                         m_inotifyHandle = -1;
@@ -38,4 +64,15 @@ public:
     
     QHash<int, QString>         m_handleToFolderMap;
     QSet<QString>               m_alreadyNotifiedCreate;
+
+    // The names of the files in each watched folder, by folder path.
+    QHash<QString, QSet<QString>> m_knownFiles;
+
+    struct PendingNotification
+    {
+        QString m_path;
+        NotificationType m_type;
+    };
+    AZStd::vector<PendingNotification> m_pendingNotifications;
+    QHash<QString, NotificationType>    m_latestPendingNotification;
 };
@@ -78,6 +78,8 @@ set(FILES
     native/utilities/ApplicationServer.h
     native/utilities/AssetBuilderInfo.cpp
     native/utilities/AssetBuilderInfo.h
+    native/utilities/AssetReferenceIndex.cpp
+    native/utilities/AssetReferenceIndex.h
     native/utilities/AssetServerHandler.cpp
     native/utilities/AssetServerHandler.h
     native/utilities/AssetUtilEBusHelper.h
@@ -95,6 +97,8 @@ set(FILES
     native/utilities/BuilderManager.inl
     native/utilities/ByteArrayStream.cpp
     native/utilities/ByteArrayStream.h
+    native/utilities/ContentAddressedAssetCache.cpp
+    native/utilities/ContentAddressedAssetCache.h
     native/utilities/IniConfiguration.cpp
     native/utilities/IniConfiguration.h
     native/utilities/JobDiagnosticTracker.cpp
@@ -8,6 +8,7 @@
 
 
 #include "AssetDatabase.h"
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include <AzToolsFramework/SQLite/SQLiteQuery.h>
@@ -577,6 +578,25 @@ namespace AssetProcessor
             SqlParam<AZ::u32>(":typeofdependency"),
             SqlParam<AZ::u32>(":fromAssetId"));
 
+        // inserts InsertProductDependencyBatchSize dependencies with a single statement.  The parameters are bound by position,
+        // 8 per row, which keeps a full batch below SQLite's default limit of 999 parameters per statement.
+        static constexpr size_t InsertProductDependencyBatchSize = 64;
+        static constexpr int InsertProductDependencyParamsPerRow = 8;
+        static const char* INSERT_PRODUCT_DEPENDENCY_BATCH = "AssetProcessor::InsertProductDependencyBatch";
+
+        AZStd::string BuildInsertProductDependencyBatchStatement()
+        {
+            AZStd::string statement =
+                "INSERT INTO ProductDependencies (ProductPK, DependencySourceGuid, DependencySubID, DependencyFlags, Platform, UnresolvedPath, UnresolvedDependencyType, FromAssetId) "
+                "VALUES ";
+            for (size_t row = 0; row < InsertProductDependencyBatchSize; ++row)
+            {
+                statement += (row == 0) ? "(?, ?, ?, ?, ?, ?, ?, ?)" : ", (?, ?, ?, ?, ?, ?, ?, ?)";
+            }
+            statement += ";";
+            return statement;
+        }
+
         static const char* UPDATE_PRODUCT_DEPENDENCY = "AssetProcessor::UpdateProductDependency";
         static const char* UPDATE_PRODUCT_DEPENDENCY_STATEMENT =
             "UPDATE ProductDependencies SET "
@@ -1423,6 +1443,7 @@ namespace AssetProcessor
         m_createStatements.push_back(CREATE_PRODUCT_DEPENDENCY_TABLE);
 
         AddStatement(m_databaseConnection, s_InsertProductDependencyQuery);
+        m_databaseConnection->AddStatement(INSERT_PRODUCT_DEPENDENCY_BATCH, BuildInsertProductDependencyBatchStatement());
         AddStatement(m_databaseConnection, s_UpdateProductDependencyQuery);
         AddStatement(m_databaseConnection, s_DeleteProductDependencyByProductIdQuery);
 
@@ -1540,6 +1561,32 @@ namespace AssetProcessor
         }
     }
 
+    AssetDatabaseConnection::ScopedWriteBatch::ScopedWriteBatch(AssetDatabaseConnection& connection)
+        : m_connection(connection.m_databaseConnection)
+    {
+        if (m_connection)
+        {
+            m_connection->BeginTransaction();
+        }
+    }
+
+    AssetDatabaseConnection::ScopedWriteBatch::~ScopedWriteBatch()
+    {
+        if (m_connection)
+        {
+            m_connection->RollbackTransaction();
+        }
+    }
+
+    void AssetDatabaseConnection::ScopedWriteBatch::Commit()
+    {
+        if (m_connection)
+        {
+            m_connection->CommitTransaction();
+            m_connection = nullptr;
+        }
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
@@ -3239,11 +3286,20 @@ namespace AssetProcessor
             }
         }
 
-        // now insert the new ones since we know there's no collisions:
-
-        for (auto& entry : container)
+        // now insert the new ones since we know there's no collisions.
+        // full batches are inserted with the multi row statement, the remainder one row at a time:
+        size_t entryIndex = 0;
+        for (; entryIndex + InsertProductDependencyBatchSize <= container.size(); entryIndex += InsertProductDependencyBatchSize)
         {
+            if (!InsertProductDependencyBatch(container, entryIndex))
+            {
+                return false;
+            }
+        }
 
+        for (; entryIndex < container.size(); ++entryIndex)
+        {
+            const ProductDependencyDatabaseEntry& entry = container[entryIndex];
             if (!s_InsertProductDependencyQuery.BindAndStep(*m_databaseConnection, entry.m_productPK, entry.m_dependencySourceGuid, entry.m_dependencySubID, entry.m_dependencyFlags.to_ullong(), entry.m_platform.c_str(), entry.m_unresolvedPath.c_str(), entry.m_dependencyType, entry.m_fromAssetId))
             {
                 return false;
@@ -3254,6 +3310,39 @@ namespace AssetProcessor
         return true;
     }
 
+    bool AssetDatabaseConnection::InsertProductDependencyBatch(const ProductDependencyDatabaseEntryContainer& container, size_t firstEntryIndex)
+    {
+        StatementAutoFinalizer autoFinal(*m_databaseConnection, INSERT_PRODUCT_DEPENDENCY_BATCH);
+        Statement* statement = autoFinal.Get();
+        if (!statement)
+        {
+            AZ_Error(LOG_NAME, false, "Could not get the %s statement", INSERT_PRODUCT_DEPENDENCY_BATCH);
+            return false;
+        }
+
+        // the values are bound by reference, the container outlives the statement
+        for (size_t row = 0; row < InsertProductDependencyBatchSize; ++row)
+        {
+            const ProductDependencyDatabaseEntry& entry = container[firstEntryIndex + row];
+            const int firstParamIndex = aznumeric_cast<int>(row) * InsertProductDependencyParamsPerRow + 1;
+            Internal::Bind(statement, firstParamIndex, entry.m_productPK);
+            Internal::Bind(statement, firstParamIndex + 1, entry.m_dependencySourceGuid);
+            Internal::Bind(statement, firstParamIndex + 2, entry.m_dependencySubID);
+            Internal::Bind(statement, firstParamIndex + 3, static_cast<AZ::s64>(entry.m_dependencyFlags.to_ullong()));
+            Internal::Bind(statement, firstParamIndex + 4, entry.m_platform.c_str());
+            Internal::Bind(statement, firstParamIndex + 5, entry.m_unresolvedPath.c_str());
+            Internal::Bind(statement, firstParamIndex + 6, static_cast<AZ::u32>(entry.m_dependencyType));
+            Internal::Bind(statement, firstParamIndex + 7, entry.m_fromAssetId);
+        }
+
+        if (statement->Step() == Statement::SqlError)
+        {
+            AZ_Error(LOG_NAME, false, "Failed to execute the %s statement", INSERT_PRODUCT_DEPENDENCY_BATCH);
+            return false;
+        }
+        return true;
+    }
+
     bool AssetDatabaseConnection::RemoveProductDependencyByProductId(AZ::s64 productID)
     {
         ScopedTransaction transaction(m_databaseConnection);
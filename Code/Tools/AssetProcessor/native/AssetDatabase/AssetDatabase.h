@@ -45,6 +45,23 @@ namespace AssetProcessor
         }
         void VacuumAndAnalyze();
 
+        //! Groups every write made through the connection while it is in scope into a single transaction, instead of
+        //! committing each statement (or each Set/Remove call) on its own.  The writes are visible to this connection
+        //! right away, and to other connections once the batch commits.  Writes are rolled back unless Commit is called.
+        //! Batches can be nested, the outermost one commits the writes of the others.
+        class ScopedWriteBatch
+        {
+        public:
+            explicit ScopedWriteBatch(AssetDatabaseConnection& connection);
+            ~ScopedWriteBatch();
+            void Commit();
+
+            ScopedWriteBatch(const ScopedWriteBatch&) = delete;
+            ScopedWriteBatch& operator=(const ScopedWriteBatch&) = delete;
+        private:
+            AzToolsFramework::SQLite::Connection* m_connection = nullptr;
+        };
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase(bool ignoreFutureAssetDBVersionError) override;
@@ -213,6 +230,7 @@ namespace AssetProcessor
         bool UpdateProductDependencies(AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer& container);
 
         // bulk inserts are lighter weight and don't change the input data.  Note that this also deletes old dependencies for the products mentioned in the container.
+        // The dependencies are inserted with multi row statements, so passing the dependencies of all the products of a job in one call is cheaper than one call per product.
         bool SetProductDependencies(const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer& container);
 
         bool RemoveProductDependencyByProductId(AZ::s64 productID);
@@ -244,6 +262,9 @@ namespace AssetProcessor
         void ExecuteCreateStatements();
 
     private:
+        // inserts one full batch of dependencies from the container, starting at firstEntryIndex
+        bool InsertProductDependencyBatch(const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer& container, size_t firstEntryIndex);
+
         AZStd::vector<AZStd::string> m_createStatements; // contains all statements required to create the tables
     };
 }//namespace EditorFramework
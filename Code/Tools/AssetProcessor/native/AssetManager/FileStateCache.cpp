@@ -66,27 +66,41 @@ namespace AssetProcessor
     bool FileStateCache::GetHash(const QString& absolutePath, FileHash* foundHash)
     {
         AZ_Assert(!m_fileInfoMap.empty(), "FileStateCache::Exists called before cache is initialized!");
-        LockGuardType scopeLock(m_mapMutex);
-        auto fileInfoItr = m_fileInfoMap.find(PathToKey(absolutePath));
-
-        if(fileInfoItr == m_fileInfoMap.end())
+        QString key;
+        AZ::u64 hashGeneration = 0;
         {
-            // No info on this file, return false
-            return false;
-        }
+            LockGuardType scopeLock(m_mapMutex);
+            key = PathToKey(absolutePath);
+            auto fileInfoItr = m_fileInfoMap.find(key);
 
-        auto itr = m_fileHashMap.find(PathToKey(absolutePath));
+            if (fileInfoItr == m_fileInfoMap.end())
+            {
+                // No info on this file, return false
+                return false;
+            }
 
-        if (itr != m_fileHashMap.end())
-        {
-            *foundHash = itr.value();
-            return true;
+            auto itr = m_fileHashMap.find(key);
+
+            if (itr != m_fileHashMap.end())
+            {
+                *foundHash = itr.value();
+                return true;
+            }
+
+            hashGeneration = m_hashGeneration;
         }
 
-        // There's no hash stored yet or its been invalidated, calculate it
+        // There's no hash stored yet or its been invalidated, calculate it.
+        // This is done without holding the lock so that several threads can hash files at the same time.
         *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
 
-        m_fileHashMap[PathToKey(absolutePath)] = *foundHash;
+        LockGuardType scopeLock(m_mapMutex);
+        // If any hash was invalidated in the meantime, this file may have changed while it was being hashed.
+        // The hash is still returned, since it was correct when the file was read, but it isn't cached.
+        if (hashGeneration == m_hashGeneration)
+        {
+            m_fileHashMap[key] = *foundHash;
+        }
         return true;
     }
 
@@ -162,6 +176,7 @@ namespace AssetProcessor
     void FileStateCache::InvalidateHash(const QString& absolutePath)
     {
         m_keyCache = {}; // Clear the key cache, its only really intended to help speedup the startup phase
+        ++m_hashGeneration;
 
         auto fileHashItr = m_fileHashMap.find(PathToKey(absolutePath));
 
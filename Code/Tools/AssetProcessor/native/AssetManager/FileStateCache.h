@@ -145,6 +145,9 @@ namespace AssetProcessor
 
         QHash<QString, FileHash> m_fileHashMap;
 
+        /// Incremented whenever a hash is invalidated, so a hash computed outside the lock is only cached if nothing changed meanwhile
+        AZ::u64 m_hashGeneration = 0;
+
         AZ::Event<FileStateInfo> m_deleteEvent;
 
         /// Cache of input path values to their final, normalized map key format.
@@ -8,6 +8,7 @@
 #include <QStringList>
 #include <QCoreApplication>
 #include <QElapsedTimer>
+#include <QtConcurrent/QtConcurrentMap>
 
 #include <AzCore/Casting/lossy_cast.h>
 
@@ -1221,6 +1222,18 @@ namespace AssetProcessor
             }
         }
 
+        // the records of all the processed jobs are written in a single transaction, which is committed before any of the new
+        // products are announced, so that listeners reading from their own database connection can already see them.
+        AssetDatabaseConnection::ScopedWriteBatch writeBatch(*m_stateData);
+
+        struct ProductNotification
+        {
+            AssetNotificationMessage m_message;
+            QString m_intermediateAssetPath; // empty unless the product is an intermediate asset
+        };
+        AZStd::vector<AZStd::vector<ProductNotification>> productNotifications;
+        productNotifications.reserve(m_assetProcessedList.size());
+
         //process the asset list
         for (AssetProcessedEntry& processedAsset : m_assetProcessedList)
         {
@@ -1228,6 +1241,9 @@ namespace AssetProcessor
             // note that the cache stores products WITH the name of the platform in it so you don't have to do anything
             // to those strings to process them.
 
+            // one entry per processed job, the products' notifications are sent after the write batch commits
+            AZStd::vector<ProductNotification>& jobProductNotifications = productNotifications.emplace_back();
+
             //create/update the source record for this job
             AzToolsFramework::AssetDatabase::SourceDatabaseEntry source;
             auto sourceUuidOutcome = AssetUtilities::GetSourceUuid(processedAsset.m_entry.m_sourceAssetReference);
@@ -1526,12 +1542,18 @@ namespace AssetProcessor
             AZ_Assert(uuidInterface, "Programmer Error - IUuidRequests interface is not available.");
 
             //set the new products
+            // the dependencies of all the products of the job are collected first, so they are written with a single bulk insert
+            AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer jobDependencies;
+            AZStd::vector<AZStd::pair<size_t, size_t>> productDependencyRanges; // [begin, end) of each product's entries in jobDependencies
+            AZStd::vector<AssetBuilderSDK::ProductPathDependencySet> productPathDependencies;
+            productDependencyRanges.reserve(newProducts.size());
+            productPathDependencies.reserve(newProducts.size());
             for (size_t productIdx = 0; productIdx < newProducts.size(); ++productIdx)
             {
                 AZStd::unordered_set<AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry> dependencySet;
 
                 auto& pair = newProducts[productIdx];
-                auto pathDependencies = AZStd::move(pair.second->m_pathDependencies);
+                auto& pathDependencies = productPathDependencies.emplace_back(AZStd::move(pair.second->m_pathDependencies));
 
                 AZStd::vector<AssetBuilderSDK::ProductDependency> resolvedDependencies;
                 m_pathDependencyManager->ResolveDependencies(pathDependencies, resolvedDependencies, job.m_platform, pair.first.m_productName);
@@ -1567,8 +1589,7 @@ namespace AssetProcessor
                 }
 
                 // Add all dependencies to the dependency container
-                AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer dependencyContainer;
-                dependencyContainer.reserve(dependencySet.size());
+                const size_t dependenciesBegin = jobDependencies.size();
 
                 for(auto& entry : dependencySet)
                 {
@@ -1578,17 +1599,24 @@ namespace AssetProcessor
                         entry.m_dependencySourceGuid = canonicalUuid.value();
                     }
 
-                    dependencyContainer.push_back(entry);
+                    jobDependencies.push_back(entry);
                 }
+                productDependencyRanges.emplace_back(dependenciesBegin, jobDependencies.size());
+            }
 
-                // Set the new dependencies
-                if (!m_stateData->SetProductDependencies(dependencyContainer))
-                {
-                    AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to set product dependencies");
-                }
+            // Set the new dependencies
+            if (!m_stateData->SetProductDependencies(jobDependencies))
+            {
+                AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to set product dependencies");
+            }
+
+            jobProductNotifications.reserve(newProducts.size());
+            for (size_t productIdx = 0; productIdx < newProducts.size(); ++productIdx)
+            {
+                auto& pair = newProducts[productIdx];
 
                 // Save any unresolved dependencies
-                m_pathDependencyManager->SaveUnresolvedDependenciesToDatabase(pathDependencies, pair.first, job.m_platform);
+                m_pathDependencyManager->SaveUnresolvedDependenciesToDatabase(productPathDependencies[productIdx], pair.first, job.m_platform);
 
                 // now we need notify everyone about the new products
                 AzToolsFramework::AssetDatabase::ProductDatabaseEntry& newProduct = pair.first;
@@ -1610,27 +1638,45 @@ namespace AssetProcessor
                 message.m_sizeBytes = QFileInfo(fullProductPath).size();
                 message.m_assetId = assetId;
 
-                message.m_dependencies.reserve(dependencySet.size());
+                const auto& [dependenciesBegin, dependenciesEnd] = productDependencyRanges[productIdx];
+                message.m_dependencies.reserve(dependenciesEnd - dependenciesBegin);
 
-                for (const auto& entry : dependencySet)
+                for (size_t dependencyIdx = dependenciesBegin; dependencyIdx < dependenciesEnd; ++dependencyIdx)
                 {
+                    const auto& entry = jobDependencies[dependencyIdx];
                     message.m_dependencies.emplace_back(AZ::Data::AssetId(entry.m_dependencySourceGuid, entry.m_dependencySubID), entry.m_dependencyFlags);
                 }
 
+                ProductNotification& notification = jobProductNotifications.emplace_back();
+                notification.m_message = AZStd::move(message);
 
-                Q_EMIT AssetMessage(message);
+                auto productPath = AssetUtilities::ProductPath::FromDatabasePath(newProduct.m_productName);
+                ProductAssetWrapper wrapper{*pair.second, productPath};
+                if (wrapper.HasIntermediateProduct())
+                {
+                    notification.m_intermediateAssetPath = QString::fromUtf8(productPath.GetIntermediatePath().c_str());
+                }
 
                 AddKnownFoldersRecursivelyForFile(fullProductPath, m_cacheRootDir.absolutePath());
+            }
+        }
 
-                auto productPath = AssetUtilities::ProductPath::FromDatabasePath(pair.first.m_productName);
-                ProductAssetWrapper wrapper{*pair.second, productPath};
+        writeBatch.Commit();
 
-                if (wrapper.HasIntermediateProduct())
+        for (size_t processedIdx = 0; processedIdx < m_assetProcessedList.size(); ++processedIdx)
+        {
+            const AssetProcessedEntry& processedAsset = m_assetProcessedList[processedIdx];
+
+            for (const ProductNotification& notification : productNotifications[processedIdx])
+            {
+                Q_EMIT AssetMessage(notification.m_message);
+
+                if (!notification.m_intermediateAssetPath.isEmpty())
                 {
                     // Now that we've verified that the output doesn't conflict with an existing source
                     // And we've updated the database, trigger processing the output
-                    Q_EMIT IntermediateAssetCreated(QString::fromUtf8(productPath.GetIntermediatePath().c_str()));
-                    AssessFileInternal(QString::fromUtf8(productPath.GetIntermediatePath().c_str()), false);
+                    Q_EMIT IntermediateAssetCreated(notification.m_intermediateAssetPath);
+                    AssessFileInternal(notification.m_intermediateAssetPath, false);
                 }
             }
 
@@ -3433,6 +3479,10 @@ namespace AssetProcessor
             return;
         }
 
+        // files whose modtime changed but which had a hash last time.  CanSkipProcessingFile will
+        // have to hash each of them to find out whether only the timestamp changed.
+        QVector<QString> filesToHash;
+
         // the strategy here is to only warm up the file cache if absolutely everything
         // is okay - the mod time must match last time, the file must exist, the hash must be present
         // and non zero from last time.  If anything at all is not correct, we will not warm the
@@ -3448,27 +3498,28 @@ namespace AssetProcessor
                 if(databaseModTime != 0)
                 {
                     auto thisModTime = aznumeric_cast<decltype(databaseModTime)>(AssetUtilities::AdjustTimestamp(fileInfo.m_modTime));
+                    // does the database know what its hash was last time?
+                    auto hashItr = m_fileHashes.find(fileInfo.m_filePath.toUtf8().constData());
+                    AZ::u64 databaseHashValue = hashItr != m_fileHashes.end() ? hashItr->second : 0;
                     if (thisModTime == databaseModTime)
                     {
                         // the actual modtime of the file has not changed since last and the file still exists.
-                        // does the database know what its hash was last time?
-                        auto hashItr = m_fileHashes.find(fileInfo.m_filePath.toUtf8().constData());
-                        if(hashItr != m_fileHashes.end())
+                        if (databaseHashValue != 0)
                         {
-                            AZ::u64 databaseHashValue = hashItr->second;
-                            if (databaseHashValue != 0)
+                            // we have a valid database hash value and mod time has not changed.
+                            // cache it so that future calls to GetFileHash and the like
+                            // use this cached value.
+                            if (fileStateCache)
                             {
-                                // we have a valid database hash value and mod time has not changed.
-                                // cache it so that future calls to GetFileHash and the like
-                                // use this cached value.
-                                if (fileStateCache)
-                                {
-                                    fileStateCache->WarmUpCache(fileInfo, databaseHashValue);
-                                    continue;
-                                }
+                                fileStateCache->WarmUpCache(fileInfo, databaseHashValue);
+                                continue;
                             }
                         }
                     }
+                    else if (databaseHashValue != 0)
+                    {
+                        filesToHash.push_back(fileInfo.m_filePath);
+                    }
                 }
             }
             // Note that the 'continue' statement above, which happens if all conditions are met
@@ -3478,6 +3529,21 @@ namespace AssetProcessor
             // came from the bulk scan, so we can still warm up the file cache with this info.
             fileStateCache->WarmUpCache(fileInfo);
         }
+
+        if (filesToHash.isEmpty() || !AssetUtilities::ShouldUseFileHashing())
+        {
+            return;
+        }
+
+        // Hashing is bound by reading the files, so hash them all on the thread pool now instead of one at a time
+        // while assessing.  The file state cache keeps the results, which CanSkipProcessingFile then finds there.
+        AssetProcessor::StatsCapture::BeginCaptureStat("PrefetchingFileHashes");
+        QtConcurrent::blockingMap(filesToHash, [fileStateCache](const QString& filePath)
+        {
+            IFileStateRequests::FileHash fileHash = 0;
+            fileStateCache->GetHash(filePath, &fileHash);
+        });
+        AssetProcessor::StatsCapture::EndCaptureStat("PrefetchingFileHashes");
     }
 
     // this means a file is definitely coming from the file scanner, and not the file monitor.
@@ -5517,34 +5583,36 @@ namespace AssetProcessor
                 "\n(This may be a long running operation)\n----------------\n",
                 dbPattern.toUtf8().data());
             // Find all products that match the given pattern.
+            AZStd::vector<MissingDependencyScanner::FileToScan> filesToScan;
             m_stateData->QueryProductLikeProductName(
                 dbPattern.toStdString().c_str(),
                 AssetDatabaseConnection::LikeType::Raw,
                 [&](AzToolsFramework::AssetDatabase::ProductDatabaseEntry& entry)
                 {
+                    MissingDependencyScanner::FileToScan& fileToScan = filesToScan.emplace_back();
+                    fileToScan.m_productPK = entry.m_productID;
+
                     // Get the full path to the asset, so that it can be loaded by the scanner.
-                    AZStd::string fullPath;
                     AzFramework::StringFunc::Path::Join(
                         m_normalizedCacheRootPath.toStdString().c_str(),
                         entry.m_productName.c_str(),
-                        fullPath);
+                        fileToScan.m_fullPath);
 
                     // Get any existing product dependencies available for the product, so
                     // the scanner can cull results based on these existing dependencies.
-                    AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer container;
                     m_stateData->QueryProductDependencyByProductId(
                         entry.m_productID,
                         [&](AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& entry)
                         {
-                            container.emplace_back() = AZStd::move(entry);
+                            fileToScan.m_dependencies.emplace_back() = AZStd::move(entry);
                             return true; // return true to keep iterating over further rows.
                         });
-
-                    // Scan the file to report anything that looks like a missing product dependency.
-                    // Don't queue results on the main thread, so the tickbus won't need to be pumped.
-                    m_missingDependencyScanner.ScanFile(fullPath, maxScanIteration, entry.m_productID, container, m_stateData, false, [](AZStd::string /*relativeDependencyFilePath*/) {});
                     return true;
                 });
+
+            // Scan the files to report anything that looks like a missing product dependency.
+            // Results are not queued on the main thread, so the tickbus won't need to be pumped.
+            m_missingDependencyScanner.ScanFiles(filesToScan, maxScanIteration, m_stateData, "", [](AZStd::string /*relativeDependencyFilePath*/) {});
         }
 
         if (dependencyAdditionalScanFolders.size())
@@ -5568,13 +5636,15 @@ namespace AssetProcessor
                     {
                         continue;
                     }
+                    AZStd::vector<MissingDependencyScanner::FileToScan> filesToScan;
                     for (const AZStd::string& fullFilePath : filesFoundOutcome.GetValue())
                     {
                         char resolvedFilePath[AZ_MAX_PATH_LEN] = { 0 };
                         AZ::IO::FileIOBase::GetInstance()->ResolvePath(fullFilePath.c_str(), resolvedFilePath, AZ_MAX_PATH_LEN);
-                        // Scan the file to report anything that looks like a missing product dependency.
-                        m_missingDependencyScanner.ScanFile(resolvedFilePath, maxScanIteration, m_stateData, dependencyTokenName, false, [](AZStd::string /*relativeDependencyFilePath*/){});
+                        filesToScan.emplace_back().m_fullPath = resolvedFilePath;
                     }
+                    // Scan the files to report anything that looks like a missing product dependency.
+                    m_missingDependencyScanner.ScanFiles(filesToScan, maxScanIteration, m_stateData, dependencyTokenName, [](AZStd::string /*relativeDependencyFilePath*/){});
                 }
 
                 AZ_Printf("AssetProcessor", "Scan complete, time taken ( %f ) millisecs.\n", static_cast<double>(scanFolderTime.elapsed()));
@@ -8,11 +8,33 @@
 #include "native/AssetManager/assetScannerWorker.h"
 #include "native/AssetManager/assetScanner.h"
 #include "native/utilities/PlatformConfiguration.h"
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <QDir>
 #include <QtConcurrent/QtConcurrentFilter>
 
+AZ_CVAR(AZ::u32, ap_scanThreadCount, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of threads used to walk the scan folders. 0 picks a count from the hardware concurrency.");
+
 using namespace AssetProcessor;
 
+namespace
+{
+    AZ::u32 GetScanThreadCount()
+    {
+        // directory walking is bound by the file system more than by the cpu, so more threads stop helping quickly.
+        constexpr AZ::u32 MaxDefaultScanThreadCount = 8;
+        AZ::u32 threadCount = ap_scanThreadCount;
+        if (threadCount == 0)
+        {
+            threadCount = AZStd::min(AZStd::thread::hardware_concurrency(), MaxDefaultScanThreadCount);
+        }
+        return AZStd::max(threadCount, 1u);
+    }
+}
+
 AssetScannerWorker::AssetScannerWorker(PlatformConfiguration* config, QObject* parent)
     : QObject(parent)
     , m_platformConfiguration(config)
@@ -35,11 +57,7 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
-    {
-        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
-    }
+    ScanForSourceFiles();
 
     // we want not to emit any signals until we're finished scanning
     // so that we don't interleave directory tree walking (IO access to the file table)
@@ -72,113 +90,178 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles()
 {
-    if (!m_doScan)
+    CachePaths cachePaths;
+    QDir cacheDir;
+    AssetUtilities::ComputeProjectCacheRoot(cacheDir);
+    cachePaths.m_normalizedCachePath = AssetUtilities::NormalizeDirectoryPath(cacheDir.absolutePath());
+    cachePaths.m_cachePath = cachePaths.m_normalizedCachePath.toUtf8().constData();
+
+    QString intermediateAssetsFolder = QString::fromUtf8(AssetUtilities::GetIntermediateAssetsFolder(cachePaths.m_cachePath).c_str());
+    cachePaths.m_normalizedIntermediateAssetsFolder = AssetUtilities::NormalizeDirectoryPath(intermediateAssetsFolder);
+
+    const int scanFolderCount = m_platformConfiguration->GetScanFolderCount();
+    AZStd::vector<PendingDirectory> pendingDirectories;
+    for (int idx = 0; idx < scanFolderCount; idx++)
     {
-        return;
+        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+        pendingDirectories.push_back({ scanFolderInfo.ScanPath(), idx, scanFolderInfo.RecurseSubFolders() });
     }
 
-    QFileInfoList entries;
+    // Directories of all scan folders go through a single queue, so threads that finish a small scan folder
+    // help with the large ones. Each thread collects its own results per scan folder, which are merged afterwards.
+    const AZ::u32 threadCount = GetScanThreadCount();
+    AZStd::vector<AZStd::vector<ScanResults>> threadResults(threadCount, AZStd::vector<ScanResults>(scanFolderCount));
+    AZStd::mutex pendingMutex;
+    AZStd::condition_variable pendingCondition;
+    AZ::u32 busyThreadCount = 0;
 
-    QDir cacheDir;
-    AssetUtilities::ComputeProjectCacheRoot(cacheDir);
-    QString normalizedCachePath = AssetUtilities::NormalizeDirectoryPath(cacheDir.absolutePath());
-    AZ::IO::Path cachePath(normalizedCachePath.toUtf8().constData());
+    auto scanThread = [&](AZ::u32 threadIndex)
+    {
+        AZStd::vector<ScanResults>& results = threadResults[threadIndex];
+        AZStd::vector<PendingDirectory> subDirectories;
+        AZStd::unique_lock<AZStd::mutex> lock(pendingMutex);
+        while (true)
+        {
+            pendingCondition.wait(lock, [&]() { return !pendingDirectories.empty() || busyThreadCount == 0 || !m_doScan; });
+            if (pendingDirectories.empty() || !m_doScan)
+            {
+                // nothing left to scan and no other thread can add more, or the scan was cancelled
+                break;
+            }
+
+            PendingDirectory directory = AZStd::move(pendingDirectories.back());
+            pendingDirectories.pop_back();
+            ++busyThreadCount;
+            lock.unlock();
+
+            subDirectories.clear();
+            ScanDirectory(directory, cachePaths, results[directory.m_rootScanFolderIndex], subDirectories);
 
-    QString intermediateAssetsFolder = QString::fromUtf8(AssetUtilities::GetIntermediateAssetsFolder(cachePath).c_str());
-    QString normalizedIntermediateAssetsFolder = AssetUtilities::NormalizeDirectoryPath(intermediateAssetsFolder);
+            lock.lock();
+            --busyThreadCount;
+            pendingDirectories.insert(pendingDirectories.end(), subDirectories.begin(), subDirectories.end());
+            pendingCondition.notify_all();
+        }
+    };
 
-    // Implemented non-recursively so that the above functions only have to be called once per scan,
-    // and so that the performance is easy to analyze in a profiler:
-    QList<ScanFolderInfo> pathsToScanQueue;
-    pathsToScanQueue.push_back(scanFolderInfo);
+    AZStd::vector<AZStd::thread> threads;
+    AZStd::thread_desc threadDesc;
+    threadDesc.m_name = "AssetScannerWorker";
+    for (AZ::u32 threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(threadDesc, scanThread, threadIndex);
+    }
+    scanThread(0);
+    for (AZStd::thread& thread : threads)
+    {
+        thread.join();
+    }
 
-    while (!pathsToScanQueue.empty())
+    // merge in scan folder order, so a file reachable from several scan folders keeps the first one, as in a sequential scan.
+    for (int idx = 0; idx < scanFolderCount; idx++)
     {
-        ScanFolderInfo pathToScan = pathsToScanQueue.back();
-        pathsToScanQueue.pop_back();
-        QDir dir(pathToScan.ScanPath());
-        dir.setSorting(QDir::Unsorted);
-        // Only scan sub folders if recurseSubFolders flag is set
-        if (!scanFolderInfo.RecurseSubFolders())
+        for (AZ::u32 threadIndex = 0; threadIndex < threadCount; ++threadIndex)
         {
-            entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+            ScanResults& results = threadResults[threadIndex][idx];
+            m_fileList.unite(results.m_fileList);
+            m_folderList.unite(results.m_folderList);
+            m_excludedList.unite(results.m_excludedList);
         }
-        else
+    }
+}
+
+void AssetScannerWorker::ScanDirectory(
+    const PendingDirectory& directory, const CachePaths& cachePaths, ScanResults& results, AZStd::vector<PendingDirectory>& subDirectories)
+{
+    if (!m_doScan)
+    {
+        return;
+    }
+
+    const ScanFolderInfo& rootScanFolder = m_platformConfiguration->GetScanFolderAt(directory.m_rootScanFolderIndex);
+
+    QDir dir(directory.m_path);
+    dir.setSorting(QDir::Unsorted);
+    QFileInfoList entries;
+    // Only scan sub folders if recurseSubFolders flag is set
+    if (!directory.m_recurseSubFolders)
+    {
+        entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+    }
+    else
+    {
+        entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+    }
+
+    for (const QFileInfo& entry : entries)
+    {
+        if (!m_doScan) // scan was cancelled!
         {
-            entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+            return;
         }
 
-        for (const QFileInfo& entry : entries)
+        QString absPath = entry.absoluteFilePath();
+        const bool isDirectory = entry.isDir();
+        QDateTime modTime = entry.lastModified();
+        AZ::u64 fileSize = isDirectory ? 0 : entry.size();
+        AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
+        QString relPath = absPath.mid(rootScanFolder.ScanPath().length() + 1);
+
+        if (isDirectory)
         {
-            if (!m_doScan) // scan was cancelled!
-            {
-                return;
-            }
+            // in debug, assert that the paths coming from qt directory info iteration is already normalized
+            // allowing us to skip normalization and know that comparisons like "IsInCacheFolder" will actually succed.
+            Q_ASSERT(absPath == AssetUtilities::NormalizeDirectoryPath(absPath));
+            // Filtering out excluded directories immediately (not in a thread pool) since that prevents us from recursing.
 
-            QString absPath = entry.absoluteFilePath();
-            const bool isDirectory = entry.isDir();
-            QDateTime modTime = entry.lastModified();
-            AZ::u64 fileSize = isDirectory ? 0 : entry.size();
-            AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
-            QString relPath = absPath.mid(rootScanFolder.ScanPath().length() + 1);
+            // we already know the root scan folder, and can thus chop that part off and call the cheaper IsFileExcludedRelPath:
 
-            if (isDirectory)
+            if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
             {
-                // in debug, assert that the paths coming from qt directory info iteration is already normalized
-                // allowing us to skip normalization and know that comparisons like "IsInCacheFolder" will actually succed.
-                Q_ASSERT(absPath == AssetUtilities::NormalizeDirectoryPath(absPath));
-                // Filtering out excluded directories immediately (not in a thread pool) since that prevents us from recursing.
-
-                // we already know the root scan folder, and can thus chop that part off and call the cheaper IsFileExcludedRelPath:
-
-                if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
-                {
-                    m_excludedList.insert(AZStd::move(assetFileInfo));
-                    continue;
-                }
+                results.m_excludedList.insert(AZStd::move(assetFileInfo));
+                continue;
+            }
 
-                // Entry is a directory
-                // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
-                m_folderList.insert(AZStd::move(assetFileInfo));
+            // Entry is a directory
+            // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
+            results.m_folderList.insert(AZStd::move(assetFileInfo));
 
-                // recurse into this folder.
-                // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
+            // recurse into this folder.
+            // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
 
-                if (absPath.startsWith(normalizedCachePath))
+            if (absPath.startsWith(cachePaths.m_normalizedCachePath))
+            {
+                // its in the cache.  Is it the cache itself?
+                if (absPath.length() != cachePaths.m_normalizedCachePath.length())
                 {
-                    // its in the cache.  Is it the cache itself?
-                    if (absPath.length() != normalizedCachePath.length())
+                    // no.  Is it in the intermediateassets?
+                    if (!absPath.startsWith(cachePaths.m_normalizedIntermediateAssetsFolder))
                     {
-                        // no.  Is it in the intermediateassets?
-                        if (!absPath.startsWith(normalizedIntermediateAssetsFolder))
-                        {
-                            // Its not something in the intermediate assets folder, nor is it the cache itself,
-                            // so it is just a file somewhere in the cache.
-                            continue; // do not recurse.
-                        }
+                        // Its not something in the intermediate assets folder, nor is it the cache itself,
+                        // so it is just a file somewhere in the cache.
+                        continue; // do not recurse.
                     }
                 }
-                // then we can recurse.  Otherwise, its a non-intermediate-assets-folder
-                ScanFolderInfo tempScanFolderInfo(absPath, "", "", false, true);
-                pathsToScanQueue.push_back(tempScanFolderInfo);
             }
-            else
-            {
-                // Entry is a file
-                Q_ASSERT(absPath == AssetUtilities::NormalizeFilePath(absPath));
+            // then we can recurse.  Otherwise, its a non-intermediate-assets-folder
+            subDirectories.push_back({ absPath, directory.m_rootScanFolderIndex, true });
+        }
+        else
+        {
+            // Entry is a file
+            Q_ASSERT(absPath == AssetUtilities::NormalizeFilePath(absPath));
 
-                if (!AssetUtilities::IsInCacheFolder(absPath.toUtf8().constData(), cachePath)) // Ignore files in the cache
+            if (!AssetUtilities::IsInCacheFolder(absPath.toUtf8().constData(), cachePaths.m_cachePath)) // Ignore files in the cache
+            {
+                if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
                 {
-                    if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
-                    {
-                        m_fileList.insert(AZStd::move(assetFileInfo));
-                    }
-                    else
-                    {
-                        m_excludedList.insert(AZStd::move(assetFileInfo));
-                    }
+                    results.m_fileList.insert(AZStd::move(assetFileInfo));
+                }
+                else
+                {
+                    results.m_excludedList.insert(AZStd::move(assetFileInfo));
                 }
             }
         }
@@ -11,6 +11,9 @@
 #if !defined(Q_MOC_RUN)
 #include "native/assetprocessor.h"
 #include "assetScanFolderInfo.h"
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <QString>
 #include <QSet>
 #include <QObject>
@@ -43,13 +46,38 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        // a directory waiting to be listed, and the index of the scan folder it was found in
+        struct PendingDirectory
+        {
+            QString m_path;
+            int m_rootScanFolderIndex = 0;
+            bool m_recurseSubFolders = true;
+        };
+
+        // everything found in a single root scan folder
+        struct ScanResults
+        {
+            QSet<AssetFileInfo> m_fileList;
+            QSet<AssetFileInfo> m_folderList;
+            QSet<AssetFileInfo> m_excludedList;
+        };
+
+        // cache locations, computed once per scan
+        struct CachePaths
+        {
+            QString m_normalizedCachePath;
+            QString m_normalizedIntermediateAssetsFolder;
+            AZ::IO::Path m_cachePath;
+        };
+
+        // walks every scan folder, spreading the directories of all scan folders across the scan threads.
+        void ScanForSourceFiles();
+        // lists a single directory into results, and appends the sub folders to recurse into to subDirectories.
+        void ScanDirectory(const PendingDirectory& directory, const CachePaths& cachePaths, ScanResults& results, AZStd::vector<PendingDirectory>& subDirectories);
         void EmitFiles();
 
     private:
-        volatile bool m_doScan = true;
+        AZStd::atomic_bool m_doScan{ true };
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
@@ -19,6 +19,11 @@
 #include <QObject>
 #endif
 
+namespace FileWatcherTests
+{
+    class FileWatcherPlatformUnitTest;
+}
+
 //////////////////////////////////////////////////////////////////////////
 //! FileWatcher
 /*! Class that handles creation and deletion of FolderRootWatches based on
@@ -57,6 +62,7 @@ private:
 
     class PlatformImplementation;
     friend class PlatformImplementation;
+    friend class FileWatcherTests::FileWatcherPlatformUnitTest;
     struct WatchRoot
     {
         QString m_directory;
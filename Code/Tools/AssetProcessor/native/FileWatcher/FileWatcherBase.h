@@ -40,6 +40,11 @@ namespace AssetBuilderSDK
 *   treats file modify differently, and in some cases, creating a file modifies its metadata (security attributes, size, ...) and that
 *   counts as a modify.  likewise, touching the data of a file counts as multiple things being modified (size, content, attributes,
 *   modification time) and the OS may issue each of those as separate modify events, with no way to tell them apart.
+*   Implementations may also coalesce repeated modify events for the same file.
+* - if the OS drops events because too many happened at once, the implementation rescans the watched folders instead and
+*   reports the files added, modified and deleted meanwhile.  Several changes to the same file are then reported as one,
+*   so a file that was deleted and re-created may be reported as fileModified only, and a file that was created and deleted
+*   again is not reported at all.
  * */
 class FileWatcherBase : public QObject
 {
@@ -38,6 +38,7 @@ namespace AssetProcessor
     constexpr const char* AutoFailReasonKey = "failreason"; // the key to look in for auto-fail reason.
     constexpr const char* AutoFailLogFile = "faillogfile"; // if this is provided, this is a complete log of the failure and will be added after the failreason.
     constexpr const char* AutoFailOmitFromDatabaseKey = "failreason_omitFromDatabase"; // if set in your job info hash, your job will not be tracked by the database.
+    constexpr const char* TransferredInputFilesKey = "transferredinputfiles"; // the files, one per line, sent along with a job to builders on other hosts.  Removed before the job is sent to a builder.
     const unsigned int g_RetriesForFenceFile = 5; // number of retries for fencing
     constexpr int RetriesForJobLostConnection = ASSETPROCESSOR_TRAIT_ASSET_BUILDER_LOST_CONNECTION_RETRIES; // number of times to retry a job when a network error due to network issues or a crashed AssetBuilder process is determined to have caused a job failure
     [[maybe_unused]] constexpr const char* IntermediateAssetsFolderName = "Intermediate Assets"; // name of the intermediate assets folder
@@ -7,10 +7,35 @@
  */
 #include <native/resourcecompiler/RCQueueSortModel.h>
 #include <native/AssetDatabase/AssetDatabase.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include "rcjoblistmodel.h"
 
 namespace AssetProcessor
 {
+    namespace
+    {
+        // expected duration of jobs that never ran, when there is no history at all
+        constexpr AZ::s64 DefaultJobDurationMs = 1000;
+        // computing the critical paths visits every queued job, so it is not done every time a job is added
+        constexpr qint64 CriticalPathUpdateIntervalMs = 1000;
+
+        bool IsOrderDependency(const JobDependencyInternal& jobDependencyInternal)
+        {
+            return jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly;
+        }
+
+        QueueElementID GetDependencyElementID(const AssetBuilderSDK::JobDependency& jobDependency)
+        {
+            return QueueElementID(
+                SourceAssetReference(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
+                jobDependency.m_platformIdentifier.c_str(),
+                jobDependency.m_jobKey.c_str());
+        }
+    }
+
     RCQueueSortModel::RCQueueSortModel(QObject* parent)
         : QSortFilterProxyModel(parent)
     {
@@ -35,11 +60,21 @@ namespace AssetProcessor
             BusDisconnect();
             setSourceModel(nullptr);
             m_sourceModel = nullptr;
+            m_criticalPathDurations.clear();
+            m_criticalPathTimer.invalidate();
         }
     }
 
-    RCJob* RCQueueSortModel::GetNextPendingJob()
+    RCJob* RCQueueSortModel::GetNextPendingJob(const AZStd::function<bool(const RCJob*)>& canStartJob)
     {
+        if (m_criticalPathsDirty && (!m_criticalPathTimer.isValid() || m_criticalPathTimer.elapsed() >= CriticalPathUpdateIntervalMs))
+        {
+            UpdateCriticalPaths();
+            m_criticalPathTimer.start();
+            m_criticalPathsDirty = false;
+            m_dirtyNeedsResort = true;
+        }
+
         if (m_dirtyNeedsResort)
         {
             setDynamicSortFilter(false);
@@ -93,19 +128,14 @@ namespace AssetProcessor
                 bool canProcessJob = true;
                 for (const JobDependencyInternal& jobDependencyInternal : actualJob->GetJobDependencies())
                 {
-                    if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
-                        jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
-                        jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly)
+                    if (IsOrderDependency(jobDependencyInternal))
                     {
                         const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
                         AZ_Assert(
                             AZ::IO::PathView(jobDependency.m_sourceFile.m_sourceFileDependencyPath).IsAbsolute(),
                             "Dependency path %s is not an absolute path",
                             jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str());
-                        QueueElementID elementId(
-                            SourceAssetReference(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
-                            jobDependency.m_platformIdentifier.c_str(),
-                            jobDependency.m_jobKey.c_str());
+                        QueueElementID elementId = GetDependencyElementID(jobDependency);
 
                         if (m_sourceModel->isInFlight(elementId) || m_sourceModel->isInQueue(elementId))
                         {
@@ -123,7 +153,7 @@ namespace AssetProcessor
                     }
                 }
 
-                if (canProcessJob)
+                if (canProcessJob && (!canStartJob || canStartJob(actualJob)))
                 {
                     return actualJob;
                 }
@@ -273,6 +303,14 @@ namespace AssetProcessor
             return priorityLeft > priorityRight;
         }
 
+        AZ::s64 criticalPathLeft = GetCriticalPathDuration(leftJob);
+        AZ::s64 criticalPathRight = GetCriticalPathDuration(rightJob);
+
+        if (criticalPathLeft != criticalPathRight)
+        {
+            return criticalPathLeft > criticalPathRight;
+        }
+
         if (leftJob->GetJobEntry().m_sourceAssetReference == rightJob->GetJobEntry().m_sourceAssetReference)
         {
             // If there are two jobs for the same source, then sort by job run key.
@@ -311,11 +349,185 @@ namespace AssetProcessor
     void RCQueueSortModel::AddJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries[rcJob->GetJobEntry().m_jobRunKey] = rcJob;
+        m_criticalPathsDirty = true;
     }
 
     void RCQueueSortModel::RemoveJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey);
+        m_criticalPathDurations.erase(rcJob);
+    }
+
+    void RCQueueSortModel::SetExpectedJobDuration(const QueueElementID& elementId, AZ::s64 durationMs)
+    {
+        m_expectedJobDurations[elementId] = durationMs;
+    }
+
+    void RCQueueSortModel::LoadExpectedJobDurations()
+    {
+        m_expectedJobDurationsLoaded = true;
+        m_defaultJobDuration = DefaultJobDurationMs;
+
+        AZStd::string databaseLocation;
+        AzToolsFramework::AssetDatabase::AssetDatabaseRequestsBus::Broadcast(&AzToolsFramework::AssetDatabase::AssetDatabaseRequests::GetAssetDatabaseLocation, databaseLocation);
+        if (databaseLocation.empty())
+        {
+            return;
+        }
+
+        AssetProcessor::AssetDatabaseConnection assetDatabaseConnection;
+        if (!assetDatabaseConnection.OpenDatabase())
+        {
+            return;
+        }
+
+        // stats are named ProcessJob,<scan folder>,<relative source path>,<job key>,<platform>,<builder guid>
+        AZ::s64 totalDuration = 0;
+        AZ::s64 durationCount = 0;
+        auto statsFunction = [this, &totalDuration, &durationCount](AzToolsFramework::AssetDatabase::StatDatabaseEntry& entry)
+        {
+            static constexpr int numTokensExpected = 6;
+            AZStd::vector<AZStd::string> tokens;
+            AZ::StringFunc::Tokenize(entry.m_statName, tokens, ',');
+
+            if (tokens.size() == numTokensExpected)
+            {
+                QueueElementID elementId(SourceAssetReference(tokens[1].c_str(), tokens[2].c_str()), tokens[4].c_str(), tokens[3].c_str());
+                // a source can be processed by several builders with the same job key, use the slowest
+                AZ::s64& expectedDuration = m_expectedJobDurations[elementId];
+                expectedDuration = AZStd::max(expectedDuration, entry.m_statValue);
+                totalDuration += entry.m_statValue;
+                ++durationCount;
+            }
+            return true;
+        };
+        assetDatabaseConnection.QueryStatLikeStatName("ProcessJob,%", statsFunction);
+
+        if (durationCount > 0)
+        {
+            // jobs that never ran are expected to take as long as an average job
+            m_defaultJobDuration = AZStd::max<AZ::s64>(totalDuration / durationCount, 1);
+        }
+    }
+
+    AZ::s64 RCQueueSortModel::GetExpectedJobDuration(const RCJob* rcJob) const
+    {
+        auto found = m_expectedJobDurations.find(rcJob->GetElementID());
+        return found != m_expectedJobDurations.end() ? found->second : m_defaultJobDuration;
+    }
+
+    AZ::s64 RCQueueSortModel::GetCriticalPathDuration(const RCJob* rcJob) const
+    {
+        auto found = m_criticalPathDurations.find(rcJob);
+        return found != m_criticalPathDurations.end() ? found->second : 0;
+    }
+
+    void RCQueueSortModel::UpdateCriticalPaths()
+    {
+        if (!m_sourceModel)
+        {
+            return;
+        }
+
+        if (!m_expectedJobDurationsLoaded)
+        {
+            LoadExpectedJobDurations();
+        }
+
+        AZStd::vector<RCJob*> pendingJobs;
+        AZStd::unordered_map<QueueElementID, AZStd::vector<size_t>> pendingJobsByElementId;
+        for (int idx = 0; idx < m_sourceModel->itemCount(); ++idx)
+        {
+            RCJob* rcJob = m_sourceModel->getItem(idx);
+            if (rcJob && rcJob->GetState() == RCJob::pending)
+            {
+                pendingJobsByElementId[rcJob->GetElementID()].push_back(pendingJobs.size());
+                pendingJobs.push_back(rcJob);
+            }
+        }
+
+        // for each pending job, the pending jobs that wait on it
+        AZStd::vector<AZStd::vector<size_t>> dependentJobs(pendingJobs.size());
+        for (size_t jobIndex = 0; jobIndex < pendingJobs.size(); ++jobIndex)
+        {
+            for (const JobDependencyInternal& jobDependencyInternal : pendingJobs[jobIndex]->GetJobDependencies())
+            {
+                if (!IsOrderDependency(jobDependencyInternal))
+                {
+                    continue;
+                }
+
+                auto found = pendingJobsByElementId.find(GetDependencyElementID(jobDependencyInternal.m_jobDependency));
+                if (found != pendingJobsByElementId.end())
+                {
+                    for (size_t dependencyIndex : found->second)
+                    {
+                        if (dependencyIndex != jobIndex)
+                        {
+                            dependentJobs[dependencyIndex].push_back(jobIndex);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Depth first search with an explicit stack, since dependency chains can be long.
+        // A job is finished once all the jobs waiting on it are, and jobs of a dependency cycle that are
+        // still being visited don't add to the critical path.
+        enum class VisitState : AZ::u8
+        {
+            NotVisited,
+            Visiting,
+            Visited
+        };
+        AZStd::vector<VisitState> visitStates(pendingJobs.size(), VisitState::NotVisited);
+        AZStd::vector<AZ::s64> criticalPaths(pendingJobs.size(), 0);
+        AZStd::vector<AZStd::pair<size_t, size_t>> stack; // job index, index of the next dependent job to visit
+
+        for (size_t rootIndex = 0; rootIndex < pendingJobs.size(); ++rootIndex)
+        {
+            if (visitStates[rootIndex] != VisitState::NotVisited)
+            {
+                continue;
+            }
+
+            visitStates[rootIndex] = VisitState::Visiting;
+            stack.emplace_back(rootIndex, 0);
+            while (!stack.empty())
+            {
+                const size_t jobIndex = stack.back().first;
+                const size_t nextDependent = stack.back().second;
+                if (nextDependent < dependentJobs[jobIndex].size())
+                {
+                    ++stack.back().second;
+                    const size_t dependentIndex = dependentJobs[jobIndex][nextDependent];
+                    if (visitStates[dependentIndex] == VisitState::NotVisited)
+                    {
+                        visitStates[dependentIndex] = VisitState::Visiting;
+                        stack.emplace_back(dependentIndex, 0);
+                    }
+                    continue;
+                }
+
+                AZ::s64 longestDependentPath = 0;
+                for (size_t dependentIndex : dependentJobs[jobIndex])
+                {
+                    if (visitStates[dependentIndex] == VisitState::Visited)
+                    {
+                        longestDependentPath = AZStd::max(longestDependentPath, criticalPaths[dependentIndex]);
+                    }
+                }
+                criticalPaths[jobIndex] = GetExpectedJobDuration(pendingJobs[jobIndex]) + longestDependentPath;
+                visitStates[jobIndex] = VisitState::Visited;
+                stack.pop_back();
+            }
+        }
+
+        m_criticalPathDurations.clear();
+        for (size_t jobIndex = 0; jobIndex < pendingJobs.size(); ++jobIndex)
+        {
+            m_criticalPathDurations[pendingJobs[jobIndex]] = criticalPaths[jobIndex];
+        }
     }
 
     void RCQueueSortModel::OnEscalateJobs(AssetProcessor::JobIdEscalationList jobIdEscalationList)
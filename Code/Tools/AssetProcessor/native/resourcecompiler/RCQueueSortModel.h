@@ -9,6 +9,7 @@
 #define ASSETPROCESSOR_RCQUEUESORTMODEL_H
 
 #if !defined(Q_MOC_RUN)
+#include <QElapsedTimer>
 #include <QSortFilterProxyModel>
 #include <QSet>
 #include <QString>
@@ -16,14 +17,15 @@
 
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/functional.h>
 #include "native/assetprocessor.h"
+#include "native/resourcecompiler/RCCommon.h"
 #endif
 
 class RCcontrollerUnitTests;
 
 namespace AssetProcessor
 {
-    class QueueElementID;
     class RCJobListModel;
     class RCJob;
 
@@ -34,7 +36,11 @@ namespace AssetProcessor
     //!  * Jobs in Sync Compile Requests for currently connected platforms (with most recent requests first)
     //!  * Jobs in Async Compile Lists for currently connected platforms
     //!  * Remaining jobs in currently connected platforms, in priority order
+    //!  * Jobs of the same priority by critical path, longest first
     //!  (The same, repeated, for unconnected platforms).
+    //! The critical path of a job is the expected duration of the longest chain of queued jobs that wait on it through
+    //! order job dependencies, including the job itself.  Starting those first keeps long chains from running alone
+    //! at the end of a build, after every other job has finished.
     class RCQueueSortModel
         : public QSortFilterProxyModel
         , protected AssetProcessorPlatformBus::Handler
@@ -45,7 +51,11 @@ namespace AssetProcessor
         explicit RCQueueSortModel(QObject* parent = 0);
 
         void AttachToModel(RCJobListModel* target);
-        RCJob* GetNextPendingJob();
+        //! Returns the first pending job, in processing order, whose order dependencies are done and which canStartJob accepts
+        RCJob* GetNextPendingJob(const AZStd::function<bool(const RCJob*)>& canStartJob = {});
+
+        //! Record how long a job took, to estimate how long it takes the next time
+        void SetExpectedJobDuration(const QueueElementID& elementId, AZ::s64 durationMs);
 
         void AddJobIdEntry(AssetProcessor::RCJob* rcJob);
         void RemoveJobIdEntry(AssetProcessor::RCJob* rcJob);
@@ -67,6 +77,21 @@ namespace AssetProcessor
         QSet<QString> m_currentlyConnectedPlatforms;
         bool m_dirtyNeedsResort = false; // instead of constantly resorting, we resort only when someone wants to pull an element from us
 
+        //! Load how long each job took in previous runs, from the ProcessJob stats of the asset database
+        void LoadExpectedJobDurations();
+        AZ::s64 GetExpectedJobDuration(const RCJob* rcJob) const;
+        AZ::s64 GetCriticalPathDuration(const RCJob* rcJob) const;
+        //! Compute the critical path of every pending job
+        void UpdateCriticalPaths();
+
+        AZStd::unordered_map<QueueElementID, AZ::s64> m_expectedJobDurations;
+        AZ::s64 m_defaultJobDuration = 0;
+        bool m_expectedJobDurationsLoaded = false;
+
+        AZStd::unordered_map<const RCJob*, AZ::s64> m_criticalPathDurations;
+        bool m_criticalPathsDirty = false; // set when jobs are added, the critical paths are updated at most every CriticalPathUpdateIntervalMs
+        QElapsedTimer m_criticalPathTimer;
+
         // ---------------------------------------------------------
         // AssetProcessorPlatformBus::Handler
         void AssetProcessorPlatformConnected(const AZStd::string platform) override;
@@ -68,6 +68,8 @@ namespace AssetProcessor
             FinishJob(rcJob);
         }, Qt::QueuedConnection);
 
+        ++m_jobsInFlightPerBuilder[rcJob->GetBuilderName()];
+
         // Mark as "being processed" by moving to Processing list
         m_RCJobListModel.markAsProcessing(rcJob);
         m_RCJobListModel.markAsStarted(rcJob);
@@ -102,9 +104,42 @@ namespace AssetProcessor
         return m_jobsCountPerPlatform[platform.toLower()];
     }
 
+    void RCController::SetMaxJobsPerBuilder(const AZStd::unordered_map<AZStd::string, int>& maxJobsPerBuilder)
+    {
+        m_maxJobsPerBuilder = maxJobsPerBuilder;
+    }
+
+    bool RCController::IsBuilderBelowJobLimit(const RCJob* rcJob) const
+    {
+        auto limit = m_maxJobsPerBuilder.find(rcJob->GetBuilderName());
+        if (limit == m_maxJobsPerBuilder.end())
+        {
+            return true;
+        }
+
+        auto inFlight = m_jobsInFlightPerBuilder.find(rcJob->GetBuilderName());
+        return inFlight == m_jobsInFlightPerBuilder.end() || inFlight->second < limit->second;
+    }
+
     void RCController::FinishJob(RCJob* rcJob)
     {
         m_RCQueueSortModel.RemoveJobIdEntry(rcJob);
+
+        // pending jobs that are cancelled are finished without ever being launched
+        if (rcJob->GetTimeLaunched().isValid())
+        {
+            auto builderJobs = m_jobsInFlightPerBuilder.find(rcJob->GetBuilderName());
+            if (builderJobs != m_jobsInFlightPerBuilder.end() && builderJobs->second > 0)
+            {
+                --builderJobs->second;
+            }
+        }
+
+        if (rcJob->GetState() == RCJob::completed)
+        {
+            // the queue uses how long jobs take to find the longest chains of dependent jobs
+            m_RCQueueSortModel.SetExpectedJobDuration(rcJob->GetElementID(), rcJob->GetTimeLaunched().msecsTo(QDateTime::currentDateTime()));
+        }
         QString platform = rcJob->GetPlatformInfo().m_identifier.c_str();
         auto found = m_jobsCountPerPlatform.find(platform);
         if (found != m_jobsCountPerPlatform.end())
@@ -334,7 +369,11 @@ namespace AssetProcessor
         if (!m_dispatchingJobs)
         {
             m_dispatchingJobs = true;
-            RCJob* rcJob = m_RCQueueSortModel.GetNextPendingJob();
+            auto canStartJob = [this](const RCJob* pendingJob)
+            {
+                return IsBuilderBelowJobLimit(pendingJob);
+            };
+            RCJob* rcJob = m_RCQueueSortModel.GetNextPendingJob(canStartJob);
 
             while (m_RCJobListModel.jobsInFlight() < m_maxJobs && rcJob && !m_shuttingDown)
             {
@@ -347,7 +386,7 @@ namespace AssetProcessor
                     }
                 }
                 StartJob(rcJob);
-                rcJob = m_RCQueueSortModel.GetNextPendingJob();
+                rcJob = m_RCQueueSortModel.GetNextPendingJob(canStartJob);
             }
             m_dispatchingJobs = false;
         }
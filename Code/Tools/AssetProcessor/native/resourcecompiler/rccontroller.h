@@ -57,6 +57,9 @@ namespace AssetProcessor
         int NumberOfPendingJobsPerPlatform(QString platform);
         bool IsIdle();
 
+        //! Limit how many jobs of each builder, by builder name, can run at the same time
+        void SetMaxJobsPerBuilder(const AZStd::unordered_map<AZStd::string, int>& maxJobsPerBuilder);
+
     Q_SIGNALS:
         void FileCompiled(JobEntry entry, AssetBuilderSDK::ProcessJobResponse response);
         void FileFailed(JobEntry entry);
@@ -110,8 +113,12 @@ namespace AssetProcessor
 
     private:
         void FinishJob(AssetProcessor::RCJob* rcJob);
+        //! Returns false if the builder of the job already runs as many jobs as it is allowed to
+        bool IsBuilderBelowJobLimit(const AssetProcessor::RCJob* rcJob) const;
 
         unsigned int m_maxJobs;
+        AZStd::unordered_map<AZStd::string, int> m_maxJobsPerBuilder;
+        AZStd::unordered_map<AZStd::string, int> m_jobsInFlightPerBuilder;
 
         bool m_dispatchingJobs = false;
         bool m_shuttingDown = false;
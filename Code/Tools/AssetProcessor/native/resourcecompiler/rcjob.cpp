@@ -246,6 +246,24 @@ namespace AssetProcessor
         processJobRequest.m_watchFolder = GetJobEntry().m_sourceAssetReference.ScanFolderPath().c_str();
         processJobRequest.m_fullPath = GetJobEntry().GetAbsoluteSourcePath().toUtf8().data();
         processJobRequest.m_jobId = GetJobEntry().m_jobRunKey;
+
+        // the other files the job was fingerprinted with, which builders on other hosts receive along with the source.
+        // Only external builders can run on other hosts, and Builder::AddInputFiles removes this parameter before sending them the request.
+        if (m_jobDetails.m_assetBuilderDesc.IsExternalBuilder())
+        {
+            AZStd::string transferredInputFiles;
+            for (const auto& fingerprintFile : m_jobDetails.m_fingerprintFiles)
+            {
+                if (AZ::IO::PathView(fingerprintFile.first) != AZ::IO::PathView(processJobRequest.m_fullPath))
+                {
+                    transferredInputFiles.append(fingerprintFile.first).push_back('\n');
+                }
+            }
+            if (!transferredInputFiles.empty())
+            {
+                processJobRequest.m_jobDescription.m_jobParameters[AZ_CRC_CE(AssetProcessor::TransferredInputFilesKey)] = AZStd::move(transferredInputFiles);
+            }
+        }
     }
 
     QString RCJob::GetJobKey() const
@@ -258,6 +276,11 @@ namespace AssetProcessor
         return m_jobDetails.m_jobEntry.m_builderGuid;
     }
 
+    const AZStd::string& RCJob::GetBuilderName() const
+    {
+        return m_jobDetails.m_assetBuilderDesc.m_name;
+    }
+
     bool RCJob::IsCritical() const
     {
         return m_jobDetails.m_critical;
@@ -546,6 +569,10 @@ namespace AssetProcessor
                                  builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(),
                                  builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str())
                             .arg(builderParams.m_rcJob->GetOriginalFingerprint());
+                        if (assetServerMode != AssetServerMode::Inactive)
+                        {
+                            builderParams.m_contentKey = AssetUtilities::GenerateContentFingerprint(builderParams.m_rcJob->m_jobDetails);
+                        }
                         bool operationResult = false;
                         if (assetServerMode == AssetServerMode::Server)
                         {
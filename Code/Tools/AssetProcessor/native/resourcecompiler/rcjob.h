@@ -113,6 +113,8 @@ namespace AssetProcessor
         AssetBuilderSDK::ProcessJobRequest m_processJobRequest;
         AssetBuilderSDK::AssetBuilderDesc  m_assetBuilderDesc;
         QString m_serverKey;
+        //! Content fingerprint of the job, used as the key of the content addressed asset cache
+        AZStd::string m_contentKey;
 
         BuilderParams(AssetProcessor::RCJob* job = nullptr)
             : Params(job)
@@ -247,6 +249,7 @@ namespace AssetProcessor
 
         QString GetJobKey() const;
         AZ::Uuid GetBuilderGuid() const;
+        const AZStd::string& GetBuilderName() const;
         bool IsCritical() const;
         bool IsAutoFail() const;
         int GetPriority() const;
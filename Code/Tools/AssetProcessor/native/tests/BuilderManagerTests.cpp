@@ -11,8 +11,15 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #endif
 #include "BuilderManagerTests.h"
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzTest/Utils.h>
 #include <native/connection/connectionManager.h>
+#include <native/unittests/UnitTestUtils.h>
+#include <native/utilities/ByteArrayStream.h>
 
 namespace UnitTests
 {
@@ -56,6 +63,274 @@ namespace UnitTests
         ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
     }
 
+    //! Exposes the file transfer of builders running on another host than the AP
+    class TransferTestBuilder : public TestBuilder
+    {
+    public:
+        TransferTestBuilder(const AssetUtilities::QuitListener& quitListener, bool transferFiles)
+            : TestBuilder(quitListener, AZ::Uuid::CreateRandom(), 1)
+        {
+            m_transferFiles = transferFiles;
+        }
+
+        using Builder::AddInputFiles;
+        using Builder::ExtractOutputFiles;
+    };
+
+    class BuilderFileTransferTest : public ::UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            AZ::ComponentApplication::Descriptor descriptor;
+            m_systemEntity = m_app->Create(descriptor);
+
+            AssetBuilderSDK::InitializeSerializationContext();
+            AssetBuilder::InitializeSerializationContext();
+
+            m_tempDir = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_tempPath = m_tempDir->GetDirectory();
+            m_scanFolder = m_tempPath / "ScanFolder";
+
+            CreateFile(m_scanFolder / "source.txt", "source");
+            CreateFile(m_scanFolder / "sub" / "dependency.txt", "dependency");
+            CreateFile(m_tempPath / "Outside" / "other.txt", "other");
+        }
+
+        void TearDown() override
+        {
+            m_builderInputs.clear();
+            m_sentInputFiles.clear();
+            m_receivedProducts.clear();
+            m_tempDir.reset();
+
+            delete m_systemEntity;
+            m_systemEntity = nullptr;
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        void CreateFile(const AZ::IO::Path& filePath, const char* contents)
+        {
+            EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QString::fromUtf8(filePath.c_str()), contents));
+        }
+
+        AZStd::string ReadFile(const AZ::IO::Path& filePath)
+        {
+            auto readResult = AZ::Utils::ReadFile<AZStd::string>(filePath.Native());
+            return readResult.IsSuccess() ? readResult.TakeValue() : AZStd::string();
+        }
+
+        //! A job for source.txt, that was fingerprinted with a file in the scan folder and one outside of it
+        AssetBuilderSDK::ProcessJobRequest MakeRequest() const
+        {
+            AssetBuilderSDK::ProcessJobRequest request;
+            request.m_watchFolder = m_scanFolder.Native();
+            request.m_sourceFile = "source.txt";
+            request.m_fullPath = (m_scanFolder / "source.txt").Native();
+            request.m_tempDirPath = (m_tempPath / "APTemp").Native();
+            request.m_jobDescription.m_jobParameters[AZ_CRC_CE(AssetProcessor::TransferredInputFilesKey)] =
+                AZStd::string::format("%s\n%s\n", (m_scanFolder / "sub" / "dependency.txt").c_str(), (m_tempPath / "Outside" / "other.txt").c_str());
+            return request;
+        }
+
+        //! Sends the request the way the AP does, and answers it the way a builder on another host does: it keeps the
+        //! inputs it receives in m_builderInputs, and its product has the contents of the source.
+        //! The inputs sent and the products received are kept in m_sentInputFiles and m_receivedProducts.
+        AssetProcessor::BuilderRunJobOutcome RunJobOverLoopback(const TransferTestBuilder& builder)
+        {
+            m_sentInputFiles.clear();
+            m_receivedProducts.clear();
+
+            AssetBuilder::ProcessJobNetRequest netRequest;
+            netRequest.m_request = MakeRequest();
+            if (!builder.AddInputFiles(netRequest))
+            {
+                return AssetProcessor::BuilderRunJobOutcome::FailedToTransferFiles;
+            }
+
+            QByteArray requestBuffer;
+            EXPECT_TRUE(AssetProcessor::PackMessage(netRequest, requestBuffer));
+            AssetBuilder::ProcessJobNetRequest receivedRequest;
+            EXPECT_TRUE(AssetProcessor::UnpackMessage(requestBuffer, receivedRequest));
+
+            AssetBuilder::ProcessJobNetResponse builderResponse;
+            builderResponse.m_response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+            for (const AssetBuilder::TransferredFile& inputFile : receivedRequest.m_inputFiles)
+            {
+                if (!inputFile.m_contents.empty())
+                {
+                    m_builderInputs[inputFile.m_hash] = inputFile.m_contents;
+                }
+
+                auto builderInput = m_builderInputs.find(inputFile.m_hash);
+                if (builderInput == m_builderInputs.end())
+                {
+                    builderResponse.m_response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+                    continue;
+                }
+                builderResponse.m_storedInputHashes.push_back(inputFile.m_hash);
+
+                if (inputFile.m_relativePath == receivedRequest.m_request.m_sourceFile)
+                {
+                    AssetBuilder::TransferredFile& outputFile = builderResponse.m_outputFiles.emplace_back();
+                    outputFile.m_relativePath = "product.bin";
+                    outputFile.m_contents = builderInput->second;
+                    builderResponse.m_response.m_outputProducts.emplace_back().m_productFileName = outputFile.m_relativePath;
+                }
+            }
+
+            QByteArray responseBuffer;
+            EXPECT_TRUE(AssetProcessor::PackMessage(builderResponse, responseBuffer));
+            AssetBuilder::ProcessJobNetResponse netResponse;
+            EXPECT_TRUE(AssetProcessor::UnpackMessage(responseBuffer, netResponse));
+
+            AssetProcessor::BuilderRunJobOutcome result = builder.ExtractOutputFiles(netRequest, netResponse);
+            m_sentInputFiles = AZStd::move(netRequest.m_inputFiles);
+            m_receivedProducts = AZStd::move(netResponse.m_response.m_outputProducts);
+            return result;
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZ::Entity* m_systemEntity = nullptr;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDir;
+        AZ::IO::Path m_tempPath;
+        AZ::IO::Path m_scanFolder;
+        AssetUtilities::QuitListener m_quitListener;
+
+        //! The inputs kept by the simulated builder, by hash
+        AZStd::unordered_map<AZ::u64, AZStd::vector<AZ::u8>> m_builderInputs;
+
+        AZStd::vector<AssetBuilder::TransferredFile> m_sentInputFiles;
+        AZStd::vector<AssetBuilderSDK::JobProduct> m_receivedProducts;
+    };
+
+    TEST_F(BuilderFileTransferTest, TransferredFile_WriteTo_WritesUnderFolder)
+    {
+        const AZ::IO::Path folder = m_tempPath / "Output";
+
+        AssetBuilder::TransferredFile file;
+        file.m_relativePath = "sub/folder/file.txt";
+        file.m_contents = { 'a', 'b', 'c' };
+        EXPECT_TRUE(file.WriteTo(folder.c_str()));
+        EXPECT_EQ(ReadFile(folder / "sub" / "folder" / "file.txt"), "abc");
+
+        // paths that stay in the folder once normalized are fine
+        file.m_relativePath = "sub/../other.txt";
+        EXPECT_TRUE(file.WriteTo(folder.c_str()));
+        EXPECT_EQ(ReadFile(folder / "other.txt"), "abc");
+    }
+
+    TEST_F(BuilderFileTransferTest, TransferredFile_WriteToPathOutsideFolder_Fails)
+    {
+        const AZ::IO::Path folder = m_tempPath / "Output";
+
+        AssetBuilder::TransferredFile file;
+        file.m_contents = { 'a', 'b', 'c' };
+        for (const char* relativePath : { "", "../escaped.txt", "./../escaped.txt", "sub/../../escaped.txt" })
+        {
+            file.m_relativePath = relativePath;
+            EXPECT_FALSE(file.WriteTo(folder.c_str())) << relativePath;
+        }
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists((m_tempPath / "escaped.txt").c_str()));
+
+        file.m_relativePath = (m_tempPath / "absolute.txt").Native();
+        EXPECT_FALSE(file.WriteTo(folder.c_str()));
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists((m_tempPath / "absolute.txt").c_str()));
+    }
+
+    TEST_F(BuilderFileTransferTest, AddInputFiles_TransferringBuilder_AddsInputsInScanFolder)
+    {
+        TransferTestBuilder builder(m_quitListener, true);
+
+        AssetBuilder::ProcessJobNetRequest netRequest;
+        netRequest.m_request = MakeRequest();
+        ASSERT_TRUE(builder.AddInputFiles(netRequest));
+
+        EXPECT_TRUE(netRequest.m_transferFiles);
+        EXPECT_EQ(netRequest.m_request.m_jobDescription.m_jobParameters.count(AZ_CRC_CE(AssetProcessor::TransferredInputFilesKey)), 0);
+
+        // the file outside of the scan folder must be available on the host of the builder
+        ASSERT_EQ(netRequest.m_inputFiles.size(), 2);
+        EXPECT_EQ(netRequest.m_inputFiles[0].m_relativePath, "source.txt");
+        EXPECT_EQ(AZStd::string(netRequest.m_inputFiles[0].m_contents.begin(), netRequest.m_inputFiles[0].m_contents.end()), "source");
+        EXPECT_EQ(netRequest.m_inputFiles[1].m_relativePath, "sub/dependency.txt");
+        EXPECT_EQ(AZStd::string(netRequest.m_inputFiles[1].m_contents.begin(), netRequest.m_inputFiles[1].m_contents.end()), "dependency");
+        EXPECT_NE(netRequest.m_inputFiles[0].m_hash, netRequest.m_inputFiles[1].m_hash);
+    }
+
+    TEST_F(BuilderFileTransferTest, AddInputFiles_LocalBuilder_RemovesListOfInputs)
+    {
+        TransferTestBuilder builder(m_quitListener, false);
+
+        AssetBuilder::ProcessJobNetRequest netRequest;
+        netRequest.m_request = MakeRequest();
+        ASSERT_TRUE(builder.AddInputFiles(netRequest));
+
+        EXPECT_FALSE(netRequest.m_transferFiles);
+        EXPECT_TRUE(netRequest.m_inputFiles.empty());
+        EXPECT_EQ(netRequest.m_request.m_jobDescription.m_jobParameters.count(AZ_CRC_CE(AssetProcessor::TransferredInputFilesKey)), 0);
+    }
+
+    TEST_F(BuilderFileTransferTest, ExtractOutputFiles_LocalRequest_LeavesResponseAlone)
+    {
+        TransferTestBuilder builder(m_quitListener, false);
+
+        AssetBuilder::ProcessJobNetRequest netRequest;
+        netRequest.m_request = MakeRequest();
+        AssetBuilder::ProcessJobNetResponse netResponse;
+        netResponse.m_response.m_outputProducts.emplace_back().m_productFileName = "product.bin";
+
+        EXPECT_EQ(builder.ExtractOutputFiles(netRequest, netResponse), AssetProcessor::BuilderRunJobOutcome::Ok);
+        EXPECT_EQ(netResponse.m_response.m_outputProducts[0].m_productFileName, "product.bin");
+    }
+
+    TEST_F(BuilderFileTransferTest, RunJobOverLoopback_TransfersInputsOnceAndProducts)
+    {
+        TransferTestBuilder builder(m_quitListener, true);
+        const AZ::IO::Path productPath = AZ::IO::Path(MakeRequest().m_tempDirPath) / "product.bin";
+
+        ASSERT_EQ(RunJobOverLoopback(builder), AssetProcessor::BuilderRunJobOutcome::Ok);
+        ASSERT_EQ(m_receivedProducts.size(), 1);
+        EXPECT_EQ(AZ::IO::Path(m_receivedProducts[0].m_productFileName), productPath);
+        EXPECT_EQ(ReadFile(productPath), "source");
+
+        // the builder reported that it stored the inputs, so their contents are not sent again
+        ASSERT_EQ(RunJobOverLoopback(builder), AssetProcessor::BuilderRunJobOutcome::Ok);
+        ASSERT_EQ(m_sentInputFiles.size(), 2);
+        EXPECT_TRUE(m_sentInputFiles[0].m_contents.empty());
+        EXPECT_TRUE(m_sentInputFiles[1].m_contents.empty());
+        EXPECT_EQ(ReadFile(productPath), "source");
+
+        // a source that changed is sent again
+        CreateFile(m_scanFolder / "source.txt", "changed source");
+        ASSERT_EQ(RunJobOverLoopback(builder), AssetProcessor::BuilderRunJobOutcome::Ok);
+        ASSERT_EQ(m_sentInputFiles.size(), 2);
+        EXPECT_FALSE(m_sentInputFiles[0].m_contents.empty());
+        EXPECT_TRUE(m_sentInputFiles[1].m_contents.empty());
+        EXPECT_EQ(ReadFile(productPath), "changed source");
+    }
+
+    TEST_F(BuilderFileTransferTest, RunJobOverLoopback_BuilderLostInputs_SendsThemAgain)
+    {
+        TransferTestBuilder builder(m_quitListener, true);
+
+        ASSERT_EQ(RunJobOverLoopback(builder), AssetProcessor::BuilderRunJobOutcome::Ok);
+
+        // like a builder that was restarted, or failed to store the inputs
+        m_builderInputs.clear();
+        EXPECT_EQ(RunJobOverLoopback(builder), AssetProcessor::BuilderRunJobOutcome::TransferredInputsMissing);
+        EXPECT_TRUE(m_receivedProducts.empty());
+
+        ASSERT_EQ(RunJobOverLoopback(builder), AssetProcessor::BuilderRunJobOutcome::Ok);
+        ASSERT_EQ(m_sentInputFiles.size(), 2);
+        EXPECT_FALSE(m_sentInputFiles[0].m_contents.empty());
+        EXPECT_FALSE(m_sentInputFiles[1].m_contents.empty());
+        EXPECT_EQ(ReadFile(AZ::IO::Path(MakeRequest().m_tempDirPath) / "product.bin"), "source");
+    }
+
     AZ::Outcome<void, AZStd::string> TestBuilder::Start(AssetProcessor::BuilderPurpose /*purpose*/)
     {
         return AZ::Success();
@@ -10,6 +10,8 @@
 #include <native/utilities/assetUtils.h>
 #include <native/unittests/UnitTestUtils.h>
 #include <AzFramework/IO/LocalFileIO.h>
+#include <AzCore/std/parallel/thread.h>
+#include <QtConcurrent/QtConcurrentMap>
 
 namespace UnitTests
 {
@@ -158,6 +160,69 @@ namespace UnitTests
         CheckForFile(testPath, true);
     }
 
+    TEST_F(FileStateCacheTests, GetHashFromSeveralThreads_MatchesDirectHash)
+    {
+        constexpr int FileCount = 32;
+        QSet<AssetFileInfo> infoSet;
+        AZStd::vector<QString> testPaths;
+        for (int index = 0; index < FileCount; ++index)
+        {
+            QString testPath = m_temporarySourceDir.absoluteFilePath(QString("test%1.txt").arg(index));
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, QString("contents of file %1").arg(index)));
+
+            AssetFileInfo fileInfo;
+            fileInfo.m_filePath = testPath;
+            fileInfo.m_modTime = QFileInfo(testPath).lastModified();
+            infoSet.insert(fileInfo);
+            testPaths.push_back(testPath);
+        }
+
+        m_fileStateCache->AddInfoSet(infoSet);
+
+        // every thread asks for every file, so several threads hash the same uncached file at once
+        AZStd::vector<AZStd::vector<AssetProcessor::IFileStateRequests::FileHash>> threadHashes(4);
+        AZStd::vector<AZStd::thread> threads;
+        for (auto& hashes : threadHashes)
+        {
+            threads.emplace_back([this, &testPaths, &hashes]()
+            {
+                for (const QString& testPath : testPaths)
+                {
+                    AssetProcessor::IFileStateRequests::FileHash hash = 0;
+                    EXPECT_TRUE(m_fileStateCache->GetHash(testPath, &hash));
+                    hashes.push_back(hash);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZStd::vector<AZ::u64> expectedHashes;
+        for (int index = 0; index < FileCount; ++index)
+        {
+            AZ::u64 expectedHash = AssetUtilities::GetFileHash(testPaths[index].toUtf8().constData(), true);
+            for (const auto& hashes : threadHashes)
+            {
+                ASSERT_EQ(hashes.size(), FileCount);
+                EXPECT_EQ(hashes[index], expectedHash);
+            }
+            expectedHashes.push_back(expectedHash);
+        }
+
+        // the hashes are cached now: change the files without telling the cache, it must not read them again
+        for (int index = 0; index < FileCount; ++index)
+        {
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPaths[index], QString("changed contents of file %1").arg(index)));
+            ASSERT_NE(AssetUtilities::GetFileHash(testPaths[index].toUtf8().constData(), true), expectedHashes[index]);
+
+            AssetProcessor::IFileStateRequests::FileHash cachedHash = 0;
+            EXPECT_TRUE(m_fileStateCache->GetHash(testPaths[index], &cachedHash));
+            EXPECT_EQ(cachedHash, expectedHashes[index]);
+        }
+    }
+
     TEST_F(FileStateCacheTests, HandlesMixedSeperators)
     {
         QSet<AssetFileInfo> infoSet;
@@ -170,4 +235,118 @@ namespace UnitTests
         CheckForFile(R"(c:\some\test\file.txt)", true);
         CheckForFile(R"(c:/some/test/file.txt)", true);
     }
+
+    //! Hashes a set of files through the file state cache, either one at a time as assessing files does,
+    //! or on the Qt thread pool as warming up the file cache does. The files are in the OS file cache after
+    //! the first iteration, so this measures how hashing scales across threads rather than disk throughput.
+    class FileStateCacheHashBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr int FileCount = 256;
+        static constexpr int FileSize = 256 * 1024;
+
+        void SetUp([[maybe_unused]] const benchmark::State& st) override
+        {
+            internalSetUp();
+        }
+
+        void SetUp([[maybe_unused]] benchmark::State& st) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& st) override
+        {
+            internalTearDown();
+        }
+
+        void TearDown([[maybe_unused]] benchmark::State& st) override
+        {
+            internalTearDown();
+        }
+
+        //! The cache keeps the hashes it computed, so every iteration starts with a new one
+        void ResetCache()
+        {
+            m_fileStateCache = nullptr;
+            m_fileStateCache = AZStd::make_unique<AssetProcessor::FileStateCache>();
+            m_fileStateCache->AddInfoSet(m_infoSet);
+        }
+
+        void HashFile(const QString& filePath)
+        {
+            AssetProcessor::IFileStateRequests::FileHash fileHash = 0;
+            m_fileStateCache->GetHash(filePath, &fileHash);
+            benchmark::DoNotOptimize(fileHash);
+        }
+
+        QVector<QString> m_filePaths;
+        QSet<AssetFileInfo> m_infoSet;
+        AZStd::unique_ptr<AssetProcessor::FileStateCache> m_fileStateCache;
+
+    private:
+        void internalSetUp()
+        {
+            m_temporaryDir = AZStd::make_unique<QTemporaryDir>();
+            QDir temporarySourceDir(m_temporaryDir->path());
+            AZ::IO::FileIOBase::SetInstance(aznew AZ::IO::LocalFileIO());
+
+            QByteArray contents(FileSize, 'a');
+            for (int index = 0; index < FileCount; ++index)
+            {
+                QString filePath = temporarySourceDir.absoluteFilePath(QString("file%1.txt").arg(index));
+                contents[0] = static_cast<char>(index);
+                QFile file(filePath);
+                if (file.open(QIODevice::WriteOnly))
+                {
+                    file.write(contents);
+                }
+
+                AssetFileInfo fileInfo;
+                fileInfo.m_filePath = filePath;
+                fileInfo.m_modTime = QFileInfo(filePath).lastModified();
+                m_infoSet.insert(fileInfo);
+                m_filePaths.push_back(filePath);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_fileStateCache = nullptr;
+            m_infoSet.clear();
+            m_filePaths.clear();
+            delete AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            m_temporaryDir = nullptr;
+        }
+
+        AZStd::unique_ptr<QTemporaryDir> m_temporaryDir;
+    };
+
+    BENCHMARK_DEFINE_F(FileStateCacheHashBenchmark, BM_GetHash)(benchmark::State& state)
+    {
+        const bool useThreadPool = state.range(0) != 0;
+        state.SetLabel(useThreadPool ? "ThreadPool" : "Sequential");
+        for ([[maybe_unused]] auto unused : state)
+        {
+            state.PauseTiming();
+            ResetCache();
+            state.ResumeTiming();
+
+            if (useThreadPool)
+            {
+                QtConcurrent::blockingMap(m_filePaths, [this](const QString& filePath) { HashFile(filePath); });
+            }
+            else
+            {
+                for (const QString& filePath : m_filePaths)
+                {
+                    HashFile(filePath);
+                }
+            }
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * FileCount * FileSize);
+    }
+
+    BENCHMARK_REGISTER_F(FileStateCacheHashBenchmark, BM_GetHash)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
 }
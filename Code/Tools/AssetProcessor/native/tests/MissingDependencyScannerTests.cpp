@@ -7,6 +7,7 @@
  */
 
 #include <native/tests/AssetProcessorTest.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Outcome/Outcome.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include <native/utilities/MissingDependencyScanner.h>
@@ -130,7 +131,7 @@ namespace AssetProcessor
             return AZ::Success(result);
         }
 
-        void CreateAndValidateMissingProductDependency(const AZStd::string& missingProductName)
+        void CreateAndValidateMissingProductDependency(const AZStd::string& missingProductName, bool scanInBatch = false)
         {
             using namespace AzToolsFramework::AssetDatabase;
 
@@ -156,7 +157,16 @@ namespace AssetProcessor
 
             AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer container;
 
-            m_data->m_scanner.ScanFile(testFilePath.toUtf8().constData(), AssetProcessor::MissingDependencyScanner::DefaultMaxScanIteration, productId, container, m_data->m_dbConn, false, [](AZStd::string /*dependencyFile*/) {});
+            if (scanInBatch)
+            {
+                AZStd::vector<MissingDependencyScanner::FileToScan> filesToScan;
+                filesToScan.push_back({ testFilePath.toUtf8().constData(), productId, container });
+                m_data->m_scanner.ScanFiles(filesToScan, AssetProcessor::MissingDependencyScanner::DefaultMaxScanIteration, m_data->m_dbConn, "", [](AZStd::string /*dependencyFile*/) {});
+            }
+            else
+            {
+                m_data->m_scanner.ScanFile(testFilePath.toUtf8().constData(), AssetProcessor::MissingDependencyScanner::DefaultMaxScanIteration, productId, container, m_data->m_dbConn, false, [](AZStd::string /*dependencyFile*/) {});
+            }
 
             MissingProductDependencyDatabaseEntryContainer missingDeps;
             ASSERT_TRUE(m_data->m_dbConn->GetMissingProductDependenciesByProductId(productId, missingDeps));
@@ -192,6 +202,11 @@ namespace AssetProcessor
         CreateAndValidateMissingProductDependency("tests/1-withdash.product");
     }
 
+    TEST_F(MissingDependencyScannerTest, ScanFiles_FindsValidReferenceToProduct)
+    {
+        CreateAndValidateMissingProductDependency("tests/1.product", /*scanInBatch*/ true);
+    }
+
     TEST_F(MissingDependencyScannerTest, ScanFile_CPP_File_FindsValidReferenceToProduct)
     {
         using namespace AzToolsFramework::AssetDatabase;
@@ -260,4 +275,195 @@ namespace AssetProcessor
         m_data->m_scanner.ScanFile(sourceFilePath.toUtf8().constData(), AssetProcessor::MissingDependencyScanner::DefaultMaxScanIteration, m_data->m_dbConn, dependencyToken, false, missingDependencyCallback);
         ASSERT_TRUE(productDependency.empty());
     }
+
+    TEST_F(MissingDependencyScannerTest, ScanFile_ProductsChangedSincePreviousScan_IndexIsUpdated)
+    {
+        QDir assetRootPath(m_data->m_databaseLocationListener.GetAssetRootDir().c_str());
+        AZ::Outcome<AZ::s64, AZStd::string> scanResult = CreateScanFolder("Test", assetRootPath.absoluteFilePath("subfolder1").toUtf8().constData());
+        ASSERT_TRUE(scanResult.IsSuccess());
+        AZ::Outcome<SourceAndProductInfo, AZStd::string> firstAsset = CreateSourceAndProductAsset(scanResult.GetValue(), "tests/1", "pc", "test/tests/1.product");
+        ASSERT_TRUE(firstAsset.IsSuccess());
+
+        QString testFilePath = assetRootPath.absoluteFilePath("subfolder1/TestFile.txt");
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testFilePath, "tests/1.product tests/2.product"));
+
+        AZStd::vector<AZStd::string> references;
+        auto scanTestFile = [&]()
+        {
+            references.clear();
+            m_data->m_scanner.ScanFile(testFilePath.toUtf8().constData(), AssetProcessor::MissingDependencyScanner::DefaultMaxScanIteration, m_data->m_dbConn, "", false,
+                [&references](AZStd::string relativeDependencyFilePath) { references.push_back(relativeDependencyFilePath); });
+        };
+
+        scanTestFile();
+        EXPECT_EQ(references, AZStd::vector<AZStd::string>{ "tests/1.product" });
+
+        // the index was loaded by the first scan, the next one only reads the products the database notified as changed
+        AZ::Outcome<SourceAndProductInfo, AZStd::string> secondAsset = CreateSourceAndProductAsset(scanResult.GetValue(), "tests/2", "pc", "test/tests/2.product");
+        ASSERT_TRUE(secondAsset.IsSuccess());
+        ASSERT_TRUE(m_data->m_dbConn->RemoveProduct(firstAsset.GetValue().m_productId));
+
+        scanTestFile();
+        EXPECT_EQ(references, AZStd::vector<AZStd::string>{ "tests/2.product" });
+    }
+
+    class AssetReferenceIndexTest
+        : public AssetProcessorTest
+    {
+    protected:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+
+            m_index = AZStd::make_unique<AssetReferenceIndex>();
+            m_index->AddProduct({ 1, m_textureGuid, 0, "pc/Project/Textures/Brick.dds", "Textures/Brick.png" });
+            m_index->AddProduct({ 2, m_materialGuid, 1, "pc/Project/Materials/Brick.azmaterial", "Materials/Brick.material" });
+        }
+
+        void TearDown() override
+        {
+            m_index = nullptr;
+
+            AssetProcessorTest::TearDown();
+        }
+
+        AZStd::vector<AZStd::string> FindReferences(AZStd::string_view text)
+        {
+            AZStd::vector<AZStd::string> references;
+            m_index->FindReferences(text, [&](size_t offset, size_t length)
+            {
+                references.emplace_back(text.substr(offset, length));
+            });
+            return references;
+        }
+
+        AZStd::vector<AZ::s64> FindProductsByPath(AZStd::string_view path, AZStd::string_view referencingProductName)
+        {
+            AZStd::vector<AZ::s64> productIDs;
+            m_index->FindProductsByPath(path, referencingProductName, [&](const AssetReferenceIndex::Product& product)
+            {
+                productIDs.push_back(product.m_productID);
+            });
+            return productIDs;
+        }
+
+        const AZ::Uuid m_textureGuid = AZ::Uuid("{5CF1D1A9-6C40-4B1C-8D0E-2B7F1B4C8B11}");
+        const AZ::Uuid m_materialGuid = AZ::Uuid("{8E3A2A57-0F5D-4E0B-9A43-6C1D2E3F4A22}");
+        AZStd::unique_ptr<AssetReferenceIndex> m_index;
+    };
+
+    TEST_F(AssetReferenceIndexTest, FindReferences_FindsOnlyPathsOfKnownAssets)
+    {
+        AZStd::vector<AZStd::string> references = FindReferences("uses textures\\BRICK.dds and Materials//Brick.material, not brick.txt.");
+
+        ASSERT_EQ(references.size(), 2);
+        EXPECT_EQ(references[0], "textures\\BRICK.dds");
+        EXPECT_EQ(references[1], "Materials//Brick.material");
+    }
+
+    TEST_F(AssetReferenceIndexTest, FindReferences_PathWithUnknownFolders_ReportsKnownEnd)
+    {
+        AZStd::vector<AZStd::string> references = FindReferences(R"("@engroot@/Other/Project/Textures/Brick.dds")");
+
+        ASSERT_EQ(references.size(), 1);
+        EXPECT_EQ(references[0], "Project/Textures/Brick.dds");
+    }
+
+    TEST_F(AssetReferenceIndexTest, FindProductsByPath_MatchesProductAndRelativePaths)
+    {
+        EXPECT_EQ(FindProductsByPath("Project/Textures/Brick.dds", ""), AZStd::vector<AZ::s64>{ 1 });
+        EXPECT_EQ(FindProductsByPath("textures/brick.dds", ""), AZStd::vector<AZ::s64>{ 1 });
+        EXPECT_EQ(FindProductsByPath("Brick.dds", "pc/Project/Textures/Wall.azmaterial"), AZStd::vector<AZ::s64>{ 1 });
+        EXPECT_TRUE(FindProductsByPath("Brick.dds", "").empty());
+        EXPECT_TRUE(FindProductsByPath("Brick.dds", "pc/Project/Materials/Wall.azmaterial").empty());
+    }
+
+    TEST_F(AssetReferenceIndexTest, RemoveProduct_ProductIsNoLongerFound)
+    {
+        m_index->RemoveProduct(1);
+
+        EXPECT_EQ(m_index->GetProductCount(), 1);
+        EXPECT_EQ(m_index->GetProduct(1), nullptr);
+        EXPECT_TRUE(FindReferences("textures/brick.dds").empty());
+        EXPECT_TRUE(FindProductsByPath("textures/brick.dds", "").empty());
+
+        size_t productCount = 0;
+        m_index->FindProductsOfSource(m_textureGuid, [&productCount](const AssetReferenceIndex::Product&) { ++productCount; });
+        EXPECT_EQ(productCount, 0);
+
+        m_index->AddProduct({ 1, m_textureGuid, 0, "pc/Project/Textures/Brick.dds", "Textures/Brick.png" });
+        EXPECT_EQ(FindProductsByPath("textures/brick.dds", ""), AZStd::vector<AZ::s64>{ 1 });
+    }
+
+    //! Finds the references in a file with an index of a growing number of products. The database lookups the scanner
+    //! used before cost a scan of the product table for every path in the file, so a scan of the whole project grew with
+    //! the number of files times the number of products. With the index, the cost of a file should not depend on the
+    //! number of products.
+    class AssetReferenceIndexBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr int PathsPerFile = 2000;
+
+        void SetUp(const benchmark::State& st) override
+        {
+            internalSetUp(st.range(0));
+        }
+
+        void SetUp(benchmark::State& st) override
+        {
+            internalSetUp(st.range(0));
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& st) override
+        {
+            internalTearDown();
+        }
+
+        void TearDown([[maybe_unused]] benchmark::State& st) override
+        {
+            internalTearDown();
+        }
+
+        AZStd::unique_ptr<AssetReferenceIndex> m_index;
+        AZStd::string m_text;
+
+    private:
+        void internalSetUp(int64_t productCount)
+        {
+            m_index = AZStd::make_unique<AssetReferenceIndex>();
+            for (int64_t productIndex = 0; productIndex < productCount; ++productIndex)
+            {
+                m_index->AddProduct({ productIndex, AZ::Uuid::CreateRandom(), 0,
+                    AZStd::string::format("pc/project/folder%d/asset%d.product", aznumeric_cast<int>(productIndex % 100), aznumeric_cast<int>(productIndex)),
+                    AZStd::string::format("folder%d/asset%d.source", aznumeric_cast<int>(productIndex % 100), aznumeric_cast<int>(productIndex)) });
+            }
+
+            // half of the paths refer to known products
+            for (int pathIndex = 0; pathIndex < PathsPerFile; ++pathIndex)
+            {
+                const int productIndex = aznumeric_cast<int>((pathIndex * 7919) % productCount);
+                m_text += (pathIndex % 2) ? AZStd::string::format("\t\"path\": \"folder%d/asset%d.product\",\n", productIndex % 100, productIndex)
+                                          : AZStd::string::format("\t\"other\": \"unknown%d/file%d.txt\",\n", pathIndex % 100, pathIndex);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_index = nullptr;
+            m_text = {};
+        }
+    };
+
+    BENCHMARK_DEFINE_F(AssetReferenceIndexBenchmark, BM_FindReferences)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto unused : state)
+        {
+            size_t referenceCount = 0;
+            m_index->FindReferences(m_text, [&referenceCount](size_t, size_t) { ++referenceCount; });
+            benchmark::DoNotOptimize(referenceCount);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * m_text.size());
+    }
+
+    BENCHMARK_REGISTER_F(AssetReferenceIndexBenchmark, BM_FindReferences)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
 }
@@ -2664,4 +2664,213 @@ namespace UnitTests
 
     }
 
+    TEST_F(AssetDatabaseTest, ScopedWriteBatch_NotCommitted_RollsBackAllWrites)
+    {
+        CreateCoverageTestData();
+
+        {
+            AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch writeBatch(m_data->m_connection);
+
+            // SetProducts commits its own nested transaction, which must not commit the batch
+            ProductDatabaseEntryContainer products;
+            products.emplace_back(m_data->m_job1.m_jobID, 5, "someproduct5.dds", AZ::Data::AssetType::CreateRandom());
+            products.emplace_back(m_data->m_job1.m_jobID, 6, "someproduct6.dds", AZ::Data::AssetType::CreateRandom());
+            ASSERT_TRUE(m_data->m_connection.SetProducts(products));
+
+            ProductDatabaseEntryContainer productsInBatch;
+            EXPECT_TRUE(m_data->m_connection.GetProductsByJobID(m_data->m_job1.m_jobID, productsInBatch));
+            EXPECT_EQ(productsInBatch.size(), 4);
+        }
+
+        ProductDatabaseEntryContainer productsAfterBatch;
+        EXPECT_TRUE(m_data->m_connection.GetProductsByJobID(m_data->m_job1.m_jobID, productsAfterBatch));
+        EXPECT_EQ(productsAfterBatch.size(), 2);
+    }
+
+    TEST_F(AssetDatabaseTest, ScopedWriteBatch_Committed_KeepsAllWrites)
+    {
+        CreateCoverageTestData();
+
+        {
+            AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch writeBatch(m_data->m_connection);
+
+            ProductDatabaseEntry product5(m_data->m_job1.m_jobID, 5, "someproduct5.dds", AZ::Data::AssetType::CreateRandom());
+            ASSERT_TRUE(m_data->m_connection.SetProduct(product5));
+
+            ProductDependencyDatabaseEntryContainer dependencies;
+            dependencies.emplace_back(product5.m_productID, m_data->m_sourceFile2.m_sourceGuid, 3, 0, "pc", 0);
+            ASSERT_TRUE(m_data->m_connection.SetProductDependencies(dependencies));
+
+            writeBatch.Commit();
+        }
+
+        ProductDatabaseEntryContainer products;
+        EXPECT_TRUE(m_data->m_connection.GetProductsByJobID(m_data->m_job1.m_jobID, products));
+        EXPECT_EQ(products.size(), 3);
+
+        ProductDependencyDatabaseEntryContainer dependencies;
+        EXPECT_TRUE(m_data->m_connection.GetProductDependencies(dependencies));
+        EXPECT_EQ(dependencies.size(), 1);
+    }
+
+    TEST_F(AssetDatabaseTest, SetProductDependencies_MoreThanOneInsertBatch_ReplacesAllDependencies)
+    {
+        CreateCoverageTestData();
+
+        // an old dependency which has to be removed
+        ProductDependencyDatabaseEntryContainer oldDependencies;
+        oldDependencies.emplace_back(m_data->m_product1.m_productID, m_data->m_sourceFile2.m_sourceGuid, 1, 0, "pc", 0);
+        ASSERT_TRUE(m_data->m_connection.SetProductDependencies(oldDependencies));
+
+        // enough dependencies for two products to need full multi row inserts as well as single row inserts for the remainder
+        constexpr AZ::u32 NumDependenciesPerProduct = 100;
+        ProductDependencyDatabaseEntryContainer dependencies;
+        for (AZ::s64 productId : { m_data->m_product1.m_productID, m_data->m_product2.m_productID })
+        {
+            for (AZ::u32 subId = 0; subId < NumDependenciesPerProduct; ++subId)
+            {
+                dependencies.emplace_back(productId, m_data->m_sourceFile1.m_sourceGuid, subId, 0, "pc", 0, "unresolved.txt");
+            }
+        }
+        ASSERT_TRUE(m_data->m_connection.SetProductDependencies(dependencies));
+
+        ProductDependencyDatabaseEntryContainer product1Dependencies;
+        EXPECT_TRUE(m_data->m_connection.GetProductDependenciesByProductID(m_data->m_product1.m_productID, product1Dependencies));
+        ASSERT_EQ(product1Dependencies.size(), NumDependenciesPerProduct);
+
+        ProductDependencyDatabaseEntryContainer product2Dependencies;
+        EXPECT_TRUE(m_data->m_connection.GetProductDependenciesByProductID(m_data->m_product2.m_productID, product2Dependencies));
+        ASSERT_EQ(product2Dependencies.size(), NumDependenciesPerProduct);
+
+        // every field of every row must have been bound to the right parameter
+        AZStd::vector<bool> foundSubIds(NumDependenciesPerProduct, false);
+        AZ::u32 foundSubIdCount = 0;
+        for (const ProductDependencyDatabaseEntry& dependency : product1Dependencies)
+        {
+            EXPECT_EQ(dependency.m_dependencySourceGuid, m_data->m_sourceFile1.m_sourceGuid);
+            EXPECT_EQ(dependency.m_platform, "pc");
+            EXPECT_EQ(dependency.m_unresolvedPath, "unresolved.txt");
+            ASSERT_LT(dependency.m_dependencySubID, NumDependenciesPerProduct);
+            if (!foundSubIds[dependency.m_dependencySubID])
+            {
+                foundSubIds[dependency.m_dependencySubID] = true;
+                ++foundSubIdCount;
+            }
+        }
+        EXPECT_EQ(foundSubIdCount, NumDependenciesPerProduct);
+    }
+
+    // Measures how many completed jobs per second are written to a database on disk, with the records of each job
+    // written one statement at a time (JobsPerBatch:0), or with the records of a number of jobs in a single write batch, as
+    // the Asset Processor does for all the jobs it finishes processing at once.  Note that the connection already runs with
+    // PRAGMA synchronous = 0, so a commit does not wait for the disk and the gains come from fewer WAL commits.
+    // For some reason, BENCHMARK_F doesn't seem to call the destructor, so the connection is released in TearDown.
+    struct AssetDatabaseWriteBenchmarks : public ::benchmark::Fixture
+    {
+        static inline constexpr int NumProductsPerJob = 4;
+        static inline constexpr int NumDependenciesPerProduct = 32;
+
+        void SetUp([[maybe_unused]] const benchmark::State& st) override
+        {
+            Init();
+        }
+
+        void SetUp([[maybe_unused]] benchmark::State& st) override
+        {
+            Init();
+        }
+
+        void TearDown([[maybe_unused]] benchmark::State& st) override
+        {
+            Destroy();
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& st) override
+        {
+            Destroy();
+        }
+
+        void Init()
+        {
+            m_databaseLocationListener = AZStd::make_unique<AssetProcessor::MockAssetDatabaseRequestsHandler>();
+            m_connection = AZStd::make_unique<AssetProcessor::AssetDatabaseConnection>();
+            m_connection->OpenDatabase();
+
+            m_scanFolder = ScanFolderDatabaseEntry("c:/O3DE/dev", "dev", "rootportkey");
+            m_connection->SetScanFolder(m_scanFolder);
+            m_jobCount = 0;
+        }
+
+        void Destroy()
+        {
+            m_connection.reset();
+            m_databaseLocationListener.reset();
+        }
+
+        //! Writes the records of one completed job: its source, the job, its products and their dependencies
+        void WriteCompletedJob()
+        {
+            ++m_jobCount;
+
+            SourceDatabaseEntry source(m_scanFolder.m_scanFolderID, AZStd::string::format("source%u.txt", m_jobCount).c_str(), AZ::Uuid::CreateRandom(), "fingerprint");
+            m_connection->SetSource(source);
+
+            JobDatabaseEntry job(source.m_sourceID, "jobkey", m_jobCount, "pc", AZ::Uuid::CreateRandom(), AzToolsFramework::AssetSystem::JobStatus::Completed, m_jobCount);
+            m_connection->SetJob(job);
+
+            // like the Asset Processor, the dependencies of all the products of the job are set with a single call
+            ProductDependencyDatabaseEntryContainer dependencies;
+            for (AZ::u32 subId = 0; subId < NumProductsPerJob; ++subId)
+            {
+                ProductDatabaseEntry product(job.m_jobID, subId, AZStd::string::format("pc/product%u_%u.bin", m_jobCount, subId).c_str(), AZ::Data::AssetType::CreateRandom());
+                m_connection->SetProduct(product);
+
+                LegacySubIDsEntry legacySubId(product.m_productID, subId);
+                m_connection->CreateOrUpdateLegacySubID(legacySubId);
+
+                for (AZ::u32 dependencySubId = 0; dependencySubId < NumDependenciesPerProduct; ++dependencySubId)
+                {
+                    dependencies.emplace_back(product.m_productID, AZ::Uuid::CreateRandom(), dependencySubId, 0, "pc", 0);
+                }
+            }
+            m_connection->SetProductDependencies(dependencies);
+        }
+
+        AZStd::unique_ptr<AssetProcessor::MockAssetDatabaseRequestsHandler> m_databaseLocationListener;
+        AZStd::unique_ptr<AssetProcessor::AssetDatabaseConnection> m_connection;
+        ScanFolderDatabaseEntry m_scanFolder;
+        AZ::u32 m_jobCount = 0;
+    };
+
+    BENCHMARK_DEFINE_F(AssetDatabaseWriteBenchmarks, BM_WriteCompletedJobs)(benchmark::State& state)
+    {
+        const int64_t jobsPerBatch = state.range(0);
+        for ([[maybe_unused]] auto unused : state)
+        {
+            if (jobsPerBatch > 0)
+            {
+                AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch writeBatch(*m_connection);
+                for (int64_t jobIndex = 0; jobIndex < jobsPerBatch; ++jobIndex)
+                {
+                    WriteCompletedJob();
+                }
+                writeBatch.Commit();
+            }
+            else
+            {
+                WriteCompletedJob();
+            }
+        }
+
+        // reported as items_per_second, the number of jobs committed per second
+        state.SetItemsProcessed(state.iterations() * AZStd::max<int64_t>(jobsPerBatch, 1));
+    }
+
+    BENCHMARK_REGISTER_F(AssetDatabaseWriteBenchmarks, BM_WriteCompletedJobs)
+        ->ArgName("JobsPerBatch")
+        ->Arg(0)
+        ->Arg(1)
+        ->Arg(16)
+        ->Unit(benchmark::kMicrosecond);
+
 } // end namespace UnitTests
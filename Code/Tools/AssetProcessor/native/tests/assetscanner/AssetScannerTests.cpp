@@ -154,4 +154,39 @@ namespace AssetProcessor
         EXPECT_FALSE(m_files.contains(tempDir.filePath("subfolder2/aaa/basefile.txt")));
         EXPECT_EQ(m_folders.size(), 0);
     }
+
+    TEST_F(AssetScannerTest, AssetScannerManyFoldersTest_FindsEveryFileOnce)
+    {
+        QDir tempDir(m_tempDir.path());
+
+        // enough folders that the walk is spread across the scan threads
+        QSet<QString> expectedFiles;
+        for (int folderIndex = 0; folderIndex < 32; ++folderIndex)
+        {
+            for (int depth = 0; depth < 3; ++depth)
+            {
+                QString folder = QString("subfolder1/folder%1").arg(folderIndex);
+                for (int level = 0; level < depth; ++level)
+                {
+                    folder += QString("/level%1").arg(level);
+                }
+                QString file = tempDir.filePath(QString("%1/file%2.txt").arg(folder).arg(depth));
+                EXPECT_TRUE(UnitTestUtils::CreateDummyFile(file));
+                expectedFiles << file;
+            }
+        }
+
+        m_assetScanner.get()->StartScan();
+
+        BlockUntilScanComplete(5000);
+
+        // the 4 files created by SetUp are also found
+        EXPECT_EQ(m_files.size(), expectedFiles.size() + 4);
+        for (const QString& expectedFile : expectedFiles)
+        {
+            EXPECT_TRUE(m_files.contains(expectedFile));
+        }
+        // 32 folders with 2 levels below each, plus subfolder2/aaa
+        EXPECT_EQ(m_folders.size(), 32 * 3 + 1);
+    }
 }
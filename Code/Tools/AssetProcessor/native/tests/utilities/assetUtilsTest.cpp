@@ -9,6 +9,8 @@
 #include <QHash>
 
 #include "native/tests/AssetProcessorTest.h"
+#include <native/tests/MockAssetDatabaseRequestsHandler.h>
+#include <native/AssetDatabase/AssetDatabase.h>
 #include <native/utilities/PlatformConfiguration.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/parallel/thread.h>
@@ -230,6 +232,40 @@ TEST_F(AssetUtilitiesTest, GenerateFingerprint_Empty_Asserts)
     m_errorAbsorber->Clear();
 }
 
+TEST_F(AssetUtilitiesTest, GenerateContentFingerprint_ModifiedTimeChanges_OnlyContentMatters)
+{
+    QTemporaryDir dir;
+    QDir tempPath(dir.path());
+    QString canonicalTempDirPath = AssetUtilities::NormalizeDirectoryPath(tempPath.canonicalPath());
+    UnitTestUtils::ScopedDir changeDir(canonicalTempDirPath);
+    tempPath = QDir(canonicalTempDirPath);
+    QString absoluteTestFilePath1 = tempPath.absoluteFilePath("basicfile.txt");
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath1, "contents"));
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_extraInformationForFingerprinting = "extra info1";
+    jobDetail.m_jobEntry.m_jobKey = "job key";
+    jobDetail.m_fingerprintFiles.insert(AZStd::make_pair(absoluteTestFilePath1.toUtf8().constData(), "basicfile.txt"));
+    AZStd::string result1 = AssetUtilities::GenerateContentFingerprint(jobDetail);
+    EXPECT_EQ(result1.size(), 40);
+
+    // rewriting the same contents changes the modification time, but not the content fingerprint
+    UnitTestUtils::SleepForMinimumFileSystemTime();
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath1, "contents"));
+    EXPECT_EQ(AssetUtilities::GenerateContentFingerprint(jobDetail), result1);
+
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath1, "contents new"));
+    AZStd::string result2 = AssetUtilities::GenerateContentFingerprint(jobDetail);
+    EXPECT_NE(result2, result1);
+
+    // the job identity and parameters are part of the fingerprint
+    jobDetail.m_jobEntry.m_platformInfo.m_identifier = "pc";
+    AZStd::string result3 = AssetUtilities::GenerateContentFingerprint(jobDetail);
+    EXPECT_NE(result3, result2);
+    jobDetail.m_jobParam[AZ_CRC_CE("param")] = "value";
+    EXPECT_NE(AssetUtilities::GenerateContentFingerprint(jobDetail), result3);
+}
+
 TEST_F(AssetUtilitiesTest, GenerateFingerprint_MissingFile_NotSameAsZeroByteFile)
 {
     QTemporaryDir dir;
@@ -496,6 +532,101 @@ TEST_F(AssetUtilitiesTest, GenerateFingerprint_GivenJobDependencies_AffectsOutco
     EXPECT_NE(fingerprint3, fingerprint1);
 }
 
+TEST_F(AssetUtilitiesTest, GenerateContentFingerprint_GivenJobDependencies_UsesDependentProductHashes)
+{
+    using namespace testing;
+    using namespace AzToolsFramework::AssetDatabase;
+    using ::testing::NiceMock;
+
+    NiceMock<AssetUtilsTest::MockJobDependencyResponder> responder;
+    responder.BusConnect();
+
+    AssetProcessor::MockAssetDatabaseRequestsHandler databaseLocationListener;
+    AssetProcessor::AssetDatabaseConnection dbConn;
+    ASSERT_TRUE(dbConn.OpenDatabase());
+
+    QTemporaryDir dir;
+    QDir tempPath(dir.path());
+    QString canonicalTempDirPath = AssetUtilities::NormalizeDirectoryPath(tempPath.canonicalPath());
+    UnitTests::MockPathConversion mockPathConversion(canonicalTempDirPath.toUtf8().constData());
+    UnitTestUtils::ScopedDir changeDir(canonicalTempDirPath);
+    tempPath = QDir(canonicalTempDirPath);
+    QString absoluteTestFilePath = tempPath.absoluteFilePath("basicfile.txt");
+    QString absoluteDependencyFilePath = tempPath.absoluteFilePath("dependency.txt");
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents"));
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteDependencyFilePath, "dependency contents"));
+
+    ScanFolderDatabaseEntry scanFolder;
+    scanFolder.m_displayName = "scanfolder";
+    scanFolder.m_portableKey = "scanfolder";
+    scanFolder.m_scanFolder = canonicalTempDirPath.toUtf8().constData();
+    ASSERT_TRUE(dbConn.SetScanFolder(scanFolder));
+    mockPathConversion.SetScanFolder(AssetProcessor::ScanFolderInfo{
+        canonicalTempDirPath, "scanfolder", "scanfolder", true, true, { AssetBuilderSDK::PlatformInfo{ "pc", {} } }, 0, scanFolder.m_scanFolderID });
+
+    SourceDatabaseEntry sourceEntry;
+    sourceEntry.m_sourceName = "dependency.txt";
+    sourceEntry.m_scanFolderPK = scanFolder.m_scanFolderID;
+    sourceEntry.m_sourceGuid = AZ::Uuid::CreateRandom();
+    ASSERT_TRUE(dbConn.SetSource(sourceEntry));
+
+    const AZ::Uuid builderUuid = AZ::Uuid::CreateRandom();
+    JobDatabaseEntry jobEntry;
+    jobEntry.m_sourcePK = sourceEntry.m_sourceID;
+    jobEntry.m_jobKey = "thing";
+    jobEntry.m_platform = "pc";
+    jobEntry.m_builderGuid = builderUuid;
+    jobEntry.m_status = AzToolsFramework::AssetSystem::JobStatus::Completed;
+    jobEntry.m_fingerprint = 0x12341234;
+    jobEntry.m_jobRunKey = 1;
+    ASSERT_TRUE(dbConn.SetJob(jobEntry));
+
+    ProductDatabaseEntry productEntry;
+    productEntry.m_jobPK = jobEntry.m_jobID;
+    productEntry.m_subID = 1;
+    productEntry.m_productName = "pc/dependency.product";
+    productEntry.m_hash = 0x1111;
+    ASSERT_TRUE(dbConn.SetProduct(productEntry));
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_jobEntry.m_jobKey = "job key";
+    jobDetail.m_fingerprintFiles.insert(AZStd::make_pair(absoluteTestFilePath.toUtf8().constData(), "basicfile.txt"));
+    AZStd::string fingerprintWithoutDependency = AssetUtilities::GenerateContentFingerprint(jobDetail);
+
+    AssetBuilderSDK::JobDependency jobDep("thing", "pc", AssetBuilderSDK::JobDependencyType::Order,
+        AssetBuilderSDK::SourceFileDependency(absoluteDependencyFilePath.toUtf8().constData(), AZ::Uuid::CreateNull()));
+    AssetProcessor::JobDependencyInternal internalJobDep(jobDep);
+    internalJobDep.m_builderUuidList.insert(builderUuid);
+    jobDetail.m_jobDependencyList.push_back(internalJobDep);
+
+    AZStd::string fingerprint1 = AssetUtilities::GenerateContentFingerprint(jobDetail);
+    EXPECT_EQ(fingerprint1.size(), 40);
+    EXPECT_NE(fingerprint1, fingerprintWithoutDependency);
+
+    // the dependent job being processed again with the same products does not change the fingerprint
+    jobEntry.m_fingerprint = 0x56785678;
+    jobEntry.m_jobRunKey = 2;
+    ASSERT_TRUE(dbConn.SetJob(jobEntry));
+    EXPECT_EQ(AssetUtilities::GenerateContentFingerprint(jobDetail), fingerprint1);
+
+    // different dependent products -> different result
+    productEntry.m_hash = 0x2222;
+    ASSERT_TRUE(dbConn.SetProduct(productEntry));
+    AZStd::string fingerprint2 = AssetUtilities::GenerateContentFingerprint(jobDetail);
+    EXPECT_EQ(fingerprint2.size(), 40);
+    EXPECT_NE(fingerprint2, fingerprint1);
+
+    // the products are not known while the dependent job is queued again with different inputs, or has not completed
+    EXPECT_CALL(responder, GetJobFingerprint(_))
+        .WillOnce(
+            Return(0x11111111));
+    EXPECT_TRUE(AssetUtilities::GenerateContentFingerprint(jobDetail).empty());
+
+    jobEntry.m_status = AzToolsFramework::AssetSystem::JobStatus::Queued;
+    ASSERT_TRUE(dbConn.SetJob(jobEntry));
+    EXPECT_TRUE(AssetUtilities::GenerateContentFingerprint(jobDetail).empty());
+}
+
 TEST_F(AssetUtilitiesTest, GetFileFingerprint_BasicTest)
 {
     QTemporaryDir dir;
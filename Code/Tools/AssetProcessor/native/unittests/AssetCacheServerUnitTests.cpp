@@ -13,9 +13,11 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #endif
 #include <AzTest/Utils.h>
+#include <AzFramework/IO/LocalFileIO.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <native/resourcecompiler/rcjob.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/ContentAddressedAssetCache.h>
 #include <native/utilities/assetUtils.h>
 #include <native/unittests/UnitTestUtils.h>
 #include <QStandardPaths>
@@ -122,7 +124,7 @@ namespace UnitTest
     TEST_F(AssetServerHandlerUnitTest, AssetCacheServer_UnConfiguredToRunAsServer_SetsFalse)
     {
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
 
         AssetProcessor::AssetServerHandler assetServerHandler;
         EXPECT_FALSE(assetServerHandler.IsServerAddressValid());
@@ -134,7 +136,7 @@ namespace UnitTest
         MockSettingsRegistry();
 
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
 
         AssetProcessor::AssetServerHandler assetServerHandler;
         EXPECT_TRUE(assetServerHandler.IsServerAddressValid());
@@ -147,7 +149,7 @@ namespace UnitTest
         MockSettingsRegistry();
 
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
 
         AssetProcessor::AssetServerHandler assetServerHandler;
         EXPECT_TRUE(assetServerHandler.IsServerAddressValid());
@@ -169,7 +171,7 @@ namespace UnitTest
         ON_CALL(m_mockArchiveCommandsBusHandler, CreateArchive(::testing::_, ::testing::_)).WillByDefault(createArchive);
 
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
         EXPECT_CALL(m_mockArchiveCommandsBusHandler, CreateArchive(::testing::_, ::testing::_)).Times(1);
 
         QObject parent{};
@@ -209,7 +211,7 @@ namespace UnitTest
         ON_CALL(m_mockArchiveCommandsBusHandler, ExtractArchive(::testing::_, ::testing::_)).WillByDefault(extractArchive);
 
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
         EXPECT_CALL(m_mockArchiveCommandsBusHandler, ExtractArchive(::testing::_, ::testing::_)).Times(1);
 
         QObject parent{};
@@ -231,4 +233,99 @@ namespace UnitTest
         EXPECT_EQ(mode, AssetServerMode::Client);
         EXPECT_TRUE(assetServerHandler.RetrieveJobResult(builderParams));
     }
+
+    TEST_F(AssetServerHandlerUnitTest, ContentAddressedCache_StoreAndRetrieve_SharesIdenticalProducts)
+    {
+        AZ::IO::LocalFileIO localFileIO;
+        AZ::IO::FileIOBase* previousFileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::FileIOBase::SetInstance(nullptr);
+        AZ::IO::FileIOBase::SetInstance(&localFileIO);
+
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+        QDir root(tempDir.GetDirectory());
+        QString cacheFolder = root.absoluteFilePath("cache");
+        QString pcJobFolder = root.absoluteFilePath("job_pc");
+        QString linuxJobFolder = root.absoluteFilePath("job_linux");
+        QString retrieveFolder = root.absoluteFilePath("retrieve");
+
+        // the same product is output by both jobs, the other product differs
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(pcJobFolder).absoluteFilePath("shared.product"), "identical contents"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(pcJobFolder).absoluteFilePath("sub/unique.product"), "pc contents"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(linuxJobFolder).absoluteFilePath("shared.product"), "identical contents"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(linuxJobFolder).absoluteFilePath("sub/unique.product"), "linux contents"));
+
+        AssetProcessor::ContentAddressedAssetCache cache(cacheFolder);
+        EXPECT_FALSE(cache.HasJobResult("pckey"));
+
+        AssetProcessor::ContentAddressedAssetCache::TransferStats stats;
+        EXPECT_TRUE(cache.StoreJobResult("pckey", pcJobFolder, {}, {}, &stats));
+        EXPECT_EQ(stats.m_fileCount, 2);
+        EXPECT_EQ(stats.m_objectsWritten, 2);
+        EXPECT_EQ(stats.m_objectsReused, 0);
+
+        EXPECT_TRUE(cache.StoreJobResult("linuxkey", linuxJobFolder, {}, {}, &stats));
+        EXPECT_EQ(stats.m_fileCount, 2);
+        EXPECT_EQ(stats.m_objectsWritten, 1);
+        EXPECT_EQ(stats.m_objectsReused, 1);
+        EXPECT_TRUE(cache.HasJobResult("pckey"));
+        EXPECT_TRUE(cache.HasJobResult("linuxkey"));
+
+        EXPECT_TRUE(cache.RetrieveJobResult("linuxkey", retrieveFolder, &stats));
+        EXPECT_EQ(stats.m_fileCount, 2);
+        QFile uniqueProduct(QDir(retrieveFolder).absoluteFilePath("sub/unique.product"));
+        ASSERT_TRUE(uniqueProduct.open(QIODevice::ReadOnly));
+        EXPECT_EQ(uniqueProduct.readAll(), QByteArray("linux contents"));
+        EXPECT_TRUE(QFile::exists(QDir(retrieveFolder).absoluteFilePath("shared.product")));
+
+        EXPECT_FALSE(cache.RetrieveJobResult("missingkey", retrieveFolder));
+
+        AZ::IO::FileIOBase::SetInstance(nullptr);
+        AZ::IO::FileIOBase::SetInstance(previousFileIO);
+    }
+
+    TEST_F(AssetServerHandlerUnitTest, ContentAddressedCache_RetrieveManifestWithEscapingPath_Fails)
+    {
+        AZ::IO::LocalFileIO localFileIO;
+        AZ::IO::FileIOBase* previousFileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::FileIOBase::SetInstance(nullptr);
+        AZ::IO::FileIOBase::SetInstance(&localFileIO);
+
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+        QDir root(tempDir.GetDirectory());
+        QString cacheFolder = root.absoluteFilePath("cache");
+        QString jobFolder = root.absoluteFilePath("job");
+        QString retrieveFolder = root.absoluteFilePath("retrieve");
+
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(jobFolder).absoluteFilePath("valid.product"), "contents"));
+        AssetProcessor::ContentAddressedAssetCache cache(cacheFolder);
+        EXPECT_TRUE(cache.StoreJobResult("validkey", jobFolder, {}, {}));
+        AZStd::string objectId = AssetProcessor::ContentAddressedAssetCache::ComputeObjectId(QDir(jobFolder).absoluteFilePath("valid.product"));
+        ASSERT_FALSE(objectId.empty());
+
+        // manifests are read from a shared folder, entries that point outside of the job folder must not be written
+        auto writeManifest = [&cacheFolder](const char* jobKey, const QString& entry)
+        {
+            QString manifestPath = QDir(cacheFolder).absoluteFilePath(QString("jobs/%1/%2.manifest").arg(QString(jobKey).left(2), jobKey));
+            return UnitTestUtils::CreateDummyFile(manifestPath, QString("O3DE content addressed job result 1\n%1\n").arg(entry));
+        };
+        EXPECT_TRUE(writeManifest("parentkey", QString("%1 ../escaped.product").arg(objectId.c_str())));
+        EXPECT_TRUE(writeManifest("nestedkey", QString("%1 sub/../../escaped.product").arg(objectId.c_str())));
+        EXPECT_TRUE(writeManifest("rootedkey", QString("%1 %2").arg(objectId.c_str(), root.absoluteFilePath("escaped.product"))));
+        EXPECT_TRUE(writeManifest("objectkey", "../../job/valid.product valid.product"));
+
+        EXPECT_FALSE(cache.RetrieveJobResult("parentkey", retrieveFolder));
+        EXPECT_FALSE(cache.RetrieveJobResult("nestedkey", retrieveFolder));
+        EXPECT_FALSE(cache.RetrieveJobResult("rootedkey", retrieveFolder));
+        EXPECT_FALSE(cache.RetrieveJobResult("objectkey", retrieveFolder));
+        EXPECT_FALSE(QFile::exists(root.absoluteFilePath("escaped.product")));
+        EXPECT_FALSE(QFile::exists(QDir(retrieveFolder).absoluteFilePath("valid.product")));
+
+        // paths that stay inside of the job folder once normalized are fine
+        EXPECT_TRUE(writeManifest("normalkey", QString("%1 sub/../normalized.product").arg(objectId.c_str())));
+        EXPECT_TRUE(cache.RetrieveJobResult("normalkey", retrieveFolder));
+        EXPECT_TRUE(QFile::exists(QDir(retrieveFolder).absoluteFilePath("normalized.product")));
+
+        AZ::IO::FileIOBase::SetInstance(nullptr);
+        AZ::IO::FileIOBase::SetInstance(previousFileIO);
+    }
 }
@@ -18,6 +18,11 @@
 #include <native/FileWatcher/FileWatcher.h>
 #include <native/unittests/UnitTestUtils.h>
 
+#if defined(AZ_PLATFORM_LINUX)
+#include <native/FileWatcher/FileWatcher_platform.h>
+#endif
+
+#include <QDateTime>
 #include <QSet>
 #include <QDir>
 #include <QString>
@@ -790,4 +795,187 @@ namespace FileWatcherTests
 
     INSTANTIATE_TEST_CASE_P(FileWatcherUnitTest, FileWatcherUnitTest_DefaultExclusions, ::testing::Bool());
 
+#if defined(AZ_PLATFORM_LINUX)
+    // These tests call into the inotify implementation directly instead of running the thread that reads the events,
+    // so that they can simulate the kernel dropping events.
+    class FileWatcherPlatformUnitTest : public ::testing::Test
+    {
+    public:
+        using NotificationType = FileWatcher::PlatformImplementation::NotificationType;
+
+        void SetUp() override
+        {
+            int dummyArgC = 0;
+            char** dummyArgV = nullptr;
+            m_app = AZStd::make_unique<QCoreApplication>(dummyArgC, dummyArgV);
+
+            m_tempDir = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_assetRootPath = QFileInfo(m_tempDir->GetDirectory()).canonicalFilePath();
+
+            m_fileWatcher = AZStd::make_unique<FileWatcher>();
+            m_fileWatcher->AddExclusion(AssetBuilderSDK::FilePatternMatcher("*ignored*", AssetBuilderSDK::AssetBuilderPattern::Wildcard));
+            m_fileWatcher->AddFolderWatch(m_assetRootPath);
+
+            QObject::connect(m_fileWatcher.get(), &FileWatcher::fileAdded, [this](QString filename)
+                {
+                    m_filesAdded.push_back(filename);
+                });
+            QObject::connect(m_fileWatcher.get(), &FileWatcher::fileRemoved, [this](QString filename)
+                {
+                    m_filesRemoved.push_back(filename);
+                });
+            QObject::connect(m_fileWatcher.get(), &FileWatcher::fileModified, [this](QString filename)
+                {
+                    m_filesModified.push_back(filename);
+                });
+        }
+
+        void TearDown() override
+        {
+            m_fileWatcher->PlatformStop();
+            m_fileWatcher.reset();
+            m_tempDir.reset();
+            m_app.reset();
+        }
+
+        //! Establishes the watches on the existing folders, without starting the thread that reads the events.
+        void StartPlatformWatch()
+        {
+            ASSERT_TRUE(m_fileWatcher->PlatformStart());
+        }
+
+        void QueueNotification(NotificationType type, const QString& path)
+        {
+            m_fileWatcher->m_platformImpl->QueueNotification(type, path);
+        }
+
+        void RescanAfterOverflow(const QDateTime& changedSince)
+        {
+            m_fileWatcher->m_platformImpl->RescanAfterOverflow(changedSince, *m_fileWatcher);
+        }
+
+        //! Sends the queued notifications and delivers the resulting signals.
+        void FlushNotifications()
+        {
+            m_fileWatcher->m_platformImpl->FlushNotifications(*m_fileWatcher);
+            QCoreApplication::processEvents(QEventLoop::AllEvents);
+        }
+
+        QString GetPath(const QString& relativePath) const
+        {
+            return QDir(m_assetRootPath).absoluteFilePath(relativePath);
+        }
+
+    protected:
+        AZStd::unique_ptr<QCoreApplication> m_app;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDir;
+        AZStd::unique_ptr<FileWatcher> m_fileWatcher;
+        QString m_assetRootPath;
+
+        // unlike FileWatcherUnitTest, these keep every modification, so that tests can count them.
+        QList<QString> m_filesAdded;
+        QList<QString> m_filesRemoved;
+        QList<QString> m_filesModified;
+    };
+
+    TEST_F(FileWatcherPlatformUnitTest, QueueNotification_RepeatedModifications_AreCoalesced)
+    {
+        StartPlatformWatch();
+
+        const QString firstFile = GetPath("first.txt");
+        const QString secondFile = GetPath("second.txt");
+
+        QueueNotification(NotificationType::Modified, firstFile);
+        QueueNotification(NotificationType::Modified, firstFile);
+        QueueNotification(NotificationType::Modified, secondFile);
+        QueueNotification(NotificationType::Modified, firstFile);
+        FlushNotifications();
+
+        // a modification is only dropped when the latest queued notification of the file is already a modification.
+        ASSERT_EQ(m_filesModified.count(), 2);
+        EXPECT_EQ(m_filesModified[0], firstFile);
+        EXPECT_EQ(m_filesModified[1], secondFile);
+        m_filesModified.clear();
+
+        // a deletion in between must not be lost or reordered.
+        QueueNotification(NotificationType::Modified, firstFile);
+        QueueNotification(NotificationType::Removed, firstFile);
+        QueueNotification(NotificationType::Added, firstFile);
+        QueueNotification(NotificationType::Modified, firstFile);
+        QueueNotification(NotificationType::Modified, firstFile);
+        FlushNotifications();
+
+        EXPECT_EQ(m_filesModified.count(), 2);
+        EXPECT_EQ(m_filesRemoved.count(), 1);
+        EXPECT_EQ(m_filesAdded.count(), 1);
+        m_filesModified.clear();
+
+        // nothing is kept from one flush to the next.
+        QueueNotification(NotificationType::Modified, firstFile);
+        FlushNotifications();
+        EXPECT_EQ(m_filesModified.count(), 1);
+    }
+
+    TEST_F(FileWatcherPlatformUnitTest, RescanAfterOverflow_ReportsChangesMadeWhileEventsWereDropped)
+    {
+        const QDateTime startTime = QDateTime::currentDateTimeUtc();
+        const QDateTime longAgo = startTime.addSecs(-3600);
+
+        // set the modification times explicitly, so that the test does not depend on the precision of file system timestamps.
+        auto createFile = [this, &longAgo](const QString& relativePath)
+        {
+            EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath(relativePath)));
+            QFile file(GetPath(relativePath));
+            EXPECT_TRUE(file.open(QFile::ReadWrite));
+            EXPECT_TRUE(file.setFileTime(longAgo, QFileDevice::FileModificationTime));
+        };
+
+        createFile("unchanged.txt");
+        createFile("modified.txt");
+        createFile("deleted.txt");
+        createFile("deleted_ignored.txt");
+        createFile("subdir/deleted.txt");
+        createFile("subdir/unchanged.txt");
+
+        StartPlatformWatch();
+
+        // the watch thread is not running, so none of these events are read, as if the inotify queue had overflowed.
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("modified.txt"), "modified"));
+        EXPECT_TRUE(QFile::remove(GetPath("deleted.txt")));
+        EXPECT_TRUE(QFile::remove(GetPath("deleted_ignored.txt")));
+        EXPECT_TRUE(QFile::remove(GetPath("subdir/deleted.txt")));
+        // a file moved in keeps its old modification time.
+        createFile("movedin.txt");
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(GetPath("newdir/added.txt")));
+
+        RescanAfterOverflow(startTime.addSecs(-60));
+        FlushNotifications();
+
+        EXPECT_EQ(m_filesRemoved.count(), 2);
+        EXPECT_TRUE(m_filesRemoved.contains(GetPath("deleted.txt")));
+        EXPECT_TRUE(m_filesRemoved.contains(GetPath("subdir/deleted.txt")));
+
+        EXPECT_EQ(m_filesAdded.count(), 3);
+        EXPECT_TRUE(m_filesAdded.contains(GetPath("movedin.txt")));
+        EXPECT_TRUE(m_filesAdded.contains(GetPath("newdir")));
+        EXPECT_TRUE(m_filesAdded.contains(GetPath("newdir/added.txt")));
+
+        EXPECT_EQ(m_filesModified.count(), 1);
+        EXPECT_TRUE(m_filesModified.contains(GetPath("modified.txt")));
+
+        // the rescan updates the known files, so a later overflow does not report the same additions and deletions again.
+        m_filesAdded.clear();
+        m_filesRemoved.clear();
+        m_filesModified.clear();
+        EXPECT_TRUE(QFile::remove(GetPath("newdir/added.txt")));
+
+        RescanAfterOverflow(startTime.addSecs(-60));
+        FlushNotifications();
+
+        ASSERT_EQ(m_filesRemoved.count(), 1);
+        EXPECT_EQ(m_filesRemoved[0], GetPath("newdir/added.txt"));
+        EXPECT_TRUE(m_filesAdded.isEmpty());
+    }
+#endif // AZ_PLATFORM_LINUX
+
 } // namespace File Watcher Tests.
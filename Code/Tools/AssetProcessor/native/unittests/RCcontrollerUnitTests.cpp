@@ -772,6 +772,55 @@ TEST_F(RCcontrollerUnitTests, TestRCController_FeedJobsWithDependencies_Dispatch
     EXPECT_TRUE(jobFinishedB);
 }
 
+TEST_F(RCcontrollerUnitTests, TestRCQueueSortModel_JobWithDependentJobs_SortsBeforeIndependentJob)
+{
+    Reset();
+    m_rcController->SetDispatchPaused(true);
+
+    auto makeJobDetails = [this](const char* fileName, const char* jobKey)
+    {
+        JobDetails jobDetails;
+        jobDetails.m_scanFolder = &TestScanFolderInfo;
+        jobDetails.m_assetBuilderDesc = m_assetBuilderDesc;
+        jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), fileName);
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = jobKey;
+        jobDetails.m_jobEntry.m_builderGuid = BuilderUuid;
+        return jobDetails;
+    };
+
+    // Job C has an order job dependency on Job B, and Job A has no dependencies.
+    // B is on the longest chain of jobs, so it should be started before A even though A was queued first.
+    JobDetails jobDetailsA = makeJobDetails("fileA.txt", "TestJobA");
+    JobDetails jobDetailsB = makeJobDetails("fileB.txt", "TestJobB");
+    JobDetails jobDetailsC = makeJobDetails("fileC.txt", "TestJobC");
+
+    AssetBuilderSDK::SourceFileDependency sourceFileBDependency;
+    sourceFileBDependency.m_sourceFileDependencyPath =
+        (AZ::IO::Path(TestScanFolderInfo.ScanPath().toUtf8().constData()) / "fileB.txt").Native();
+    AssetBuilderSDK::JobDependency jobDependencyB("TestJobB", "pc", AssetBuilderSDK::JobDependencyType::Order, sourceFileBDependency);
+    jobDetailsC.m_jobDependencyList.push_back({ jobDependencyB });
+
+    auto addJob = [this](JobDetails& jobDetails)
+    {
+        MockRCJob* job = new MockRCJob(m_rcJobListModel);
+        job->Init(jobDetails);
+        m_rcQueueSortModel->AddJobIdEntry(job);
+        m_rcJobListModel->addNewJob(job);
+        return job;
+    };
+    addJob(jobDetailsA);
+    MockRCJob* jobB = addJob(jobDetailsB);
+    addJob(jobDetailsC);
+
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), jobB);
+
+    // a job that can't be started is skipped
+    RCJob* nextJob = m_rcQueueSortModel->GetNextPendingJob([jobB](const RCJob* rcJob) { return rcJob != jobB; });
+    ASSERT_NE(nextJob, nullptr);
+    EXPECT_EQ(nextJob->GetJobKey(), QString("TestJobA"));
+}
+
 TEST_F(RCcontrollerUnitTests, TestRCController_FeedJobsWithCyclicDependencies_AllJobsFinish)
 {
     // Now test the use case where we have a cyclic dependency,
@@ -384,6 +384,7 @@ void ApplicationManagerBase::ConnectAssetCatalog()
 void ApplicationManagerBase::InitRCController()
 {
     m_rcController = new AssetProcessor::RCController(m_platformConfiguration->GetMinJobs(), m_platformConfiguration->GetMaxJobs());
+    m_rcController->SetMaxJobsPerBuilder(m_platformConfiguration->GetMaxJobsPerBuilder());
 
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetToProcess, m_rcController, &AssetProcessor::RCController::JobSubmitted);
     QObject::connect(m_rcController, &AssetProcessor::RCController::FileCompiled, m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetProcessed, Qt::UniqueConnection);
@@ -1847,8 +1848,10 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
 
                     HandleConditionalRetry(result, retryCount, builderRef, AssetProcessor::BuilderPurpose::ProcessJob);
 
+                    // a builder on another host that no longer has an input it received earlier is sent it again by the retry
                 } while ((result == AssetProcessor::BuilderRunJobOutcome::LostConnection ||
-                          result == AssetProcessor::BuilderRunJobOutcome::ProcessTerminated) &&
+                          result == AssetProcessor::BuilderRunJobOutcome::ProcessTerminated ||
+                          result == AssetProcessor::BuilderRunJobOutcome::TransferredInputsMissing) &&
                           retryCount <= AssetProcessor::RetriesForJobLostConnection);
             }
             else
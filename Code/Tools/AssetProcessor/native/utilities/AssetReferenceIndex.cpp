@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/AssetReferenceIndex.h>
+#include <native/AssetDatabase/AssetDatabase.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        char NormalizeCharacter(char character)
+        {
+            if (character == '\\')
+            {
+                return '/';
+            }
+            if (character >= 'A' && character <= 'Z')
+            {
+                return static_cast<char>(character - 'A' + 'a');
+            }
+            return character;
+        }
+
+        //! Characters that can be part of a path written in a file. Bytes of multibyte UTF-8 characters are included.
+        bool IsPathCharacter(char character)
+        {
+            return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || (character >= '0' && character <= '9') ||
+                character == '_' || character == '-' || character == '.' || character == '/' || character == '\\' ||
+                static_cast<unsigned char>(character) >= 0x80;
+        }
+
+        //! Product names start with the platform folder
+        AZStd::string_view StripPlatformFolder(AZStd::string_view productName)
+        {
+            size_t separator = productName.find('/');
+            return separator == AZStd::string_view::npos ? productName : productName.substr(separator + 1);
+        }
+    }
+
+    void AssetReferenceIndex::Refresh(AssetDatabaseConnection& databaseConnection)
+    {
+        AZStd::unordered_set<AZ::s64> productIDs;
+        databaseConnection.QueryCombined(
+            [this, &productIDs](AzToolsFramework::AssetDatabase::CombinedDatabaseEntry& entry)
+            {
+                productIDs.insert(entry.m_productID);
+                UpdateProduct(entry);
+                return true; // return true to keep iterating over further rows.
+            });
+
+        AZStd::vector<AZ::s64> removedProductIDs;
+        for (const auto& [productID, productIndex] : m_productIndices)
+        {
+            if (productIDs.find(productID) == productIDs.end())
+            {
+                removedProductIDs.push_back(productID);
+            }
+        }
+
+        for (AZ::s64 productID : removedProductIDs)
+        {
+            RemoveProduct(productID);
+        }
+    }
+
+    void AssetReferenceIndex::RefreshProducts(AssetDatabaseConnection& databaseConnection, const AZStd::unordered_set<AZ::s64>& productIDs)
+    {
+        for (AZ::s64 productID : productIDs)
+        {
+            bool found = false;
+            databaseConnection.QueryCombinedByProductID(
+                productID,
+                [this, &found](AzToolsFramework::AssetDatabase::CombinedDatabaseEntry& entry)
+                {
+                    found = true;
+                    UpdateProduct(entry);
+                    return true;
+                });
+
+            if (!found)
+            {
+                RemoveProduct(productID);
+            }
+        }
+    }
+
+    void AssetReferenceIndex::RefreshProductsOfSources(AssetDatabaseConnection& databaseConnection, const AZStd::unordered_set<AZ::s64>& sourceIDs)
+    {
+        for (AZ::s64 sourceID : sourceIDs)
+        {
+            databaseConnection.QueryCombinedBySourceID(
+                sourceID,
+                [this](AzToolsFramework::AssetDatabase::CombinedDatabaseEntry& entry)
+                {
+                    UpdateProduct(entry);
+                    return true;
+                });
+        }
+    }
+
+    void AssetReferenceIndex::UpdateProduct(const AzToolsFramework::AssetDatabase::CombinedDatabaseEntry& entry)
+    {
+        // products keep their ID when their job runs again, so check whether anything the index uses changed
+        const Product* product = GetProduct(entry.m_productID);
+        if (!product || product->m_subID != entry.m_subID || product->m_sourceGuid != entry.m_sourceGuid ||
+            product->m_productName != NormalizePath(entry.m_productName) || product->m_sourceName != NormalizePath(entry.m_sourceName))
+        {
+            AddProduct({ entry.m_productID, entry.m_sourceGuid, entry.m_subID, entry.m_productName, entry.m_sourceName });
+        }
+    }
+
+    void AssetReferenceIndex::AddProduct(Product product)
+    {
+        RemoveProduct(product.m_productID);
+
+        product.m_productName = NormalizePath(product.m_productName);
+        product.m_sourceName = NormalizePath(product.m_sourceName);
+
+        AZ::u32 productIndex = 0;
+        if (m_freeProductIndices.empty())
+        {
+            productIndex = aznumeric_cast<AZ::u32>(m_products.size());
+            m_products.push_back(AZStd::move(product));
+        }
+        else
+        {
+            productIndex = m_freeProductIndices.back();
+            m_freeProductIndices.pop_back();
+            m_products[productIndex] = AZStd::move(product);
+        }
+
+        const Product& addedProduct = m_products[productIndex];
+        m_productIndices[addedProduct.m_productID] = productIndex;
+        m_productsBySource.emplace(addedProduct.m_sourceGuid, productIndex);
+        for (AZ::u8 keyType = 0; keyType < KeyTypeCount; ++keyType)
+        {
+            AZStd::string_view key = GetKey(addedProduct, static_cast<KeyType>(keyType));
+            if (!key.empty())
+            {
+                m_keys.emplace(HashKey(static_cast<KeyType>(keyType), key), productIndex);
+            }
+        }
+    }
+
+    void AssetReferenceIndex::RemoveProduct(AZ::s64 productID)
+    {
+        auto productIndexIter = m_productIndices.find(productID);
+        if (productIndexIter == m_productIndices.end())
+        {
+            return;
+        }
+
+        const AZ::u32 productIndex = productIndexIter->second;
+        const Product& product = m_products[productIndex];
+
+        auto eraseProductIndex = [productIndex](auto& multimap, const auto& key)
+        {
+            auto range = multimap.equal_range(key);
+            for (auto entry = range.first; entry != range.second; ++entry)
+            {
+                if (entry->second == productIndex)
+                {
+                    multimap.erase(entry);
+                    return;
+                }
+            }
+        };
+
+        for (AZ::u8 keyType = 0; keyType < KeyTypeCount; ++keyType)
+        {
+            AZStd::string_view key = GetKey(product, static_cast<KeyType>(keyType));
+            if (!key.empty())
+            {
+                eraseProductIndex(m_keys, HashKey(static_cast<KeyType>(keyType), key));
+            }
+        }
+        eraseProductIndex(m_productsBySource, product.m_sourceGuid);
+
+        m_products[productIndex] = {};
+        m_freeProductIndices.push_back(productIndex);
+        m_productIndices.erase(productIndexIter);
+    }
+
+    void AssetReferenceIndex::Clear()
+    {
+        m_products.clear();
+        m_freeProductIndices.clear();
+        m_productIndices.clear();
+        m_keys.clear();
+        m_productsBySource.clear();
+    }
+
+    size_t AssetReferenceIndex::GetProductCount() const
+    {
+        return m_productIndices.size();
+    }
+
+    const AssetReferenceIndex::Product* AssetReferenceIndex::GetProduct(AZ::s64 productID) const
+    {
+        auto productIndexIter = m_productIndices.find(productID);
+        return productIndexIter == m_productIndices.end() ? nullptr : &m_products[productIndexIter->second];
+    }
+
+    void AssetReferenceIndex::FindReferences(AZStd::string_view text, const ReferenceCallback& callback) const
+    {
+        // reused for every path of the text
+        AZStd::string normalizedPath;
+        AZStd::vector<AZStd::pair<size_t, size_t>> candidates;
+
+        size_t position = 0;
+        while (position < text.size())
+        {
+            if (!IsPathCharacter(text[position]))
+            {
+                ++position;
+                continue;
+            }
+
+            size_t pathStart = position;
+            while (position < text.size() && IsPathCharacter(text[position]))
+            {
+                ++position;
+            }
+
+            // a period at the end is more likely to end a sentence than to be part of the file name
+            size_t pathEnd = position;
+            while (pathEnd > pathStart && text[pathEnd - 1] == '.')
+            {
+                --pathEnd;
+            }
+
+            FindReferencesInPath(text, pathStart, pathEnd, callback, normalizedPath, candidates);
+        }
+    }
+
+    void AssetReferenceIndex::FindReferencesInPath(
+        AZStd::string_view text,
+        size_t pathStart,
+        size_t pathEnd,
+        const ReferenceCallback& callback,
+        AZStd::string& normalizedPath,
+        AZStd::vector<AZStd::pair<size_t, size_t>>& candidates) const
+    {
+        // The candidates are the whole path and every end of it that starts after a slash, longest first,
+        // as (offset in the normalized path, offset in the text).
+        normalizedPath.clear();
+        candidates.clear();
+        candidates.emplace_back(0, pathStart);
+
+        bool hasFolderOrExtension = false;
+        for (size_t position = pathStart; position < pathEnd; ++position)
+        {
+            char character = NormalizeCharacter(text[position]);
+            if (character == '/')
+            {
+                hasFolderOrExtension = true;
+                if (!normalizedPath.empty() && normalizedPath.back() == '/')
+                {
+                    // collapse repeated slashes, and start the candidate after the last one
+                    if (candidates.back().first == normalizedPath.size())
+                    {
+                        candidates.back().second = position + 1;
+                    }
+                    continue;
+                }
+
+                normalizedPath.push_back(character);
+                if (position + 1 < pathEnd)
+                {
+                    candidates.emplace_back(normalizedPath.size(), position + 1);
+                }
+                continue;
+            }
+
+            hasFolderOrExtension = hasFolderOrExtension || character == '.';
+            normalizedPath.push_back(character);
+        }
+
+        // a single word is far more likely to be text than a reference to an asset
+        if (!hasFolderOrExtension)
+        {
+            return;
+        }
+
+        AZStd::string_view path(normalizedPath);
+        size_t fileNameStart = path.rfind('/');
+        AZStd::string_view fileName = fileNameStart == AZStd::string_view::npos ? path : path.substr(fileNameStart + 1);
+
+        // every product path ends with the file name of the product, so only sources can match when no product has that name
+        const bool isProductFileName = HasKey(KeyType::ProductFileName, fileName);
+        for (const auto& [normalizedOffset, textOffset] : candidates)
+        {
+            AZStd::string_view candidate = path.substr(normalizedOffset);
+            if (HasKey(KeyType::SourceName, candidate) ||
+                (isProductFileName && (HasKey(KeyType::ProductPath, candidate) || HasKey(KeyType::ProductSubPath, candidate))))
+            {
+                callback(textOffset, pathEnd - textOffset);
+                return;
+            }
+        }
+
+        if (isProductFileName)
+        {
+            callback(pathStart, pathEnd - pathStart);
+        }
+    }
+
+    void AssetReferenceIndex::FindProductsBySourceName(AZStd::string_view path, const ProductCallback& callback) const
+    {
+        FindProducts(KeyType::SourceName, NormalizePath(path), [this, &callback](AZ::u32 productIndex)
+        {
+            callback(m_products[productIndex]);
+        });
+    }
+
+    void AssetReferenceIndex::FindProductsByPath(
+        AZStd::string_view path, AZStd::string_view referencingProductName, const ProductCallback& callback) const
+    {
+        // a product may match more than one way, only report it once
+        AZStd::vector<AZ::u32> productIndices;
+        auto addProduct = [&productIndices](AZ::u32 productIndex)
+        {
+            if (AZStd::find(productIndices.begin(), productIndices.end(), productIndex) == productIndices.end())
+            {
+                productIndices.push_back(productIndex);
+            }
+        };
+
+        AZStd::string normalizedPath = NormalizePath(path);
+        FindProducts(KeyType::ProductPath, normalizedPath, addProduct);
+        FindProducts(KeyType::ProductSubPath, normalizedPath, addProduct);
+
+        if (!referencingProductName.empty())
+        {
+            // the path may be relative to the folder of the referencing product, on the same platform
+            AZStd::string relativeProductName = NormalizePath(referencingProductName);
+            relativeProductName.erase(relativeProductName.rfind('/') + 1);
+            relativeProductName = NormalizePath(relativeProductName + normalizedPath);
+            FindProducts(KeyType::ProductPath, StripPlatformFolder(relativeProductName),
+                [this, &addProduct, &relativeProductName](AZ::u32 productIndex)
+                {
+                    if (m_products[productIndex].m_productName == relativeProductName)
+                    {
+                        addProduct(productIndex);
+                    }
+                });
+        }
+
+        for (AZ::u32 productIndex : productIndices)
+        {
+            callback(m_products[productIndex]);
+        }
+    }
+
+    void AssetReferenceIndex::FindProductsOfSource(const AZ::Uuid& sourceGuid, const ProductCallback& callback) const
+    {
+        auto range = m_productsBySource.equal_range(sourceGuid);
+        for (auto entry = range.first; entry != range.second; ++entry)
+        {
+            callback(m_products[entry->second]);
+        }
+    }
+
+    AZStd::string AssetReferenceIndex::NormalizePath(AZStd::string_view path)
+    {
+        AZStd::string normalizedPath;
+        normalizedPath.reserve(path.size());
+        for (char character : path)
+        {
+            character = NormalizeCharacter(character);
+            if (character == '/' && !normalizedPath.empty() && normalizedPath.back() == '/')
+            {
+                continue;
+            }
+            normalizedPath.push_back(character);
+        }
+        return normalizedPath;
+    }
+
+    AZStd::string_view AssetReferenceIndex::GetKey(const Product& product, KeyType keyType)
+    {
+        AZStd::string_view productName(product.m_productName);
+        switch (keyType)
+        {
+        case KeyType::ProductPath:
+            return StripPlatformFolder(productName);
+        case KeyType::ProductSubPath:
+        {
+            AZStd::string_view productPath = StripPlatformFolder(productName);
+            size_t separator = productPath.find('/');
+            return separator == AZStd::string_view::npos ? AZStd::string_view() : productPath.substr(separator + 1);
+        }
+        case KeyType::ProductFileName:
+        {
+            size_t separator = productName.rfind('/');
+            return separator == AZStd::string_view::npos ? productName : productName.substr(separator + 1);
+        }
+        case KeyType::SourceName:
+            return product.m_sourceName;
+        }
+        return {};
+    }
+
+    size_t AssetReferenceIndex::HashKey(KeyType keyType, AZStd::string_view key)
+    {
+        size_t hash = static_cast<size_t>(keyType);
+        AZStd::hash_combine(hash, key);
+        return hash;
+    }
+
+    bool AssetReferenceIndex::HasKey(KeyType keyType, AZStd::string_view key) const
+    {
+        auto range = m_keys.equal_range(HashKey(keyType, key));
+        for (auto entry = range.first; entry != range.second; ++entry)
+        {
+            if (GetKey(m_products[entry->second], keyType) == key)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void AssetReferenceIndex::FindProducts(
+        KeyType keyType, AZStd::string_view key, const AZStd::function<void(AZ::u32 productIndex)>& callback) const
+    {
+        if (key.empty())
+        {
+            return;
+        }
+
+        auto range = m_keys.equal_range(HashKey(keyType, key));
+        for (auto entry = range.first; entry != range.second; ++entry)
+        {
+            // different keys may share a hash
+            if (GetKey(m_products[entry->second], keyType) == key)
+            {
+                callback(entry->second);
+            }
+        }
+    }
+} // namespace AssetProcessor
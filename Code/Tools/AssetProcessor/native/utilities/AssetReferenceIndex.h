@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AzToolsFramework::AssetDatabase
+{
+    class CombinedDatabaseEntry;
+}
+
+namespace AssetProcessor
+{
+    class AssetDatabaseConnection;
+
+    //! AssetReferenceIndex finds the paths in a text that refer to products in the asset database, for the missing
+    //! dependency scanner. Every product is indexed under the paths a file is expected to use to refer to it:
+    //!     - its path without the platform folder, such as "project/textures/a.dds" for "pc/project/textures/a.dds"
+    //!     - that path without its first folder, which is usually the scan folder, such as "textures/a.dds"
+    //!     - the name of its source, relative to the scan folder of the source
+    //! and under its file name, which is used to find paths relative to the folder of the product being scanned.
+    //! Paths are compared case insensitively, with either slash and with repeated slashes collapsed.
+    //!
+    //! The index only holds hashes of these paths and the position of the product, so looking up a path costs one hash
+    //! lookup instead of a query matching the end of every product name in the database. It is updated incrementally:
+    //! Refresh only adds the products that are new to it and drops those that were removed from the database, and
+    //! RefreshProducts and RefreshProductsOfSources only read the products that are known to have changed.
+    //! Lookups don't modify the index, so any number of threads can look up paths while it isn't being refreshed.
+    class AssetReferenceIndex
+    {
+    public:
+        struct Product
+        {
+            AZ::s64 m_productID = -1;
+            AZ::Uuid m_sourceGuid = AZ::Uuid::CreateNull();
+            AZ::u32 m_subID = 0;
+            AZStd::string m_productName; //!< Normalized, including the platform folder
+            AZStd::string m_sourceName; //!< Normalized, relative to the scan folder of the source
+        };
+
+        using ProductCallback = AZStd::function<void(const Product& product)>;
+        //! Called with the offset and length of a reference in the text that was searched
+        using ReferenceCallback = AZStd::function<void(size_t offset, size_t length)>;
+
+        //! Adds the products of the database that are not indexed yet and removes those that are no longer in it
+        void Refresh(AssetDatabaseConnection& databaseConnection);
+
+        //! Reads the products with the IDs from the database again, removing those that are no longer in it
+        void RefreshProducts(AssetDatabaseConnection& databaseConnection, const AZStd::unordered_set<AZ::s64>& productIDs);
+
+        //! Reads the products of the sources with the IDs from the database again. This doesn't remove the products that
+        //! were removed with their source, since the index doesn't know which source they belonged to.
+        void RefreshProductsOfSources(AssetDatabaseConnection& databaseConnection, const AZStd::unordered_set<AZ::s64>& sourceIDs);
+
+        //! Adds the product, replacing any product with the same ID. Its names don't need to be normalized.
+        void AddProduct(Product product);
+        void RemoveProduct(AZ::s64 productID);
+        void Clear();
+
+        size_t GetProductCount() const;
+
+        //! Returns the product with the ID, or nullptr if it isn't indexed
+        const Product* GetProduct(AZ::s64 productID) const;
+
+        //! Calls the callback with every reference to a known asset in the text. A reference is a path, or the end of a path
+        //! starting after one of its slashes, that is indexed for a product or a source. A path that isn't indexed but
+        //! ends with the file name of a product is reported whole, since it may be relative to the product being scanned.
+        void FindReferences(AZStd::string_view text, const ReferenceCallback& callback) const;
+
+        //! Calls the callback with every product of the sources named by the path
+        void FindProductsBySourceName(AZStd::string_view path, const ProductCallback& callback) const;
+
+        //! Calls the callback with every product the path refers to, either with its own path or with a path relative to the
+        //! folder of the referencing product, which is the product name of the file being scanned and may be empty.
+        void FindProductsByPath(AZStd::string_view path, AZStd::string_view referencingProductName, const ProductCallback& callback) const;
+
+        //! Calls the callback with every product of the source with the UUID
+        void FindProductsOfSource(const AZ::Uuid& sourceGuid, const ProductCallback& callback) const;
+
+        //! Returns the path in lower case with forward slashes and without repeated slashes, the form the index compares.
+        static AZStd::string NormalizePath(AZStd::string_view path);
+
+    private:
+        enum class KeyType : AZ::u8
+        {
+            ProductPath,
+            ProductSubPath,
+            ProductFileName,
+            SourceName
+        };
+        static constexpr AZ::u8 KeyTypeCount = 4;
+
+        //! Adds the product of the entry, unless it is indexed already with the same names and IDs
+        void UpdateProduct(const AzToolsFramework::AssetDatabase::CombinedDatabaseEntry& entry);
+
+        static AZStd::string_view GetKey(const Product& product, KeyType keyType);
+        static size_t HashKey(KeyType keyType, AZStd::string_view key);
+
+        bool HasKey(KeyType keyType, AZStd::string_view key) const;
+        void FindProducts(KeyType keyType, AZStd::string_view key, const AZStd::function<void(AZ::u32 productIndex)>& callback) const;
+        void FindReferencesInPath(
+            AZStd::string_view text,
+            size_t pathStart,
+            size_t pathEnd,
+            const ReferenceCallback& callback,
+            AZStd::string& normalizedPath,
+            AZStd::vector<AZStd::pair<size_t, size_t>>& candidates) const;
+
+        //! Products by position; removed products leave an empty slot, which is reused by the next added product
+        AZStd::vector<Product> m_products;
+        AZStd::vector<AZ::u32> m_freeProductIndices;
+        AZStd::unordered_map<AZ::s64, AZ::u32> m_productIndices;
+        //! Hash of the key type and the key, to the position of the product
+        AZStd::unordered_multimap<size_t, AZ::u32> m_keys;
+        AZStd::unordered_multimap<AZ::Uuid, AZ::u32> m_productsBySource;
+    };
+} // namespace AssetProcessor
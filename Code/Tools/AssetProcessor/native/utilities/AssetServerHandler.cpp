@@ -7,6 +7,7 @@
  */
 
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/ContentAddressedAssetCache.h>
 #include <native/resourcecompiler/rcjob.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
@@ -85,6 +86,20 @@ namespace AssetProcessor
         return {};
     }
 
+    bool CheckContentAddressed()
+    {
+        bool contentAddressed = false;
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(contentAddressed,
+                AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorServerKey)
+                + "/"
+                + ContentAddressedCacheKey);
+        }
+        return contentAddressed;
+    }
+
     QString AssetServerHandler::ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
     {
         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
@@ -134,6 +149,7 @@ namespace AssetProcessor
     {
         SetRemoteCachingMode(CheckServerMode());
         SetServerAddress(CheckServerAddress());
+        SetContentAddressed(CheckContentAddressed());
         AssetServerBus::Handler::BusConnect();
     }
 
@@ -249,8 +265,23 @@ namespace AssetProcessor
         return true;
     }
 
+    bool AssetServerHandler::IsContentAddressed() const
+    {
+        return m_contentAddressed;
+    }
+
+    void AssetServerHandler::SetContentAddressed(bool contentAddressed)
+    {
+        m_contentAddressed = contentAddressed;
+    }
+
     bool AssetServerHandler::RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams)
     {
+        if (m_contentAddressed && !builderParams.m_contentKey.empty())
+        {
+            return RetrieveContentAddressedJobResult(builderParams);
+        }
+
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
@@ -288,6 +319,11 @@ namespace AssetProcessor
 
     bool AssetServerHandler::StoreJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList)
     {
+        if (m_contentAddressed && !builderParams.m_contentKey.empty())
+        {
+            return StoreContentAddressedJobResult(builderParams, sourceFileList);
+        }
+
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
@@ -371,4 +407,87 @@ namespace AssetProcessor
         }
         return allSuccess;
     }
+
+    bool AssetServerHandler::RetrieveContentAddressedJobResult(const AssetProcessor::BuilderParams& builderParams)
+    {
+        AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
+        AssetUtilities::QuitListener listener;
+        listener.BusConnect();
+
+        if (!IsServerAddressValid())
+        {
+            AZ_Error(AssetProcessor::DebugChannel, false, "Retrieving content addressed job result failed. Server address is not valid.");
+            return false;
+        }
+
+        ContentAddressedAssetCache cache(QString::fromUtf8(m_serverAddress.c_str()));
+        if (!cache.HasJobResult(builderParams.m_contentKey))
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieving content addressed job result canceled. Result does not exist on server. \n");
+            return false;
+        }
+
+        if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieving content addressed job result canceled. \n");
+            return false;
+        }
+
+        ContentAddressedAssetCache::TransferStats stats;
+        bool success = cache.RetrieveJobResult(builderParams.m_contentKey, QString::fromUtf8(builderParams.GetTempJobDirectory().c_str()), &stats);
+        AZ_Error(AssetProcessor::DebugChannel, success, "Retrieving content addressed job result failed.\n");
+        if (success)
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieved job (%s, %s, %s) with content key (%s), %llu files, %llu bytes.\n",
+                builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_contentKey.c_str(),
+                stats.m_fileCount, stats.m_bytesTransferred);
+        }
+        return success;
+    }
+
+    bool AssetServerHandler::StoreContentAddressedJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList)
+    {
+        AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
+        AssetUtilities::QuitListener listener;
+        listener.BusConnect();
+
+        if (!IsServerAddressValid())
+        {
+            AZ_Error(AssetProcessor::DebugChannel, false, "Storing content addressed job result failed. Server address is not valid.");
+            return false;
+        }
+
+        ContentAddressedAssetCache cache(QString::fromUtf8(m_serverAddress.c_str()));
+        if (cache.HasJobResult(builderParams.m_contentKey))
+        {
+            // the same inputs were already processed, possibly on another branch or machine
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Storing content addressed job result canceled. A result for this content already exists on server. \n");
+            return true;
+        }
+
+        if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Storing content addressed job result canceled. \n");
+            return false;
+        }
+
+        QFileInfo sourceFile{ builderParams.m_rcJob->GetJobEntry().GetAbsoluteSourcePath() };
+        ContentAddressedAssetCache::TransferStats stats;
+        bool success = cache.StoreJobResult(
+            builderParams.m_contentKey,
+            QString::fromUtf8(builderParams.GetTempJobDirectory().c_str()),
+            sourceFile.absolutePath(),
+            sourceFileList,
+            &stats);
+        AZ_Error(AssetProcessor::DebugChannel, success, "Storing content addressed job result failed. \n");
+        if (success)
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Stored job (%s, %s, %s) with content key (%s), %llu files, %llu new objects, %llu reused objects.\n",
+                builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_contentKey.c_str(),
+                stats.m_fileCount, stats.m_objectsWritten, stats.m_objectsReused);
+        }
+        return success;
+    }
 }// AssetProcessor
@@ -15,6 +15,7 @@ namespace AssetProcessor
 {
     inline constexpr const char* AssetCacheServerModeKey{ "assetCacheServerMode" };
     inline constexpr const char* CacheServerAddressKey{ "cacheServerAddress" };
+    inline constexpr const char* ContentAddressedCacheKey{ "contentAddressedCache" };
 
     //! AssetServerHandler is implementing asset server using network share.
     class AssetServerHandler
@@ -44,14 +45,22 @@ namespace AssetProcessor
         const AZStd::string& GetServerAddress() const override;
         //! Store the remote folder location for the shared cache 
         bool SetServerAddress(const AZStd::string& address) override;
+        //! Returns true if job results are stored by content in the shared cache instead of as one archive per job
+        bool IsContentAddressed() const;
+        //! Store job results by content in the shared cache instead of as one archive per job
+        void SetContentAddressed(bool contentAddressed);
     protected:
         //! Source files intended to be copied into the cache don't go through out temp folder so they need
         //! to be added to the Archive in an additional step
         bool AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList);
         QString ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams);
+        //! Content addressed versions of StoreJobResult and RetrieveJobResult, see ContentAddressedAssetCache
+        bool StoreContentAddressedJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList);
+        bool RetrieveContentAddressedJobResult(const AssetProcessor::BuilderParams& builderParams);
         
     private:
         AssetServerMode m_assetCachingMode = AssetServerMode::Inactive;
         AZStd::string m_serverAddress;
+        bool m_contentAddressed = false;
     };
 } //namespace AssetProcessor
@@ -11,6 +11,8 @@
 #include <AzCore/Settings/CommandLine.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/Utils/Utils.h>
 #include <utilities/Builder.h>
@@ -29,6 +31,122 @@ namespace AssetProcessor
         return m_connectionId > 0;
     }
 
+    bool Builder::TransfersFiles() const
+    {
+        return m_transferFiles;
+    }
+
+    bool Builder::AddInputFiles(AssetBuilder::ProcessJobNetRequest& netRequest) const
+    {
+        // The list of files to transfer is only meant for the AP, builders don't see it
+        AZStd::string transferredInputFiles;
+        AssetBuilderSDK::JobParameterMap& jobParameters = netRequest.m_request.m_jobDescription.m_jobParameters;
+        auto transferredInputFilesItr = jobParameters.find(AZ_CRC_CE(AssetProcessor::TransferredInputFilesKey));
+        if (transferredInputFilesItr != jobParameters.end())
+        {
+            transferredInputFiles = AZStd::move(transferredInputFilesItr->second);
+            jobParameters.erase(transferredInputFilesItr);
+        }
+
+        if (!m_transferFiles)
+        {
+            return true;
+        }
+
+        const AssetBuilderSDK::ProcessJobRequest& request = netRequest.m_request;
+        netRequest.m_transferFiles = true;
+
+        // Only files in the scan folder of the source are sent.  Anything else builders read, like engine and gem files,
+        // must be available on the host of the builder.
+        AZStd::vector<AZ::IO::PathView> inputPaths{ AZ::IO::PathView(request.m_fullPath) };
+        for (const AssetBuilderSDK::SourceFileDependency& sourceDependency : request.m_sourceFileDependencyList)
+        {
+            inputPaths.emplace_back(sourceDependency.m_sourceFileDependencyPath);
+        }
+        AZ::StringFunc::TokenizeVisitor(
+            transferredInputFiles,
+            [&inputPaths](AZStd::string_view inputPath)
+            {
+                inputPaths.emplace_back(inputPath);
+            },
+            '\n');
+
+        const AZ::IO::PathView watchFolder(request.m_watchFolder);
+        for (const AZ::IO::PathView& inputPath : inputPaths)
+        {
+            if (!inputPath.IsRelativeTo(watchFolder))
+            {
+                continue;
+            }
+
+            AssetBuilder::TransferredFile& inputFile = netRequest.m_inputFiles.emplace_back();
+            inputFile.m_relativePath = inputPath.LexicallyRelative(watchFolder).StringAsPosix();
+            if (!inputFile.ReadFrom(AZ::IO::FixedMaxPath(inputPath).c_str()))
+            {
+                AZ_Error("Builder", false, "Failed to read %.*s to send it to builder %s", AZ_STRING_ARG(inputPath.Native()), UuidString().c_str());
+                return false;
+            }
+
+            if (!inputFile.m_contents.empty() && m_transferredInputHashes.contains(inputFile.m_hash))
+            {
+                inputFile.m_contents.clear();
+            }
+        }
+
+        return true;
+    }
+
+    BuilderRunJobOutcome Builder::ExtractOutputFiles(
+        const AssetBuilder::ProcessJobNetRequest& netRequest, AssetBuilder::ProcessJobNetResponse& netResponse) const
+    {
+        if (!netRequest.m_transferFiles)
+        {
+            return BuilderRunJobOutcome::Ok;
+        }
+
+        // Only the inputs the builder confirms it stored are not sent again.  An input that was not sent because the builder
+        // was expected to have it, but which it doesn't have, fails the job on the builder and is sent again on the next run.
+        const AZStd::unordered_set<AZ::u64> storedInputHashes(netResponse.m_storedInputHashes.begin(), netResponse.m_storedInputHashes.end());
+        bool inputsMissing = false;
+        for (const AssetBuilder::TransferredFile& inputFile : netRequest.m_inputFiles)
+        {
+            if (storedInputHashes.contains(inputFile.m_hash))
+            {
+                m_transferredInputHashes.insert(inputFile.m_hash);
+            }
+            else
+            {
+                inputsMissing = inputsMissing || inputFile.m_contents.empty();
+                m_transferredInputHashes.erase(inputFile.m_hash);
+            }
+        }
+
+        if (inputsMissing)
+        {
+            AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Builder %s is missing inputs of %s, sending them again\n",
+                UuidString().c_str(), netRequest.m_request.m_sourceFile.c_str());
+            return BuilderRunJobOutcome::TransferredInputsMissing;
+        }
+
+        const AZ::IO::Path tempDirPath(netRequest.m_request.m_tempDirPath);
+        for (const AssetBuilder::TransferredFile& outputFile : netResponse.m_outputFiles)
+        {
+            if (!outputFile.WriteTo(tempDirPath.c_str()))
+            {
+                AZ_Error("Builder", false, "Failed to write product %s received from builder %s", outputFile.m_relativePath.c_str(), UuidString().c_str());
+                return BuilderRunJobOutcome::FailedToTransferFiles;
+            }
+        }
+
+        // the builder names products relative to its own temp folder
+        for (AssetBuilderSDK::JobProduct& product : netResponse.m_response.m_outputProducts)
+        {
+            product.m_productFileName = (tempDirPath / product.m_productFileName).LexicallyNormal().Native();
+        }
+
+        return BuilderRunJobOutcome::Ok;
+    }
+
     AZ::Outcome<void, AZStd::string> Builder::WaitForConnection()
     {
         if (m_startupWaitTimeS == 0)
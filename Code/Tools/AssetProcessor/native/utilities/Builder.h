@@ -7,8 +7,10 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AssetBuilder/AssetBuilderStatic.h>
 #include <utilities/assetUtils.h>
 #include <AzFramework/Process/ProcessWatcher.h>
 #include <AzFramework/Process/ProcessCommunicatorTracePrinter.h>
@@ -31,7 +33,9 @@ namespace AssetProcessor
         JobCancelled,
         ResponseFailure,
         FailedToDecodeResponse,
-        FailedToWriteDebugRequest
+        FailedToWriteDebugRequest,
+        FailedToTransferFiles,
+        TransferredInputsMissing
     };
 
     //! Wrapper for managing a single builder process and sending job requests to it
@@ -62,6 +66,9 @@ namespace AssetProcessor
         //! Returns true if the builder exe has established a connection
         bool IsConnected() const;
 
+        //! Returns true if the builder runs on another host, and receives job inputs and sends back products over its connection
+        bool TransfersFiles() const;
+
         //! Blocks waiting for the builder to establish a connection
         AZ::Outcome<void, AZStd::string> WaitForConnection();
 
@@ -107,6 +114,27 @@ namespace AssetProcessor
             AZ::u32 processTimeoutLimitInSeconds,
             AZStd::binary_semaphore* waitEvent) const;
 
+        //! Adds the source, source dependencies and the files listed in the TransferredInputFilesKey job parameter to the request,
+        //! for builders that transfer files.  The job parameter is removed for all builders.
+        //! Only ProcessJob requests have files to transfer.
+        template<typename TNetRequest>
+        bool AddInputFiles(TNetRequest& /*netRequest*/) const
+        {
+            return true;
+        }
+        bool AddInputFiles(AssetBuilder::ProcessJobNetRequest& netRequest) const;
+
+        //! Writes the products received from builders that transfer files to the temp folder of the job, and records the inputs
+        //! the builder stored.  Returns TransferredInputsMissing if the builder no longer had an input that wasn't sent again,
+        //! in which case running the job again sends it.
+        template<typename TNetRequest, typename TNetResponse>
+        BuilderRunJobOutcome ExtractOutputFiles(const TNetRequest& /*netRequest*/, TNetResponse& /*netResponse*/) const
+        {
+            return BuilderRunJobOutcome::Ok;
+        }
+        BuilderRunJobOutcome ExtractOutputFiles(
+            const AssetBuilder::ProcessJobNetRequest& netRequest, AssetBuilder::ProcessJobNetResponse& netResponse) const;
+
         //! Writes the request out to disk for debug purposes and logs info on how to manually run the asset builder
         template<typename TRequest>
         bool DebugWriteRequestFile(
@@ -136,6 +164,13 @@ namespace AssetProcessor
 
         //! Time to wait in seconds for a builder to startup before timing out.
         AZ::s64 m_startupWaitTimeS = 0;
+
+        //! Indicates if the builder runs on another host, see TransfersFiles
+        bool m_transferFiles = false;
+
+        //! Hashes of the job inputs the builder reported as stored, which are not sent again.
+        //! Only accessed by the thread holding the builder reference.
+        mutable AZStd::unordered_set<AZ::u64> m_transferredInputHashes;
     };
 
     //! Scoped reference to a builder. Destructor returns the builder to the free builders pool
@@ -7,6 +7,7 @@
  */
 
 #include <utilities/BuilderManager.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/API/ApplicationAPI.h>
@@ -22,6 +23,11 @@ namespace AssetProcessor
 
     BuilderManager::BuilderManager(ConnectionManager* connectionManager)
     {
+        if (const auto* settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(m_allowUnmanagedBuilderConnections, "/Amazon/AssetProcessor/Settings/BuilderManager/AllowRemoteBuilders");
+        }
+
         using namespace AZStd::placeholders;
         connectionManager->RegisterService(AssetBuilder::BuilderHelloRequest::MessageType(), AZStd::bind(&BuilderManager::IncomingBuilderPing, this, _1, _2, _3, _4, _5));
 
@@ -89,8 +95,13 @@ namespace AssetProcessor
             {
                 if (m_allowUnmanagedBuilderConnections)
                 {
-                    AZ_TracePrintf("BuilderManager", "External builder connection accepted for ProcessJob work\n");
+                    AZ_TracePrintf("BuilderManager", "External builder connection accepted for ProcessJob work%s\n",
+                        requestPing.m_transferFiles ? ", job files will be transferred over the connection" : "");
                     builder = AddNewBuilder(BuilderPurpose::ProcessJob); // We only accept external connections for ProcessJob builders
+                    if (builder)
+                    {
+                        builder->m_transferFiles = requestPing.m_transferFiles;
+                    }
                 }
                 else
                 {
@@ -98,7 +109,7 @@ namespace AssetProcessor
                         "BuilderManager",
                         false,
                         "Received request ping from builder but could not match uuid %s to list of builders started by this AssetProcessor instance.  "
-                        "If you intended to connect an external builder, please set BuilderManager::m_allowUnmanagedBuilderConnections to true to allow this.",
+                        "If you intended to connect an external builder, please set /Amazon/AssetProcessor/Settings/BuilderManager/AllowRemoteBuilders to true to allow this.",
                         requestPing.m_uuid.ToString<AZStd::string>().c_str());
                 }
             }
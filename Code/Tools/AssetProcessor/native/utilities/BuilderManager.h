@@ -89,7 +89,8 @@ namespace AssetProcessor
         // This is done this way so that it can be output in order, to track down race conditions with asset builders.
         AZStd::unordered_map<AZ::Uuid, BuilderDebugOutput> m_builderDebugOutput;
 
-        //! Indicates if we allow builders to connect that we haven't started up ourselves.  Useful for debugging
+        //! Indicates if we allow builders to connect that we haven't started up ourselves, like builders running on other hosts.
+        //! Set with /Amazon/AssetProcessor/Settings/BuilderManager/AllowRemoteBuilders
         bool m_allowUnmanagedBuilderConnections = false;
 
         //! Responsible for going through all the idle builders and pumping their communicators so they don't stall
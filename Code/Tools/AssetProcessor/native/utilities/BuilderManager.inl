@@ -19,6 +19,11 @@ namespace AssetProcessor
         TNetResponse netResponse;
         netRequest.m_request = request;
 
+        if (!AddInputFiles(netRequest))
+        {
+            return BuilderRunJobOutcome::FailedToTransferFiles;
+        }
+
         struct BuildTracker final
         {
             BuildTracker(const Builder& builder, const AZStd::string& sourceFile, const AZStd::string& task)
@@ -71,6 +76,12 @@ namespace AssetProcessor
             return BuilderRunJobOutcome::FailedToDecodeResponse;
         }
 
+        result = ExtractOutputFiles(netRequest, netResponse);
+        if (result != BuilderRunJobOutcome::Ok)
+        {
+            return result;
+        }
+
         if (!netResponse.m_response.Succeeded() || s_createRequestFileForSuccessfulJob)
         {
             // we write the request out to disk for failure or debugging
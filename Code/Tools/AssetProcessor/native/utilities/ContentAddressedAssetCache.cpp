@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/ContentAddressedAssetCache.h>
+#include <native/assetprocessor.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/IO/Path/Path.h>
+#include <QCoreApplication>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QThread>
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        constexpr const char* ManifestHeader = "O3DE content addressed job result 1";
+
+        QString GetShardedPath(const QString& folder, const AZStd::string& name, const char* extension)
+        {
+            QString fileName = QString("%1%2").arg(name.c_str(), extension);
+            return QDir(folder).filePath(QString("%1/%2").arg(fileName.left(2), fileName));
+        }
+
+        //! Write the file next to its destination and move it in place, so other readers of the cache never see it partially written.
+        bool CommitFile(const QString& temporaryPath, const QString& destinationPath)
+        {
+            if (QFile::rename(temporaryPath, destinationPath))
+            {
+                return true;
+            }
+
+            // another process may have committed the same file first, which is fine since the contents are identical
+            QFile::remove(temporaryPath);
+            return QFile::exists(destinationPath);
+        }
+
+        //! Object ids are hexadecimal, anything else in a manifest could address a file outside of the objects folder.
+        bool IsValidObjectId(const AZStd::string& objectId)
+        {
+            return !objectId.empty() && objectId.find_first_not_of("0123456789abcdef") == AZStd::string::npos;
+        }
+
+        //! Manifests come from a shared folder, make sure the product paths in them can't write outside of the job folder.
+        bool NormalizeManifestPath(const QString& manifestPath, AZ::IO::FixedMaxPath& relativePath)
+        {
+            relativePath = AZ::IO::PathView(manifestPath.toUtf8().constData()).LexicallyNormal();
+            return !relativePath.empty() && !relativePath.HasRootPath() && relativePath.begin()->Native() != "..";
+        }
+
+        QString GetTemporaryPath(const QString& destinationPath)
+        {
+            // unique per process and thread, since several builders may store the same file at once
+            return QString("%1.%2.%3.tmp")
+                .arg(destinationPath)
+                .arg(QCoreApplication::applicationPid())
+                .arg(reinterpret_cast<quintptr>(QThread::currentThreadId()), 0, 16);
+        }
+    }
+
+    ContentAddressedAssetCache::ContentAddressedAssetCache(const QString& cacheFolder)
+        : m_cacheFolder(cacheFolder)
+    {
+    }
+
+    QString ContentAddressedAssetCache::GetObjectPath(const AZStd::string& objectId) const
+    {
+        return GetShardedPath(QDir(m_cacheFolder).filePath("objects"), objectId, "");
+    }
+
+    QString ContentAddressedAssetCache::GetManifestPath(const AZStd::string& jobKey) const
+    {
+        return GetShardedPath(QDir(m_cacheFolder).filePath("jobs"), jobKey, ".manifest");
+    }
+
+    AZStd::string ContentAddressedAssetCache::ComputeObjectId(const QString& filePath)
+    {
+        QFileInfo fileInfo(filePath);
+        if (!fileInfo.isFile() || !fileInfo.isReadable())
+        {
+            return {};
+        }
+
+        AZ::IO::SizeType bytesRead = 0;
+        AZ::u64 fileHash = AssetBuilderSDK::GetFileHash(filePath.toUtf8().constData(), &bytesRead);
+        if (bytesRead != static_cast<AZ::IO::SizeType>(fileInfo.size()))
+        {
+            // the file changed while it was hashed
+            return {};
+        }
+
+        // the size is part of the id so a hash collision also requires files of the same size
+        return AZStd::string::format("%016llx%llx", static_cast<unsigned long long>(fileHash), static_cast<unsigned long long>(bytesRead));
+    }
+
+    bool ContentAddressedAssetCache::HasJobResult(const AZStd::string& jobKey) const
+    {
+        return !jobKey.empty() && QFile::exists(GetManifestPath(jobKey));
+    }
+
+    bool ContentAddressedAssetCache::StoreObject(const QString& filePath, const AZStd::string& objectId, TransferStats& stats) const
+    {
+        QString objectPath = GetObjectPath(objectId);
+        if (QFile::exists(objectPath))
+        {
+            ++stats.m_objectsReused;
+            return true;
+        }
+
+        QFileInfo objectInfo(objectPath);
+        if (!objectInfo.absoluteDir().exists() && !objectInfo.absoluteDir().mkpath("."))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not make cache object folder %s", objectInfo.absolutePath().toUtf8().constData());
+            return false;
+        }
+
+        QString temporaryPath = GetTemporaryPath(objectPath);
+        QFile::remove(temporaryPath);
+        if (!QFile::copy(filePath, temporaryPath) || !CommitFile(temporaryPath, objectPath))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not store %s in the cache as %s", filePath.toUtf8().constData(), objectPath.toUtf8().constData());
+            return false;
+        }
+
+        ++stats.m_objectsWritten;
+        stats.m_bytesTransferred += QFileInfo(filePath).size();
+        return true;
+    }
+
+    bool ContentAddressedAssetCache::StoreJobResult(
+        const AZStd::string& jobKey,
+        const QString& jobDirectory,
+        const QString& sourceDirectory,
+        const AZStd::vector<AZStd::string>& sourceFileList,
+        TransferStats* stats)
+    {
+        if (jobKey.empty())
+        {
+            return false;
+        }
+
+        // collect (relative path, absolute path) of every file of the result
+        AZStd::vector<AZStd::pair<QString, QString>> files;
+        QDir jobDir(jobDirectory);
+        QDirIterator dirIterator(jobDirectory, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (dirIterator.hasNext())
+        {
+            QString filePath = dirIterator.next();
+            files.emplace_back(jobDir.relativeFilePath(filePath), filePath);
+        }
+
+        QDir sourceDir(sourceDirectory);
+        for (const AZStd::string& sourceFile : sourceFileList)
+        {
+            files.emplace_back(QString::fromUtf8(sourceFile.c_str()), sourceDir.absoluteFilePath(sourceFile.c_str()));
+        }
+
+        TransferStats localStats;
+        QString manifest;
+        QTextStream manifestStream(&manifest);
+        manifestStream << ManifestHeader << "\n";
+        for (const auto& [relativePath, filePath] : files)
+        {
+            AZ::IO::FixedMaxPath normalizedRelativePath;
+            if (!NormalizeManifestPath(relativePath, normalizedRelativePath))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Could not store %s in the cache, it is not relative to the job", relativePath.toUtf8().constData());
+                return false;
+            }
+
+            AZStd::string objectId = ComputeObjectId(filePath);
+            if (objectId.empty())
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Could not read %s to store it in the cache", filePath.toUtf8().constData());
+                return false;
+            }
+
+            if (!StoreObject(filePath, objectId, localStats))
+            {
+                return false;
+            }
+
+            manifestStream << objectId.c_str() << " " << normalizedRelativePath.StringAsPosix().c_str() << "\n";
+            ++localStats.m_fileCount;
+        }
+        manifestStream.flush();
+
+        QString manifestPath = GetManifestPath(jobKey);
+        QFileInfo manifestInfo(manifestPath);
+        if (!manifestInfo.absoluteDir().exists() && !manifestInfo.absoluteDir().mkpath("."))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not make cache job folder %s", manifestInfo.absolutePath().toUtf8().constData());
+            return false;
+        }
+
+        QString temporaryPath = GetTemporaryPath(manifestPath);
+        QFile manifestFile(temporaryPath);
+        if (!manifestFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not write cache manifest %s", temporaryPath.toUtf8().constData());
+            return false;
+        }
+        QByteArray manifestData = manifest.toUtf8();
+        bool written = manifestFile.write(manifestData) == manifestData.size();
+        manifestFile.close();
+        if (!written || !CommitFile(temporaryPath, manifestPath))
+        {
+            QFile::remove(temporaryPath);
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not write cache manifest %s", manifestPath.toUtf8().constData());
+            return false;
+        }
+
+        if (stats)
+        {
+            *stats = localStats;
+        }
+        return true;
+    }
+
+    bool ContentAddressedAssetCache::RetrieveJobResult(const AZStd::string& jobKey, const QString& jobDirectory, TransferStats* stats) const
+    {
+        if (jobKey.empty())
+        {
+            return false;
+        }
+
+        QFile manifestFile(GetManifestPath(jobKey));
+        if (!manifestFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            return false;
+        }
+
+        QTextStream manifestStream(&manifestFile);
+        if (manifestStream.readLine() != ManifestHeader)
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Cache manifest %s has an unknown format", manifestFile.fileName().toUtf8().constData());
+            return false;
+        }
+
+        TransferStats localStats;
+        QDir jobDir(jobDirectory);
+        while (!manifestStream.atEnd())
+        {
+            QString line = manifestStream.readLine();
+            if (line.isEmpty())
+            {
+                continue;
+            }
+
+            int separator = line.indexOf(' ');
+            if (separator <= 0)
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Cache manifest %s is malformed", manifestFile.fileName().toUtf8().constData());
+                return false;
+            }
+
+            AZStd::string objectId = line.left(separator).toUtf8().constData();
+            QString relativePath = line.mid(separator + 1);
+            AZ::IO::FixedMaxPath normalizedRelativePath;
+            if (!IsValidObjectId(objectId) || !NormalizeManifestPath(relativePath, normalizedRelativePath))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Cache manifest %s has an invalid entry: %s",
+                    manifestFile.fileName().toUtf8().constData(), line.toUtf8().constData());
+                return false;
+            }
+            QString objectPath = GetObjectPath(objectId);
+            QString targetPath = jobDir.absoluteFilePath(QString::fromUtf8(normalizedRelativePath.c_str()));
+
+            QFileInfo targetInfo(targetPath);
+            if (!targetInfo.absoluteDir().exists() && !targetInfo.absoluteDir().mkpath("."))
+            {
+                return false;
+            }
+
+            QFile::remove(targetPath);
+            if (!QFile::copy(objectPath, targetPath))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Cache object %s for %s is missing", objectPath.toUtf8().constData(), relativePath.toUtf8().constData());
+                return false;
+            }
+
+            ++localStats.m_fileCount;
+            localStats.m_bytesTransferred += QFileInfo(targetPath).size();
+        }
+
+        if (stats)
+        {
+            *stats = localStats;
+        }
+        return true;
+    }
+} // namespace AssetProcessor
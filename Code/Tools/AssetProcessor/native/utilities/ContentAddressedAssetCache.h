@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! ContentAddressedAssetCache stores job results in a shared folder, addressed by their content instead of by job.
+    //! Every file produced by a job is stored once as an object named after the hash of its contents, and each job
+    //! result is a small manifest, named after the content fingerprint of the job, which lists the relative paths of
+    //! its files and the objects holding them. Identical products of different jobs, platforms or branches share the
+    //! same objects, and a job whose inputs are unchanged finds its manifest even when their modification times changed.
+    //!
+    //! Layout of the cache folder:
+    //!     objects/<first two characters of the object id>/<object id>
+    //!     jobs/<first two characters of the job key>/<job key>.manifest
+    class ContentAddressedAssetCache
+    {
+    public:
+        //! Statistics of a single store or retrieve operation
+        struct TransferStats
+        {
+            AZ::u64 m_fileCount = 0; //!< files listed in the job manifest
+            AZ::u64 m_objectsWritten = 0; //!< objects that were new to the cache
+            AZ::u64 m_objectsReused = 0; //!< objects that were already in the cache
+            AZ::u64 m_bytesTransferred = 0; //!< bytes copied to or from the cache
+        };
+
+        explicit ContentAddressedAssetCache(const QString& cacheFolder);
+
+        //! Returns true if a result has been stored for the job key
+        bool HasJobResult(const AZStd::string& jobKey) const;
+
+        //! Store every file of the job directory, and the listed files relative to the source directory, as the result
+        //! of the job key. Objects already in the cache are not copied again. The manifest is written last so readers
+        //! never see a partial result.
+        bool StoreJobResult(
+            const AZStd::string& jobKey,
+            const QString& jobDirectory,
+            const QString& sourceDirectory,
+            const AZStd::vector<AZStd::string>& sourceFileList,
+            TransferStats* stats = nullptr);
+
+        //! Copy every file of the result stored for the job key into the job directory.
+        bool RetrieveJobResult(const AZStd::string& jobKey, const QString& jobDirectory, TransferStats* stats = nullptr) const;
+
+        //! Returns the id of the object that stores the contents of the file, or an empty string if it can't be read.
+        static AZStd::string ComputeObjectId(const QString& filePath);
+
+    protected:
+        QString GetObjectPath(const AZStd::string& objectId) const;
+        QString GetManifestPath(const AZStd::string& jobKey) const;
+        //! Copy the file to the object, unless the object already exists.
+        bool StoreObject(const QString& filePath, const AZStd::string& objectId, TransferStats& stats) const;
+
+    private:
+        QString m_cacheFolder;
+    };
+} // namespace AssetProcessor
@@ -7,6 +7,7 @@
  */
 
 #include "LineByLineDependencyScanner.h"
+#include "AssetReferenceIndex.h"
 #include "assetprocessor.h"
 #include "PotentialDependencies.h"
 
@@ -109,23 +110,36 @@ namespace AssetProcessor
             }
         });
 
-        // We'll first break up the input string into blocks that *could* contain a path.  This is a faster and simpler regex test
-        // For each block, we'll do a quick string check to see if it contains a path separator or a file extension (.)
-        // Only if we find one will we do the more expensive path regex check
-        SearchResult pathSearchResult = GlobalSearch(scanString, maxScanIteration, AZStd::regex(R"~(([^:*?<>|" ]+))~"), [this, &maxScanIteration, &potentialDependencies, &pathRegex](const AZStd::smatch& matchResult)
+        SearchResult pathSearchResult = SearchResult::Completed;
+        if (m_assetReferenceIndex)
         {
-            AZStd::string stringSection = matchResult[1].str();
-            if(stringSection.find('\\') != AZStd::string::npos || stringSection.find('/') != AZStd::string::npos || stringSection.find('.') != AZStd::string::npos)
+            // The index finds every reference to a known asset in a single pass over the string, so there is no scan limit to hit.
+            m_assetReferenceIndex->FindReferences(scanString, [this, &scanString, &potentialDependencies](size_t offset, size_t length)
             {
-                return GlobalSearch(stringSection, maxScanIteration, pathRegex, [this, &potentialDependencies](const AZStd::smatch& pathMatchResult)
+                PotentialDependencyMetaData dependencyMetaData(scanString.substr(offset, length), shared_from_this());
+                potentialDependencies.m_paths.insert(dependencyMetaData);
+            });
+        }
+        else
+        {
+            // We'll first break up the input string into blocks that *could* contain a path.  This is a faster and simpler regex test
+            // For each block, we'll do a quick string check to see if it contains a path separator or a file extension (.)
+            // Only if we find one will we do the more expensive path regex check
+            pathSearchResult = GlobalSearch(scanString, maxScanIteration, AZStd::regex(R"~(([^:*?<>|" ]+))~"), [this, &maxScanIteration, &potentialDependencies, &pathRegex](const AZStd::smatch& matchResult)
+            {
+                AZStd::string stringSection = matchResult[1].str();
+                if(stringSection.find('\\') != AZStd::string::npos || stringSection.find('/') != AZStd::string::npos || stringSection.find('.') != AZStd::string::npos)
                 {
-                    AZStd::string potentialPath = pathMatchResult[1].str();
-                    PotentialDependencyMetaData dependencyMetaData(potentialPath, shared_from_this());
-                    potentialDependencies.m_paths.insert(dependencyMetaData);
-                });
-            }
-            return SearchResult::Completed;
-        });
+                    return GlobalSearch(stringSection, maxScanIteration, pathRegex, [this, &potentialDependencies](const AZStd::smatch& pathMatchResult)
+                    {
+                        AZStd::string potentialPath = pathMatchResult[1].str();
+                        PotentialDependencyMetaData dependencyMetaData(potentialPath, shared_from_this());
+                        potentialDependencies.m_paths.insert(dependencyMetaData);
+                    });
+                }
+                return SearchResult::Completed;
+            });
+        }
 
         // If any scan did not complete, return that result.
         // There should only be one warning per file.
@@ -157,6 +171,11 @@ namespace AssetProcessor
         return uuidSearchString;
     }
 
+    void LineByLineDependencyScanner::SetAssetReferenceIndex(const AssetReferenceIndex* assetReferenceIndex)
+    {
+        m_assetReferenceIndex = assetReferenceIndex;
+    }
+
     bool LineByLineDependencyScanner::ScanFileForPotentialDependencies(
         AZ::IO::GenericStream& fileStream,
         PotentialDependencies& potentialDependencies,
@@ -12,11 +12,16 @@
 
 namespace AssetProcessor
 {
+    class AssetReferenceIndex;
 
     /// Scans a given file stream for anything that looks like a path, asset ID, or UUID.
     class LineByLineDependencyScanner : public SpecializedDependencyScanner
     {
     public:
+        /// When an index of known assets is set, only paths that refer to an asset in the index are reported,
+        /// and they are found with the index instead of the path regexes. The index must outlive the scans.
+        void SetAssetReferenceIndex(const AssetReferenceIndex* assetReferenceIndex);
+
         bool ScanFileForPotentialDependencies(AZ::IO::GenericStream& fileStream, PotentialDependencies& potentialDependencies, int maxScanIteration) override;
         bool DoesScannerMatchFileData(AZ::IO::GenericStream& fileStream) override;
         bool DoesScannerMatchFileExtension(const AZStd::string& fullPath) override;
@@ -40,5 +45,7 @@ namespace AssetProcessor
             const AZStd::regex& uuidRegex,
             const AZStd::regex& pathRegex,
             PotentialDependencies& potentialDependencies);
+
+        const AssetReferenceIndex* m_assetReferenceIndex = nullptr;
     };
 }
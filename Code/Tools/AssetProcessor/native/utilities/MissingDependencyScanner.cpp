@@ -18,6 +18,7 @@ AZ_POP_DISABLE_WARNING
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/wildcard.h>
@@ -26,6 +27,8 @@ AZ_POP_DISABLE_WARNING
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/FileTag/FileTag.h>
 #include <AzFramework/FileTag/FileTagBus.h>
+#include <QVector>
+#include <QtConcurrent/QtConcurrentMap>
 
 namespace AssetProcessor
 {
@@ -86,12 +89,15 @@ namespace AssetProcessor
     MissingDependencyScanner::MissingDependencyScanner()
     {
         m_defaultScanner = AZStd::make_shared<LineByLineDependencyScanner>();
+        m_defaultScanner->SetAssetReferenceIndex(&m_assetReferenceIndex);
         ApplicationManagerNotifications::Bus::Handler::BusConnect();
         MissingDependencyScannerRequestBus::Handler::BusConnect();
+        AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Handler::BusConnect();
     }
 
     MissingDependencyScanner::~MissingDependencyScanner()
     {
+        AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Handler::BusDisconnect();
         MissingDependencyScannerRequestBus::Handler::BusDisconnect();
         ApplicationManagerNotifications::Bus::Handler::BusDisconnect();
     }
@@ -105,6 +111,65 @@ namespace AssetProcessor
         AZ::SystemTickBus::ExecuteQueuedEvents();
     }
 
+    void MissingDependencyScanner::OnSourceFileChanged(const AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry)
+    {
+        // the products of the source are indexed under its name and UUID
+        AZStd::lock_guard<AZStd::mutex> lock(m_databaseChangesMutex);
+        m_changedSourceIDs.insert(entry.m_sourceID);
+    }
+
+    void MissingDependencyScanner::OnSourceFileRemoved([[maybe_unused]] AZ::s64 sourceId)
+    {
+        // the products of the source are removed with it, without a notification for each of them
+        AZStd::lock_guard<AZStd::mutex> lock(m_databaseChangesMutex);
+        m_refreshAllProducts = true;
+    }
+
+    void MissingDependencyScanner::OnProductFileChanged(const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_databaseChangesMutex);
+        m_changedProductIDs.insert(entry.m_productID);
+    }
+
+    void MissingDependencyScanner::OnProductFileRemoved(AZ::s64 productId)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_databaseChangesMutex);
+        m_changedProductIDs.insert(productId);
+    }
+
+    void MissingDependencyScanner::OnProductFilesRemoved(const AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer& products)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_databaseChangesMutex);
+        for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
+        {
+            m_changedProductIDs.insert(product.m_productID);
+        }
+    }
+
+    void MissingDependencyScanner::UpdateAssetReferenceIndex(AssetDatabaseConnection& databaseConnection)
+    {
+        // take the changes first, so those notified while the index is updated are applied on the next scan
+        AZStd::unordered_set<AZ::s64> changedProductIDs;
+        AZStd::unordered_set<AZ::s64> changedSourceIDs;
+        bool refreshAllProducts = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_databaseChangesMutex);
+            changedProductIDs.swap(m_changedProductIDs);
+            changedSourceIDs.swap(m_changedSourceIDs);
+            refreshAllProducts = m_refreshAllProducts;
+            m_refreshAllProducts = false;
+        }
+
+        if (refreshAllProducts || m_assetReferenceIndex.GetProductCount() == 0)
+        {
+            m_assetReferenceIndex.Refresh(databaseConnection);
+            return;
+        }
+
+        m_assetReferenceIndex.RefreshProductsOfSources(databaseConnection, changedSourceIDs);
+        m_assetReferenceIndex.RefreshProducts(databaseConnection, changedProductIDs);
+    }
+
     void MissingDependencyScanner::ScanFile(const AZStd::string& fullPath, int maxScanIteration, AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection, const AZStd::string& dependencyTokenName, bool queueDbCommandsOnMainThread, scanFileCallback callback)
     {
         AZ::s64 productPK = -1;
@@ -125,6 +190,14 @@ namespace AssetProcessor
         ScanFile(fullPath, maxScanIteration, productPK, dependencies, databaseConnection, "", ScannerMatchType::ExtensionOnlyFirstMatch, nullptr, queueDbCommandsOnMainThread, callback);
     }
 
+    struct MissingDependencyScanner::PendingFileScan
+    {
+        const FileToScan* m_file = nullptr;
+        AZStd::string m_analysisFingerprint;
+        FileScanResult m_result = FileScanResult::ScanFailed;
+        PotentialDependencies m_potentialDependencies;
+    };
+
     void MissingDependencyScanner::ScanFile(
         const AZStd::string& fullPath,
         int maxScanIteration,
@@ -136,10 +209,109 @@ namespace AssetProcessor
         AZ::Crc32* forceScanner,
         bool queueDbCommandsOnMainThread,
         scanFileCallback callback)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_scanMutex);
+
+        AZStd::string analysisFingerprint;
+        if (!PrepareFileScan(fullPath, productPK, databaseConnection, queueDbCommandsOnMainThread, callback, analysisFingerprint))
+        {
+            return;
+        }
+
+        UpdateAssetReferenceIndex(*databaseConnection);
+
+        PotentialDependencies potentialDependencies;
+        FileScanResult result = ScanFileContents(fullPath, maxScanIteration, matchType, forceScanner, potentialDependencies);
+        CompleteFileScan(
+            result,
+            productPK,
+            dependencies,
+            databaseConnection,
+            dependencyTokenName,
+            analysisFingerprint,
+            potentialDependencies,
+            queueDbCommandsOnMainThread,
+            callback);
+    }
+
+    void MissingDependencyScanner::ScanFiles(
+        const AZStd::vector<FileToScan>& files,
+        int maxScanIteration,
+        AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection,
+        const AZStd::string& dependencyTokenName,
+        scanFileCallback callback)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_scanMutex);
+
+        // the whole database is read anyway, so the pending changes don't need to be read one by one
+        {
+            AZStd::lock_guard<AZStd::mutex> changesLock(m_databaseChangesMutex);
+            m_changedProductIDs.clear();
+            m_changedSourceIDs.clear();
+            m_refreshAllProducts = false;
+        }
+        m_assetReferenceIndex.Refresh(*databaseConnection);
+
+        // Scan the files in batches, so the potential dependencies of every file don't have to be held at once.
+        // Only reading and scanning the files happens in parallel, everything using the database runs on this thread.
+        constexpr size_t FilesPerBatch = 256;
+        for (size_t batchStart = 0; batchStart < files.size(); batchStart += FilesPerBatch)
+        {
+            const size_t batchEnd = AZStd::min(files.size(), batchStart + FilesPerBatch);
+
+            QVector<PendingFileScan> batch;
+            for (size_t fileIndex = batchStart; fileIndex < batchEnd; ++fileIndex)
+            {
+                PendingFileScan pendingScan;
+                pendingScan.m_file = &files[fileIndex];
+                if (PrepareFileScan(
+                        pendingScan.m_file->m_fullPath,
+                        pendingScan.m_file->m_productPK,
+                        databaseConnection,
+                        /*queueDbCommandsOnMainThread*/ false,
+                        callback,
+                        pendingScan.m_analysisFingerprint))
+                {
+                    batch.push_back(AZStd::move(pendingScan));
+                }
+            }
+
+            QtConcurrent::blockingMap(batch, [this, maxScanIteration](PendingFileScan& pendingScan)
+            {
+                pendingScan.m_result = ScanFileContents(
+                    pendingScan.m_file->m_fullPath,
+                    maxScanIteration,
+                    ScannerMatchType::ExtensionOnlyFirstMatch,
+                    nullptr,
+                    pendingScan.m_potentialDependencies);
+            });
+
+            for (const PendingFileScan& pendingScan : batch)
+            {
+                CompleteFileScan(
+                    pendingScan.m_result,
+                    pendingScan.m_file->m_productPK,
+                    pendingScan.m_file->m_dependencies,
+                    databaseConnection,
+                    dependencyTokenName,
+                    pendingScan.m_analysisFingerprint,
+                    pendingScan.m_potentialDependencies,
+                    /*queueDbCommandsOnMainThread*/ false,
+                    callback);
+            }
+        }
+    }
+
+    bool MissingDependencyScanner::PrepareFileScan(
+        const AZStd::string& fullPath,
+        AZ::s64 productPK,
+        AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection,
+        bool queueDbCommandsOnMainThread,
+        scanFileCallback callback,
+        AZStd::string& analysisFingerprint)
     {
         using namespace AzFramework::FileTag;
         AZ_Printf(AssetProcessor::ConsoleChannel, "Scanning for missing dependencies:\t%s\n", fullPath.c_str());
-        AzToolsFramework::AssetDatabase::SourceDatabaseEntry sourceEntry;
         if (productPK != -1)
         {
             AZStd::vector<AZStd::vector<AZStd::string>> excludedTagsList = {
@@ -149,7 +321,9 @@ namespace AssetProcessor
             {
                 FileTags[static_cast<unsigned int>(FileTagsIndex::Shader)]
             } };
+            AzToolsFramework::AssetDatabase::SourceDatabaseEntry sourceEntry;
             databaseConnection->GetSourceByProductID(productPK, sourceEntry);
+            analysisFingerprint = sourceEntry.m_analysisFingerprint;
 
             for (const AZStd::vector<AZStd::string>& tags : excludedTagsList)
             {
@@ -164,11 +338,11 @@ namespace AssetProcessor
                     SetDependencyScanResultStatus(
                         ignoredByTagText,
                         productPK,
-                        sourceEntry.m_analysisFingerprint,
+                        analysisFingerprint,
                         databaseConnection,
                         queueDbCommandsOnMainThread,
                         callback);
-                    return;
+                    return false;
                 }
             }
         }
@@ -183,37 +357,62 @@ namespace AssetProcessor
             if (shouldIgnore)
             {
                 AZ_Printf(AssetProcessor::ConsoleChannel, "File ( %s ) will be skipped by the missing dependency scanner.\n", fullPath.c_str());
-                return;
+                return false;
             }
         }
+        return true;
+    }
 
+    MissingDependencyScanner::FileScanResult MissingDependencyScanner::ScanFileContents(
+        const AZStd::string& fullPath,
+        int maxScanIteration,
+        ScannerMatchType matchType,
+        AZ::Crc32* forceScanner,
+        PotentialDependencies& potentialDependencies)
+    {
         AZ::IO::FileIOStream fileStream;
         if (!fileStream.Open(fullPath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary))
         {
             AZ_Error(AssetProcessor::ConsoleChannel, false, "File at path %s could not be opened.", fullPath.c_str());
+            return FileScanResult::OpenFailed;
+        }
 
+        bool scanSuccessful = RunScan(fullPath, maxScanIteration, fileStream, potentialDependencies, matchType, forceScanner);
+        fileStream.Close();
+        return scanSuccessful ? FileScanResult::Scanned : FileScanResult::ScanFailed;
+    }
+
+    void MissingDependencyScanner::CompleteFileScan(
+        FileScanResult result,
+        AZ::s64 productPK,
+        const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer& dependencies,
+        AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection,
+        const AZStd::string& dependencyTokenName,
+        const AZStd::string& analysisFingerprint,
+        const PotentialDependencies& potentialDependencies,
+        bool queueDbCommandsOnMainThread,
+        scanFileCallback callback)
+    {
+        if (result == FileScanResult::OpenFailed)
+        {
             // Record that this file was ignored in the database, so the asset tab can display this information.
             SetDependencyScanResultStatus(
                 "The file could not be opened.",
                 productPK,
-                sourceEntry.m_analysisFingerprint,
+                analysisFingerprint,
                 databaseConnection,
                 queueDbCommandsOnMainThread,
                 callback);
             return;
         }
 
-        PotentialDependencies potentialDependencies;
-        bool scanSuccessful = RunScan(fullPath, maxScanIteration, fileStream, potentialDependencies, matchType, forceScanner);
-        fileStream.Close();
-
-        if (!scanSuccessful)
+        if (result == FileScanResult::ScanFailed)
         {
             // RunScan will report an error on what caused the scan to fail.
             SetDependencyScanResultStatus(
                 "An error occured, see log for details.",
                 productPK,
-                sourceEntry.m_analysisFingerprint,
+                analysisFingerprint,
                 databaseConnection,
                 queueDbCommandsOnMainThread,
                 callback);
@@ -221,7 +420,7 @@ namespace AssetProcessor
         }
 
         MissingDependencies missingDependencies;
-        PopulateMissingDependencies(productPK, databaseConnection, dependencies, missingDependencies, potentialDependencies);
+        PopulateMissingDependencies(productPK, dependencies, missingDependencies, potentialDependencies);
 
         if (queueDbCommandsOnMainThread && !m_shutdownRequested)
         {
@@ -341,314 +540,125 @@ namespace AssetProcessor
 
     void MissingDependencyScanner::PopulateMissingDependencies(
         AZ::s64 productPK,
-        AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection,
         const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer& dependencies,
         MissingDependencies& missingDependencies,
         const PotentialDependencies& potentialDependencies)
     {
+        // Everything is resolved with the index of known assets, which was refreshed before the file was scanned,
+        // instead of querying the database for every path, UUID and asset ID found in the file.
         // If a file references itself, don't report it.
-        AzToolsFramework::AssetDatabase::SourceDatabaseEntry fileWithPotentialMissingDependencies;
-        databaseConnection->GetSourceByProductID(productPK, fileWithPotentialMissingDependencies);
-
-        AZStd::map<AZ::Uuid, PotentialDependencyMetaData> uuids(potentialDependencies.m_uuids);
-        AZStd::map<AZ::Data::AssetId, PotentialDependencyMetaData> assetIds(potentialDependencies.m_assetIds);
-
-        // Check if any products exist for the given job, and those products have a sub ID that matches
-        // the expected sub ID.
-        AzToolsFramework::AssetDatabase::ProductDatabaseEntry productWithPotentialMissingDependencies;
-        databaseConnection->GetProductByProductID(productPK, productWithPotentialMissingDependencies);
-        QString scannedProductPath( productWithPotentialMissingDependencies.m_productName.c_str() );
-        auto lastSeparatorIndex = scannedProductPath.lastIndexOf(AZ_CORRECT_DATABASE_SEPARATOR_STRING);
-        scannedProductPath = scannedProductPath.remove(lastSeparatorIndex + 1, scannedProductPath.length());
-
-        // Check the existing product dependency list for the file that is being scanned, remove
-        // any potential UUIDs that match dependencies already being emitted.
-        for (const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry&
-            existingDependency : dependencies)
-        {
-            AZStd::map<AZ::Uuid, PotentialDependencyMetaData>::iterator matchingDependency =
-                uuids.find(existingDependency.m_dependencySourceGuid);
-            if (matchingDependency != uuids.end())
-            {
-                uuids.erase(matchingDependency);
-            }
+        AZ::Uuid sourceGuidWithPotentialMissingDependencies = AZ::Uuid::CreateNull();
+        AZ::u32 subIdWithPotentialMissingDependencies = 0;
+        AZStd::string productNameWithPotentialMissingDependencies;
+        if (const AssetReferenceIndex::Product* scannedProduct = m_assetReferenceIndex.GetProduct(productPK))
+        {
+            sourceGuidWithPotentialMissingDependencies = scannedProduct->m_sourceGuid;
+            subIdWithPotentialMissingDependencies = scannedProduct->m_subID;
+            productNameWithPotentialMissingDependencies = scannedProduct->m_productName;
         }
 
-        // Remove all UUIDs that don't match an asset in the database.
-        for (AZStd::map<AZ::Uuid, PotentialDependencyMetaData>::iterator uuidIter = uuids.begin();
-            uuidIter != uuids.end();
-            ++uuidIter)
+        auto dependencyExistsForSource = [&dependencies](const AZ::Uuid& sourceGuid)
         {
-            if (fileWithPotentialMissingDependencies.m_sourceGuid == uuidIter->first)
-            {
-                // This product references itself, or the source it comes from. Don't report it as a missing dependency.
-                continue;
-            }
+            return AZStd::any_of(dependencies.begin(), dependencies.end(),
+                [&sourceGuid](const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& existingDependency)
+                {
+                    return existingDependency.m_dependencySourceGuid == sourceGuid;
+                });
+        };
 
-            AzToolsFramework::AssetDatabase::SourceDatabaseEntry sourceEntry;
-            if (!databaseConnection->GetSourceBySourceGuid(uuidIter->first, sourceEntry))
-            {
-                // The UUID isn't in the asset database, don't add it to the list of missing dependencies.
-                continue;
-            }
+        auto dependencyExistsForProduct = [&dependencies](const AZ::Uuid& sourceGuid, AZ::u32 subId)
+        {
+            return AZStd::any_of(dependencies.begin(), dependencies.end(),
+                [&sourceGuid, subId](const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& existingDependency)
+                {
+                    return existingDependency.m_dependencySourceGuid == sourceGuid && existingDependency.m_dependencySubID == subId;
+                });
+        };
 
-            AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer jobs;
-            if (!databaseConnection->GetJobsBySourceID(sourceEntry.m_sourceID, jobs))
+        for (const auto& uuidEntry : potentialDependencies.m_uuids)
+        {
+            const AZ::Uuid& uuid = uuidEntry.first;
+            const PotentialDependencyMetaData& metaData = uuidEntry.second;
+            // Skip UUIDs that match dependencies already being emitted.
+            if (sourceGuidWithPotentialMissingDependencies == uuid || dependencyExistsForSource(uuid))
             {
-                // No jobs existed for that source asset, so there are no products for this asset.
-                // With no products, there is no way there can be a missing product dependency.
+                // This product references itself, or the source it comes from. Don't report it as a missing dependency.
                 continue;
             }
 
             // The dependency only referenced the source UUID, so add all products as missing dependencies.
-            for (const AzToolsFramework::AssetDatabase::JobDatabaseEntry& job : jobs)
+            // A UUID that isn't in the asset database has no products, and isn't reported.
+            m_assetReferenceIndex.FindProductsOfSource(uuid, [&](const AssetReferenceIndex::Product& product)
             {
-                AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
-                if (!databaseConnection->GetProductsByJobID(job.m_jobID, products))
-                {
-                    continue;
-                }
-                for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
-                {
-                    // This match was for a UUID with no product ID, so add all products as missing dependencies.
-                    MissingDependency missingDependency(
-                        AZ::Data::AssetId(uuidIter->first, product.m_subID),
-                        uuidIter->second);
-                    missingDependencies.insert(missingDependency);
-                }
-            }
+                missingDependencies.insert(MissingDependency(AZ::Data::AssetId(uuid, product.m_subID), metaData));
+            });
         }
 
         // Validate the asset ID list, removing anything that is already a dependency, or does not exist in the asset database.
-        for (AZStd::map<AZ::Data::AssetId, PotentialDependencyMetaData>::iterator assetIdIter = assetIds.begin();
-            assetIdIter != assetIds.end();
-            ++assetIdIter)
-        {
-            bool foundUUID = false;
-            // Strip out all existing, matching dependencies
-            for (const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry&
-                existingDependency : dependencies)
-            {
-                if (existingDependency.m_dependencySourceGuid == assetIdIter->first.m_guid &&
-                    existingDependency.m_dependencySubID == assetIdIter->first.m_subId)
-                {
-                    foundUUID = true;
-                    break;
-                }
-            }
-
-            // There is already a dependency with this UUID, so it's not a missing dependency.
-            if (foundUUID)
-            {
-                continue;
-            }
-
-            AzToolsFramework::AssetDatabase::SourceDatabaseEntry sourceEntry;
-            if (!databaseConnection->GetSourceBySourceGuid(assetIdIter->first.m_guid, sourceEntry))
-            {
-                // The UUID isn't in the asset database. Don't report it as a missing dependency
-                // because UUIDs are used for tracking many things that are not assets.
-                continue;
-            }
-
-            AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer jobs;
-            if (!databaseConnection->GetJobsBySourceID(sourceEntry.m_sourceID, jobs))
+        for (const auto& assetIdEntry : potentialDependencies.m_assetIds)
+        {
+            const AZ::Data::AssetId& assetId = assetIdEntry.first;
+            const PotentialDependencyMetaData& metaData = assetIdEntry.second;
+            if (dependencyExistsForProduct(assetId.m_guid, assetId.m_subId))
             {
-                // No jobs existed for that source asset, so there are no products for this asset.
-                // With no products, there is no way there can be a missing product dependency.
                 continue;
             }
 
-
-            bool isProductOfFileWithPotentialMissingDependencies = fileWithPotentialMissingDependencies.m_sourceGuid == assetIdIter->first.m_guid;
-
-            bool foundMatchingProduct = false;
-            for (const AzToolsFramework::AssetDatabase::JobDatabaseEntry& job : jobs)
+            bool isProductOfFileWithPotentialMissingDependencies = sourceGuidWithPotentialMissingDependencies == assetId.m_guid;
+            m_assetReferenceIndex.FindProductsOfSource(assetId.m_guid, [&](const AssetReferenceIndex::Product& product)
             {
-                AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
-                if (!databaseConnection->GetProductsByJobID(job.m_jobID, products))
-                {
-                    continue;
-                }
-                for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
+                // This product references itself. Don't report it as a missing dependency.
+                // If the product references a different product of the same source and that isn't
+                // a dependency, then do report that.
+                // We have to check against more than the productPK to catch identical products across multiple
+                // platforms.
+                if (product.m_subID != assetId.m_subId || productPK == product.m_productID ||
+                    (isProductOfFileWithPotentialMissingDependencies && subIdWithPotentialMissingDependencies == product.m_subID))
                 {
-                    if (product.m_subID == assetIdIter->first.m_subId)
-                    {
-                        // This product references itself. Don't report it as a missing dependency.
-                        // If the product references a different product of the same source and that isn't
-                        // a dependency, then do report that.
-                        // We have to check against more than the productPK to catch identical products across multiple
-                        // platforms. 
-                        if (productPK == product.m_productID ||
-                            (isProductOfFileWithPotentialMissingDependencies && productWithPotentialMissingDependencies.m_subID == product.m_subID))
-                        {
-                            continue;
-                        }
-
-                        MissingDependency missingDependency(
-                            assetIdIter->first,
-                            assetIdIter->second);
-                        missingDependencies.insert(missingDependency);
-                        foundMatchingProduct = true;
-                        break;
-                    }
-                }
-                if (foundMatchingProduct)
-                {
-                    break;
+                    return;
                 }
-            }
+                missingDependencies.insert(MissingDependency(assetId, metaData));
+            });
         }
 
         for (const PotentialDependencyMetaData& path : potentialDependencies.m_paths)
         {
-            AzToolsFramework::AssetDatabase::SourceDatabaseEntryContainer searchSources;
-            QString searchName(path.m_sourceString.c_str());
-            // The paths in the file may have had slashes in either direction, or double slashes.
-            searchName.replace(AZ_WRONG_DATABASE_SEPARATOR_STRING, AZ_CORRECT_DATABASE_SEPARATOR_STRING);
-            searchName.replace(AZ_DOUBLE_CORRECT_DATABASE_SEPARATOR, AZ_CORRECT_DATABASE_SEPARATOR_STRING);
-            
-            if (databaseConnection->GetSourcesBySourceName(searchName, searchSources))
+            // A source matched the path, add its products as resolved path dependencies.
+            bool foundSource = false;
+            m_assetReferenceIndex.FindProductsBySourceName(path.m_sourceString, [&](const AssetReferenceIndex::Product& product)
             {
-                // A source matched the path, look up products and add them as resolved path dependencies.
-                for (const AzToolsFramework::AssetDatabase::SourceDatabaseEntry& source : searchSources)
+                foundSource = true;
+                if (sourceGuidWithPotentialMissingDependencies == product.m_sourceGuid || dependencyExistsForSource(product.m_sourceGuid))
                 {
-                    if (fileWithPotentialMissingDependencies.m_sourceGuid == source.m_sourceGuid)
-                    {
-                        // This product references itself, or the source it comes from. Don't report it as a missing dependency.
-                        continue;
-                    }
-
-                    bool dependencyExistsForSource = false;
-                    for (const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry&
-                        existingDependency : dependencies)
-                    {
-                        if (existingDependency.m_dependencySourceGuid == source.m_sourceGuid)
-                        {
-                            dependencyExistsForSource = true;
-                            break;
-                        }
-                    }
-
-                    if (dependencyExistsForSource)
-                    {
-                        continue;
-                    }
-
-                    AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer jobs;
-                    if (!databaseConnection->GetJobsBySourceID(source.m_sourceID, jobs))
-                    {
-                        // No jobs exist for this source, which means there is no matching product dependency.
-                        continue;
-                    }
-
-                    for (const AzToolsFramework::AssetDatabase::JobDatabaseEntry& job : jobs)
-                    {
-                        AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
-                        if (!databaseConnection->GetProductsByJobID(job.m_jobID, products))
-                        {
-                            // No products, no product dependencies.
-                            continue;
-                        }
-
-                        for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
-                        {
-                            MissingDependency missingDependency(
-                                AZ::Data::AssetId(source.m_sourceGuid, product.m_subID),
-                                path);
-                            missingDependencies.insert(missingDependency);
-                        }
-                    }
-                }
-            }
-            else
-            {
-                // Product paths in the asset database include the platform and additional pathing information that
-                // makes this check more complex than the source path check.
-                // Examples:
-                //      pc/usersettings.xml
-                //      pc/ProjectName/file.xml
-                // Taking all results from this EndsWith check can lead to an over-emission of potential missing dependencies.
-                // For example, if a file has a comment like "Something about .dds files", then EndsWith would return
-                // every single dds file in the database.
-                AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
-                if (!databaseConnection->GetProductsLikeProductName(searchName, AssetDatabaseConnection::LikeType::EndsWith, products))
-                {
-                    continue;
+                    // This product references itself, or the source it comes from. Don't report it as a missing dependency.
+                    return;
                 }
-                for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
-                {
-                    if (productPK == product.m_productID)
-                    {
-                        // Don't report if a file has a reference to itself.
-                        continue;
-                    }
-
-                    // Cull the platform from the product path to perform a more confident comparison against the given path.
-                    QString culledProductPath = QString(product.m_productName.c_str());
-
-                    // If this appears to be a valid path to a product relative to the product being checked
-                    if (culledProductPath.compare(scannedProductPath.append(searchName), Qt::CaseInsensitive) != 0)
-                    {
-
-                        culledProductPath = culledProductPath.remove(0, culledProductPath.indexOf(AZ_CORRECT_DATABASE_SEPARATOR_STRING) + 1);
-
-                        // This first check will catch paths that include the project name, as well as references to assets that include a scan folder in the path.
-                        if (culledProductPath.compare(searchName, Qt::CaseInsensitive) != 0)
-                        {
-                            int nextFolderIndex = culledProductPath.indexOf(AZ_CORRECT_DATABASE_SEPARATOR_STRING);
-                            if (nextFolderIndex == -1)
-                            {
-                                continue;
-                            }
-                            // Perform a second check with the scan folder removed. Many asset references are relevant to scan folder roots.
-                            // For example, a material may have a relative path reference to a texture as "textures/SomeTexture.dds".
-                            // This relative path resolves in many systems based on scan folder root, so if this file is in "platform/project/textures/SomeTexture.dds",
-                            // this check is intended to find that reference.
-                            culledProductPath = culledProductPath.remove(0, nextFolderIndex + 1);
-                            if (culledProductPath.compare(searchName, Qt::CaseInsensitive) != 0)
-                            {
-                                continue;
-                            }
-                        }
-                    }
+                missingDependencies.insert(MissingDependency(AZ::Data::AssetId(product.m_sourceGuid, product.m_subID), path));
+            });
 
-                    AzToolsFramework::AssetDatabase::SourceDatabaseEntryContainer productSources;
-                    if (!databaseConnection->GetSourcesByProductName(QString(product.m_productName.c_str()), productSources))
-                    {
-                        AZ_Error(
-                            AssetProcessor::ConsoleChannel,
-                            false,
-                            "Product %s does not have a matching source. Your database may be corrupted.", product.m_productName.c_str());
-                        continue;
-                    }
+            if (foundSource)
+            {
+                continue;
+            }
 
-                    for (const AzToolsFramework::AssetDatabase::SourceDatabaseEntry& source : productSources)
+            // Product paths in the asset database include the platform and additional pathing information.
+            // Examples:
+            //      pc/usersettings.xml
+            //      pc/ProjectName/file.xml
+            // The path matches a product if it is the product path without the platform, the product path without
+            // the platform and the next folder, which is usually the scan folder, or a path relative to the folder of
+            // the product being scanned. For example, a material may have a relative path reference to a texture as
+            // "textures/SomeTexture.dds", which resolves in many systems based on scan folder root.
+            m_assetReferenceIndex.FindProductsByPath(path.m_sourceString, productNameWithPotentialMissingDependencies,
+                [&](const AssetReferenceIndex::Product& product)
+                {
+                    // Don't report if a file has a reference to itself.
+                    if (productPK == product.m_productID || dependencyExistsForProduct(product.m_sourceGuid, product.m_subID))
                     {
-                        bool dependencyExistsForProduct = false;
-                        for (const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry&
-                            existingDependency : dependencies)
-                        {
-                            if (existingDependency.m_dependencySourceGuid == source.m_sourceGuid &&
-                                existingDependency.m_dependencySubID == product.m_subID)
-                            {
-                                dependencyExistsForProduct = true;
-                                break;
-                            }
-                        }
-                        if (!dependencyExistsForProduct)
-                        {
-                            AZ::Data::AssetId assetId(source.m_sourceGuid, product.m_subID);
-                            MissingDependency missingDependency(
-                                AZ::Data::AssetId(source.m_sourceGuid, product.m_subID),
-                                path);
-
-                            missingDependencies.insert(missingDependency);
-                        }
+                        return;
                     }
-                }
-
-            }
+                    missingDependencies.insert(MissingDependency(AZ::Data::AssetId(product.m_sourceGuid, product.m_subID), path));
+                });
         }
     }
 
@@ -9,12 +9,16 @@
 
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/regex.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
 #include <AzToolsFramework/Asset/AssetUtils.h>
 #include <native/utilities/ApplicationManagerAPI.h>
+#include <native/utilities/AssetReferenceIndex.h>
 
 namespace AZ
 {
@@ -80,6 +84,7 @@ namespace AssetProcessor
     class MissingDependencyScanner
         : public MissingDependencyScannerRequestBus::Handler
         , AssetProcessor::ApplicationManagerNotifications::Bus::Handler
+        , AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Handler
     {
     public:
         MissingDependencyScanner();
@@ -88,6 +93,13 @@ namespace AssetProcessor
         // ApplicationManagerNotifications::Bus::Handler
         void ApplicationShutdownRequested() override;
 
+        // AssetDatabaseNotificationBus::Handler
+        void OnSourceFileChanged(const AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry) override;
+        void OnSourceFileRemoved(AZ::s64 sourceId) override;
+        void OnProductFileChanged(const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& entry) override;
+        void OnProductFileRemoved(AZ::s64 productId) override;
+        void OnProductFilesRemoved(const AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer& products) override;
+
         //! Scans the file at the fullPath for anything that looks like a missing dependency.
         //! Reporting is handled internally, no results are returned.
         //! Anything that matches a result in the given dependency list will not be reported as a missing dependency.
@@ -123,6 +135,26 @@ namespace AssetProcessor
             bool queueDbCommandsOnMainThread,
             scanFileCallback callback);
 
+        //! A file to scan with ScanFiles
+        struct FileToScan
+        {
+            AZStd::string m_fullPath;
+            AZ::s64 m_productPK = -1; //!< -1 if the file is not a product
+            AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer m_dependencies;
+        };
+
+        //! Scans each file like ScanFile with the default match type, without queueing database commands on the main thread.
+        //! The index of known assets is refreshed from the whole database once for all files, which also picks up the products
+        //! removed without a notification, such as those of removed jobs. The contents of the files are read and scanned
+        //! in parallel on the Qt thread pool. Resolving and reporting the results uses the database connection, so that
+        //! happens on the calling thread, in the order of the files.
+        void ScanFiles(
+            const AZStd::vector<FileToScan>& files,
+            int maxScanIteration,
+            AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection,
+            const AZStd::string& dependencyTokenName,
+            scanFileCallback callback);
+
         static const int DefaultMaxScanIteration;
 
         void RegisterSpecializedScanner(AZStd::shared_ptr<SpecializedDependencyScanner> scanner);
@@ -130,6 +162,47 @@ namespace AssetProcessor
         bool PopulateRulesForScanFolder(const AZStd::string& scanFolderPath, const AZStd::vector<AzFramework::GemInfo>& gemInfoList, AZStd::string& dependencyTokenName);
 
     protected:
+        //! Loads the index of known assets if it is empty, and otherwise only reads the products that changed since it was
+        //! last updated, according to the asset database notifications.
+        void UpdateAssetReferenceIndex(AssetDatabaseConnection& databaseConnection);
+
+        enum class FileScanResult
+        {
+            Scanned,
+            OpenFailed,
+            ScanFailed
+        };
+        struct PendingFileScan;
+
+        //! Returns false if the file tags exclude the file from the scan, after recording that in the database
+        bool PrepareFileScan(
+            const AZStd::string& fullPath,
+            AZ::s64 productPK,
+            AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection,
+            bool queueDbCommandsOnMainThread,
+            scanFileCallback callback,
+            AZStd::string& analysisFingerprint);
+
+        //! Reads the file and scans it for potential dependencies. This doesn't use the database, so files can be scanned in parallel.
+        FileScanResult ScanFileContents(
+            const AZStd::string& fullPath,
+            int maxScanIteration,
+            ScannerMatchType matchType,
+            AZ::Crc32* forceScanner,
+            PotentialDependencies& potentialDependencies);
+
+        //! Resolves the potential dependencies of a scanned file and reports the missing ones
+        void CompleteFileScan(
+            FileScanResult result,
+            AZ::s64 productPK,
+            const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer& dependencies,
+            AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection,
+            const AZStd::string& dependencyTokenName,
+            const AZStd::string& analysisFingerprint,
+            const PotentialDependencies& potentialDependencies,
+            bool queueDbCommandsOnMainThread,
+            scanFileCallback callback);
+
         bool RunScan(
             const AZStd::string& fullPath,
             int maxScanIteration,
@@ -140,7 +213,6 @@ namespace AssetProcessor
 
         void PopulateMissingDependencies(
             AZ::s64 productPK,
-            AZStd::shared_ptr<AssetDatabaseConnection> databaseConnection,
             const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer& dependencies,
             MissingDependencies& missingDependencies,
             const PotentialDependencies& potentialDependencies);
@@ -164,6 +236,18 @@ namespace AssetProcessor
         DependencyScannerMap m_specializedScanners;
         AZStd::shared_ptr<LineByLineDependencyScanner> m_defaultScanner;
         AZStd::unordered_map<AZStd::string, AZStd::vector<AZStd::string>> m_dependenciesRulesMap;
+        //! Known products, used to find and resolve paths and UUIDs in the scanned files
+        AssetReferenceIndex m_assetReferenceIndex;
+        //! Scans may be requested from other threads, and refresh the index
+        AZStd::mutex m_scanMutex;
+
+        //! Changes to the database that the index doesn't have yet. The database notifications can be sent from any thread,
+        //! including during a scan, so these are guarded separately from the index.
+        AZStd::mutex m_databaseChangesMutex;
+        AZStd::unordered_set<AZ::s64> m_changedProductIDs;
+        AZStd::unordered_set<AZ::s64> m_changedSourceIDs;
+        //! Set when products were removed without a notification for each of them
+        bool m_refreshAllProducts = false;
 
         AZStd::atomic_bool m_shutdownRequested = false;
     };
@@ -1145,6 +1145,19 @@ namespace AssetProcessor
             m_maxJobs = aznumeric_cast<int>(jobCount);
         }
 
+        m_maxJobsPerBuilder.clear();
+        auto maxJobsPerBuilderVisitor = [this, settingsRegistry](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+        {
+            AZ::s64 builderJobCount = 0;
+            if (settingsRegistry->Get(builderJobCount, visitArgs.m_jsonKeyPath) && builderJobCount > 0)
+            {
+                m_maxJobsPerBuilder[visitArgs.m_fieldName] = aznumeric_cast<int>(builderJobCount);
+            }
+            return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+        };
+        AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, maxJobsPerBuilderVisitor,
+            AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/Jobs/maxJobsPerBuilder");
+
         if (!skipScanFolders)
         {
             AZStd::unordered_map<AZStd::string, AZ::IO::Path> gemNameToPathMap;
@@ -1852,6 +1865,11 @@ namespace AssetProcessor
         return m_maxJobs;
     }
 
+    const AZStd::unordered_map<AZStd::string, int>& PlatformConfiguration::GetMaxJobsPerBuilder() const
+    {
+        return m_maxJobsPerBuilder;
+    }
+
     void PlatformConfiguration::EnableCommonPlatform()
     {
         EnablePlatform(AssetBuilderSDK::PlatformInfo{ AssetBuilderSDK::CommonPlatformName, AZStd::unordered_set<AZStd::string>{ "common" } });
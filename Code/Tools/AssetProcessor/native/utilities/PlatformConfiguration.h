@@ -181,6 +181,9 @@ namespace AssetProcessor
         //! Gets the minumum jobs specified in the configuration file
         int GetMinJobs() const;
         int GetMaxJobs() const;
+        //! Gets the maximum number of jobs of each builder that may run at the same time, by builder name.
+        //! Builders that are not listed are only limited by GetMaxJobs.
+        const AZStd::unordered_map<AZStd::string, int>& GetMaxJobsPerBuilder() const;
 
         void EnableCommonPlatform();
         void AddIntermediateScanFolder();
@@ -334,6 +337,7 @@ namespace AssetProcessor
 
         int m_minJobs = 1;
         int m_maxJobs = 3;
+        AZStd::unordered_map<AZStd::string, int> m_maxJobsPerBuilder;
 
         // used only during file read, keeps the total running list of all the enabled platforms from all config files and command lines
         AZStd::vector<AZStd::string> m_tempEnabledPlatforms;
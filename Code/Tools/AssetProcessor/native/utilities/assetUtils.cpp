@@ -1111,6 +1111,101 @@ namespace AssetUtilities
         return digest[0]; // we only currently use 32-bit hashes.  This could be extended if collisions still occur.
     }
 
+    AZStd::string GenerateContentFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    {
+        // same layout as GenerateFingerprint, but files contribute their content hash instead of their modification time,
+        // and the job identity is included since the result addresses products shared across jobs, platforms and branches.
+        AZStd::string fingerprintString = AZStd::string::format("%s:%s:%s:%s",
+            jobDetail.m_extraInformationForFingerprinting.c_str(),
+            jobDetail.m_jobEntry.m_jobKey.toUtf8().constData(),
+            jobDetail.m_jobEntry.m_platformInfo.m_identifier.c_str(),
+            jobDetail.m_jobEntry.m_builderGuid.ToString<AZStd::string>().c_str());
+
+        // the parameter map is unordered, sort it so the fingerprint is stable
+        AZStd::vector<AZStd::pair<AZ::u32, AZStd::string>> jobParameters(jobDetail.m_jobParam.begin(), jobDetail.m_jobParam.end());
+        AZStd::sort(jobParameters.begin(), jobParameters.end());
+        for (const auto& jobParameter : jobParameters)
+        {
+            fingerprintString.append(AZStd::string::format(":%u=%s", jobParameter.first, jobParameter.second.c_str()));
+        }
+
+        for (const auto& fingerprintFile : jobDetail.m_fingerprintFiles)
+        {
+            if (!AZ::IO::SystemFile::Exists(fingerprintFile.first.c_str()))
+            {
+                fingerprintString.append(AZStd::string::format(":-:%s", fingerprintFile.second.c_str()));
+                continue;
+            }
+
+            AZ::u64 fileHash = GetFileHash(fingerprintFile.first.c_str());
+            if (fileHash == 0)
+            {
+                // file hashing is disabled for change detection, but the content fingerprint always needs it
+                fileHash = AssetBuilderSDK::GetFileHash(fingerprintFile.first.c_str());
+            }
+            fingerprintString.append(AZStd::string::format(":%llx:%s", static_cast<unsigned long long>(fileHash), fingerprintFile.second.c_str()));
+        }
+
+        // dependent jobs contribute the content hashes of their products, which is what this job consumes from them.
+        // Their products can change without their source changing, and their own fingerprints are based on modification times.
+        AZStd::unique_ptr<AssetProcessor::AssetDatabaseConnection> databaseConnection;
+        for (const AssetProcessor::JobDependencyInternal& jobDependencyInternal : jobDetail.m_jobDependencyList)
+        {
+            if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly)
+            {
+                continue;
+            }
+            AssetProcessor::JobDesc jobDesc(AssetProcessor::SourceAssetReference(jobDependencyInternal.m_jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
+                jobDependencyInternal.m_jobDependency.m_jobKey, jobDependencyInternal.m_jobDependency.m_platformIdentifier);
+
+            if (!databaseConnection)
+            {
+                databaseConnection = AZStd::make_unique<AssetProcessor::AssetDatabaseConnection>();
+                if (!databaseConnection->OpenDatabase())
+                {
+                    return {};
+                }
+            }
+
+            for (const AZ::Uuid& builderUuid : jobDependencyInternal.m_builderUuidList)
+            {
+                AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer jobs;
+                databaseConnection->GetJobsBySourceName(jobDesc.m_sourceAsset, jobs, builderUuid, QString::fromUtf8(jobDesc.m_jobKey.c_str()),
+                    QString::fromUtf8(jobDesc.m_platformIdentifier.c_str()), AzToolsFramework::AssetSystem::JobStatus::Completed);
+                if (jobs.empty())
+                {
+                    // the dependent job has not completed, so the products this job would consume are not known yet
+                    return {};
+                }
+
+                AZ::u32 dependentJobFingerprint = 0;
+                AssetProcessor::ProcessingJobInfoBus::BroadcastResult(dependentJobFingerprint, &AssetProcessor::ProcessingJobInfoBusTraits::GetJobFingerprint, AssetProcessor::JobIndentifier(jobDesc, builderUuid));
+                if (dependentJobFingerprint != 0 && dependentJobFingerprint != jobs.front().m_fingerprint)
+                {
+                    // the dependent job has been queued again with different inputs, its products in the database are out of date
+                    return {};
+                }
+
+                AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
+                databaseConnection->GetProductsByJobID(jobs.front().m_jobID, products);
+                AZStd::sort(products.begin(), products.end(),
+                    [](const auto& lhs, const auto& rhs) { return lhs.m_subID < rhs.m_subID; });
+                for (const auto& product : products)
+                {
+                    fingerprintString.append(AZStd::string::format(":%u=%llx", product.m_subID, static_cast<unsigned long long>(product.m_hash)));
+                }
+            }
+        }
+
+        AZ::Sha1 sha;
+        sha.ProcessBytes(AZStd::as_bytes(AZStd::span(fingerprintString)));
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
     std::uint64_t AdjustTimestamp(QDateTime timestamp, int overridePrecision)
     {
         if (timestamp.isDaylightTime())
@@ -235,6 +235,11 @@ namespace AssetUtilities
     //! interrogate a given file, which is specified as a full path name, and generate a fingerprint for it.
     unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail);
 
+    //! Generate a fingerprint for a job from the contents of its files instead of their modification times, so that identical
+    //! inputs produce the same fingerprint on every machine and branch. Used as the key of the content addressed asset cache.
+    //! Returns an empty string if the products of a dependent job are not known yet, as the fingerprint depends on them.
+    AZStd::string GenerateContentFingerprint(const AssetProcessor::JobDetails& jobDetail);
+
     //! Returns a hash of the contents of the specified file
     // hashMsDelay is only for automated tests to test that writing to a file while it's hashing does not cause a crash.
     // hashMsDelay is not used in non-unit test builds.
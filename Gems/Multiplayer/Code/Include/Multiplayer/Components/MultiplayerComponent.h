@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/QuantizingSerializer.h>
 #include <AzNetworking/DataStructures/FixedSizeBitsetView.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/MultiplayerStats.h>
@@ -25,6 +27,8 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR_EXTERNED(bool, net_ReportQuantizationWaste);
+
     class NetworkEntityRpcMessage;
     class ReplicationRecord;
     class NetBindComponent;
@@ -163,6 +167,49 @@ namespace Multiplayer
         }
     }
 
+    //! Serializes a floating point network property quantized to BITS_PER_ELEMENT bits per element within [minValue, maxValue].
+    //! ELEMENT_TYPE is the underlying value type, TYPE may be the value type itself or a wrapper such as a RewindableObject.
+    //! When net_ReportQuantizationWaste is enabled, received updates also report the number of serialized bits not carrying quantized data.
+    template <uint32_t BITS_PER_ELEMENT, typename ELEMENT_TYPE, typename TYPE>
+    inline void SerializeQuantizedNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer,
+        AzNetworking::FixedSizeBitsetView& bitset,
+        int32_t bitIndex,
+        TYPE& value,
+        const char* name,
+        float minValue,
+        float maxValue,
+        NetComponentId componentId,
+        PropertyIndex propertyIndex,
+        MultiplayerStats& stats
+    )
+    {
+        static_assert(BITS_PER_ELEMENT > 0 && BITS_PER_ELEMENT * AzNetworking::QuantizedElementCount<ELEMENT_TYPE>::Value <= AzNetworking::QuantizingSerializer::MaxPackedBits,
+            "Quantized network property does not fit in a single packed value");
+        if (bitset.GetBit(bitIndex))
+        {
+            AzNetworking::QuantizingSerializer quantizingSerializer(serializer, AzNetworking::QuantizedElementCount<ELEMENT_TYPE>::Value, BITS_PER_ELEMENT, minValue, maxValue);
+            const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
+            const uint32_t prevUpdateSize = serializer.GetSize();
+            quantizingSerializer.ClearTrackedChangesFlag();
+            quantizingSerializer.Serialize(value, name);
+            if (modifyRecord && !quantizingSerializer.GetTrackedChangesFlag())
+            {
+                // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
+                bitset.SetBit(bitIndex, false);
+            }
+            const uint32_t postUpdateSize = serializer.GetSize();
+            UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+            if (net_ReportQuantizationWaste && modifyRecord && (postUpdateSize > prevUpdateSize))
+            {
+                const uint32_t serializedBits = (postUpdateSize - prevUpdateSize) * 8;
+                const uint32_t packedBits = quantizingSerializer.GetPackedBitCount();
+                stats.RecordPropertyWastedBits(componentId, propertyIndex, serializedBits > packedBits ? serializedBits - packedBits : 0);
+            }
+        }
+    }
+
     template <typename TYPE, AZStd::size_t SIZE>
     inline void SerializeNetworkPropertyHelperArray
     (
@@ -10,6 +10,7 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/RewindHistoryStore.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -45,8 +46,10 @@ namespace Multiplayer
 
             void UpdateTransform(const AZ::Transform& transform);
             void SyncToCurrentTransform();
+            void ReleaseRewindSlot();
 
-            Multiplayer::RewindableObject<AZ::Transform, Multiplayer::RewindHistorySize> m_transform;
+            // Transform history lives in the shared rewind history store so rewinding all hit volumes touches contiguous memory
+            Multiplayer::RewindSlotId m_rewindSlot = Multiplayer::InvalidRewindSlotId;
             AZStd::shared_ptr<Physics::Shape> m_physicsShape;
 
             // Cached so we don't have to do subsequent lookups by name
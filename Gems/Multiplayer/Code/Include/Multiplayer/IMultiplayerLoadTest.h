@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    class NetworkInput;
+
+    //! Generates the input for a single load test client.
+    //! @param clientIndex the index of the load test client the input is generated for
+    //! @param input       the input to populate, its component inputs are allocated from the script's component list
+    //! @param deltaTime   the amount of time in seconds the input covers
+    using LoadTestInputScript = AZStd::function<void(uint32_t clientIndex, NetworkInput& input, float deltaTime)>;
+
+    //! @class IMultiplayerLoadTest
+    //! @brief IMultiplayerLoadTest spawns simulated clients that connect to a dedicated server from a single process.
+    //!
+    //! IMultiplayerLoadTest is an AZ::Interface<T> provided by the Multiplayer.LoadTest module. Simulated clients perform
+    //! the regular multiplayer handshake and stream NetworkInput for their player entity, but never replicate or render
+    //! entities locally, so hundreds of them can share a single INetworking instance.
+    class IMultiplayerLoadTest
+    {
+    public:
+        AZ_RTTI(IMultiplayerLoadTest, "{3D0E7C2B-6A41-4F0C-9C8B-5E2A7D14B3F6}");
+
+        virtual ~IMultiplayerLoadTest() = default;
+
+        //! Spawns simulated clients and connects them to the provided server.
+        //! @param clientCount   the number of clients to spawn
+        //! @param remoteAddress the address of the server to connect to
+        //! @param port          the port of the server to connect to
+        //! @return the number of clients that successfully started connecting
+        virtual uint32_t SpawnClients(uint32_t clientCount, const AZStd::string& remoteAddress, uint16_t port) = 0;
+
+        //! Disconnects and destroys all simulated clients.
+        virtual void DespawnAllClients() = 0;
+
+        //! Returns the number of simulated clients, connected or not.
+        //! @return the number of simulated clients
+        virtual uint32_t GetClientCount() const = 0;
+
+        //! Sets the script used to generate input for simulated clients spawned after this call.
+        //! @param componentIds the multiplayer components to allocate inputs for, in the order the player entity binds them
+        //! @param script       the script to invoke for every generated input
+        virtual void SetInputScript(const AZStd::vector<NetComponentId>& componentIds, LoadTestInputScript script) = 0;
+    };
+}
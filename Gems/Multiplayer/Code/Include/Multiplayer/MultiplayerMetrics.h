@@ -13,7 +13,8 @@ namespace Multiplayer
     //! Declares multiplayer metric group ids.
     enum MultiplayerGroupIds
     {
-        MultiplayerGroup_Networking = 101           // A group of multiplayer metrics
+        MultiplayerGroup_Networking = 101,          // A group of multiplayer metrics
+        MultiplayerGroup_LoadTest                   // Metrics reported by simulated load test clients
     };
 
     //! Declares multiplayer metric stat ids.
@@ -41,4 +42,42 @@ namespace Multiplayer
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
     };
+
+    //! Declares multiplayer load test stat ids.
+    //! Histogram stats hold the number of load test clients whose latest sample falls within the bucket.
+    enum MultiplayerLoadTestStatIds
+    {
+        MultiplayerLoadTestStat_ConnectedClients = 2001,    // Number of load test clients that have been assigned a player entity
+        MultiplayerLoadTestStat_SentInputs,                 // Total inputs sent by all load test clients since the last report
+        MultiplayerLoadTestStat_SentBytesPerSecond,         // Combined upstream bandwidth of all load test clients
+        MultiplayerLoadTestStat_ReceivedBytesPerSecond,     // Combined downstream bandwidth of all load test clients
+
+        // Interval between EntityUpdates packets for new host frames, normalized to a single host frame.
+        // This includes network jitter and the server's replication rate, it is not the server's own tick time.
+        MultiplayerLoadTestStat_AverageEntityUpdateIntervalMs,
+        MultiplayerLoadTestStat_MaxEntityUpdateIntervalMs,
+        MultiplayerLoadTestStat_EntityUpdateIntervalUnder40Ms,
+        MultiplayerLoadTestStat_EntityUpdateIntervalUnder80Ms,
+        MultiplayerLoadTestStat_EntityUpdateIntervalUnder160Ms,
+        MultiplayerLoadTestStat_EntityUpdateIntervalOver160Ms,
+
+        // Round trip time
+        MultiplayerLoadTestStat_AverageRttMs,
+        MultiplayerLoadTestStat_MaxRttMs,
+        MultiplayerLoadTestStat_RttUnder25Ms,
+        MultiplayerLoadTestStat_RttUnder50Ms,
+        MultiplayerLoadTestStat_RttUnder100Ms,
+        MultiplayerLoadTestStat_RttUnder200Ms,
+        MultiplayerLoadTestStat_RttOver200Ms,
+
+        // Downstream bandwidth per client
+        MultiplayerLoadTestStat_ReceivedUnder8KBps,
+        MultiplayerLoadTestStat_ReceivedUnder32KBps,
+        MultiplayerLoadTestStat_ReceivedUnder128KBps,
+        MultiplayerLoadTestStat_ReceivedOver128KBps,
+
+        // Server tick duration, measured on the server's clock from the host times of consecutive EntityUpdates packets
+        MultiplayerLoadTestStat_AverageHostFrameIntervalMs,
+        MultiplayerLoadTestStat_MaxHostFrameIntervalMs,
+    };
 }
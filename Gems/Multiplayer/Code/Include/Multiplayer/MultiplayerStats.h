@@ -55,6 +55,7 @@ namespace Multiplayer
         void RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
+        void RecordPropertyWastedBits(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t wastedBits);
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
@@ -76,6 +77,7 @@ namespace Multiplayer
             AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*> m_entitySerializeStop;
             AZ::Event<NetComponentId, PropertyIndex, uint32_t> m_propertySent;
             AZ::Event<NetComponentId, PropertyIndex, uint32_t> m_propertyReceived;
+            AZ::Event<NetComponentId, PropertyIndex, uint32_t> m_propertyWastedBits;
             AZ::Event<AZ::EntityId, const char*, NetComponentId, RpcIndex, uint32_t> m_rpcSent;
             AZ::Event<AZ::EntityId, const char*, NetComponentId, RpcIndex, uint32_t> m_rpcReceived;
         };
@@ -89,6 +91,7 @@ namespace Multiplayer
             AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*>::Handler m_entitySerializeStop;
             AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler m_propertySent;
             AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler m_propertyReceived;
+            AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler m_propertyWastedBits;
             AZ::Event<AZ::EntityId, const char*, NetComponentId, RpcIndex, uint32_t>::Handler m_rpcSent;
             AZ::Event<AZ::EntityId, const char*, NetComponentId, RpcIndex, uint32_t>::Handler m_rpcReceived;
         };
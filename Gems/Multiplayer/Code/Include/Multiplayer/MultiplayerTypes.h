@@ -63,6 +63,10 @@ namespace Multiplayer
 
     AZ_TYPE_SAFE_INTEGRAL(ClientInputId, uint16_t);
 
+    //! Sequence number of a full entity state snapshot, used by snapshot replication to identify acknowledged baselines.
+    AZ_TYPE_SAFE_INTEGRAL(SnapshotSequenceId, uint16_t);
+    static constexpr SnapshotSequenceId InvalidSnapshotSequenceId = SnapshotSequenceId{ 0 };
+
     //! This is a strong typedef for representing the number of application frames since application start.
     AZ_TYPE_SAFE_INTEGRAL(HostFrameId, uint32_t);
     static constexpr HostFrameId InvalidHostFrameId = HostFrameId{ AzPhysics::SimulatedBody::UndefinedFrameId };
@@ -22,6 +22,7 @@
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -116,6 +117,20 @@ namespace Multiplayer
 
         UpdateValidationResult ValidateUpdate(const NetworkEntityUpdateMessage& updateMessage, AzNetworking::PacketId packetId, EntityReplicator* entityReplicator);
 
+        //! A complete entity state received through snapshot replication, retained as a baseline for later snapshot deltas.
+        struct ReceivedSnapshot
+        {
+            SnapshotSequenceId m_sequenceId = InvalidSnapshotSequenceId;
+            AZStd::vector<uint8_t> m_data;
+        };
+        using ReceivedSnapshots = AZStd::deque<ReceivedSnapshot>;
+
+        //! Reconstructs the entity state encoded in a snapshot update message and retains it as a future baseline.
+        //! @param updateMessage  the snapshot update message to decode
+        //! @param isNewestUpdate true if the message will be applied, in which case a snapshot without a baseline discards older history
+        //! @return pointer to the decoded snapshot, or nullptr if the baseline snapshot is unavailable or the message is malformed
+        const ReceivedSnapshot* DecodeSnapshotUpdate(const NetworkEntityUpdateMessage& updateMessage, bool isNewestUpdate);
+
         using RpcMessages = AZStd::list<NetworkEntityRpcMessage>;
         bool DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator);
 
@@ -191,6 +206,9 @@ namespace Multiplayer
         NetEntityIdSet m_replicatorsPendingSend;
         NetEntityIdSet m_replicatorsPendingReset;
 
+        //! Recently received snapshots per entity, used to decode snapshot deltas
+        AZStd::unordered_map<NetEntityId, ReceivedSnapshots> m_receivedSnapshots;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -150,6 +150,8 @@ namespace Multiplayer
 
         AZStd::unique_ptr<PropertyPublisher> m_propertyPublisher;
         AZStd::unique_ptr<PropertySubscriber> m_propertySubscriber;
+        //! Sequence id the next property publisher starts its snapshots at, carried across Reset()
+        SnapshotSequenceId m_nextSnapshotSequenceId = SnapshotSequenceId{ 1 };
 
         NetBindComponent* m_netBindComponent = nullptr;
         EntityReplicationManager& m_replicationManager;
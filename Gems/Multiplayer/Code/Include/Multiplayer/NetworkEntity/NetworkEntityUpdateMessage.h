@@ -73,6 +73,23 @@ namespace Multiplayer
         //! @return the current value of PrefabEntityId
         const PrefabEntityId& GetPrefabEntityId() const;
 
+        //! Marks the data of this message as a snapshot delta, encoded against a previously acknowledged baseline snapshot.
+        //! @param snapshotSequenceId the sequence id of the snapshot encoded in this message
+        //! @param baselineSequenceId the sequence id of the baseline snapshot the data is encoded against, InvalidSnapshotSequenceId for none
+        void SetSnapshotSequenceIds(SnapshotSequenceId snapshotSequenceId, SnapshotSequenceId baselineSequenceId);
+
+        //! Gets whether or not the data of this message is a snapshot delta rather than a set of changed properties.
+        //! @return true if the data of this message is a snapshot delta
+        bool GetIsSnapshot() const;
+
+        //! Gets the sequence id of the snapshot encoded in this message.
+        //! @return the sequence id of the snapshot encoded in this message
+        SnapshotSequenceId GetSnapshotSequenceId() const;
+
+        //! Gets the sequence id of the baseline snapshot the data of this message is encoded against.
+        //! @return the sequence id of the baseline snapshot, InvalidSnapshotSequenceId if encoded against an empty baseline
+        SnapshotSequenceId GetBaselineSequenceId() const;
+
         //! Sets the current value for Data
         //! @param value the value to set Data to
         void SetData(const AzNetworking::PacketEncodingBuffer& value);
@@ -97,7 +114,10 @@ namespace Multiplayer
         bool           m_isDelete = false;
         bool           m_wasMigrated = false;
         bool           m_hasValidPrefabId = false;
+        bool           m_isSnapshot = false;
         PrefabEntityId m_prefabEntityId;
+        SnapshotSequenceId m_snapshotSequenceId = InvalidSnapshotSequenceId;
+        SnapshotSequenceId m_baselineSequenceId = InvalidSnapshotSequenceId;
 
         // Only allocated if we actually have data
         // This is to prevent blowing out stack memory if we declare an array of these EntityUpdateMessages
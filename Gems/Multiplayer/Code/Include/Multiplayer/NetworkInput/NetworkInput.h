@@ -51,6 +51,11 @@ namespace Multiplayer
 
         void AttachNetBindComponent(NetBindComponent* netBindComponent);
 
+        //! Allocates component inputs for the provided multiplayer components without requiring a local entity.
+        //! Used by hosts that generate input for remote entities they do not replicate, such as simulated load test clients
+        //! @param netComponentIds the multiplayer components to allocate inputs for, in the order the owning entity binds them
+        void AttachComponentInputs(const AZStd::vector<NetComponentId>& netComponentIds);
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         //! Fetches a vector of datums detailing which values per component input were
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+
+namespace Multiplayer
+{
+    AZ_TYPE_SAFE_INTEGRAL(RewindSlotId, uint32_t);
+    static constexpr RewindSlotId InvalidRewindSlotId = RewindSlotId{ AZStd::numeric_limits<uint32_t>::max() };
+
+    //! A read only view over the values of every slot recorded for a single host frame.
+    //! Each array is indexed by RewindSlotId and holds GetSlotCapacity() elements, unallocated slots contain stale data.
+    struct RewindHistoryFrameView
+    {
+        const AZ::Vector3* m_translations = nullptr;
+        const AZ::Quaternion* m_rotations = nullptr;
+        const float* m_uniformScales = nullptr;
+        uint32_t m_slotCount = 0;
+    };
+
+    //! @class RewindHistoryStore
+    //! @brief Contiguous ring buffered transform history shared by every rewindable slot in the simulation.
+    //!
+    //! Where a RewindableObject keeps a private history array per instance, the RewindHistoryStore keeps a single
+    //! frame-major ring of RewindHistorySize rows, each row holding the translation, rotation and scale of every slot
+    //! in separate arrays. Fetching a slot's value for any frame inside the history window is a single indexed lookup,
+    //! and all values for one frame are contiguous so rewound state for many entities can be gathered in parallel.
+    //!
+    //! Slots are allocated, freed and written from the main thread only and never while time is rewound. Readers never
+    //! mutate the store, so any number of jobs may read concurrently during a rewind without taking a lock.
+    class RewindHistoryStore
+    {
+    public:
+        AZ_RTTI(RewindHistoryStore, "{5F7A2C9E-1B43-4D86-8E0F-6A3D92C4B71E}");
+
+        static constexpr uint32_t SlotCapacityIncrement = 256;
+
+        RewindHistoryStore();
+        virtual ~RewindHistoryStore();
+
+        //! Allocates a new slot, initializing its entire history to the provided transform.
+        //! @param owningConnectionId the connection that owns the slot, owners are never rewound against themselves
+        //! @param transform          the initial transform of the slot
+        //! @param frameId            the host frame the initial transform was recorded at
+        //! @return the allocated slot id
+        RewindSlotId AllocateSlot(AzNetworking::ConnectionId owningConnectionId, const AZ::Transform& transform, HostFrameId frameId);
+
+        //! Releases a slot, allowing it to be reused by a subsequent allocation.
+        //! @param slotId the slot to release
+        void FreeSlot(RewindSlotId slotId);
+
+        //! Updates the owning connection of a slot.
+        //! @param slotId             the slot to update
+        //! @param owningConnectionId the new owning connection
+        void SetOwningConnectionId(RewindSlotId slotId, AzNetworking::ConnectionId owningConnectionId);
+
+        //! Records the value of a slot for the provided frame.
+        //! Frames skipped since the last write are filled with the previous value, writes older than the last recorded frame are ignored.
+        //! @param slotId    the slot to write
+        //! @param frameId   the host frame the value is recorded at
+        //! @param transform the value to record
+        void Record(RewindSlotId slotId, HostFrameId frameId, const AZ::Transform& transform);
+
+        //! Returns the value of a slot for the provided frame, clamped to the oldest frame still in the history window.
+        //! @param slotId  the slot to read
+        //! @param frameId the host frame to read the value for
+        //! @return the value of the slot at the requested frame
+        AZ::Transform GetTransformForFrame(RewindSlotId slotId, HostFrameId frameId) const;
+
+        //! Returns a view over every slot's values for the provided frame.
+        //! Frames newer than a slot's last write or older than the history window are not resolved per slot, callers
+        //! that need exact values for slots that were not written every frame should use GetTransformForFrame.
+        //! @param frameId the host frame to return the view for
+        //! @return a view over every slot's values for the provided frame
+        RewindHistoryFrameView GetFrameView(HostFrameId frameId) const;
+
+        //! Records the value of a slot for the current host frame, respecting the slot's owning connection.
+        //! @param slotId    the slot to write
+        //! @param transform the value to record
+        void SetTransform(RewindSlotId slotId, const AZ::Transform& transform);
+
+        //! Returns the value of a slot for the current, possibly rewound, host frame.
+        //! @param slotId the slot to read
+        //! @return the value of the slot at the current host frame
+        AZ::Transform GetTransform(RewindSlotId slotId) const;
+
+        //! Returns the value of a slot for the current host frame, blended with the previous frame by the current host blend factor.
+        //! @param slotId the slot to read
+        //! @return the blended value of the slot at the current host frame
+        AZ::Transform GetBlendedTransform(RewindSlotId slotId) const;
+
+        //! Returns the number of slots currently allocated.
+        //! @return the number of slots currently allocated
+        uint32_t GetAllocatedSlotCount() const;
+
+        //! Returns the number of slots storage is currently reserved for.
+        //! @return the number of slots storage is currently reserved for
+        uint32_t GetSlotCapacity() const;
+
+    private:
+
+        HostFrameId GetCurrentFrameForSlot(RewindSlotId slotId) const;
+        HostFrameId ClampFrameForSlot(RewindSlotId slotId, HostFrameId frameId) const;
+        void WriteRow(uint32_t rowIndex, uint32_t slotIndex, const AZ::Vector3& translation, const AZ::Quaternion& rotation, float uniformScale);
+        void GrowSlotCapacity();
+
+        static uint32_t GetRowIndex(HostFrameId frameId);
+
+        // Frame-major history, element (row, slot) lives at row * m_slotCapacity + slot
+        AZStd::vector<AZ::Vector3> m_translations;
+        AZStd::vector<AZ::Quaternion> m_rotations;
+        AZStd::vector<float> m_uniformScales;
+
+        // Per slot state, indexed by RewindSlotId
+        AZStd::vector<HostFrameId> m_headFrames;
+        AZStd::vector<AzNetworking::ConnectionId> m_owningConnectionIds;
+        AZStd::vector<RewindSlotId> m_freeSlots;
+
+        uint32_t m_slotCapacity = 0;
+        uint32_t m_slotCount = 0;
+    };
+
+    // Convenience helpers
+    inline RewindHistoryStore* GetRewindHistoryStore()
+    {
+        return AZ::Interface<RewindHistoryStore>::Get();
+    }
+}
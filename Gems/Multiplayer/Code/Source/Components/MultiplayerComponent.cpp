@@ -12,6 +12,9 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR(bool, net_ReportQuantizationWaste, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, received quantized network properties report the number of serialized bits not carrying quantized data");
+
     MultiplayerComponent::MultiplayerComponent()
         : m_networkActivatedHandler([this]() { OnNetworkActivated(); })
     {
@@ -36,7 +36,10 @@ namespace Multiplayer
         , m_shapeConfig(shapeConfig)
         , m_jointIndex(jointIndex)
     {
-        m_transform.SetOwningConnectionId(connectionId);
+        if (RewindHistoryStore* rewindHistoryStore = GetRewindHistoryStore())
+        {
+            m_rewindSlot = rewindHistoryStore->AllocateSlot(connectionId, AZ::Transform::CreateIdentity(), GetNetworkTime()->GetHostFrameId());
+        }
 
         m_colliderOffSetTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_colliderConfig->m_rotation, m_colliderConfig->m_position);
 
@@ -62,28 +65,23 @@ namespace Multiplayer
 
     void NetworkHitVolumesComponent::AnimatedHitVolume::UpdateTransform(const AZ::Transform& transform)
     {
-        m_transform = transform;
+        if (m_rewindSlot != InvalidRewindSlotId)
+        {
+            GetRewindHistoryStore()->SetTransform(m_rewindSlot, transform);
+        }
         m_physicsShape->SetLocalPose(transform.GetTranslation(), transform.GetRotation());
     }
 
     void NetworkHitVolumesComponent::AnimatedHitVolume::SyncToCurrentTransform()
     {
-        AZ::Transform rewoundTransform;
-        const AZ::Transform& targetTransform = m_transform.Get();
-        const float blendFactor = Multiplayer::GetNetworkTime()->GetHostBlendFactor();
-        if (blendFactor < 1.f)
-        {
-            // If a blend factor was supplied, interpolate the transform appropriately
-            const AZ::Transform& previousTransform = m_transform.GetPrevious();
-            rewoundTransform.SetRotation(previousTransform.GetRotation().Slerp(targetTransform.GetRotation(), blendFactor));
-            rewoundTransform.SetTranslation(previousTransform.GetTranslation().Lerp(targetTransform.GetTranslation(), blendFactor));
-            rewoundTransform.SetUniformScale(AZ::Lerp(previousTransform.GetUniformScale(), targetTransform.GetUniformScale(), blendFactor));
-        }
-        else
+        if (m_rewindSlot == InvalidRewindSlotId)
         {
-            rewoundTransform = m_transform.Get();
+            return;
         }
 
+        // The store interpolates with the previous frame if a blend factor was supplied
+        const AZ::Transform rewoundTransform = GetRewindHistoryStore()->GetBlendedTransform(m_rewindSlot);
+
         const AZ::Transform  physicsTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_physicsShape->GetLocalPose().second, m_physicsShape->GetLocalPose().first);
 
         // Don't call SetLocalPose unless the transforms are actually different
@@ -96,6 +94,18 @@ namespace Multiplayer
         }
     }
 
+    void NetworkHitVolumesComponent::AnimatedHitVolume::ReleaseRewindSlot()
+    {
+        if (m_rewindSlot != InvalidRewindSlotId)
+        {
+            if (RewindHistoryStore* rewindHistoryStore = GetRewindHistoryStore())
+            {
+                rewindHistoryStore->FreeSlot(m_rewindSlot);
+            }
+            m_rewindSlot = InvalidRewindSlotId;
+        }
+    }
+
     void NetworkHitVolumesComponent::NetworkHitVolumesComponent::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -231,6 +241,10 @@ namespace Multiplayer
 
     void NetworkHitVolumesComponent::DestroyHitVolumes()
     {
+        for (AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+        {
+            hitVolume.ReleaseRewindSlot();
+        }
         m_animatedHitVolumes.clear();
     }
 
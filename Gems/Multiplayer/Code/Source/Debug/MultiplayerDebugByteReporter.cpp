@@ -41,6 +41,12 @@ namespace Multiplayer
         m_aggregateBytes = 0;
     }
 
+    void MultiplayerDebugByteReporter::ReportWastedBits(size_t bitCount)
+    {
+        m_wastedBitsCount++;
+        m_totalWastedBits += bitCount;
+    }
+
     float MultiplayerDebugByteReporter::GetAverageBytes() const
     {
         if (m_count == 0)
@@ -51,6 +57,16 @@ namespace Multiplayer
         return aznumeric_cast<float>(m_totalBytes) / aznumeric_cast<float>(m_count);
     }
 
+    float MultiplayerDebugByteReporter::GetAverageWastedBits() const
+    {
+        if (m_wastedBitsCount == 0)
+        {
+            return 0.0f;
+        }
+
+        return aznumeric_cast<float>(m_totalWastedBits) / aznumeric_cast<float>(m_wastedBitsCount);
+    }
+
     size_t MultiplayerDebugByteReporter::GetMaxBytes() const
     {
         return m_maxBytes;
@@ -98,6 +114,8 @@ namespace Multiplayer
         m_totalBytesThisSecond += other.m_totalBytesThisSecond;
         m_minBytes = AZStd::GetMin(m_minBytes, other.m_minBytes);
         m_maxBytes = AZStd::GetMax(m_maxBytes, other.m_maxBytes);
+        m_wastedBitsCount += other.m_wastedBitsCount;
+        m_totalWastedBits += other.m_totalWastedBits;
     }
 
     void MultiplayerDebugByteReporter::Reset()
@@ -109,6 +127,8 @@ namespace Multiplayer
         m_minBytes = std::numeric_limits<decltype(m_minBytes)>::max();
         m_maxBytes = 0;
         m_aggregateBytes = 0;
+        m_wastedBitsCount = 0;
+        m_totalWastedBits = 0;
     }
 
     void MultiplayerDebugComponentReporter::ReportField(const char* fieldName, size_t byteSize)
@@ -117,6 +137,11 @@ namespace Multiplayer
         m_fieldReports[fieldName].ReportBytes(byteSize);
     }
 
+    void MultiplayerDebugComponentReporter::ReportFieldWastedBits(const char* fieldName, size_t bitCount)
+    {
+        m_fieldReports[fieldName].ReportWastedBits(bitCount);
+    }
+
     void MultiplayerDebugComponentReporter::ReportFragmentEnd()
     {
         MultiplayerDebugByteReporter::ReportAggregateBytes();
@@ -155,6 +180,19 @@ namespace Multiplayer
 
     void MultiplayerDebugEntityReporter::ReportField(AZ::u32 index, const char* componentName,
         const char* fieldName, size_t byteSize)
+    {
+        GetCurrentComponentReport(index, componentName).ReportField(fieldName, byteSize);
+        MultiplayerDebugByteReporter::AggregateBytes(byteSize);
+    }
+
+    void MultiplayerDebugEntityReporter::ReportFieldWastedBits(AZ::u32 index, const char* componentName,
+        const char* fieldName, size_t bitCount)
+    {
+        GetCurrentComponentReport(index, componentName).ReportFieldWastedBits(fieldName, bitCount);
+        MultiplayerDebugByteReporter::ReportWastedBits(bitCount);
+    }
+
+    MultiplayerDebugComponentReporter& MultiplayerDebugEntityReporter::GetCurrentComponentReport(AZ::u32 index, const char* componentName)
     {
         if (m_currentComponentReport == nullptr)
         {
@@ -163,8 +201,7 @@ namespace Multiplayer
             m_currentComponentReport = &m_componentReports[component.str().c_str()];
         }
 
-        m_currentComponentReport->ReportField(fieldName, byteSize);
-        MultiplayerDebugByteReporter::AggregateBytes(byteSize);
+        return *m_currentComponentReport;
     }
 
     void MultiplayerDebugEntityReporter::ReportFragmentEnd()
@@ -24,8 +24,10 @@ namespace Multiplayer
         void ReportBytes(size_t byteSize);
         void AggregateBytes(size_t byteSize);
         void ReportAggregateBytes();
+        void ReportWastedBits(size_t bitCount);
 
         float GetAverageBytes() const;
+        float GetAverageWastedBits() const;
         size_t GetMaxBytes() const;
         size_t GetMinBytes() const;
         size_t GetTotalBytes() const;
@@ -44,6 +46,8 @@ namespace Multiplayer
         size_t m_minBytes;
         size_t m_maxBytes;
         size_t m_aggregateBytes;
+        size_t m_wastedBitsCount;
+        size_t m_totalWastedBits;
 
         AZStd::chrono::steady_clock::time_point m_lastUpdateTime;
     };
@@ -55,6 +59,7 @@ namespace Multiplayer
         MultiplayerDebugComponentReporter() = default;
 
         void ReportField(const char* fieldName, size_t byteSize);
+        void ReportFieldWastedBits(const char* fieldName, size_t bitCount);
         void ReportFragmentEnd();
 
         using Report = AZStd::pair<AZStd::string, MultiplayerDebugByteReporter*>;
@@ -74,6 +79,7 @@ namespace Multiplayer
         MultiplayerDebugEntityReporter() = default;
 
         void ReportField(AZ::u32 index, const char* componentName, const char* fieldName, size_t byteSize);
+        void ReportFieldWastedBits(AZ::u32 index, const char* componentName, const char* fieldName, size_t bitCount);
         void ReportFragmentEnd();
 
         void Combine(const MultiplayerDebugEntityReporter& other);
@@ -89,6 +95,8 @@ namespace Multiplayer
         AZStd::map<AZStd::string, MultiplayerDebugComponentReporter>& GetComponentReports();
 
     private:
+        MultiplayerDebugComponentReporter& GetCurrentComponentReport(AZ::u32 index, const char* componentName);
+
         MultiplayerDebugComponentReporter* m_currentComponentReport = nullptr;
         AZStd::map<AZStd::string, MultiplayerDebugComponentReporter> m_componentReports;
         AZStd::string m_entityName;
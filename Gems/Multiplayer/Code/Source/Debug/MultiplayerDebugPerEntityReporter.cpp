@@ -68,7 +68,7 @@ namespace Multiplayer
             if (ReplicatedStateTreeNode(componentPair.first, componentReport, k_ImGuiCyan, 1))
             {
                 ImGui::Separator();
-                ImGui::Columns(6, "replicated_field_columns");
+                ImGui::Columns(7, "replicated_field_columns");
                 ImGui::NextColumn();
                 ImGui::Text("kbps");
                 ImGui::NextColumn();
@@ -80,6 +80,8 @@ namespace Multiplayer
                 ImGui::NextColumn();
                 ImGui::Text("Total Bytes");
                 ImGui::NextColumn();
+                ImGui::Text("Avg. Wasted Bits");
+                ImGui::NextColumn();
 
                 auto fieldReports = componentReport.GetFieldReports();
                 for (auto& fieldPair : fieldReports)
@@ -112,6 +114,8 @@ namespace Multiplayer
                     ImGui::NextColumn();
                     ImGui::Text("%zu", fieldReport.GetTotalBytes());
                     ImGui::NextColumn();
+                    ImGui::Text("%.2f", fieldReport.GetAverageWastedBits());
+                    ImGui::NextColumn();
 
                     ImGui::PopStyleColor();
                 }
@@ -151,6 +155,11 @@ namespace Multiplayer
             {
                 RecordPropertyReceived(netComponentId, propertyId, totalBytes);
             });
+        m_eventHandlers.m_propertyWastedBits = decltype(m_eventHandlers.m_propertyWastedBits)([this](NetComponentId netComponentId,
+            PropertyIndex propertyId, uint32_t wastedBits)
+            {
+                RecordPropertyWastedBits(netComponentId, propertyId, wastedBits);
+            });
         m_eventHandlers.m_rpcSent = decltype(m_eventHandlers.m_rpcSent)([this](AZ::EntityId entityId, const char* entityName,
                                                                                NetComponentId netComponentId,
                                                                                RpcIndex rpcId, uint32_t totalBytes)
@@ -283,6 +292,19 @@ namespace Multiplayer
         }
     }
 
+    void MultiplayerDebugPerEntityReporter::RecordPropertyWastedBits(
+        NetComponentId netComponentId,
+        PropertyIndex propertyId,
+        uint32_t wastedBits)
+    {
+        if (const MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry())
+        {
+            m_currentReceivingEntityReport.ReportFieldWastedBits(static_cast<AZ::u32>(netComponentId),
+                componentRegistry->GetComponentName(netComponentId),
+                componentRegistry->GetComponentPropertyName(netComponentId, propertyId), wastedBits);
+        }
+    }
+
     void MultiplayerDebugPerEntityReporter::RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId,
                                                           RpcIndex rpcId, uint32_t totalBytes)
     {
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/LoadTestClient.h>
+#include <Multiplayer/Components/LocalPredictionPlayerInputComponent.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Time/ITime.h>
+#include <AzNetworking/ConnectionLayer/IConnectionSet.h>
+#include <AzNetworking/Framework/INetworking.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    // Lower bound on the input rate, a zero rate would otherwise never drain the input accumulator
+    static constexpr float MinInputRateSec = 0.001f;
+
+    // Inputs older than the input history the server receives can never be applied, so a long stall only sends the latest ones
+    static constexpr uint32_t MaxInputsPerUpdate = NetworkInputArray::MaxElements;
+
+    LoadTestClient::LoadTestClient
+    (
+        uint32_t clientIndex,
+        uint64_t temporaryUserId,
+        const AZStd::vector<NetComponentId>& inputComponentIds,
+        const LoadTestInputScript& inputScript
+    )
+        : m_clientIndex(clientIndex)
+        , m_temporaryUserId(temporaryUserId)
+        , m_interfaceName(AZStd::string::format("LoadTestClient%u", clientIndex))
+        , m_inputScript(inputScript)
+    {
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            m_inputArray[i].AttachComponentInputs(inputComponentIds);
+        }
+    }
+
+    LoadTestClient::~LoadTestClient()
+    {
+        if (m_networkInterface != nullptr)
+        {
+            // Destroying the interface disconnects the client, which calls back into OnDisconnect
+            AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(m_interfaceName);
+            m_networkInterface = nullptr;
+        }
+    }
+
+    bool LoadTestClient::Connect(const IpAddress& remoteAddress)
+    {
+        m_networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_interfaceName, ProtocolType::Udp, TrustZone::ExternalClientToServer, *this);
+        if (m_networkInterface == nullptr)
+        {
+            return false;
+        }
+        m_connectionId = m_networkInterface->Connect(remoteAddress);
+        return m_connectionId != InvalidConnectionId;
+    }
+
+    void LoadTestClient::Update(float deltaTime, float inputRateSec)
+    {
+        if (!HasPlayerEntity())
+        {
+            return;
+        }
+
+        inputRateSec = AZStd::max(inputRateSec, MinInputRateSec);
+        m_inputAccumulator += deltaTime;
+        for (uint32_t sentInputs = 0; (sentInputs < MaxInputsPerUpdate) && (m_inputAccumulator >= inputRateSec); ++sentInputs)
+        {
+            m_inputAccumulator -= inputRateSec;
+            SendInput(inputRateSec);
+        }
+        // Carry the remaining time, but drop any backlog beyond the inputs a single update is allowed to send
+        m_inputAccumulator = AZStd::min(m_inputAccumulator, inputRateSec * MaxInputsPerUpdate);
+
+        if (IConnection* connection = m_networkInterface->GetConnectionSet().GetConnection(m_connectionId))
+        {
+            const ConnectionMetrics& metrics = connection->GetMetrics();
+            m_samples.m_roundTripTimeMs = metrics.m_connectionRtt.GetRoundTripTimeSeconds() * 1000.0f;
+            m_samples.m_sentBytesPerSecond = metrics.m_sendDatarate.GetBytesPerSecond();
+            m_samples.m_receivedBytesPerSecond = metrics.m_recvDatarate.GetBytesPerSecond();
+        }
+    }
+
+    bool LoadTestClient::HasPlayerEntity() const
+    {
+        return m_playerEntityId != InvalidNetEntityId;
+    }
+
+    void LoadTestClient::CollectSamples(LoadTestClientSamples& outSamples)
+    {
+        outSamples.m_entityUpdateIntervals.swap(m_samples.m_entityUpdateIntervals);
+        outSamples.m_hostFrameIntervals.swap(m_samples.m_hostFrameIntervals);
+        outSamples.m_sentInputs = m_samples.m_sentInputs;
+        outSamples.m_roundTripTimeMs = m_samples.m_roundTripTimeMs;
+        outSamples.m_sentBytesPerSecond = m_samples.m_sentBytesPerSecond;
+        outSamples.m_receivedBytesPerSecond = m_samples.m_receivedBytesPerSecond;
+        m_samples.m_entityUpdateIntervals.clear();
+        m_samples.m_hostFrameIntervals.clear();
+        m_samples.m_sentInputs = 0;
+    }
+
+    bool LoadTestClient::IsHandshakeComplete([[maybe_unused]] IConnection* connection) const
+    {
+        return m_handshakeComplete;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Connect& packet
+    )
+    {
+        // Only servers handle connect requests
+        return false;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Accept& packet
+    )
+    {
+        // Load test clients never load the level, they are ready for entity updates as soon as they are accepted
+        m_handshakeComplete = true;
+        connection->SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(true));
+        return true;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ReadyForEntityUpdates& packet
+    )
+    {
+        return false;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::SyncConsole& packet
+    )
+    {
+        // Every load test client shares this process' console, replicated server cvars are intentionally not applied
+        return true;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ConsoleCommand& packet
+    )
+    {
+        return true;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityUpdates& packet
+    )
+    {
+        if ((m_lastHostFrameId == InvalidHostFrameId) || (packet.GetHostFrameId() > m_lastHostFrameId))
+        {
+            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+            if (m_lastHostFrameId != InvalidHostFrameId)
+            {
+                // Normalize to a single server frame in case updates for some frames were lost or skipped
+                const uint32_t elapsedFrames = aznumeric_cast<uint32_t>(packet.GetHostFrameId()) - aznumeric_cast<uint32_t>(m_lastHostFrameId);
+                const AZ::TimeMs frameIntervalMs = (currentTimeMs - m_lastHostFrameReceivedTimeMs) / static_cast<AZ::TimeMs>(elapsedFrames);
+                m_samples.m_entityUpdateIntervals.push_back(frameIntervalMs);
+
+                // Host times are stamped by the server at the start of each frame, so their delta is the server's tick duration
+                const AZ::TimeMs hostFrameIntervalMs = (packet.GetHostTimeMs() - m_lastHostTimeMs) / static_cast<AZ::TimeMs>(elapsedFrames);
+                m_samples.m_hostFrameIntervals.push_back(hostFrameIntervalMs);
+            }
+            m_lastHostFrameId = packet.GetHostFrameId();
+            m_lastHostTimeMs = packet.GetHostTimeMs();
+            m_lastHostFrameReceivedTimeMs = currentTimeMs;
+        }
+
+        for (const NetworkEntityUpdateMessage& updateMessage : packet.GetEntityMessages())
+        {
+            if (updateMessage.GetNetworkRole() == NetEntityRole::Autonomous)
+            {
+                m_playerEntityId = updateMessage.GetIsDelete() ? InvalidNetEntityId : updateMessage.GetEntityId();
+            }
+            else if (updateMessage.GetIsDelete() && (updateMessage.GetEntityId() == m_playerEntityId))
+            {
+                m_playerEntityId = InvalidNetEntityId;
+            }
+        }
+        return true;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityRpcs& packet
+    )
+    {
+        // Rpcs, including input corrections, are received and decoded but never applied
+        return true;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::RequestReplicatorReset& packet
+    )
+    {
+        return true;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigration& packet
+    )
+    {
+        AZLOG_WARN("Load test client %u does not support server migration and will disconnect", m_clientIndex);
+        connection->Disconnect(DisconnectReason::ClientMigrated, TerminationEndpoint::Local);
+        return true;
+    }
+
+    bool LoadTestClient::HandleRequest
+    (
+        IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::VersionMismatch& packet
+    )
+    {
+        // Reply with our component versions so the server can decide whether to accept the connection
+        AZLOG_WARN("Load test client %u has a multiplayer component version mismatch with the server", m_clientIndex);
+        connection->SendReliablePacket(MultiplayerPackets::VersionMismatch(GetMultiplayerComponentRegistry()->GetMultiplayerComponentVersionHashes()));
+        return true;
+    }
+
+    ConnectResult LoadTestClient::ValidateConnect
+    (
+        [[maybe_unused]] const IpAddress& remoteAddress,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] ISerializer& serializer
+    )
+    {
+        // Load test clients never accept incoming connections
+        return ConnectResult::Rejected;
+    }
+
+    void LoadTestClient::OnConnect(IConnection* connection)
+    {
+        // The server hands the temporary user id to IMultiplayerSpawner::OnPlayerJoin, so every client needs its own
+        connection->SendReliablePacket(MultiplayerPackets::Connect(
+            0,
+            m_temporaryUserId,
+            "",
+            GetMultiplayerComponentRegistry()->GetSystemVersionHash()));
+    }
+
+    PacketDispatchResult LoadTestClient::OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        return MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+    }
+
+    void LoadTestClient::OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId)
+    {
+        ;
+    }
+
+    void LoadTestClient::OnDisconnect([[maybe_unused]] IConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint)
+    {
+        if (endpoint == TerminationEndpoint::Remote)
+        {
+            const AZStd::string reasonString = ToString(reason);
+            AZLOG_INFO("Load test client %u was disconnected by the server due to %s", m_clientIndex, reasonString.c_str());
+        }
+        m_handshakeComplete = false;
+        m_playerEntityId = InvalidNetEntityId;
+        m_connectionId = InvalidConnectionId;
+    }
+
+    void LoadTestClient::SendInput(float inputRateSec)
+    {
+        IConnection* connection = m_networkInterface->GetConnectionSet().GetConnection(m_connectionId);
+        if (connection == nullptr)
+        {
+            return;
+        }
+
+        // Shift the input history so that the most recent input is always at index 0, matching what regular clients send
+        for (uint32_t i = NetworkInputArray::MaxElements - 1; i > 0; --i)
+        {
+            m_inputArray[i] = m_inputArray[i - 1];
+        }
+
+        NetworkInput& input = m_inputArray[0];
+        input.SetClientInputId(++m_clientInputId);
+        input.SetHostFrameId(m_lastHostFrameId);
+        input.SetHostTimeMs(m_lastHostTimeMs);
+        input.SetHostBlendFactor(0.0f);
+        if (m_inputScript)
+        {
+            m_inputScript(m_clientIndex, input, inputRateSec);
+        }
+
+        // Load test clients do not simulate their player entity, so they cannot provide a meaningful state hash
+        // The server will respond with periodic corrections, which matches the cost of a badly desynced real client
+        MultiplayerPackets::EntityRpcs rpcsPacket;
+        rpcsPacket.ModifyEntityRpcs().emplace_back(
+            LocalPredictionPlayerInputComponentBase::BuildSendClientInputRpcMessage(m_playerEntityId, m_inputArray, AZ::HashValue32{ 0 }));
+        connection->SendUnreliablePacket(rpcsPacket);
+        ++m_samples.m_sentInputs;
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/IMultiplayerLoadTest.h>
+#include <Multiplayer/NetworkInput/NetworkInputArray.h>
+#include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+
+namespace AzNetworking
+{
+    class INetworkInterface;
+}
+
+namespace Multiplayer
+{
+    //! Samples gathered by a load test client since the last time they were collected.
+    struct LoadTestClientSamples
+    {
+        //! Arrival intervals of EntityUpdates packets for new host frames, divided by the number of host frames they advanced
+        AZStd::vector<AZ::TimeMs> m_entityUpdateIntervals;
+        //! Server tick durations taken from the host times of EntityUpdates packets, divided by the number of host frames they advanced
+        AZStd::vector<AZ::TimeMs> m_hostFrameIntervals;
+        uint32_t m_sentInputs = 0;
+        float m_roundTripTimeMs = 0.0f;
+        float m_sentBytesPerSecond = 0.0f;
+        float m_receivedBytesPerSecond = 0.0f;
+    };
+
+    //! @class LoadTestClient
+    //! @brief A lightweight simulated client used to load test a dedicated server.
+    //!
+    //! Each load test client owns its own network interface, so the server sees it as a distinct remote endpoint, and performs
+    //! the regular multiplayer handshake. Entity updates are inspected only to discover the client's autonomous player entity
+    //! and to time their arrival, they are never applied. Once a player entity has been assigned, the client streams
+    //! scripted NetworkInput to it at the configured input rate.
+    class LoadTestClient final
+        : public AzNetworking::IConnectionListener
+    {
+    public:
+
+        //! @param clientIndex       the index of the client, passed to the input script
+        //! @param temporaryUserId   the user id sent to the server on connect, must be unique and non-zero for each client
+        //! @param inputComponentIds the multiplayer components to allocate inputs for
+        //! @param inputScript       the script generating the client's input
+        LoadTestClient(uint32_t clientIndex, uint64_t temporaryUserId, const AZStd::vector<NetComponentId>& inputComponentIds, const LoadTestInputScript& inputScript);
+        ~LoadTestClient() override;
+
+        //! Creates the client's network interface and starts connecting to the server.
+        //! @param remoteAddress the address of the server to connect to
+        //! @return boolean true if the connection attempt was started
+        bool Connect(const AzNetworking::IpAddress& remoteAddress);
+
+        //! Generates and sends input for the client's player entity.
+        //! @param deltaTime     the time in seconds since the last update
+        //! @param inputRateSec  the rate in seconds at which inputs should be generated, clamped to at least one millisecond
+        void Update(float deltaTime, float inputRateSec);
+
+        //! Returns true if the server has assigned a player entity to this client.
+        //! @return boolean true if the server has assigned a player entity to this client
+        bool HasPlayerEntity() const;
+
+        //! Moves the samples gathered since the last call into the provided structure.
+        //! @param outSamples the structure to move samples into
+        void CollectSamples(LoadTestClientSamples& outSamples);
+
+        //! Handshake and packet handlers invoked by the multiplayer packet dispatcher.
+        //! @{
+        bool IsHandshakeComplete(AzNetworking::IConnection* connection) const;
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Connect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Accept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ReadyForEntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::SyncConsole& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ConsoleCommand& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::RequestReplicatorReset& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::VersionMismatch& packet);
+        //! @}
+
+        //! IConnectionListener interface
+        //! @{
+        AzNetworking::ConnectResult ValidateConnect(const AzNetworking::IpAddress& remoteAddress, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnConnect(AzNetworking::IConnection* connection) override;
+        AzNetworking::PacketDispatchResult OnPacketReceived(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnPacketLost(AzNetworking::IConnection* connection, AzNetworking::PacketId packetId) override;
+        void OnDisconnect(AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        //! @}
+
+    private:
+
+        void SendInput(float inputRateSec);
+
+        uint32_t m_clientIndex = 0;
+        uint64_t m_temporaryUserId = 0;
+        AZ::Name m_interfaceName;
+        AzNetworking::INetworkInterface* m_networkInterface = nullptr;
+        AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+        bool m_handshakeComplete = false;
+
+        NetEntityId m_playerEntityId = InvalidNetEntityId;
+        HostFrameId m_lastHostFrameId = InvalidHostFrameId;
+        AZ::TimeMs m_lastHostTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_lastHostFrameReceivedTimeMs = AZ::Time::ZeroTimeMs;
+
+        LoadTestInputScript m_inputScript;
+        NetworkInputArray m_inputArray;
+        ClientInputId m_clientInputId = ClientInputId{ 0 };
+        float m_inputAccumulator = 0.0f;
+
+        LoadTestClientSamples m_samples;
+    };
+}
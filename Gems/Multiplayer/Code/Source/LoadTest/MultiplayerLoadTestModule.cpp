@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/MultiplayerLoadTestModule.h>
+#include <Source/LoadTest/MultiplayerLoadTestSystemComponent.h>
+
+namespace Multiplayer
+{
+    MultiplayerLoadTestModule::MultiplayerLoadTestModule()
+        : AZ::Module()
+    {
+        m_descriptors.insert(m_descriptors.end(), {
+            MultiplayerLoadTestSystemComponent::CreateDescriptor()
+        });
+    }
+
+    AZ::ComponentTypeList MultiplayerLoadTestModule::GetRequiredSystemComponents() const
+    {
+        return AZ::ComponentTypeList
+        {
+            azrtti_typeid<MultiplayerLoadTestSystemComponent>()
+        };
+    }
+}
+
+#if defined(O3DE_GEM_NAME)
+AZ_DECLARE_MODULE_CLASS(AZ_JOIN(Gem_, O3DE_GEM_NAME, _LoadTest), Multiplayer::MultiplayerLoadTestModule)
+#else
+AZ_DECLARE_MODULE_CLASS(Gem_Multiplayer_LoadTest, Multiplayer::MultiplayerLoadTestModule)
+#endif
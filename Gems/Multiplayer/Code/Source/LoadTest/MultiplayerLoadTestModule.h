@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Module/Module.h>
+
+namespace Multiplayer
+{
+    class MultiplayerLoadTestModule
+        : public AZ::Module
+    {
+    public:
+        AZ_RTTI(MultiplayerLoadTestModule, "{E2A94D61-0F3B-4C78-A5D2-91B7E6C4F038}", AZ::Module);
+        AZ_CLASS_ALLOCATOR(MultiplayerLoadTestModule, AZ::SystemAllocator);
+
+        MultiplayerLoadTestModule();
+        ~MultiplayerLoadTestModule() override = default;
+
+        AZ::ComponentTypeList GetRequiredSystemComponents() const override;
+    };
+}
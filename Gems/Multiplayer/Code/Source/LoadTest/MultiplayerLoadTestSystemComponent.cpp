@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/MultiplayerLoadTestSystemComponent.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzNetworking/Utilities/EncryptionCommon.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/MultiplayerMetrics.h>
+#include <Multiplayer/MultiplayerPerformanceStats.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(AZ::CVarFixedString, bot_serveraddr, AZ::CVarFixedString(LocalHost), nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The address of the dedicated server load test clients connect to when no address is provided");
+    AZ_CVAR(uint16_t, bot_serverport, DefaultServerPort, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The port of the dedicated server load test clients connect to when no port is provided");
+    AZ_CVAR(uint32_t, bot_autoSpawnCount, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If non-zero, the number of load test clients to spawn on the first tick after activation");
+    AZ_CVAR(AZ::TimeMs, bot_inputRateMs, AZ::TimeMs{ 33 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Rate at which load test clients send input to the server, should match the server's cl_InputRateMs");
+    AZ_CVAR(AZ::TimeMs, bot_statsReportMs, AZ::TimeMs{ 1000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Rate at which aggregated load test client metrics are reported to the multiplayer stat system");
+
+    // Histogram bucket upper bounds, the final bucket of each histogram is unbounded
+    static constexpr AZ::TimeMs EntityUpdateIntervalBucketsMs[] = { AZ::TimeMs{ 40 }, AZ::TimeMs{ 80 }, AZ::TimeMs{ 160 } };
+    static constexpr float RttBucketsMs[] = { 25.0f, 50.0f, 100.0f, 200.0f };
+    static constexpr float ReceivedBucketsBytesPerSecond[] = { 8.0f * 1024.0f, 32.0f * 1024.0f, 128.0f * 1024.0f };
+
+    template <typename TYPE, AZStd::size_t BUCKET_COUNT>
+    static AZStd::size_t GetHistogramBucket(const TYPE(&buckets)[BUCKET_COUNT], TYPE value)
+    {
+        for (AZStd::size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            if (value < buckets[i])
+            {
+                return i;
+            }
+        }
+        return BUCKET_COUNT;
+    }
+
+    void MultiplayerLoadTestSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<MultiplayerLoadTestSystemComponent, AZ::Component>()
+                ->Version(1);
+        }
+    }
+
+    void MultiplayerLoadTestSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("MultiplayerLoadTestSystemComponent"));
+    }
+
+    void MultiplayerLoadTestSystemComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("NetworkingService"));
+        required.push_back(AZ_CRC_CE("MultiplayerService"));
+    }
+
+    void MultiplayerLoadTestSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("MultiplayerLoadTestSystemComponent"));
+    }
+
+    void MultiplayerLoadTestSystemComponent::Activate()
+    {
+        DECLARE_PERFORMANCE_STAT_GROUP(MultiplayerGroup_LoadTest, "LoadTest");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_ConnectedClients, "ConnectedClients");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_SentInputs, "SentInputs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_SentBytesPerSecond, "SentBytesPerSecond");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_ReceivedBytesPerSecond, "ReceivedBytesPerSecond");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_AverageEntityUpdateIntervalMs, "AverageEntityUpdateIntervalMs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_MaxEntityUpdateIntervalMs, "MaxEntityUpdateIntervalMs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_EntityUpdateIntervalUnder40Ms, "EntityUpdateIntervalUnder40Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_EntityUpdateIntervalUnder80Ms, "EntityUpdateIntervalUnder80Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_EntityUpdateIntervalUnder160Ms, "EntityUpdateIntervalUnder160Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_EntityUpdateIntervalOver160Ms, "EntityUpdateIntervalOver160Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_AverageRttMs, "AverageRttMs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_MaxRttMs, "MaxRttMs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_RttUnder25Ms, "RttUnder25Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_RttUnder50Ms, "RttUnder50Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_RttUnder100Ms, "RttUnder100Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_RttUnder200Ms, "RttUnder200Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_RttOver200Ms, "RttOver200Ms");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_ReceivedUnder8KBps, "ReceivedUnder8KBps");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_ReceivedUnder32KBps, "ReceivedUnder32KBps");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_ReceivedUnder128KBps, "ReceivedUnder128KBps");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_ReceivedOver128KBps, "ReceivedOver128KBps");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_AverageHostFrameIntervalMs, "AverageHostFrameIntervalMs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_LoadTest, MultiplayerLoadTestStat_MaxHostFrameIntervalMs, "MaxHostFrameIntervalMs");
+
+        // Randomize the user ids so that clients of several load test processes connected to one server don't share any.
+        // The base is kept within [1, 2^63] so adding a client index never wraps around to 0, which means no user id.
+        m_temporaryUserIdBase = (AzNetworking::CryptoRand64() >> 1) + 1;
+        m_autoSpawned = false;
+        m_timeSinceReport = 0.0f;
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void MultiplayerLoadTestSystemComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        DespawnAllClients();
+    }
+
+    void MultiplayerLoadTestSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (!m_autoSpawned)
+        {
+            // Deferred until the first tick so that the networking and multiplayer system components are fully activated
+            m_autoSpawned = true;
+            if (bot_autoSpawnCount > 0)
+            {
+                const AZ::CVarFixedString serverAddress = bot_serveraddr;
+                SpawnClients(bot_autoSpawnCount, serverAddress.c_str(), bot_serverport);
+            }
+        }
+
+        const float inputRateSec = AZ::TimeMsToSeconds(bot_inputRateMs);
+        for (AZStd::unique_ptr<LoadTestClient>& client : m_clients)
+        {
+            client->Update(deltaTime, inputRateSec);
+        }
+
+        m_timeSinceReport += deltaTime;
+        if (m_timeSinceReport >= AZ::TimeMsToSeconds(bot_statsReportMs))
+        {
+            m_timeSinceReport = 0.0f;
+            ReportStats(false);
+        }
+    }
+
+    int MultiplayerLoadTestSystemComponent::GetTickOrder()
+    {
+        // Tick after the networking and multiplayer system components so packets received this frame have already been dispatched
+        return AZ::TICK_PLACEMENT + 2;
+    }
+
+    uint32_t MultiplayerLoadTestSystemComponent::SpawnClients(uint32_t clientCount, const AZStd::string& remoteAddress, uint16_t port)
+    {
+        const AzNetworking::IpAddress ipAddress(remoteAddress.c_str(), port, AzNetworking::ProtocolType::Udp);
+        if (ipAddress.GetAddress(AzNetworking::ByteOrder::Host) == 0)
+        {
+            AZLOG_WARN("Unable to resolve load test server address %s:%u", remoteAddress.c_str(), aznumeric_cast<uint32_t>(port));
+            return 0;
+        }
+
+        uint32_t spawnedClients = 0;
+        m_clients.reserve(m_clients.size() + clientCount);
+        for (uint32_t i = 0; i < clientCount; ++i)
+        {
+            const uint32_t clientIndex = m_nextClientIndex++;
+            const uint64_t temporaryUserId = m_temporaryUserIdBase + clientIndex;
+            AZStd::unique_ptr<LoadTestClient> client = AZStd::make_unique<LoadTestClient>(clientIndex, temporaryUserId, m_inputComponentIds, m_inputScript);
+            if (!client->Connect(ipAddress))
+            {
+                AZLOG_WARN("Load test client failed to connect to %s:%u", remoteAddress.c_str(), aznumeric_cast<uint32_t>(port));
+                continue;
+            }
+            m_clients.emplace_back(AZStd::move(client));
+            ++spawnedClients;
+        }
+
+        AZLOG_INFO("Spawned %u load test clients, %u total", spawnedClients, GetClientCount());
+        return spawnedClients;
+    }
+
+    void MultiplayerLoadTestSystemComponent::DespawnAllClients()
+    {
+        m_clients.clear();
+    }
+
+    uint32_t MultiplayerLoadTestSystemComponent::GetClientCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_clients.size());
+    }
+
+    void MultiplayerLoadTestSystemComponent::SetInputScript(const AZStd::vector<NetComponentId>& componentIds, LoadTestInputScript script)
+    {
+        m_inputComponentIds = componentIds;
+        m_inputScript = AZStd::move(script);
+    }
+
+    void MultiplayerLoadTestSystemComponent::SpawnBots(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZLOG_WARN("SpawnBots requires a client count");
+            return;
+        }
+
+        const AZ::CVarFixedString countString{ arguments.front() };
+        const uint32_t clientCount = aznumeric_cast<uint32_t>(atol(countString.c_str()));
+
+        AZ::CVarFixedString remoteAddress = bot_serveraddr;
+        uint16_t port = bot_serverport;
+        if (arguments.size() > 1)
+        {
+            remoteAddress = arguments[1];
+            const AZStd::size_t portSeparator = remoteAddress.find_first_of(':');
+            if (portSeparator != AZStd::string::npos)
+            {
+                port = aznumeric_cast<uint16_t>(atol(remoteAddress.c_str() + portSeparator + 1));
+                remoteAddress.resize(portSeparator);
+            }
+        }
+        SpawnClients(clientCount, remoteAddress.c_str(), port);
+    }
+
+    void MultiplayerLoadTestSystemComponent::DespawnBots([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        DespawnAllClients();
+    }
+
+    void MultiplayerLoadTestSystemComponent::DumpBotStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        m_timeSinceReport = 0.0f;
+        ReportStats(true);
+    }
+
+    void MultiplayerLoadTestSystemComponent::ReportStats(bool logStats)
+    {
+        uint32_t connectedClients = 0;
+        uint32_t sentInputs = 0;
+        float totalSentBytesPerSecond = 0.0f;
+        float totalReceivedBytesPerSecond = 0.0f;
+        float totalRttMs = 0.0f;
+        float maxRttMs = 0.0f;
+        uint32_t rttHistogram[AZ_ARRAY_SIZE(RttBucketsMs) + 1] = {};
+        uint32_t receivedHistogram[AZ_ARRAY_SIZE(ReceivedBucketsBytesPerSecond) + 1] = {};
+        uint32_t entityUpdateIntervalHistogram[AZ_ARRAY_SIZE(EntityUpdateIntervalBucketsMs) + 1] = {};
+
+        m_entityUpdateIntervals.clear();
+        m_hostFrameIntervals.clear();
+        for (AZStd::unique_ptr<LoadTestClient>& client : m_clients)
+        {
+            client->CollectSamples(m_scratchSamples);
+            sentInputs += m_scratchSamples.m_sentInputs;
+            m_entityUpdateIntervals.insert(m_entityUpdateIntervals.end(), m_scratchSamples.m_entityUpdateIntervals.begin(), m_scratchSamples.m_entityUpdateIntervals.end());
+            m_hostFrameIntervals.insert(m_hostFrameIntervals.end(), m_scratchSamples.m_hostFrameIntervals.begin(), m_scratchSamples.m_hostFrameIntervals.end());
+            if (!client->HasPlayerEntity())
+            {
+                continue;
+            }
+
+            ++connectedClients;
+            totalSentBytesPerSecond += m_scratchSamples.m_sentBytesPerSecond;
+            totalReceivedBytesPerSecond += m_scratchSamples.m_receivedBytesPerSecond;
+            totalRttMs += m_scratchSamples.m_roundTripTimeMs;
+            maxRttMs = AZStd::max(maxRttMs, m_scratchSamples.m_roundTripTimeMs);
+            ++rttHistogram[GetHistogramBucket(RttBucketsMs, m_scratchSamples.m_roundTripTimeMs)];
+            ++receivedHistogram[GetHistogramBucket(ReceivedBucketsBytesPerSecond, m_scratchSamples.m_receivedBytesPerSecond)];
+        }
+
+        AZ::TimeMs totalEntityUpdateIntervalMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs maxEntityUpdateIntervalMs = AZ::Time::ZeroTimeMs;
+        for (const AZ::TimeMs entityUpdateIntervalMs : m_entityUpdateIntervals)
+        {
+            totalEntityUpdateIntervalMs += entityUpdateIntervalMs;
+            maxEntityUpdateIntervalMs = AZStd::max(maxEntityUpdateIntervalMs, entityUpdateIntervalMs);
+            ++entityUpdateIntervalHistogram[GetHistogramBucket(EntityUpdateIntervalBucketsMs, entityUpdateIntervalMs)];
+        }
+
+        AZ::TimeMs totalHostFrameIntervalMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs maxHostFrameIntervalMs = AZ::Time::ZeroTimeMs;
+        for (const AZ::TimeMs hostFrameIntervalMs : m_hostFrameIntervals)
+        {
+            totalHostFrameIntervalMs += hostFrameIntervalMs;
+            maxHostFrameIntervalMs = AZStd::max(maxHostFrameIntervalMs, hostFrameIntervalMs);
+        }
+
+        const float averageRttMs = (connectedClients > 0) ? totalRttMs / connectedClients : 0.0f;
+        const double averageEntityUpdateIntervalMs = m_entityUpdateIntervals.empty()
+            ? 0.0
+            : aznumeric_cast<double>(totalEntityUpdateIntervalMs) / aznumeric_cast<double>(m_entityUpdateIntervals.size());
+        const double averageHostFrameIntervalMs = m_hostFrameIntervals.empty()
+            ? 0.0
+            : aznumeric_cast<double>(totalHostFrameIntervalMs) / aznumeric_cast<double>(m_hostFrameIntervals.size());
+
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_ConnectedClients, connectedClients);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_SentInputs, sentInputs);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_SentBytesPerSecond, totalSentBytesPerSecond);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_ReceivedBytesPerSecond, totalReceivedBytesPerSecond);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_AverageEntityUpdateIntervalMs, averageEntityUpdateIntervalMs);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_MaxEntityUpdateIntervalMs, maxEntityUpdateIntervalMs);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_EntityUpdateIntervalUnder40Ms, entityUpdateIntervalHistogram[0]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_EntityUpdateIntervalUnder80Ms, entityUpdateIntervalHistogram[1]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_EntityUpdateIntervalUnder160Ms, entityUpdateIntervalHistogram[2]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_EntityUpdateIntervalOver160Ms, entityUpdateIntervalHistogram[3]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_AverageRttMs, averageRttMs);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_MaxRttMs, maxRttMs);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_RttUnder25Ms, rttHistogram[0]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_RttUnder50Ms, rttHistogram[1]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_RttUnder100Ms, rttHistogram[2]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_RttUnder200Ms, rttHistogram[3]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_RttOver200Ms, rttHistogram[4]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_ReceivedUnder8KBps, receivedHistogram[0]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_ReceivedUnder32KBps, receivedHistogram[1]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_ReceivedUnder128KBps, receivedHistogram[2]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_ReceivedOver128KBps, receivedHistogram[3]);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_AverageHostFrameIntervalMs, averageHostFrameIntervalMs);
+        SET_PERFORMANCE_STAT(MultiplayerLoadTestStat_MaxHostFrameIntervalMs, maxHostFrameIntervalMs);
+
+        if (!logStats)
+        {
+            return;
+        }
+
+        AZLOG_INFO
+        (
+            "Load test: %u/%u clients connected, %u inputs sent, avg server frame %0.1fms (max %lldms), avg entity update interval %0.1fms (max %lldms), avg rtt %0.1fms (max %0.1fms), %0.1fKB/s up, %0.1fKB/s down",
+            connectedClients,
+            GetClientCount(),
+            sentInputs,
+            averageHostFrameIntervalMs,
+            aznumeric_cast<int64_t>(maxHostFrameIntervalMs),
+            averageEntityUpdateIntervalMs,
+            aznumeric_cast<int64_t>(maxEntityUpdateIntervalMs),
+            averageRttMs,
+            maxRttMs,
+            totalSentBytesPerSecond / 1024.0f,
+            totalReceivedBytesPerSecond / 1024.0f
+        );
+    }
+}
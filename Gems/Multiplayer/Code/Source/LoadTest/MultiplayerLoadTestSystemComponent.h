@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/LoadTest/LoadTestClient.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Multiplayer/IMultiplayerLoadTest.h>
+
+namespace Multiplayer
+{
+    //! Owns the simulated clients spawned through IMultiplayerLoadTest and reports their aggregated metrics.
+    class MultiplayerLoadTestSystemComponent final
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public AZ::Interface<IMultiplayerLoadTest>::Registrar
+    {
+    public:
+        AZ_COMPONENT(MultiplayerLoadTestSystemComponent, "{B6C2F0E4-58A3-4D17-9E2B-7C41A09D3E85}");
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        ~MultiplayerLoadTestSystemComponent() override = default;
+
+        //! AZ::Component overrides
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+        //! AZ::TickBus::Handler overrides
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
+        //! IMultiplayerLoadTest overrides
+        //! @{
+        uint32_t SpawnClients(uint32_t clientCount, const AZStd::string& remoteAddress, uint16_t port) override;
+        void DespawnAllClients() override;
+        uint32_t GetClientCount() const override;
+        void SetInputScript(const AZStd::vector<NetComponentId>& componentIds, LoadTestInputScript script) override;
+        //! @}
+
+        //! Console commands
+        //! @{
+        void SpawnBots(const AZ::ConsoleCommandContainer& arguments);
+        void DespawnBots(const AZ::ConsoleCommandContainer& arguments);
+        void DumpBotStats(const AZ::ConsoleCommandContainer& arguments);
+        //! @}
+
+    private:
+
+        void ReportStats(bool logStats);
+
+        AZ_CONSOLEFUNC(MultiplayerLoadTestSystemComponent, SpawnBots, AZ::ConsoleFunctorFlags::Null, "Spawns load test clients, usage: SpawnBots <count> [address[:port]]");
+        AZ_CONSOLEFUNC(MultiplayerLoadTestSystemComponent, DespawnBots, AZ::ConsoleFunctorFlags::Null, "Disconnects and destroys all load test clients");
+        AZ_CONSOLEFUNC(MultiplayerLoadTestSystemComponent, DumpBotStats, AZ::ConsoleFunctorFlags::Null, "Logs the load test metrics gathered since the last report");
+
+        AZStd::vector<AZStd::unique_ptr<LoadTestClient>> m_clients;
+        AZStd::vector<NetComponentId> m_inputComponentIds;
+        LoadTestInputScript m_inputScript;
+        uint32_t m_nextClientIndex = 0;
+        uint64_t m_temporaryUserIdBase = 0;
+        float m_timeSinceReport = 0.0f;
+        bool m_autoSpawned = false;
+
+        // Scratch storage reused between reports to avoid per report allocations
+        LoadTestClientSamples m_scratchSamples;
+        AZStd::vector<AZ::TimeMs> m_entityUpdateIntervals;
+        AZStd::vector<AZ::TimeMs> m_hostFrameIntervals;
+    };
+}
@@ -86,6 +86,11 @@ namespace Multiplayer
         m_events.m_propertyReceived.Signal(netComponentId, propertyId, totalBytes);
     }
 
+    void MultiplayerStats::RecordPropertyWastedBits(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t wastedBits)
+    {
+        m_events.m_propertyWastedBits.Signal(netComponentId, propertyId, wastedBits);
+    }
+
     void MultiplayerStats::RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
@@ -255,6 +260,7 @@ namespace Multiplayer
         handlers.m_entitySerializeStop.Connect(m_events.m_entitySerializeStop);
         handlers.m_propertySent.Connect(m_events.m_propertySent);
         handlers.m_propertyReceived.Connect(m_events.m_propertyReceived);
+        handlers.m_propertyWastedBits.Connect(m_events.m_propertyWastedBits);
         handlers.m_rpcSent.Connect(m_events.m_rpcSent);
         handlers.m_rpcReceived.Connect(m_events.m_rpcReceived);
     }
@@ -18,11 +18,13 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
+#include <AzNetworking/Serialization/DeltaSerializer.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -35,6 +37,8 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(uint32_t, net_EntityReplicatorSnapshotHistory, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of received snapshots retained per entity as baselines for decoding snapshot updates");
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -901,6 +905,27 @@ namespace Multiplayer
         // May still be nullptr
         EntityReplicator* entityReplicator = GetEntityReplicator(updateMessage.GetEntityId());
         UpdateValidationResult result = ValidateUpdate(updateMessage, packetHeader.GetPacketId(), entityReplicator);
+
+        const uint8_t* updateData = updateMessage.GetData()->GetBuffer();
+        uint32_t updateDataSize = static_cast<uint32_t>(updateMessage.GetData()->GetSize());
+        if (updateMessage.GetIsSnapshot() && (result != UpdateValidationResult::DropMessageAndDisconnect))
+        {
+            // Decode snapshots even if the message is too old to apply, the sender may still select it as a baseline once acknowledged
+            const ReceivedSnapshot* snapshot = DecodeSnapshotUpdate(updateMessage, result == UpdateValidationResult::HandleMessage);
+            if (snapshot != nullptr)
+            {
+                updateData = snapshot->m_data.data();
+                updateDataSize = static_cast<uint32_t>(snapshot->m_data.size());
+            }
+            else if (result == UpdateValidationResult::HandleMessage)
+            {
+                // We no longer have the baseline the sender encoded against, request a reset so the sender starts over without one
+                AZLOG_WARN("Unable to decode snapshot for entity id %llu, requesting replicator reset", aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()));
+                m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+                return true;
+            }
+        }
+
         switch (result)
         {
         case UpdateValidationResult::HandleMessage:
@@ -913,7 +938,7 @@ namespace Multiplayer
             AZ_Assert(false, "Unhandled case");
         }
 
-        OutputSerializer outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        OutputSerializer outputSerializer(updateData, updateDataSize);
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -941,7 +966,7 @@ namespace Multiplayer
         bool handled = true;
 
         // This may implicitly create a replicator for us
-        if (updateMessage.GetData()->GetSize() != 0)
+        if (updateDataSize != 0)
         {
             handled = HandlePropertyChangeMessage(
                           invokingConnection,
@@ -964,6 +989,7 @@ namespace Multiplayer
         // has access to the most up-to-date property values.
         if (updateMessage.GetIsDelete())
         {
+            m_receivedSnapshots.erase(updateMessage.GetEntityId());
             handled = HandleEntityDeleteMessage(entityReplicator, packetHeader, updateMessage) && handled;
             AZLOG(NET_RepDeletes, "Handled entity delete message for entity %llu.", aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()));
         }
@@ -971,6 +997,66 @@ namespace Multiplayer
         return handled;
     }
 
+    const EntityReplicationManager::ReceivedSnapshot* EntityReplicationManager::DecodeSnapshotUpdate
+    (
+        const NetworkEntityUpdateMessage& updateMessage,
+        bool isNewestUpdate
+    )
+    {
+        // Only look up the history here, an entry is added once a snapshot has actually been decoded
+        auto receivedSnapshotsIter = m_receivedSnapshots.find(updateMessage.GetEntityId());
+
+        const ReceivedSnapshot* baseline = nullptr;
+        if (updateMessage.GetBaselineSequenceId() != InvalidSnapshotSequenceId)
+        {
+            if (receivedSnapshotsIter == m_receivedSnapshots.end())
+            {
+                return nullptr;
+            }
+
+            const ReceivedSnapshots& history = receivedSnapshotsIter->second;
+            auto baselineIter = AZStd::find_if(history.begin(), history.end(),
+                [&updateMessage](const ReceivedSnapshot& snapshot) { return snapshot.m_sequenceId == updateMessage.GetBaselineSequenceId(); });
+            if (baselineIter == history.end())
+            {
+                return nullptr;
+            }
+            baseline = &(*baselineIter);
+        }
+
+        ReceivedSnapshot snapshot;
+        snapshot.m_sequenceId = updateMessage.GetSnapshotSequenceId();
+        snapshot.m_data.resize_no_construct(AzNetworking::MaxPacketSize);
+        uint32_t snapshotSize = 0;
+        if (!AzNetworking::DecodeXorDelta(
+                baseline ? baseline->m_data.data() : nullptr, baseline ? static_cast<uint32_t>(baseline->m_data.size()) : 0,
+                updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()),
+                snapshot.m_data.data(), static_cast<uint32_t>(snapshot.m_data.size()), snapshotSize))
+        {
+            return nullptr;
+        }
+        snapshot.m_data.resize(snapshotSize);
+
+        if (receivedSnapshotsIter == m_receivedSnapshots.end())
+        {
+            receivedSnapshotsIter = m_receivedSnapshots.emplace(updateMessage.GetEntityId(), ReceivedSnapshots()).first;
+        }
+        ReceivedSnapshots& receivedSnapshots = receivedSnapshotsIter->second;
+
+        if ((baseline == nullptr) && isNewestUpdate)
+        {
+            // The sender has (re)started encoding without a baseline, any older history belongs to a previous publisher
+            receivedSnapshots.clear();
+        }
+
+        while (!receivedSnapshots.empty() && (receivedSnapshots.size() >= net_EntityReplicatorSnapshotHistory))
+        {
+            receivedSnapshots.pop_front();
+        }
+        receivedSnapshots.push_back(AZStd::move(snapshot));
+        return &receivedSnapshots.back();
+    }
+
     bool EntityReplicationManager::HandleEntityRpcMessages(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcVector& rpcVector)
     {
         for (NetworkEntityRpcMessage& rpcMessage : rpcVector)
@@ -96,6 +96,11 @@ namespace Multiplayer
 
         m_remoteNetworkRole = remoteNetworkRole;
 
+        if (m_propertyPublisher)
+        {
+            // The remote endpoint may still hold snapshots of the old publisher, keep counting from where it stopped
+            m_nextSnapshotSequenceId = m_propertyPublisher->GetNextSnapshotSequenceId();
+        }
         m_propertyPublisher = nullptr;
         m_propertySubscriber = nullptr;
 
@@ -147,7 +152,8 @@ namespace Multiplayer
                 (
                     GetRemoteNetworkRole(),
                     !RemoteManagerOwnsEntityLifetime() ? PropertyPublisher::OwnsLifetime::True : PropertyPublisher::OwnsLifetime::False,
-                    *m_connection
+                    *m_connection,
+                    m_nextSnapshotSequenceId
                 );
             m_onEntityDirtiedHandler.Disconnect();
             m_netBindComponent->AddEntityDirtiedEventHandler(m_onEntityDirtiedHandler);
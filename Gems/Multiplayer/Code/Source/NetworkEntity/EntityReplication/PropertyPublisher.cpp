@@ -8,6 +8,7 @@
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Serialization/DeltaSerializer.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <Multiplayer/IMultiplayer.h>
@@ -15,12 +16,22 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
-
-    PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection)
+    AZ_CVAR(bool, net_EntityReplicatorSnapshotMode, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity updates send the complete entity state delta-encoded against the last acknowledged snapshot instead of resending unacknowledged property changes");
+
+    PropertyPublisher::PropertyPublisher
+    (
+        NetEntityRole remoteNetworkRole,
+        OwnsLifetime ownsLifetime,
+        AzNetworking::IConnection& connection,
+        SnapshotSequenceId firstSnapshotSequenceId
+    )
         : m_ownsLifetime(ownsLifetime)
         , m_connection(connection)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
+        , m_sentSnapshots(net_EntityReplicatorRecordsMax)
+        , m_nextSnapshotSequenceId(firstSnapshotSequenceId != InvalidSnapshotSequenceId ? firstSnapshotSequenceId : SnapshotSequenceId{ 1 })
     {
         if ( ownsLifetime == OwnsLifetime::False )
         {
@@ -40,6 +51,11 @@ namespace Multiplayer
         return (PropertyPublisher::EntityReplicatorState::Deleting == m_replicatorState);
     }
 
+    SnapshotSequenceId PropertyPublisher::GetNextSnapshotSequenceId() const
+    {
+        return m_nextSnapshotSequenceId;
+    }
+
     bool PropertyPublisher::IsDeleted() const
     {
         bool result = false;
@@ -203,8 +219,85 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    void PropertyPublisher::UpdateSnapshotBaseline()
+    {
+        for (auto iter = m_sentSnapshots.begin(); iter != m_sentSnapshots.end(); ++iter)
+        {
+            // m_sentSnapshots is sorted from the most to the least recently sent, so the first acknowledged snapshot
+            // is the most recent state the remote endpoint is known to have. Anything older can never be used as a baseline again.
+            if (m_connection.WasPacketAcked(iter->m_sentPacketId))
+            {
+                m_baselineSnapshot = AZStd::move(*iter);
+                m_sentSnapshots.erase(iter, m_sentSnapshots.end());
+                break;
+            }
+        }
+    }
+
+    bool PropertyPublisher::GenerateSnapshotPacket(NetBindComponent* netBindComponent, NetworkEntityUpdateMessage& updateMessage)
+    {
+        AZ_Assert(netBindComponent, "NetBindComponent is nullptr");
+        UpdateSnapshotBaseline();
+
+        // Serialize the complete replicated state of the entity, so that the remote endpoint can reconstruct it
+        // from any acknowledged baseline regardless of which intermediate updates were lost
+        ReplicationRecord snapshotRecord(m_pendingRecord.GetRemoteNetworkRole());
+        netBindComponent->FillTotalReplicationRecord(snapshotRecord);
+        // Don't send predictable properties back to the Autonomous unless we correct them
+        if (snapshotRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous)
+        {
+            snapshotRecord.Subtract(netBindComponent->GetPredictableRecord());
+        }
+
+        EntitySnapshot snapshot;
+        snapshot.m_data.resize_no_construct(AzNetworking::MaxPacketSize);
+        InputSerializer inputSerializer(snapshot.m_data.data(), static_cast<uint32_t>(snapshot.m_data.size()));
+        snapshotRecord.ResetConsumedBits();
+        snapshotRecord.Serialize(inputSerializer);
+        netBindComponent->SerializeStateDeltaMessage(snapshotRecord, inputSerializer);
+        if (!inputSerializer.IsValid())
+        {
+            return false;
+        }
+        snapshot.m_data.resize(inputSerializer.GetSize());
+
+        AzNetworking::PacketEncodingBuffer& updateData = updateMessage.ModifyData();
+        uint32_t deltaSize = 0;
+        if (!AzNetworking::EncodeXorDelta(
+                m_baselineSnapshot.m_data.data(), static_cast<uint32_t>(m_baselineSnapshot.m_data.size()),
+                snapshot.m_data.data(), static_cast<uint32_t>(snapshot.m_data.size()),
+                updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetCapacity()), deltaSize))
+        {
+            return false;
+        }
+        updateData.Resize(deltaSize);
+
+        snapshot.m_sequenceId = m_nextSnapshotSequenceId;
+        // Skip over the invalid sequence id on wraparound
+        m_nextSnapshotSequenceId = SnapshotSequenceId{ static_cast<uint16_t>(static_cast<uint16_t>(m_nextSnapshotSequenceId) + 1) };
+        if (m_nextSnapshotSequenceId == InvalidSnapshotSequenceId)
+        {
+            m_nextSnapshotSequenceId = SnapshotSequenceId{ 1 };
+        }
+
+        updateMessage.SetSnapshotSequenceIds(snapshot.m_sequenceId, m_baselineSnapshot.m_sequenceId);
+        m_pendingSnapshot = AZStd::move(snapshot);
+        return true;
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
+        if (m_pendingSnapshot.m_sequenceId != InvalidSnapshotSequenceId)
+        {
+            if (packetId != AzNetworking::InvalidPacketId)
+            {
+                // If the ring buffer is full this drops the oldest unacknowledged snapshot, the acknowledged baseline is tracked separately
+                m_pendingSnapshot.m_sentPacketId = packetId;
+                m_sentSnapshots.push_front(AZStd::move(m_pendingSnapshot));
+            }
+            m_pendingSnapshot = EntitySnapshot();
+        }
+
         // Fill in the packet id for the last sent update
         ReplicationRecord& lastSentRecord = m_sentRecords.front();
         AZ_Assert(lastSentRecord.m_sentPacketId == AzNetworking::InvalidPacketId, "Assumed we pushed on a packet in UpdateSerialization");
@@ -372,6 +465,12 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
+        // Deletes always carry the final property changes directly, there is no later update to acknowledge a snapshot against
+        if (net_EntityReplicatorSnapshotMode && !isDeleted && GenerateSnapshotPacket(netBindComponent, updateMessage))
+        {
+            return updateMessage;
+        }
+
         InputSerializer inputSerializer(
             updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
         SerializeEntityRecord(inputSerializer, netBindComponent);
@@ -35,7 +35,13 @@ namespace Multiplayer
             False,
         };
 
-        PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection);
+        //! @param firstSnapshotSequenceId the sequence id of the first snapshot sent, so a publisher replacing a previous one after
+        //!                               a reset doesn't reuse sequence ids the remote endpoint may still hold snapshots for
+        PropertyPublisher(
+            NetEntityRole remoteNetworkRole,
+            OwnsLifetime ownsLifetime,
+            AzNetworking::IConnection& connection,
+            SnapshotSequenceId firstSnapshotSequenceId = SnapshotSequenceId{ 1 });
 
         //! Set the publishing state to "rebasing". The next record sent will be a rebase record.
         //! Rebase records send the full replication state for Autonomous entities minus the predictable properties.
@@ -48,6 +54,9 @@ namespace Multiplayer
 
         //! Returns true if the entity should be deleted, false if not. It will return true whether or not the delete has been acknowledged.
         bool IsDeleting() const;
+
+        //! Returns the sequence id the next snapshot will be sent with.
+        SnapshotSequenceId GetNextSnapshotSequenceId() const;
         //! Returns true only if the entity delete has been acknlowledged.
         bool IsDeleted() const;
 
@@ -117,6 +126,14 @@ namespace Multiplayer
         //! Add/update/delete all use the same serialization path.
         bool SerializeEntityRecord(AzNetworking::ISerializer& serializer, NetBindComponent* netBindComponent);
 
+        //! Snapshot replication, used in place of phase 2 when net_EntityReplicatorSnapshotMode is enabled.
+        //! Serializes the complete entity state and encodes it against the most recently acknowledged snapshot.
+        //! @return true if a snapshot delta was written to updateMessage, false if the caller should fall back to a property change record
+        bool GenerateSnapshotPacket(NetBindComponent* netBindComponent, NetworkEntityUpdateMessage& updateMessage);
+
+        //! Promotes the most recently acknowledged sent snapshot to be the baseline for future snapshot deltas.
+        void UpdateSnapshotBaseline();
+
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
@@ -135,6 +152,22 @@ namespace Multiplayer
 
         //! List of sent records
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
+        //! A full serialized entity state, used as a baseline for snapshot replication.
+        struct EntitySnapshot
+        {
+            AzNetworking::PacketId m_sentPacketId = AzNetworking::InvalidPacketId;
+            SnapshotSequenceId m_sequenceId = InvalidSnapshotSequenceId;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        //! List of sent snapshots that have not yet been acknowledged, sorted from the most to the least recently sent.
+        AZStd::ring_buffer<EntitySnapshot> m_sentSnapshots;
+        //! The most recent snapshot acknowledged by the remote endpoint, which subsequent snapshots are encoded against.
+        EntitySnapshot m_baselineSnapshot;
+        //! The snapshot generated for the current update packet, pending a packet id.
+        EntitySnapshot m_pendingSnapshot;
+        SnapshotSequenceId m_nextSnapshotSequenceId = SnapshotSequenceId{ 1 };
+
         //! List of sent delete packets, tracked separately as a way to look for acknowledged deletes.
         //! (This could potentially get merged into m_sentRecords as an optimization)
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
@@ -17,7 +17,10 @@ namespace Multiplayer
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isSnapshot(rhs.m_isSnapshot)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_snapshotSequenceId(rhs.m_snapshotSequenceId)
+        , m_baselineSequenceId(rhs.m_baselineSequenceId)
         , m_data(AZStd::move(rhs.m_data))
     {
         ;
@@ -29,7 +32,10 @@ namespace Multiplayer
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isSnapshot(rhs.m_isSnapshot)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_snapshotSequenceId(rhs.m_snapshotSequenceId)
+        , m_baselineSequenceId(rhs.m_baselineSequenceId)
     {
         if (rhs.m_data != nullptr)
         {
@@ -54,7 +60,10 @@ namespace Multiplayer
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isSnapshot = rhs.m_isSnapshot;
         m_prefabEntityId = rhs.m_prefabEntityId;
+        m_snapshotSequenceId = rhs.m_snapshotSequenceId;
+        m_baselineSequenceId = rhs.m_baselineSequenceId;
         m_data = AZStd::move(rhs.m_data);
         return *this;
     }
@@ -66,7 +75,10 @@ namespace Multiplayer
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isSnapshot = rhs.m_isSnapshot;
         m_prefabEntityId = rhs.m_prefabEntityId;
+        m_snapshotSequenceId = rhs.m_snapshotSequenceId;
+        m_baselineSequenceId = rhs.m_baselineSequenceId;
         if (rhs.m_data != nullptr)
         {
             m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
@@ -83,6 +95,9 @@ namespace Multiplayer
              && (m_isDelete == rhs.m_isDelete)
              && (m_wasMigrated == rhs.m_wasMigrated)
              && (m_hasValidPrefabId == rhs.m_hasValidPrefabId)
+             && (m_isSnapshot == rhs.m_isSnapshot)
+             && (m_snapshotSequenceId == rhs.m_snapshotSequenceId)
+             && (m_baselineSequenceId == rhs.m_baselineSequenceId)
              && (m_prefabEntityId == rhs.m_prefabEntityId));
     }
 
@@ -98,6 +113,7 @@ namespace Multiplayer
         static const uint32_t sizeOfFlags = 1;
         static const uint32_t sizeOfEntityId = sizeof(NetEntityId);
         static const uint32_t sizeOfSliceId = 6;
+        const uint32_t sizeOfSnapshotIds = m_isSnapshot ? 2 * sizeof(SnapshotSequenceId) : 0;
 
         // 2-byte size header + the actual blob payload itself
         const uint32_t sizeOfBlob = static_cast<uint32_t>((m_data != nullptr) ? sizeof(PropertyIndex) + m_data->GetSize() : 0);
@@ -105,11 +121,11 @@ namespace Multiplayer
         if (m_hasValidPrefabId)
         {
             // sliceId is transmitted
-            return sizeOfFlags + sizeOfEntityId + sizeOfSliceId + sizeOfBlob;
+            return sizeOfFlags + sizeOfEntityId + sizeOfSliceId + sizeOfSnapshotIds + sizeOfBlob;
         }
 
         // No sliceId, remote replicator already exists so we don't need to know what type of entity this is
-        return sizeOfFlags + sizeOfEntityId + sizeOfBlob;
+        return sizeOfFlags + sizeOfEntityId + sizeOfSnapshotIds + sizeOfBlob;
     }
 
     NetEntityRole NetworkEntityUpdateMessage::GetNetworkRole() const
@@ -148,6 +164,28 @@ namespace Multiplayer
         return m_prefabEntityId;
     }
 
+    void NetworkEntityUpdateMessage::SetSnapshotSequenceIds(SnapshotSequenceId snapshotSequenceId, SnapshotSequenceId baselineSequenceId)
+    {
+        m_isSnapshot = true;
+        m_snapshotSequenceId = snapshotSequenceId;
+        m_baselineSequenceId = baselineSequenceId;
+    }
+
+    bool NetworkEntityUpdateMessage::GetIsSnapshot() const
+    {
+        return m_isSnapshot;
+    }
+
+    SnapshotSequenceId NetworkEntityUpdateMessage::GetSnapshotSequenceId() const
+    {
+        return m_snapshotSequenceId;
+    }
+
+    SnapshotSequenceId NetworkEntityUpdateMessage::GetBaselineSequenceId() const
+    {
+        return m_baselineSequenceId;
+    }
+
     void NetworkEntityUpdateMessage::SetData(const AzNetworking::PacketEncodingBuffer& value)
     {
         if (m_data == nullptr)
@@ -177,13 +215,15 @@ namespace Multiplayer
         serializer.Serialize(m_entityId, "EntityId");
 
         // Use the upper 4 bits for boolean flags, and the lower 4 bits for the network role
-        uint8_t networkTypeAndFlags = (m_isDelete ? 0x40 : 0x00)
+        uint8_t networkTypeAndFlags = (m_isSnapshot ? 0x80 : 0x00)
+                                    | (m_isDelete ? 0x40 : 0x00)
                                     | (m_wasMigrated ? 0x20 : 0x00)
                                     | (m_hasValidPrefabId ? 0x10 : 0x00)
                                     | static_cast<uint8_t>(m_networkRole);
 
         if (serializer.Serialize(networkTypeAndFlags, "TypeAndFlags"))
         {
+            m_isSnapshot = (networkTypeAndFlags & 0x80) == 0x80;
             m_isDelete = (networkTypeAndFlags & 0x40) == 0x40;
             m_wasMigrated = (networkTypeAndFlags & 0x20) == 0x20;
             m_hasValidPrefabId = (networkTypeAndFlags & 0x10) == 0x10;
@@ -201,6 +241,13 @@ namespace Multiplayer
             serializer.Serialize(m_prefabEntityId, "PrefabEntityId");
         }
 
+        if (m_isSnapshot)
+        {
+            // Snapshot deltas are only decodable against the baseline snapshot they were encoded against
+            serializer.Serialize(m_snapshotSequenceId, "SnapshotSequenceId");
+            serializer.Serialize(m_baselineSequenceId, "BaselineSequenceId");
+        }
+
         // m_data should never be nullptr
         if (m_data == nullptr)
         {
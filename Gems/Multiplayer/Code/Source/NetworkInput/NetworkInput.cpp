@@ -122,6 +122,20 @@ namespace Multiplayer
         }
     }
 
+    void NetworkInput::AttachComponentInputs(const AZStd::vector<NetComponentId>& netComponentIds)
+    {
+        m_wasAttached = true;
+        m_componentInputs.clear();
+        for (NetComponentId netComponentId : netComponentIds)
+        {
+            AZStd::unique_ptr<IMultiplayerComponentInput> componentInput = GetMultiplayerComponentRegistry()->AllocateComponentInput(netComponentId);
+            if (componentInput != nullptr)
+            {
+                m_componentInputs.emplace_back(AZStd::move(componentInput));
+            }
+        }
+    }
+
     bool NetworkInput::Serialize(AzNetworking::ISerializer& serializer)
     {
         if (!serializer.Serialize(m_inputId, "InputId")
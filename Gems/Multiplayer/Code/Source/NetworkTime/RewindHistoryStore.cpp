@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/RewindHistoryStore.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace Multiplayer
+{
+    RewindHistoryStore::RewindHistoryStore()
+    {
+        AZ::Interface<RewindHistoryStore>::Register(this);
+    }
+
+    RewindHistoryStore::~RewindHistoryStore()
+    {
+        AZ::Interface<RewindHistoryStore>::Unregister(this);
+    }
+
+    RewindSlotId RewindHistoryStore::AllocateSlot(AzNetworking::ConnectionId owningConnectionId, const AZ::Transform& transform, HostFrameId frameId)
+    {
+        RewindSlotId slotId = InvalidRewindSlotId;
+        if (!m_freeSlots.empty())
+        {
+            slotId = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            if (m_slotCount == m_slotCapacity)
+            {
+                GrowSlotCapacity();
+            }
+            slotId = RewindSlotId{ m_slotCount++ };
+        }
+
+        const uint32_t slotIndex = aznumeric_cast<uint32_t>(slotId);
+        m_headFrames[slotIndex] = frameId;
+        m_owningConnectionIds[slotIndex] = owningConnectionId;
+
+        const AZ::Vector3 translation = transform.GetTranslation();
+        const AZ::Quaternion rotation = transform.GetRotation();
+        const float uniformScale = transform.GetUniformScale();
+        for (uint32_t rowIndex = 0; rowIndex < RewindHistorySize; ++rowIndex)
+        {
+            WriteRow(rowIndex, slotIndex, translation, rotation, uniformScale);
+        }
+        return slotId;
+    }
+
+    void RewindHistoryStore::FreeSlot(RewindSlotId slotId)
+    {
+        AZ_Assert(aznumeric_cast<uint32_t>(slotId) < m_slotCount, "Attempting to free an invalid rewind slot");
+        AZ_Assert(!GetNetworkTime() || !GetNetworkTime()->IsTimeRewound(), "Rewind slots cannot be freed under a rewound time scope");
+        m_owningConnectionIds[aznumeric_cast<uint32_t>(slotId)] = AzNetworking::InvalidConnectionId;
+        m_freeSlots.push_back(slotId);
+    }
+
+    void RewindHistoryStore::SetOwningConnectionId(RewindSlotId slotId, AzNetworking::ConnectionId owningConnectionId)
+    {
+        m_owningConnectionIds[aznumeric_cast<uint32_t>(slotId)] = owningConnectionId;
+    }
+
+    void RewindHistoryStore::Record(RewindSlotId slotId, HostFrameId frameId, const AZ::Transform& transform)
+    {
+        const uint32_t slotIndex = aznumeric_cast<uint32_t>(slotId);
+        const HostFrameId headFrame = m_headFrames[slotIndex];
+        if (frameId < headFrame)
+        {
+            // Don't try and set values older than our current head value
+            return;
+        }
+
+        const uint32_t frameDelta = aznumeric_cast<uint32_t>(frameId) - aznumeric_cast<uint32_t>(headFrame);
+        if (frameDelta >= RewindHistorySize)
+        {
+            // This update represents a large enough time delta that we'll just flush the whole history with the new value
+            for (uint32_t rowIndex = 0; rowIndex < RewindHistorySize; ++rowIndex)
+            {
+                WriteRow(rowIndex, slotIndex, transform.GetTranslation(), transform.GetRotation(), transform.GetUniformScale());
+            }
+        }
+        else
+        {
+            // Carry the head value forward through any frames that were skipped since the last write
+            const uint32_t headElement = GetRowIndex(headFrame) * m_slotCapacity + slotIndex;
+            const AZ::Vector3 headTranslation = m_translations[headElement];
+            const AZ::Quaternion headRotation = m_rotations[headElement];
+            const float headUniformScale = m_uniformScales[headElement];
+            for (uint32_t skippedFrame = 1; skippedFrame < frameDelta; ++skippedFrame)
+            {
+                WriteRow(GetRowIndex(headFrame + HostFrameId{ skippedFrame }), slotIndex, headTranslation, headRotation, headUniformScale);
+            }
+            WriteRow(GetRowIndex(frameId), slotIndex, transform.GetTranslation(), transform.GetRotation(), transform.GetUniformScale());
+        }
+        m_headFrames[slotIndex] = frameId;
+    }
+
+    AZ::Transform RewindHistoryStore::GetTransformForFrame(RewindSlotId slotId, HostFrameId frameId) const
+    {
+        const uint32_t slotIndex = aznumeric_cast<uint32_t>(slotId);
+        const uint32_t element = GetRowIndex(ClampFrameForSlot(slotId, frameId)) * m_slotCapacity + slotIndex;
+        AZ::Transform result = AZ::Transform::CreateFromQuaternionAndTranslation(m_rotations[element], m_translations[element]);
+        result.SetUniformScale(m_uniformScales[element]);
+        return result;
+    }
+
+    RewindHistoryFrameView RewindHistoryStore::GetFrameView(HostFrameId frameId) const
+    {
+        RewindHistoryFrameView view;
+        if (m_slotCapacity > 0)
+        {
+            const uint32_t rowOffset = GetRowIndex(frameId) * m_slotCapacity;
+            view.m_translations = &m_translations[rowOffset];
+            view.m_rotations = &m_rotations[rowOffset];
+            view.m_uniformScales = &m_uniformScales[rowOffset];
+            view.m_slotCount = m_slotCount;
+        }
+        return view;
+    }
+
+    void RewindHistoryStore::SetTransform(RewindSlotId slotId, const AZ::Transform& transform)
+    {
+        Record(slotId, GetCurrentFrameForSlot(slotId), transform);
+    }
+
+    AZ::Transform RewindHistoryStore::GetTransform(RewindSlotId slotId) const
+    {
+        return GetTransformForFrame(slotId, GetCurrentFrameForSlot(slotId));
+    }
+
+    AZ::Transform RewindHistoryStore::GetBlendedTransform(RewindSlotId slotId) const
+    {
+        INetworkTime* networkTime = GetNetworkTime();
+        const HostFrameId currentFrame = GetCurrentFrameForSlot(slotId);
+        const AZ::Transform targetTransform = GetTransformForFrame(slotId, currentFrame);
+        const float blendFactor = networkTime->GetHostBlendFactor();
+        const bool isOwnerRewinding = networkTime->IsTimeRewound()
+            && (m_owningConnectionIds[aznumeric_cast<uint32_t>(slotId)] == networkTime->GetRewindingConnectionId());
+        if ((blendFactor >= 1.0f) || isOwnerRewinding)
+        {
+            return targetTransform;
+        }
+
+        // If a blend factor was supplied, interpolate the transform appropriately
+        const AZ::Transform previousTransform = GetTransformForFrame(slotId, currentFrame - HostFrameId{ 1 });
+        AZ::Transform blendedTransform;
+        blendedTransform.SetRotation(previousTransform.GetRotation().Slerp(targetTransform.GetRotation(), blendFactor));
+        blendedTransform.SetTranslation(previousTransform.GetTranslation().Lerp(targetTransform.GetTranslation(), blendFactor));
+        blendedTransform.SetUniformScale(AZ::Lerp(previousTransform.GetUniformScale(), targetTransform.GetUniformScale(), blendFactor));
+        return blendedTransform;
+    }
+
+    uint32_t RewindHistoryStore::GetAllocatedSlotCount() const
+    {
+        return m_slotCount - aznumeric_cast<uint32_t>(m_freeSlots.size());
+    }
+
+    uint32_t RewindHistoryStore::GetSlotCapacity() const
+    {
+        return m_slotCapacity;
+    }
+
+    HostFrameId RewindHistoryStore::GetCurrentFrameForSlot(RewindSlotId slotId) const
+    {
+        INetworkTime* networkTime = GetNetworkTime();
+        if (networkTime->IsTimeRewound() && (m_owningConnectionIds[aznumeric_cast<uint32_t>(slotId)] == networkTime->GetRewindingConnectionId()))
+        {
+            return networkTime->GetUnalteredHostFrameId();
+        }
+        return networkTime->GetHostFrameId();
+    }
+
+    HostFrameId RewindHistoryStore::ClampFrameForSlot(RewindSlotId slotId, HostFrameId frameId) const
+    {
+        const HostFrameId headFrame = m_headFrames[aznumeric_cast<uint32_t>(slotId)];
+        if (frameId >= headFrame)
+        {
+            return headFrame;
+        }
+
+        const uint32_t frameDelta = aznumeric_cast<uint32_t>(headFrame) - aznumeric_cast<uint32_t>(frameId);
+        if (frameDelta >= RewindHistorySize)
+        {
+            AZLOG(NET_Rewind, "Request for value which is too old");
+            return headFrame - HostFrameId{ RewindHistorySize - 1 };
+        }
+        return frameId;
+    }
+
+    void RewindHistoryStore::WriteRow(uint32_t rowIndex, uint32_t slotIndex, const AZ::Vector3& translation, const AZ::Quaternion& rotation, float uniformScale)
+    {
+        const uint32_t element = rowIndex * m_slotCapacity + slotIndex;
+        m_translations[element] = translation;
+        m_rotations[element] = rotation;
+        m_uniformScales[element] = uniformScale;
+    }
+
+    void RewindHistoryStore::GrowSlotCapacity()
+    {
+        AZ_Assert(!GetNetworkTime() || !GetNetworkTime()->IsTimeRewound(), "Rewind history storage cannot grow under a rewound time scope");
+
+        const uint32_t oldCapacity = m_slotCapacity;
+        const uint32_t newCapacity = oldCapacity + SlotCapacityIncrement;
+
+        AZStd::vector<AZ::Vector3> translations(newCapacity * RewindHistorySize, AZ::Vector3::CreateZero());
+        AZStd::vector<AZ::Quaternion> rotations(newCapacity * RewindHistorySize, AZ::Quaternion::CreateIdentity());
+        AZStd::vector<float> uniformScales(newCapacity * RewindHistorySize, 1.0f);
+
+        // Rows are strided by the slot capacity, so each row has to be relocated individually
+        for (uint32_t rowIndex = 0; rowIndex < RewindHistorySize; ++rowIndex)
+        {
+            const uint32_t oldOffset = rowIndex * oldCapacity;
+            const uint32_t newOffset = rowIndex * newCapacity;
+            for (uint32_t slotIndex = 0; slotIndex < m_slotCount; ++slotIndex)
+            {
+                translations[newOffset + slotIndex] = m_translations[oldOffset + slotIndex];
+                rotations[newOffset + slotIndex] = m_rotations[oldOffset + slotIndex];
+                uniformScales[newOffset + slotIndex] = m_uniformScales[oldOffset + slotIndex];
+            }
+        }
+
+        m_translations.swap(translations);
+        m_rotations.swap(rotations);
+        m_uniformScales.swap(uniformScales);
+        m_headFrames.resize(newCapacity, HostFrameId{ 0 });
+        m_owningConnectionIds.resize(newCapacity, AzNetworking::InvalidConnectionId);
+        m_slotCapacity = newCapacity;
+    }
+
+    uint32_t RewindHistoryStore::GetRowIndex(HostFrameId frameId)
+    {
+        return aznumeric_cast<uint32_t>(frameId) % RewindHistorySize;
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <Source/LoadTest/LoadTestClient.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+
+namespace Multiplayer
+{
+    class LoadTestClientTests : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+            ON_CALL(*m_mockTime, GetElapsedTimeMs()).WillByDefault(Invoke([this]() { return m_currentTimeMs; }));
+        }
+
+        void ReceiveEntityUpdates(LoadTestClient& client, HostFrameId hostFrameId, const NetworkEntityUpdateVector& entityMessages)
+        {
+            MultiplayerPackets::EntityUpdates packet;
+            packet.SetHostTimeMs(m_currentTimeMs);
+            packet.SetHostFrameId(hostFrameId);
+            packet.SetEntityMessages(entityMessages);
+            EXPECT_TRUE(client.HandleRequest(m_mockConnection.get(), UdpPacketHeader(), packet));
+        }
+
+        AZ::TimeMs m_currentTimeMs = AZ::TimeMs{ 1000 };
+    };
+
+    TEST_F(LoadTestClientTests, ClientsConnectWithTheirOwnTemporaryUserId)
+    {
+        // The server passes the temporary user id to the player spawner, so bots must not all send the same one
+        AZStd::vector<uint64_t> sentUserIds;
+        ON_CALL(*m_mockConnection, SendReliablePacket(_)).WillByDefault(Invoke([&sentUserIds](const IPacket& packet)
+        {
+            if (packet.GetPacketType() == MultiplayerPackets::Connect::Type)
+            {
+                sentUserIds.push_back(static_cast<const MultiplayerPackets::Connect&>(packet).GetTemporaryUserId());
+            }
+            return true;
+        }));
+
+        LoadTestClient firstClient(0, 1000, {}, LoadTestInputScript());
+        LoadTestClient secondClient(1, 1001, {}, LoadTestInputScript());
+        firstClient.OnConnect(m_mockConnection.get());
+        secondClient.OnConnect(m_mockConnection.get());
+
+        ASSERT_EQ(sentUserIds.size(), 2);
+        EXPECT_EQ(sentUserIds[0], 1000);
+        EXPECT_EQ(sentUserIds[1], 1001);
+    }
+
+    TEST_F(LoadTestClientTests, AcceptCompletesHandshake)
+    {
+        LoadTestClient client(0, 1000, {}, LoadTestInputScript());
+        EXPECT_FALSE(client.IsHandshakeComplete(m_mockConnection.get()));
+
+        EXPECT_CALL(*m_mockConnection, SendReliablePacket(_)).Times(1);
+        MultiplayerPackets::Accept accept;
+        EXPECT_TRUE(client.HandleRequest(m_mockConnection.get(), UdpPacketHeader(), accept));
+        EXPECT_TRUE(client.IsHandshakeComplete(m_mockConnection.get()));
+    }
+
+    TEST_F(LoadTestClientTests, EntityUpdatesTrackPlayerEntity)
+    {
+        LoadTestClient client(0, 1000, {}, LoadTestInputScript());
+        EXPECT_FALSE(client.HasPlayerEntity());
+
+        NetworkEntityUpdateVector entityMessages;
+        entityMessages.push_back(NetworkEntityUpdateMessage(NetEntityRole::Client, NetEntityId{ 4 }, false, false));
+        ReceiveEntityUpdates(client, HostFrameId{ 10 }, entityMessages);
+        EXPECT_FALSE(client.HasPlayerEntity());
+
+        entityMessages.clear();
+        entityMessages.push_back(NetworkEntityUpdateMessage(NetEntityRole::Autonomous, NetEntityId{ 5 }, false, false));
+        ReceiveEntityUpdates(client, HostFrameId{ 11 }, entityMessages);
+        EXPECT_TRUE(client.HasPlayerEntity());
+
+        entityMessages.clear();
+        entityMessages.push_back(NetworkEntityUpdateMessage(NetEntityRole::Client, NetEntityId{ 5 }, true, false));
+        ReceiveEntityUpdates(client, HostFrameId{ 12 }, entityMessages);
+        EXPECT_FALSE(client.HasPlayerEntity());
+    }
+
+    TEST_F(LoadTestClientTests, EntityUpdateIntervalsAreNormalizedToHostFrames)
+    {
+        LoadTestClient client(0, 1000, {}, LoadTestInputScript());
+
+        ReceiveEntityUpdates(client, HostFrameId{ 10 }, {});
+
+        // Two host frames advanced in 100ms
+        m_currentTimeMs = AZ::TimeMs{ 1100 };
+        ReceiveEntityUpdates(client, HostFrameId{ 12 }, {});
+
+        // Updates for older host frames arrive out of order and are not timed
+        m_currentTimeMs = AZ::TimeMs{ 1200 };
+        ReceiveEntityUpdates(client, HostFrameId{ 11 }, {});
+
+        LoadTestClientSamples samples;
+        client.CollectSamples(samples);
+        ASSERT_EQ(samples.m_entityUpdateIntervals.size(), 1);
+        EXPECT_EQ(samples.m_entityUpdateIntervals[0], AZ::TimeMs{ 50 });
+
+        // Collecting moves the samples out of the client
+        client.CollectSamples(samples);
+        EXPECT_TRUE(samples.m_entityUpdateIntervals.empty());
+    }
+
+    TEST_F(LoadTestClientTests, HostFrameIntervalsUseServerHostTimes)
+    {
+        LoadTestClient client(0, 1000, {}, LoadTestInputScript());
+
+        ReceiveEntityUpdates(client, HostFrameId{ 10 }, {});
+
+        // The server ticked two frames in 60ms, but network jitter delayed the packet's arrival by another 40ms
+        MultiplayerPackets::EntityUpdates packet;
+        packet.SetHostTimeMs(AZ::TimeMs{ 1060 });
+        packet.SetHostFrameId(HostFrameId{ 12 });
+        m_currentTimeMs = AZ::TimeMs{ 1100 };
+        EXPECT_TRUE(client.HandleRequest(m_mockConnection.get(), UdpPacketHeader(), packet));
+
+        LoadTestClientSamples samples;
+        client.CollectSamples(samples);
+        ASSERT_EQ(samples.m_entityUpdateIntervals.size(), 1);
+        EXPECT_EQ(samples.m_entityUpdateIntervals[0], AZ::TimeMs{ 50 });
+        ASSERT_EQ(samples.m_hostFrameIntervals.size(), 1);
+        EXPECT_EQ(samples.m_hostFrameIntervals[0], AZ::TimeMs{ 30 });
+
+        client.CollectSamples(samples);
+        EXPECT_TRUE(samples.m_hostFrameIntervals.empty());
+    }
+}
@@ -9,9 +9,13 @@
 #include <MockInterfaces.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
+#include <AzNetworking/Serialization/AzContainerSerializers.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
 #include <AzTest/AzTest.h>
 #include <Multiplayer/Components/MultiplayerComponent.h>
+#include <Tests/QuantizedPropertyTesterComponent.h>
 
 namespace Multiplayer
 {
@@ -71,4 +75,83 @@ namespace Multiplayer
         EXPECT_EQ(valueMap.size(), NumTestEntriesPlusSize);
     }
 
+    TEST_F(MultiplayerComponentTests, SerializeQuantizedNetworkPropertyHelperReportsWastedBits)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        AzNetworking::FixedSizeVectorBitset<1> bitset;
+        NetComponentId componentId = aznumeric_cast<NetComponentId>(0);
+        PropertyIndex propertyIndex = aznumeric_cast<PropertyIndex>(0);
+        MultiplayerStats stats;
+        stats.ReserveComponentStats(componentId, 1, 0);
+
+        uint32_t reportedWastedBits = 0;
+        MultiplayerStats::EventHandlers handlers;
+        handlers.m_propertyWastedBits = decltype(handlers.m_propertyWastedBits)(
+            [&reportedWastedBits](NetComponentId, PropertyIndex, uint32_t wastedBits) { reportedWastedBits = wastedBits; });
+        stats.ConnectHandlers(handlers);
+
+        bitset.AddBits(1);
+        bitset.SetBit(0, true);
+        AzNetworking::FixedSizeBitsetView bitsetView(bitset, 0, 1);
+
+        AZ::Vector3 inValue(1.0f, 2.0f, 3.0f);
+        AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        SerializeQuantizedNetworkPropertyHelper<10, AZ::Vector3>(inSerializer, bitsetView, 0, inValue, "Value", -8.0f, 8.0f, componentId, propertyIndex, stats);
+        EXPECT_EQ(inSerializer.GetSize(), 4u);
+
+        net_ReportQuantizationWaste = true;
+        AZ::Vector3 outValue = AZ::Vector3::CreateZero();
+        AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), inSerializer.GetSize());
+        SerializeQuantizedNetworkPropertyHelper<10, AZ::Vector3>(outSerializer, bitsetView, 0, outValue, "Value", -8.0f, 8.0f, componentId, propertyIndex, stats);
+        net_ReportQuantizationWaste = false;
+
+        EXPECT_TRUE(bitset.GetBit(0));
+        EXPECT_TRUE(outValue.IsClose(inValue, 16.0f / 1023.0f));
+        // 30 bits of quantized data are carried in a 4 byte bounded value
+        EXPECT_EQ(reportedWastedBits, 2u);
+    }
+
+    TEST_F(MultiplayerComponentTests, QuantizedNetworkPropertyRoundTripsThroughGeneratedSerializer)
+    {
+        AZStd::unique_ptr<AZ::ComponentDescriptor> testerDescriptor(MultiplayerTest::QuantizedPropertyTesterComponent::CreateDescriptor());
+        testerDescriptor->Reflect(m_serializeContext.get());
+
+        EntityInfo entityInfo(1, "entity", NetEntityId{ 1 }, EntityInfo::Role::Root);
+        entityInfo.m_entity->CreateComponent<AzFramework::TransformComponent>();
+        entityInfo.m_entity->CreateComponent<NetBindComponent>();
+        entityInfo.m_entity->CreateComponent<MultiplayerTest::QuantizedPropertyTesterComponent>();
+        SetupEntity(entityInfo.m_entity, entityInfo.m_netId, NetEntityRole::Authority);
+        entityInfo.m_entity->Activate();
+
+        auto component = entityInfo.m_entity->FindComponent<MultiplayerTest::QuantizedPropertyTesterComponent>();
+        ASSERT_NE(component, nullptr);
+        const AZ::Vector3 value(1.25f, -3.5f, 7.75f);
+        component->GetTestController()->SetPosition(value);
+
+        /* Derived from QuantizedPropertyTesterComponent.AutoComponent.xml */
+        constexpr int totalBits = 1 /*QuantizedPropertyTesterComponentInternal::AuthorityToClientDirtyEnum::Count*/;
+        constexpr int positionBit = 0 /*QuantizedPropertyTesterComponentInternal::AuthorityToClientDirtyEnum::position_DirtyFlag*/;
+
+        ReplicationRecord sendRecord;
+        sendRecord.m_authorityToClient.AddBits(totalBits);
+        sendRecord.m_authorityToClient.SetBit(positionBit, true);
+
+        AZStd::array<uint8_t, 64> buffer = {};
+        AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(component->SerializeStateDeltaMessage(sendRecord, inSerializer));
+        // 3 elements of 10 bits are packed into a single 4 byte value instead of 3 floats
+        EXPECT_EQ(inSerializer.GetSize(), 4u);
+
+        component->GetTestController()->SetPosition(AZ::Vector3::CreateZero());
+
+        ReplicationRecord receiveRecord;
+        receiveRecord.m_authorityToClient.AddBits(totalBits);
+        receiveRecord.m_authorityToClient.SetBit(positionBit, true);
+
+        AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), inSerializer.GetSize());
+        EXPECT_TRUE(component->SerializeStateDeltaMessage(receiveRecord, outSerializer));
+        EXPECT_TRUE(receiveRecord.m_authorityToClient.GetBit(positionBit));
+        EXPECT_TRUE(component->GetPosition().IsClose(value, 16.0f / 1023.0f));
+    }
+
 } // namespace Multiplayer
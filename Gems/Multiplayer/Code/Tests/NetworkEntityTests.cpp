@@ -10,6 +10,7 @@
 #include <TestMultiplayerComponent.h>
 #include <Source/NetworkEntity/NetworkEntityManager.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Source/EntityDomains/FullOwnershipEntityDomain.h>
 #include <Source/EntityDomains/NullEntityDomain.h>
 #include <Source/ReplicationWindows/NullReplicationWindow.h>
@@ -481,6 +482,87 @@ namespace Multiplayer
         EXPECT_FALSE(m_root->m_replicator->HasChangesToPublish());
     }
 
+    MATCHER_P(IsMultiplayerPacketType, packetType, "Checks an IPacket's packet type")
+    {
+        return arg.GetPacketType() == packetType;
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicationManagerDecodesSnapshotsAgainstAcknowledgedBaseline)
+    {
+        // Send snapshots from the root's replicator to the replication manager and make sure the receiver only
+        // asks for a reset when a snapshot references a baseline it doesn't have.
+        m_console->PerformCommand("net_EntityReplicatorSnapshotMode true");
+        ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+        m_entityReplicationManager->SetReplicationWindow(AZStd::make_unique<NullReplicationWindow>(m_mockConnection.get()));
+
+        // The first snapshot has nothing acknowledged to be encoded against.
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage firstSnapshot = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 1 });
+        EXPECT_TRUE(firstSnapshot.GetIsSnapshot());
+        EXPECT_EQ(firstSnapshot.GetSnapshotSequenceId(), SnapshotSequenceId{ 1 });
+        EXPECT_EQ(firstSnapshot.GetBaselineSequenceId(), InvalidSnapshotSequenceId);
+
+        // The second snapshot is encoded against the first one, which has been acknowledged.
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(1.0f, 2.0f, 3.0f));
+        m_networkEntityManager->NotifyEntitiesDirtied();
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        NetworkEntityUpdateMessage secondSnapshot = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 2 });
+        EXPECT_TRUE(secondSnapshot.GetIsSnapshot());
+        EXPECT_EQ(secondSnapshot.GetSnapshotSequenceId(), SnapshotSequenceId{ 2 });
+        EXPECT_EQ(secondSnapshot.GetBaselineSequenceId(), SnapshotSequenceId{ 1 });
+        // The remote replicator counts as established now, so the prefab id was left out of the update
+        secondSnapshot.SetPrefabEntityId(m_root->m_entity->FindComponent<NetBindComponent>()->GetPrefabEntityId());
+
+        // Other packets, such as the root's own updates, may be sent by SendUpdates too
+        EXPECT_CALL(*m_mockConnection, SendUnreliablePacket(::testing::_)).Times(::testing::AnyNumber());
+        EXPECT_CALL(*m_mockConnection, SendUnreliablePacket(IsMultiplayerPacketType(MultiplayerPackets::RequestReplicatorReset::Type))).Times(0);
+        UdpPacketHeader firstHeader(PacketType{ 11111 }, InvalidSequenceId, SequenceId{ 1 }, InvalidSequenceId, 0xF8000FFF, SequenceRolloverCount{ 0 });
+        EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), firstHeader, firstSnapshot));
+        UdpPacketHeader secondHeader(PacketType{ 11111 }, InvalidSequenceId, SequenceId{ 2 }, InvalidSequenceId, 0xF8000FFF, SequenceRolloverCount{ 0 });
+        EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), secondHeader, secondSnapshot));
+        m_entityReplicationManager->SendUpdates();
+        ::testing::Mock::VerifyAndClearExpectations(m_mockConnection.get());
+
+        // A snapshot encoded against a baseline the receiver never got can't be decoded, the receiver requests a reset instead.
+        NetworkEntityUpdateMessage orphanedSnapshot = secondSnapshot;
+        orphanedSnapshot.SetSnapshotSequenceIds(SnapshotSequenceId{ 3 }, SnapshotSequenceId{ 100 });
+        EXPECT_CALL(*m_mockConnection, SendUnreliablePacket(::testing::_)).Times(::testing::AnyNumber());
+        EXPECT_CALL(*m_mockConnection, SendUnreliablePacket(IsMultiplayerPacketType(MultiplayerPackets::RequestReplicatorReset::Type))).Times(1);
+        UdpPacketHeader thirdHeader(PacketType{ 11111 }, InvalidSequenceId, SequenceId{ 3 }, InvalidSequenceId, 0xF8000FFF, SequenceRolloverCount{ 0 });
+        EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), thirdHeader, orphanedSnapshot));
+        m_entityReplicationManager->SendUpdates();
+        ::testing::Mock::VerifyAndClearExpectations(m_mockConnection.get());
+
+        m_console->PerformCommand("net_EntityReplicatorSnapshotMode false");
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorSnapshotSequenceContinuesAfterReset)
+    {
+        // The remote endpoint may still hold snapshots from before a reset, so a reset must not restart the sequence ids
+        m_console->PerformCommand("net_EntityReplicatorSnapshotMode true");
+        ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage firstSnapshot = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 1 });
+        EXPECT_EQ(firstSnapshot.GetSnapshotSequenceId(), SnapshotSequenceId{ 1 });
+
+        const NetworkEntityHandle rootHandle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        m_root->m_replicator->Reset(NetEntityRole::Client);
+        m_root->m_replicator->Initialize(rootHandle);
+
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage resetSnapshot = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 2 });
+        EXPECT_TRUE(resetSnapshot.GetIsSnapshot());
+        EXPECT_EQ(resetSnapshot.GetSnapshotSequenceId(), SnapshotSequenceId{ 2 });
+        EXPECT_EQ(resetSnapshot.GetBaselineSequenceId(), InvalidSnapshotSequenceId);
+
+        m_console->PerformCommand("net_EntityReplicatorSnapshotMode false");
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityManagerRelevancy)
     {
         ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
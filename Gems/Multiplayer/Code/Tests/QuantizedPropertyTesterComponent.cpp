@@ -0,0 +1,53 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+#include <Tests/QuantizedPropertyTesterComponent.h>
+
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace MultiplayerTest
+{
+    void QuantizedPropertyTesterComponent::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serializeContext)
+        {
+            serializeContext->Class<QuantizedPropertyTesterComponent, QuantizedPropertyTesterComponentBase>()
+                ->Version(1);
+        }
+        QuantizedPropertyTesterComponentBase::Reflect(context);
+    }
+
+    void QuantizedPropertyTesterComponent::OnInit()
+    {
+    }
+
+    void QuantizedPropertyTesterComponent::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+    }
+
+    void QuantizedPropertyTesterComponent::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+    }
+
+    QuantizedPropertyTesterComponentController* QuantizedPropertyTesterComponent::GetTestController()
+    {
+        return static_cast<QuantizedPropertyTesterComponentController*>(GetController());
+    }
+
+    QuantizedPropertyTesterComponentController::QuantizedPropertyTesterComponentController(QuantizedPropertyTesterComponent& parent)
+        : QuantizedPropertyTesterComponentControllerBase(parent)
+    {
+    }
+
+    void QuantizedPropertyTesterComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+    }
+
+    void QuantizedPropertyTesterComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+    }
+}
@@ -0,0 +1,38 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+#pragma once
+
+#include <Tests/AutoGen/QuantizedPropertyTesterComponent.AutoComponent.h>
+
+namespace MultiplayerTest
+{
+    // Test multiplayer component with a network property that's quantized by the generated serialization code
+    class QuantizedPropertyTesterComponent
+        : public QuantizedPropertyTesterComponentBase
+    {
+    public:
+        AZ_MULTIPLAYER_COMPONENT(MultiplayerTest::QuantizedPropertyTesterComponent, s_quantizedPropertyTesterComponentConcreteUuid, MultiplayerTest::QuantizedPropertyTesterComponentBase);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        void OnInit() override;
+        void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+        void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+
+        QuantizedPropertyTesterComponentController* GetTestController();
+    };
+
+    class QuantizedPropertyTesterComponentController
+        : public QuantizedPropertyTesterComponentControllerBase
+    {
+    public:
+        explicit QuantizedPropertyTesterComponentController(QuantizedPropertyTesterComponent& parent);
+
+        void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+        void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+    };
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkTime/RewindHistoryStore.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class RewindHistoryStoreTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static AZ::Transform MakeTransform(float x)
+        {
+            return AZ::Transform::CreateTranslation(AZ::Vector3(x, 0.0f, 0.0f));
+        }
+
+        static float GetX(const AZ::Transform& transform)
+        {
+            return transform.GetTranslation().GetX();
+        }
+
+        Multiplayer::NetworkTime m_networkTime;
+        Multiplayer::RewindHistoryStore m_store;
+        AZ::LoggerSystemComponent m_loggerComponent;
+        AZ::TimeSystem m_timeSystem;
+    };
+
+    TEST_F(RewindHistoryStoreTests, RecordAndRewind)
+    {
+        const Multiplayer::RewindSlotId slot = m_store.AllocateSlot(AzNetworking::InvalidConnectionId, MakeTransform(0.0f), Multiplayer::HostFrameId{ 0 });
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            m_store.SetTransform(slot, MakeTransform(static_cast<float>(i)));
+            EXPECT_FLOAT_EQ(static_cast<float>(i), GetX(m_store.GetTransform(slot)));
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(i), AZ::Time::ZeroTimeMs, 1.f, AzNetworking::InvalidConnectionId);
+            EXPECT_FLOAT_EQ(static_cast<float>(i), GetX(m_store.GetTransform(slot)));
+            EXPECT_FLOAT_EQ(static_cast<float>(i), m_store.GetFrameView(static_cast<Multiplayer::HostFrameId>(i)).m_translations[aznumeric_cast<uint32_t>(slot)].GetX());
+        }
+    }
+
+    TEST_F(RewindHistoryStoreTests, BackfillSkippedFrames)
+    {
+        const Multiplayer::RewindSlotId slot = m_store.AllocateSlot(AzNetworking::InvalidConnectionId, MakeTransform(0.0f), Multiplayer::HostFrameId{ 0 });
+        m_store.Record(slot, Multiplayer::HostFrameId{ 2 }, MakeTransform(1.0f));
+        m_store.Record(slot, Multiplayer::HostFrameId{ 10 }, MakeTransform(2.0f));
+
+        // Writes in the past are ignored
+        m_store.Record(slot, Multiplayer::HostFrameId{ 5 }, MakeTransform(3.0f));
+
+        EXPECT_FLOAT_EQ(0.0f, GetX(m_store.GetTransformForFrame(slot, Multiplayer::HostFrameId{ 1 })));
+        for (uint32_t i = 2; i < 10; ++i)
+        {
+            EXPECT_FLOAT_EQ(1.0f, GetX(m_store.GetTransformForFrame(slot, Multiplayer::HostFrameId{ i })));
+        }
+        EXPECT_FLOAT_EQ(2.0f, GetX(m_store.GetTransformForFrame(slot, Multiplayer::HostFrameId{ 10 })));
+
+        // Frames newer than the last write return the newest value, frames older than the window are clamped
+        EXPECT_FLOAT_EQ(2.0f, GetX(m_store.GetTransformForFrame(slot, Multiplayer::HostFrameId{ 50 })));
+        m_store.Record(slot, Multiplayer::HostFrameId{ 1000 }, MakeTransform(4.0f));
+        EXPECT_FLOAT_EQ(4.0f, GetX(m_store.GetTransformForFrame(slot, Multiplayer::HostFrameId{ 10 })));
+    }
+
+    TEST_F(RewindHistoryStoreTests, SlotReuseAndGrowth)
+    {
+        AZStd::vector<Multiplayer::RewindSlotId> slots;
+        const uint32_t slotCount = Multiplayer::RewindHistoryStore::SlotCapacityIncrement + 1;
+        for (uint32_t i = 0; i < slotCount; ++i)
+        {
+            slots.push_back(m_store.AllocateSlot(AzNetworking::InvalidConnectionId, MakeTransform(static_cast<float>(i)), Multiplayer::HostFrameId{ 0 }));
+            m_store.Record(slots.back(), Multiplayer::HostFrameId{ 1 }, MakeTransform(static_cast<float>(i) + 0.5f));
+        }
+        EXPECT_EQ(slotCount, m_store.GetAllocatedSlotCount());
+        EXPECT_EQ(2 * Multiplayer::RewindHistoryStore::SlotCapacityIncrement, m_store.GetSlotCapacity());
+
+        // History recorded before the storage grew must be preserved
+        for (uint32_t i = 0; i < slotCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(static_cast<float>(i), GetX(m_store.GetTransformForFrame(slots[i], Multiplayer::HostFrameId{ 0 })));
+            EXPECT_FLOAT_EQ(static_cast<float>(i) + 0.5f, GetX(m_store.GetTransformForFrame(slots[i], Multiplayer::HostFrameId{ 1 })));
+        }
+
+        m_store.FreeSlot(slots[3]);
+        EXPECT_EQ(slotCount - 1, m_store.GetAllocatedSlotCount());
+        const Multiplayer::RewindSlotId reused = m_store.AllocateSlot(AzNetworking::InvalidConnectionId, MakeTransform(-1.0f), Multiplayer::HostFrameId{ 1 });
+        EXPECT_EQ(slots[3], reused);
+        EXPECT_FLOAT_EQ(-1.0f, GetX(m_store.GetTransformForFrame(reused, Multiplayer::HostFrameId{ 0 })));
+    }
+
+    TEST_F(RewindHistoryStoreTests, OwnerIsNotRewound)
+    {
+        const AzNetworking::ConnectionId owner = AzNetworking::ConnectionId{ 0 };
+        const Multiplayer::RewindSlotId ownedSlot = m_store.AllocateSlot(owner, MakeTransform(0.0f), Multiplayer::HostFrameId{ 0 });
+        const Multiplayer::RewindSlotId otherSlot = m_store.AllocateSlot(AzNetworking::InvalidConnectionId, MakeTransform(0.0f), Multiplayer::HostFrameId{ 0 });
+
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            m_store.SetTransform(ownedSlot, MakeTransform(static_cast<float>(i)));
+            m_store.SetTransform(otherSlot, MakeTransform(static_cast<float>(i)));
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        Multiplayer::ScopedAlterTime time(Multiplayer::HostFrameId{ 4 }, AZ::Time::ZeroTimeMs, 0.5f, owner);
+        EXPECT_FLOAT_EQ(7.0f, GetX(m_store.GetTransform(ownedSlot)));
+        EXPECT_FLOAT_EQ(7.0f, GetX(m_store.GetBlendedTransform(ownedSlot)));
+        EXPECT_FLOAT_EQ(4.0f, GetX(m_store.GetTransform(otherSlot)));
+        EXPECT_FLOAT_EQ(3.5f, GetX(m_store.GetBlendedTransform(otherSlot)));
+    }
+}
@@ -55,6 +55,7 @@ set(FILES
     Include/Multiplayer/NetworkTime/RewindableFixedVector.inl
     Include/Multiplayer/NetworkTime/RewindableObject.h
     Include/Multiplayer/NetworkTime/RewindableObject.inl
+    Include/Multiplayer/NetworkTime/RewindHistoryStore.h
     Include/Multiplayer/ReplicationWindows/IReplicationWindow.h
     Include/Multiplayer/Session/IMatchmakingRequests.h
     Include/Multiplayer/Session/ISessionHandlingRequests.h
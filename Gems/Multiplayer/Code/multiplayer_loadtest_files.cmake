@@ -0,0 +1,17 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+#
+
+set(FILES
+    Include/Multiplayer/IMultiplayerLoadTest.h
+    Source/LoadTest/LoadTestClient.cpp
+    Source/LoadTest/LoadTestClient.h
+    Source/LoadTest/MultiplayerLoadTestModule.cpp
+    Source/LoadTest/MultiplayerLoadTestModule.h
+    Source/LoadTest/MultiplayerLoadTestSystemComponent.cpp
+    Source/LoadTest/MultiplayerLoadTestSystemComponent.h
+)
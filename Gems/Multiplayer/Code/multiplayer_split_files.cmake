@@ -64,6 +64,7 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/NetworkTime/RewindHistoryStore.cpp
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
@@ -22,6 +22,7 @@ set(FILES
     Tests/IMultiplayerSpawnerMock.h
     Tests/Main.cpp
     Tests/MockInterfaces.h
+    Tests/LoadTestClientTests.cpp
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
     Tests/MultiplayerSystemTests.cpp
@@ -32,6 +33,7 @@ set(FILES
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/RewindHistoryStoreTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/SimplePlayerSpawnerTests.cpp
     Tests/TestMultiplayerComponent.h
@@ -41,4 +43,11 @@ set(FILES
     Tests/AutoGen/RpcUnitTesterComponent.AutoComponent.xml
     Tests/RpcUnitTesterComponent.h
     Tests/RpcUnitTesterComponent.cpp
+
+    Tests/AutoGen/QuantizedPropertyTesterComponent.AutoComponent.xml
+    Tests/QuantizedPropertyTesterComponent.h
+    Tests/QuantizedPropertyTesterComponent.cpp
+
+    Source/LoadTest/LoadTestClient.cpp
+    Source/LoadTest/LoadTestClient.h
 )
@@ -8,11 +8,20 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZStdCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_ZStdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Path to a zstd packet dictionary trained with net_ZStdTrainDictionary, both peers must use the same dictionary");
+    AZ_CVAR(int32_t, net_ZStdCompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The zstd compression level used by zstd packet compressors");
+    AZ_CVAR(int32_t, net_ZStdStreamWindowLog, 17, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Log2 of the history window kept by streaming zstd compressors, bounds the memory used by each connection");
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +31,41 @@ namespace MultiplayerCompression
     {
         return s_compressorName;
     }
+
+    ZStdCompressionFactory::ZStdCompressionFactory(bool streaming)
+        : m_streaming(streaming)
+    {
+        ;
+    }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> ZStdCompressionFactory::Create()
+    {
+        const AZ::CVarFixedString dictionaryPath = net_ZStdDictionaryPath;
+        const int compressionLevel = net_ZStdCompressionLevel;
+        AZStd::shared_ptr<const ZStdDictionary> dictionary = GetDictionary(AZStd::string(dictionaryPath.c_str()), compressionLevel);
+        return AZStd::make_unique<ZStdCompressor>(AZStd::move(dictionary), compressionLevel, m_streaming, net_ZStdStreamWindowLog);
+    }
+
+    const AZStd::string_view ZStdCompressionFactory::GetFactoryName() const
+    {
+        return m_streaming ? s_streamCompressorName : s_compressorName;
+    }
+
+    AZStd::shared_ptr<const ZStdDictionary> ZStdCompressionFactory::GetDictionary(const AZStd::string& path, int compressionLevel)
+    {
+        if (path.empty())
+        {
+            return nullptr;
+        }
+
+        // Compressors may be created from multiple network threads, the dictionary is loaded once and shared between all of them
+        AZStd::lock_guard<AZStd::mutex> lock(m_dictionaryMutex);
+        if ((m_dictionary == nullptr) || (m_dictionaryPath != path) || (m_dictionaryCompressionLevel != compressionLevel))
+        {
+            m_dictionary = ZStdDictionary::LoadFromFile(path.c_str(), compressionLevel);
+            m_dictionaryPath = path;
+            m_dictionaryCompressionLevel = compressionLevel;
+        }
+        return m_dictionary;
+    }
 }
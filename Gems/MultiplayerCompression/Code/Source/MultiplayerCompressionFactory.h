@@ -9,7 +9,10 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
 namespace MultiplayerCompression
@@ -29,4 +32,36 @@ namespace MultiplayerCompression
     private:
         static constexpr AZStd::string_view s_compressorName = "MultiplayerCompressor";
     };
+
+    class ZStdDictionary;
+
+    //! Factory for zstd compressors, registered as MultiplayerZStdCompressor for per packet compression and as
+    //! MultiplayerZStdStreamCompressor for per connection streaming compression, which is only valid on TCP.
+    class ZStdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        explicit ZStdCompressionFactory(bool streaming);
+
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the string name of this compressor factory
+        //! @return the string name of this compressor factory
+        const AZStd::string_view GetFactoryName() const override;
+
+    private:
+        static constexpr AZStd::string_view s_compressorName = "MultiplayerZStdCompressor";
+        static constexpr AZStd::string_view s_streamCompressorName = "MultiplayerZStdStreamCompressor";
+
+        //! Returns the dictionary configured by net_ZStdDictionaryPath, reloading it if the configuration changed.
+        AZStd::shared_ptr<const ZStdDictionary> GetDictionary(const AZStd::string& path, int compressionLevel);
+
+        AZStd::mutex m_dictionaryMutex;
+        AZStd::shared_ptr<const ZStdDictionary> m_dictionary;
+        AZStd::string m_dictionaryPath;
+        int m_dictionaryCompressionLevel = 0;
+        bool m_streaming = false;
+    };
 }
@@ -49,12 +49,20 @@ namespace MultiplayerCompression
     MultiplayerCompressionSystemComponent::MultiplayerCompressionSystemComponent()
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
+        m_zstdCompressionFactory = new ZStdCompressionFactory(false);
+        m_zstdStreamCompressionFactory = new ZStdCompressionFactory(true);
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdCompressionFactory);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdStreamCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdCompressionFactory->GetFactoryName());
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdStreamCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
+        delete m_zstdCompressionFactory;
+        delete m_zstdStreamCompressionFactory;
     }
 }
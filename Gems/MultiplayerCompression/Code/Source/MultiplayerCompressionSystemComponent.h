@@ -41,5 +41,7 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        ZStdCompressionFactory* m_zstdCompressionFactory;
+        ZStdCompressionFactory* m_zstdStreamCompressionFactory;
     };
 }
@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZStdCompressor.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzNetworking/Framework/PacketCapture.h>
+
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    // Trained dictionaries beyond 64KiB give diminishing returns for packets bounded by the MTU
+    static constexpr size_t DefaultDictionaryCapacity = 64 * 1024;
+
+    ZStdDictionary::ZStdDictionary(const void* dictionaryData, size_t dictionarySize, int compressionLevel)
+    {
+        m_compressionDictionary = ZSTD_createCDict(dictionaryData, dictionarySize, compressionLevel);
+        m_decompressionDictionary = ZSTD_createDDict(dictionaryData, dictionarySize);
+    }
+
+    ZStdDictionary::~ZStdDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    AZStd::shared_ptr<ZStdDictionary> ZStdDictionary::LoadFromFile(const char* path, int compressionLevel)
+    {
+        const AZ::IO::SystemFile::SizeType dictionarySize = AZ::IO::SystemFile::Length(path);
+        if (dictionarySize == 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Unable to load zstd dictionary %s", path);
+            return nullptr;
+        }
+
+        AZStd::vector<uint8_t> dictionaryData;
+        dictionaryData.resize_no_construct(dictionarySize);
+        if (AZ::IO::SystemFile::Read(path, dictionaryData.data(), dictionarySize) != dictionarySize)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read zstd dictionary %s", path);
+            return nullptr;
+        }
+
+        // The digested dictionaries take copies of the dictionary content, so the file data can be released here
+        AZStd::shared_ptr<ZStdDictionary> dictionary = AZStd::make_shared<ZStdDictionary>(dictionaryData.data(), dictionaryData.size(), compressionLevel);
+        if (!dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to digest zstd dictionary %s", path);
+            return nullptr;
+        }
+
+        return dictionary;
+    }
+
+    bool ZStdDictionary::IsValid() const
+    {
+        return (m_compressionDictionary != nullptr) && (m_decompressionDictionary != nullptr);
+    }
+
+    ZStdCompressor::ZStdCompressor(AZStd::shared_ptr<const ZStdDictionary> dictionary, int compressionLevel, bool streaming, int windowLog)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_compressionLevel(compressionLevel)
+        , m_windowLog(windowLog)
+        , m_streaming(streaming)
+    {
+        m_compressionContext = ZSTD_createCCtx();
+        m_decompressionContext = ZSTD_createDCtx();
+        if ((m_compressionContext == nullptr) || (m_decompressionContext == nullptr))
+        {
+            return;
+        }
+
+        // The parameter API was added in zstd 1.4.0, older versions configure each frame or stream when it starts
+#if ZSTD_VERSION_NUMBER >= 10400
+        ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_compressionLevel, compressionLevel);
+        // Both peers agree on the dictionary out of band, so the frame header doesn't need to carry any of this
+        ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_dictIDFlag, 0);
+        ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_checksumFlag, 0);
+        ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_contentSizeFlag, 0);
+        if (m_streaming)
+        {
+            ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_windowLog, windowLog);
+        }
+
+        if (m_dictionary != nullptr)
+        {
+            ZSTD_CCtx_refCDict(m_compressionContext, m_dictionary->GetCompressionDictionary());
+            ZSTD_DCtx_refDDict(m_decompressionContext, m_dictionary->GetDecompressionDictionary());
+        }
+#else
+        if (m_streaming)
+        {
+            ResetCompressionStream();
+            if (m_dictionary != nullptr)
+            {
+                ZSTD_initDStream_usingDDict(m_decompressionContext, m_dictionary->GetDecompressionDictionary());
+            }
+            else
+            {
+                ZSTD_initDStream(m_decompressionContext);
+            }
+        }
+#endif
+    }
+
+    ZStdCompressor::~ZStdCompressor()
+    {
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+    }
+
+    bool ZStdCompressor::Init()
+    {
+        return (m_compressionContext != nullptr) && (m_decompressionContext != nullptr);
+    }
+
+    size_t ZStdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZStdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZStdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "zstd contexts failed to initialize");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_streaming)
+        {
+            return CompressStream(uncompData, uncompSize, compData, compDataSize, compSize);
+        }
+
+#if ZSTD_VERSION_NUMBER >= 10400
+        const size_t result = ZSTD_compress2(m_compressionContext, compData, compDataSize, uncompData, uncompSize);
+#else
+        const size_t result = (m_dictionary != nullptr)
+            ? ZSTD_compress_usingCDict(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_dictionary->GetCompressionDictionary())
+            : ZSTD_compressCCtx(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+#endif
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B) error:(%s)", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+                ? AzNetworking::CompressorError::InsufficientBuffer
+                : AzNetworking::CompressorError::CorruptData;
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZStdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "zstd contexts failed to initialize");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        consumedSizeOut = compDataSize;
+
+        if (m_streaming)
+        {
+            return DecompressStream(compData, compDataSize, uncompData, uncompDataSize, uncompSizeOut);
+        }
+
+#if ZSTD_VERSION_NUMBER >= 10400
+        const size_t result = ZSTD_decompressDCtx(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize);
+#else
+        const size_t result = (m_dictionary != nullptr)
+            ? ZSTD_decompress_usingDDict(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize, m_dictionary->GetDecompressionDictionary())
+            : ZSTD_decompressDCtx(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize);
+#endif
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B) error:(%s)", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSizeOut = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZStdCompressor::CompressStream(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize)
+    {
+        ZSTD_inBuffer input = { uncompData, uncompSize, 0 };
+        ZSTD_outBuffer output = { compData, compDataSize, 0 };
+
+        // Flushing ends the current block without ending the frame, so the peer can decode this packet immediately
+        // while later packets keep referencing the history of everything sent before them
+        size_t remaining = 0;
+#if ZSTD_VERSION_NUMBER < 10400
+        // Older versions consume the input and flush the block with separate calls
+        while ((input.pos < input.size) && !ZSTD_isError(remaining) && (output.pos < output.size))
+        {
+            remaining = ZSTD_compressStream(m_compressionContext, &output, &input);
+        }
+#endif
+        do
+        {
+            if (!ZSTD_isError(remaining))
+            {
+#if ZSTD_VERSION_NUMBER >= 10400
+                remaining = ZSTD_compressStream2(m_compressionContext, &output, &input, ZSTD_e_flush);
+#else
+                // Input that was not consumed means the output filled up first
+                remaining = (input.pos < input.size) ? 1 : ZSTD_flushStream(m_compressionContext, &output);
+#endif
+            }
+
+            if (ZSTD_isError(remaining) || ((remaining != 0) && (output.pos == output.size)))
+            {
+                // The stream has diverged from what the peer will see, the connection can't recover from this
+                AZ_Warning("Multiplayer Compressor", false, "Stream compression failed for uncompSize:(%zu B) compDataSize:(%zu B)", uncompSize, compDataSize);
+                ResetCompressionStream();
+                return ZSTD_isError(remaining)
+                    ? AzNetworking::CompressorError::CorruptData
+                    : AzNetworking::CompressorError::InsufficientBuffer;
+            }
+        } while (remaining != 0);
+
+        compSize = output.pos;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    void ZStdCompressor::ResetCompressionStream()
+    {
+#if ZSTD_VERSION_NUMBER >= 10400
+        ZSTD_CCtx_reset(m_compressionContext, ZSTD_reset_session_only);
+#else
+        if (m_dictionary != nullptr)
+        {
+            // The digested dictionary fixes the compression parameters, so the window log only applies without one
+            ZSTD_initCStream_usingCDict(m_compressionContext, m_dictionary->GetCompressionDictionary());
+        }
+        else
+        {
+            ZSTD_parameters parameters = ZSTD_getParams(m_compressionLevel, 0, 0);
+            parameters.cParams.windowLog = static_cast<unsigned>(m_windowLog);
+            parameters.fParams.contentSizeFlag = 0;
+            parameters.fParams.checksumFlag = 0;
+            ZSTD_initCStream_advanced(m_compressionContext, nullptr, 0, parameters, ZSTD_CONTENTSIZE_UNKNOWN);
+        }
+#endif
+    }
+
+    AzNetworking::CompressorError ZStdCompressor::DecompressStream(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& uncompSize)
+    {
+        ZSTD_inBuffer input = { compData, compDataSize, 0 };
+        ZSTD_outBuffer output = { uncompData, uncompDataSize, 0 };
+
+        // Every packet ends on a flushed block, so once all input is consumed and output space remains the packet is complete
+        while (input.pos < input.size)
+        {
+            const size_t result = ZSTD_decompressStream(m_decompressionContext, &output, &input);
+            if (ZSTD_isError(result))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Stream decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B) error:(%s)", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+                return AzNetworking::CompressorError::CorruptData;
+            }
+
+            if (output.pos == output.size)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Stream decompression exceeded uncompDataSize:(%zu B)", uncompDataSize);
+                return AzNetworking::CompressorError::InsufficientBuffer;
+            }
+        }
+
+        uncompSize = output.pos;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    bool TrainZStdDictionary(const AZStd::vector<AZStd::string>& traceFiles, const char* outputPath, size_t dictionaryCapacity)
+    {
+        AZStd::vector<uint8_t> samples;
+        AZStd::vector<size_t> sampleSizes;
+        for (const AZStd::string& traceFile : traceFiles)
+        {
+            const AZ::IO::SystemFile::SizeType traceSize = AZ::IO::SystemFile::Length(traceFile.c_str());
+            AZStd::vector<uint8_t> traceData;
+            traceData.resize_no_construct(traceSize);
+            if ((traceSize == 0) || (AZ::IO::SystemFile::Read(traceFile.c_str(), traceData.data(), traceSize) != traceSize))
+            {
+                AZLOG_WARN("Failed to read packet trace %s", traceFile.c_str());
+                continue;
+            }
+
+            if (AzNetworking::PacketCaptureReader::HasCaptureHeader(traceData.data(), traceData.size()))
+            {
+                // A capture recorded with net_StartPacketCapture, both directions hold payloads as they are handed to the compressor
+                AzNetworking::PacketCaptureReader captureReader;
+                if (!captureReader.Open(traceFile.c_str()))
+                {
+                    continue;
+                }
+
+                AzNetworking::CapturedPacket capturedPacket;
+                while (captureReader.ReadNext(capturedPacket))
+                {
+                    const uint32_t sampleSize = capturedPacket.m_payload.GetSize();
+                    if (sampleSize > 0)
+                    {
+                        const uint8_t* payload = capturedPacket.m_payload.GetBuffer();
+                        samples.insert(samples.end(), payload, payload + sampleSize);
+                        sampleSizes.push_back(sampleSize);
+                    }
+                }
+                continue;
+            }
+
+            size_t offset = 0;
+            while (offset + sizeof(uint32_t) <= traceData.size())
+            {
+                const uint32_t sampleSize = static_cast<uint32_t>(traceData[offset])
+                    | (static_cast<uint32_t>(traceData[offset + 1]) << 8)
+                    | (static_cast<uint32_t>(traceData[offset + 2]) << 16)
+                    | (static_cast<uint32_t>(traceData[offset + 3]) << 24);
+                offset += sizeof(uint32_t);
+                if (sampleSize > traceData.size() - offset)
+                {
+                    AZLOG_WARN("Packet trace %s is truncated, ignoring the remainder", traceFile.c_str());
+                    break;
+                }
+
+                samples.insert(samples.end(), traceData.begin() + offset, traceData.begin() + offset + sampleSize);
+                sampleSizes.push_back(sampleSize);
+                offset += sampleSize;
+            }
+        }
+
+        if (sampleSizes.empty())
+        {
+            AZLOG_WARN("No packet samples were found, unable to train a zstd dictionary");
+            return false;
+        }
+
+        AZStd::vector<uint8_t> dictionary;
+        dictionary.resize_no_construct(dictionaryCapacity);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), samples.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(dictionarySize))
+        {
+            AZLOG_WARN("Failed to train a zstd dictionary from %zu samples: %s", sampleSizes.size(), ZDICT_getErrorName(dictionarySize));
+            return false;
+        }
+
+        AZ::IO::SystemFile outputFile;
+        if (!outputFile.Open(outputPath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZLOG_WARN("Failed to open %s for writing", outputPath);
+            return false;
+        }
+
+        const bool written = outputFile.Write(dictionary.data(), dictionarySize) == dictionarySize;
+        outputFile.Close();
+        AZLOG_INFO("Trained a %zu byte zstd dictionary from %zu packet samples into %s", dictionarySize, sampleSizes.size(), outputPath);
+        return written;
+    }
+
+    void net_ZStdTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("Usage: net_ZStdTrainDictionary <outputPath> <traceFile> [traceFile...]");
+            return;
+        }
+
+        const AZStd::string outputPath(arguments.front());
+        AZStd::vector<AZStd::string> traceFiles;
+        for (auto argument = arguments.begin() + 1; argument != arguments.end(); ++argument)
+        {
+            traceFiles.emplace_back(*argument);
+        }
+
+        TrainZStdDictionary(traceFiles, outputPath.c_str(), DefaultDictionaryCapacity);
+    }
+    AZ_CONSOLEFREEFUNC(net_ZStdTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Trains a zstd packet dictionary from packet captures or size prefixed packet trace files: net_ZStdTrainDictionary <outputPath> <traceFile> [traceFile...]");
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+// The packages of some platforms still ship zstd 1.3.5, which only declares the advanced API used by the fallbacks for it here
+#define ZSTD_STATIC_LINKING_ONLY
+
+#include <zstd.h>
+
+namespace MultiplayerCompression
+{
+    static const char* ZStdCompressorName = "ZStd";
+    static const AzNetworking::CompressorType ZStdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZStdCompressorName)));
+
+    /**
+    * A pre-trained zstd dictionary, digested once for compression and decompression.
+    * Digested dictionaries are read-only and shared between all ZStd compressors created by the same factory.
+    */
+    class ZStdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZStdDictionary, AZ::SystemAllocator);
+
+        ZStdDictionary(const void* dictionaryData, size_t dictionarySize, int compressionLevel);
+        ~ZStdDictionary();
+
+        //! Loads and digests a dictionary file produced by net_ZStdTrainDictionary.
+        //! @param path             path to the dictionary file
+        //! @param compressionLevel the zstd compression level to digest the dictionary for
+        //! @return the loaded dictionary, or nullptr if the file could not be loaded
+        static AZStd::shared_ptr<ZStdDictionary> LoadFromFile(const char* path, int compressionLevel);
+
+        bool IsValid() const;
+        const ZSTD_CDict* GetCompressionDictionary() const { return m_compressionDictionary; }
+        const ZSTD_DDict* GetDecompressionDictionary() const { return m_decompressionDictionary; }
+
+    private:
+        ZStdDictionary(const ZStdDictionary&) = delete;
+        ZStdDictionary& operator=(const ZStdDictionary&) = delete;
+
+        ZSTD_CDict* m_compressionDictionary = nullptr;
+        ZSTD_DDict* m_decompressionDictionary = nullptr;
+    };
+
+    /**
+    * Implements a zstd Compressor against Multiplayer's Compressor interface for use with AzNetworking.
+    * Small replication packets carry little redundancy on their own, so the compressor relies on a pre-trained dictionary
+    * and optionally on a streaming context that keeps the history of every previous packet sent over the connection.
+    * Streaming requires every compressed packet to be decompressed exactly once and in order, so it must only be used on
+    * reliable ordered transports (TCP). Per packet mode is safe on any transport.
+    */
+    class ZStdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZStdCompressor, AZ::SystemAllocator);
+
+        //! Constructor.
+        //! @param dictionary       optional pre-trained dictionary, both peers must use the same dictionary
+        //! @param compressionLevel zstd compression level, ignored for the dictionary which is digested for its own level
+        //! @param streaming        true to compress all packets as a single continuous stream
+        //! @param windowLog        log2 of the stream history window, bounds the per connection memory use when streaming
+        ZStdCompressor(AZStd::shared_ptr<const ZStdDictionary> dictionary, int compressionLevel, bool streaming, int windowLog);
+        ~ZStdCompressor() override;
+
+        const char* GetName() const { return ZStdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZStdCompressorType; };
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        ZStdCompressor(const ZStdCompressor&) = delete;
+        ZStdCompressor& operator=(const ZStdCompressor&) = delete;
+
+        AzNetworking::CompressorError CompressStream(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize);
+        AzNetworking::CompressorError DecompressStream(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& uncompSize);
+
+        //! Starts a new compression stream, dropping the history of the previous one
+        void ResetCompressionStream();
+
+        AZStd::shared_ptr<const ZStdDictionary> m_dictionary;
+        ZSTD_CCtx* m_compressionContext = nullptr;
+        ZSTD_DCtx* m_decompressionContext = nullptr;
+        int m_compressionLevel = 0;
+        int m_windowLog = 0;
+        bool m_streaming = false;
+    };
+
+    //! Trains a zstd dictionary from packet trace files and writes it to outputPath.
+    //! Trace files are either packet captures written by net_StartPacketCapture, or a sequence of uncompressed packet payloads
+    //! each prefixed with its size as a little endian uint32_t.
+    //! @param traceFiles         the trace files to gather training samples from
+    //! @param outputPath         the path to write the trained dictionary to
+    //! @param dictionaryCapacity the maximum size of the trained dictionary in bytes
+    //! @return boolean true on success
+    bool TrainZStdDictionary(const AZStd::vector<AZStd::string>& traceFiles, const char* outputPath, size_t dictionaryCapacity);
+}
@@ -10,12 +10,18 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZStdCompressor.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Framework/PacketCapture.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
 
 class MultiplayerCompressionTest
     : public UnitTest::LeakDetectionFixture
@@ -115,4 +121,151 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+namespace
+{
+    // Builds a small replication-like packet, a fixed layout with only a few bytes varying between packets
+    AZStd::vector<uint8_t> MakeReplicationPacket(uint32_t sequence)
+    {
+        AZStd::vector<uint8_t> packet;
+        for (uint32_t entity = 0; entity < 8; ++entity)
+        {
+            const uint8_t header[] = { 0xA5, 0x01, static_cast<uint8_t>(entity), 0x00, 0x10, 0x20, 0x30, 0x40 };
+            packet.insert(packet.end(), AZStd::begin(header), AZStd::end(header));
+            packet.push_back(static_cast<uint8_t>(sequence + entity));
+            packet.push_back(static_cast<uint8_t>((sequence * 7) >> 8));
+        }
+        return packet;
+    }
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdRoundTripTest)
+{
+    MultiplayerCompression::ZStdCompressor zstdCompressor(nullptr, 3, false, 17);
+    ASSERT_TRUE(zstdCompressor.Init());
+
+    const AZStd::vector<uint8_t> packet = MakeReplicationPacket(1);
+    AZStd::vector<uint8_t> compressed(zstdCompressor.GetMaxCompressedBufferSize(packet.size()));
+    AZStd::vector<uint8_t> decompressed(packet.size() + 32);
+
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    EXPECT_EQ(zstdCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(zstdCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(consumedSize, compressedSize);
+    ASSERT_EQ(uncompressedSize, packet.size());
+    EXPECT_EQ(memcmp(decompressed.data(), packet.data(), packet.size()), 0);
+
+    EXPECT_EQ(zstdCompressor.Decompress(packet.data(), packet.size(), decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdDictionaryTest)
+{
+    // Any content can serve as a raw dictionary, a previously seen packet is representative of the trained case
+    const AZStd::vector<uint8_t> dictionaryContent = MakeReplicationPacket(0);
+    auto dictionary = AZStd::make_shared<MultiplayerCompression::ZStdDictionary>(dictionaryContent.data(), dictionaryContent.size(), 3);
+    ASSERT_TRUE(dictionary->IsValid());
+
+    MultiplayerCompression::ZStdCompressor plainCompressor(nullptr, 3, false, 17);
+    MultiplayerCompression::ZStdCompressor dictionaryCompressor(dictionary, 3, false, 17);
+
+    const AZStd::vector<uint8_t> packet = MakeReplicationPacket(5);
+    AZStd::vector<uint8_t> compressed(dictionaryCompressor.GetMaxCompressedBufferSize(packet.size()));
+    AZStd::vector<uint8_t> decompressed(packet.size() + 32);
+
+    size_t plainSize = 0;
+    size_t dictionarySize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    EXPECT_EQ(plainCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), plainSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), dictionarySize), AzNetworking::CompressorError::Ok);
+    EXPECT_LT(dictionarySize, plainSize);
+
+    EXPECT_EQ(dictionaryCompressor.Decompress(compressed.data(), dictionarySize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(uncompressedSize, packet.size());
+    EXPECT_EQ(memcmp(decompressed.data(), packet.data(), packet.size()), 0);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdStreamTest)
+{
+    MultiplayerCompression::ZStdCompressor sender(nullptr, 3, true, 17);
+    MultiplayerCompression::ZStdCompressor receiver(nullptr, 3, true, 17);
+
+    size_t firstCompressedSize = 0;
+    size_t lastCompressedSize = 0;
+    for (uint32_t sequence = 0; sequence < 16; ++sequence)
+    {
+        const AZStd::vector<uint8_t> packet = MakeReplicationPacket(sequence);
+        AZStd::vector<uint8_t> compressed(sender.GetMaxCompressedBufferSize(packet.size()));
+        AZStd::vector<uint8_t> decompressed(packet.size() + 32);
+
+        size_t compressedSize = 0;
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+        ASSERT_EQ(sender.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+        ASSERT_EQ(receiver.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+        ASSERT_EQ(uncompressedSize, packet.size());
+        EXPECT_EQ(memcmp(decompressed.data(), packet.data(), packet.size()), 0);
+
+        firstCompressedSize = (sequence == 0) ? compressedSize : firstCompressedSize;
+        lastCompressedSize = compressedSize;
+    }
+
+    // Later packets reference the stream history, so repeated structure costs almost nothing
+    EXPECT_LT(lastCompressedSize, firstCompressedSize);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdTrainFromCaptureTest)
+{
+    AZ::LoggerSystemComponent loggerComponent;
+    AZ::TimeSystem timeSystem;
+    AZ::Test::ScopedAutoTempDirectory tempDirectory;
+    const AZStd::string capturePath = tempDirectory.Resolve("training.aznc").Native();
+    const AZStd::string dictionaryPath = tempDirectory.Resolve("training.dict").Native();
+
+    {
+        AzNetworking::PacketCaptureWriter writer;
+        ASSERT_TRUE(writer.Open(capturePath.c_str()));
+        for (uint32_t sequence = 0; sequence < 512; ++sequence)
+        {
+            const AZStd::vector<uint8_t> packet = MakeReplicationPacket(sequence);
+            writer.Record(
+                AzNetworking::PacketCaptureDirection::Outbound, AzNetworking::ProtocolType::Udp, AzNetworking::ConnectionId{ 1 },
+                AzNetworking::PacketType{ 1000 }, AzNetworking::PacketId{ sequence }, packet.data(), static_cast<uint32_t>(packet.size()));
+        }
+        writer.Close();
+    }
+
+    EXPECT_TRUE(MultiplayerCompression::TrainZStdDictionary({ capturePath }, dictionaryPath.c_str(), 4 * 1024));
+    auto dictionary = MultiplayerCompression::ZStdDictionary::LoadFromFile(dictionaryPath.c_str(), 3);
+    ASSERT_NE(dictionary, nullptr);
+    ASSERT_TRUE(dictionary->IsValid());
+
+    // The trained dictionary should help with a packet that wasn't part of the capture
+    MultiplayerCompression::ZStdCompressor plainCompressor(nullptr, 3, false, 17);
+    MultiplayerCompression::ZStdCompressor dictionaryCompressor(dictionary, 3, false, 17);
+    const AZStd::vector<uint8_t> packet = MakeReplicationPacket(1000);
+    AZStd::vector<uint8_t> compressed(dictionaryCompressor.GetMaxCompressedBufferSize(packet.size()));
+    size_t plainSize = 0;
+    size_t dictionarySize = 0;
+    EXPECT_EQ(plainCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), plainSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), dictionarySize), AzNetworking::CompressorError::Ok);
+    EXPECT_LT(dictionarySize, plainSize);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdNullTest)
+{
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZStdCompressor zstdCompressor(nullptr, 3, false, 17);
+
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(nullptr, 4, nullptr, 4, compressedSize);
+    EXPECT_TRUE(compressStatus == AzNetworking::CompressorError::Uninitialized);
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(nullptr, 4, nullptr, 4, consumedSize, uncompressedSize);
+    EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);